@@ -170,10 +170,11 @@ public:
         m_render_cmd_queue = GetRenderContext().GetRenderCommandKit().GetQueue();
 
         // Create index buffer for cube mesh
-        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(m_cube_mesh.GetIndexDataSize(), GetIndexFormat(m_cube_mesh.GetIndex(0))));
+        const Data::Bytes cube_index_data = m_cube_mesh.GetIndexData();
+        m_index_buffer = GetRenderContext().CreateBuffer(Rhi::BufferSettings::ForIndexBuffer(m_cube_mesh.GetIndexDataSize(), m_cube_mesh.GetIndexFormat()));
         m_index_buffer.SetName("Cube Index Buffer");
         m_index_buffer.SetData(m_render_cmd_queue, {
-            reinterpret_cast<Data::ConstRawPtr>(m_cube_mesh.GetIndices().data()), // NOSONAR
+            cube_index_data.data(),
             m_cube_mesh.GetIndexDataSize()
         });
 
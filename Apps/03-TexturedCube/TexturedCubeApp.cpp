@@ -99,11 +99,12 @@ void TexturedCubeApp::Init()
 
     // Create index buffer for cube mesh
     const Data::Size index_data_size = cube_mesh.GetIndexDataSize();
-    const gfx::PixelFormat index_format = gfx::GetIndexFormat(cube_mesh.GetIndex(0));
+    const gfx::PixelFormat index_format = cube_mesh.GetIndexFormat();
+    const Data::Bytes      index_data   = cube_mesh.GetIndexData(index_format);
     m_index_buffer = GetRenderContext().CreateBuffer(rhi::BufferSettings::ForIndexBuffer(index_data_size, index_format));
     m_index_buffer.SetName("Cube Index Buffer");
     m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(cube_mesh.GetIndices().data()), // NOSONAR
+        index_data.data(),
         index_data_size
     });
 
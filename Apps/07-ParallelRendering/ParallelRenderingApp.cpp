@@ -195,6 +195,11 @@ void ParallelRenderingApp::Init()
 
     // Create frame buffer resources
 
+#ifndef ROOT_CONSTANTS_ENABLED
+    // Uniforms are tracked per frame in flight to update only changed instance ranges of each frame buffer
+    m_cube_array_buffers_ptr->SetFramesInFlightCount(static_cast<Data::Size>(GetFrames().size()));
+#endif // ROOT_CONSTANTS_ENABLED
+
     tf::Taskflow program_bindings_task_flow;
     for(ParallelRenderingFrame& frame : GetFrames())
     {
@@ -443,8 +448,8 @@ bool ParallelRenderingApp::Render()
 #ifdef ROOT_CONSTANTS_ENABLED
     const auto& cubes_program_bindings = frame.cubes_program_bindings;
 #else // ROOT_CONSTANTS_ENABLED
-    // Update uniforms buffer related to current frame
-    frame.cubes_array.uniforms_buffer.SetData(render_cmd_queue, m_cube_array_buffers_ptr->GetFinalPassUniformsSubresource());
+    // Update changed instance uniforms in buffer related to current frame
+    m_cube_array_buffers_ptr->UpdateFinalPassUniformsBuffer(frame.cubes_array.uniforms_buffer, render_cmd_queue, frame.index);
     const auto& cubes_program_bindings = frame.cubes_array.program_bindings_per_instance;
 #endif // ROOT_CONSTANTS_ENABLED
 
@@ -0,0 +1,405 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/BlockAllocator.hpp
+Allocation policies for sub-allocating offset ranges of a single memory block:
+linear (bump), buddy and ring allocators. Policies do not touch memory,
+so they can be used for GPU memory blocks and tested on CPU.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Math.hpp>
+#include <Methane/Memory.hpp>
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vector>
+#include <deque>
+#include <set>
+#include <map>
+#include <bit>
+#include <algorithm>
+#include <type_traits>
+
+namespace Methane::Data
+{
+
+template<typename SizeType> requires std::is_unsigned_v<SizeType>
+struct BlockAllocatorStatistics
+{
+    SizeType block_size          = 0U; // total size of the block
+    SizeType used_size           = 0U; // size of the allocated ranges including alignment and rounding overhead
+    SizeType requested_size      = 0U; // size requested by all live allocations
+    SizeType largest_free_size   = 0U; // size of the largest range which can be allocated
+    uint32_t allocations_count   = 0U; // count of live allocations
+
+    [[nodiscard]] SizeType GetFreeSize() const noexcept { return block_size - used_size; }
+
+    // Ratio of free memory which can not be used for the largest allocation: 0 - no fragmentation, 1 - fully fragmented
+    [[nodiscard]] float GetFragmentation() const noexcept
+    {
+        const SizeType free_size = GetFreeSize();
+        return free_size ? 1.F - static_cast<float>(largest_free_size) / static_cast<float>(free_size) : 0.F;
+    }
+
+    [[nodiscard]] friend bool operator==(const BlockAllocatorStatistics& left, const BlockAllocatorStatistics& right) noexcept = default;
+};
+
+// Linear allocator appends allocations to the end of the used range,
+// freed space is reused only when all allocations in block are released.
+// It is the fastest policy suitable for transient and rarely freed allocations.
+template<typename SizeType> requires std::is_unsigned_v<SizeType>
+class LinearBlockAllocator
+{
+public:
+    using Statistics = BlockAllocatorStatistics<SizeType>;
+
+    explicit LinearBlockAllocator(SizeType block_size)
+        : m_block_size(block_size)
+    {
+        META_CHECK_NOT_ZERO_DESCR(block_size, "linear allocator block size can not be zero");
+    }
+
+    [[nodiscard]] SizeType GetBlockSize() const noexcept { return m_block_size; }
+    [[nodiscard]] bool     IsEmpty() const noexcept      { return !m_allocations_count; }
+
+    [[nodiscard]] Opt<SizeType> Allocate(SizeType size, SizeType alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO_DESCR(size, "allocation size can not be zero");
+        const SizeType offset = AlignUp(m_used_end, alignment);
+        if (offset < m_used_end || offset > m_block_size || m_block_size - offset < size)
+            return std::nullopt;
+
+        m_used_end = offset + size;
+        m_requested_size += size;
+        m_allocations_count++;
+        m_allocation_sizes.try_emplace(offset, size);
+        return offset;
+    }
+
+    void Free(SizeType offset)
+    {
+        META_FUNCTION_TASK();
+        const auto allocation_it = m_allocation_sizes.find(offset);
+        META_CHECK_TRUE_DESCR(allocation_it != m_allocation_sizes.end(), "no allocation was found at offset {}", offset);
+        m_requested_size -= allocation_it->second;
+        m_allocation_sizes.erase(allocation_it);
+        m_allocations_count--;
+
+        if (!m_allocations_count)
+        {
+            Reset();
+            return;
+        }
+
+        // Allocations are appended in offsets order, so used range ends with the last live allocation
+        const auto& [last_offset, last_size] = *m_allocation_sizes.rbegin();
+        m_used_end = last_offset + last_size;
+    }
+
+    void Reset() noexcept
+    {
+        m_used_end          = 0U;
+        m_requested_size    = 0U;
+        m_allocations_count = 0U;
+        m_allocation_sizes.clear();
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const noexcept
+    {
+        return Statistics{
+            m_block_size,
+            m_used_end,
+            m_requested_size,
+            m_block_size - m_used_end,
+            m_allocations_count
+        };
+    }
+
+private:
+    const SizeType               m_block_size;
+    SizeType                     m_used_end          = 0U;
+    SizeType                     m_requested_size    = 0U;
+    uint32_t                     m_allocations_count = 0U;
+    std::map<SizeType, SizeType> m_allocation_sizes;
+};
+
+// Buddy allocator splits power-of-two block into halves recursively down to the minimum allocation size,
+// freed ranges are merged back with their buddies, so it provides bounded external fragmentation
+// and logarithmic allocation time in exchange for internal rounding overhead.
+template<typename SizeType> requires std::is_unsigned_v<SizeType>
+class BuddyBlockAllocator
+{
+public:
+    using Statistics = BlockAllocatorStatistics<SizeType>;
+
+    BuddyBlockAllocator(SizeType block_size, SizeType min_allocation_size)
+        : m_block_size(block_size)
+        , m_min_allocation_size(min_allocation_size)
+        , m_levels_count(GetLevelsCount(block_size, min_allocation_size))
+        , m_free_offsets_by_level(m_levels_count)
+    {
+        m_free_offsets_by_level[0].insert(0U);
+    }
+
+    [[nodiscard]] SizeType GetBlockSize() const noexcept         { return m_block_size; }
+    [[nodiscard]] SizeType GetMinAllocationSize() const noexcept { return m_min_allocation_size; }
+    [[nodiscard]] bool     IsEmpty() const noexcept              { return m_allocation_levels.empty(); }
+
+    [[nodiscard]] Opt<SizeType> Allocate(SizeType size, SizeType alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO_DESCR(size, "allocation size can not be zero");
+        META_CHECK_TRUE_DESCR(IsPowerOfTwo(alignment), "alignment {} must be a power of two", alignment);
+
+        // Buddy ranges are naturally aligned by their size, so alignment is satisfied by rounding up the range size
+        const SizeType range_size = std::bit_ceil(std::max({ size, alignment, m_min_allocation_size }));
+        if (range_size > m_block_size)
+            return std::nullopt;
+
+        const uint32_t target_level = GetLevelOfSize(range_size);
+        uint32_t free_level = target_level;
+        while (m_free_offsets_by_level[free_level].empty())
+        {
+            if (!free_level)
+                return std::nullopt;
+            free_level--;
+        }
+
+        // Split larger free range down to the target level, pushing right halves to the free lists
+        const SizeType offset = *m_free_offsets_by_level[free_level].begin();
+        m_free_offsets_by_level[free_level].erase(m_free_offsets_by_level[free_level].begin());
+        for(uint32_t level = free_level + 1; level <= target_level; ++level)
+        {
+            m_free_offsets_by_level[level].insert(offset + GetSizeOfLevel(level));
+        }
+
+        m_allocation_levels.try_emplace(offset, target_level, size);
+        m_used_size      += range_size;
+        m_requested_size += size;
+        return offset;
+    }
+
+    void Free(SizeType offset)
+    {
+        META_FUNCTION_TASK();
+        const auto allocation_it = m_allocation_levels.find(offset);
+        META_CHECK_TRUE_DESCR(allocation_it != m_allocation_levels.end(), "no allocation was found at offset {}", offset);
+
+        uint32_t level = allocation_it->second.first;
+        m_used_size      -= GetSizeOfLevel(level);
+        m_requested_size -= allocation_it->second.second;
+        m_allocation_levels.erase(allocation_it);
+
+        // Merge freed range with its free buddies up the levels
+        SizeType merged_offset = offset;
+        while (level > 0)
+        {
+            const SizeType buddy_offset = merged_offset ^ GetSizeOfLevel(level);
+            std::set<SizeType>& free_offsets = m_free_offsets_by_level[level];
+            const auto buddy_it = free_offsets.find(buddy_offset);
+            if (buddy_it == free_offsets.end())
+                break;
+
+            free_offsets.erase(buddy_it);
+            merged_offset = std::min(merged_offset, buddy_offset);
+            level--;
+        }
+        m_free_offsets_by_level[level].insert(merged_offset);
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const noexcept
+    {
+        SizeType largest_free_size = 0U;
+        for(uint32_t level = 0U; level < m_levels_count; ++level)
+        {
+            if (m_free_offsets_by_level[level].empty())
+                continue;
+
+            largest_free_size = GetSizeOfLevel(level);
+            break;
+        }
+        return Statistics{
+            m_block_size,
+            m_used_size,
+            m_requested_size,
+            largest_free_size,
+            static_cast<uint32_t>(m_allocation_levels.size())
+        };
+    }
+
+private:
+    [[nodiscard]] static uint32_t GetLevelsCount(SizeType block_size, SizeType min_allocation_size)
+    {
+        META_CHECK_TRUE_DESCR(IsPowerOfTwo(block_size), "buddy allocator block size {} must be a power of two", block_size);
+        META_CHECK_TRUE_DESCR(IsPowerOfTwo(min_allocation_size), "buddy allocator minimum allocation size {} must be a power of two", min_allocation_size);
+        META_CHECK_LESS_OR_EQUAL_DESCR(min_allocation_size, block_size, "buddy allocator minimum allocation size must not exceed block size");
+        return static_cast<uint32_t>(std::countr_zero(block_size) - std::countr_zero(min_allocation_size)) + 1U;
+    }
+
+    [[nodiscard]] SizeType GetSizeOfLevel(uint32_t level) const noexcept { return m_block_size >> level; }
+    [[nodiscard]] uint32_t GetLevelOfSize(SizeType size) const noexcept
+    {
+        return static_cast<uint32_t>(std::countr_zero(m_block_size) - std::countr_zero(size));
+    }
+
+    using LevelAndSize = std::pair<uint32_t, SizeType>;
+
+    const SizeType                  m_block_size;
+    const SizeType                  m_min_allocation_size;
+    const uint32_t                  m_levels_count;
+    std::vector<std::set<SizeType>> m_free_offsets_by_level;
+    std::map<SizeType, LevelAndSize> m_allocation_levels;
+    SizeType                        m_used_size      = 0U;
+    SizeType                        m_requested_size = 0U;
+};
+
+// Ring allocator appends allocations at the head wrapping around the block end,
+// allocations are released in the same order they were made, which is suitable
+// for streaming data retired by GPU completion in FIFO order.
+template<typename SizeType> requires std::is_unsigned_v<SizeType>
+class RingBlockAllocator
+{
+public:
+    using Statistics = BlockAllocatorStatistics<SizeType>;
+
+    explicit RingBlockAllocator(SizeType block_size)
+        : m_block_size(block_size)
+    {
+        META_CHECK_NOT_ZERO_DESCR(block_size, "ring allocator block size can not be zero");
+    }
+
+    [[nodiscard]] SizeType GetBlockSize() const noexcept  { return m_block_size; }
+    [[nodiscard]] SizeType GetHeadOffset() const noexcept { return m_head; }
+    [[nodiscard]] uint32_t GetWrapsCount() const noexcept { return m_wraps_count; }
+    [[nodiscard]] bool     IsEmpty() const noexcept       { return m_allocations.empty(); }
+
+    [[nodiscard]] Opt<SizeType> Allocate(SizeType size, SizeType alignment = 1U)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO_DESCR(size, "allocation size can not be zero");
+        if (size > m_block_size)
+            return std::nullopt;
+
+        // Ring is restarted from the block beginning when empty to reduce wrap-arounds
+        if (IsEmpty())
+            return AllocateAt(0U, size);
+
+        const SizeType offset = AlignUp(m_head, alignment);
+        if (IsWrapped())
+        {
+            // Free space is the range between head and tail
+            if (offset < m_head || offset > m_tail || m_tail - offset < size)
+                return std::nullopt;
+
+            return AllocateAt(offset, size);
+        }
+
+        // Free space is split in two ranges: from head to block end and from block beginning to tail
+        if (offset >= m_head && offset <= m_block_size && m_block_size - offset >= size)
+            return AllocateAt(offset, size);
+
+        if (size > m_tail)
+            return std::nullopt;
+
+        m_wraps_count++;
+        return AllocateAt(0U, size);
+    }
+
+    // Releases allocations in FIFO order up to and including the allocation ending at the given offset
+    void ReleaseUntil(SizeType end_offset)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_TRUE_DESCR(std::ranges::any_of(m_allocations, [end_offset](const Allocation& allocation) { return allocation.offset + allocation.size == end_offset; }),
+                              "no allocation was found ending at offset {}", end_offset);
+        while(!m_allocations.empty())
+        {
+            const Allocation allocation = m_allocations.front();
+            m_allocations.pop_front();
+            m_requested_size -= allocation.size;
+            if (allocation.offset + allocation.size == end_offset)
+                break;
+        }
+
+        if (m_allocations.empty())
+        {
+            m_head = 0U;
+            m_tail = 0U;
+        }
+        else
+        {
+            m_tail = m_allocations.front().offset;
+        }
+    }
+
+    [[nodiscard]] Statistics GetStatistics() const noexcept
+    {
+        SizeType used_size         = 0U;
+        SizeType largest_free_size = m_block_size;
+        if (IsWrapped())
+        {
+            used_size         = m_block_size - m_tail + m_head;
+            largest_free_size = m_tail - m_head;
+        }
+        else if (!IsEmpty())
+        {
+            used_size         = m_head - m_tail;
+            largest_free_size = std::max(m_block_size - m_head, m_tail);
+        }
+        return Statistics{
+            m_block_size,
+            used_size,
+            m_requested_size,
+            largest_free_size,
+            static_cast<uint32_t>(m_allocations.size())
+        };
+    }
+
+private:
+    struct Allocation
+    {
+        SizeType offset;
+        SizeType size;
+    };
+
+    // Head is behind the tail, when live allocations continue from block beginning after wrap-around
+    [[nodiscard]] bool IsWrapped() const noexcept { return !IsEmpty() && m_head <= m_tail; }
+
+    SizeType AllocateAt(SizeType offset, SizeType size)
+    {
+        if (IsEmpty())
+            m_tail = offset;
+
+        m_head = offset + size;
+        m_requested_size += size;
+        m_allocations.push_back(Allocation{ offset, size });
+        return offset;
+    }
+
+    const SizeType         m_block_size;
+    SizeType               m_head           = 0U; // end of the newest live allocation
+    SizeType               m_tail           = 0U; // start of the oldest live allocation
+    SizeType               m_requested_size = 0U;
+    uint32_t               m_wraps_count    = 0U;
+    std::deque<Allocation> m_allocations;
+};
+
+} // namespace Methane::Data
@@ -44,12 +44,14 @@ public:
 
     const TSize& GetSize() const { return m_root_bin.GetRect().size; }
 
-    // Tries to pack rectangle in free space of rectangular bin
+    // Tries to pack rectangle in free space of rectangular bin, preferring space released by other rectangles
     // returns true is rect is packed and updates rect.origin with coordinates in rectangular bin
     bool TryPack(TRect& rect)
     {
         META_FUNCTION_TASK();
-        if (!m_root_bin.TryPack(rect, m_rect_margins))
+        if (rect.size && m_released_rects_count && m_root_bin.TryReuse(rect, m_rect_margins))
+            m_released_rects_count--;
+        else if (!m_root_bin.TryPack(rect, m_rect_margins))
             return false;
 
         META_CHECK_GREATER_OR_EQUAL(rect.GetLeft(), 0);
@@ -59,6 +61,21 @@ public:
         return true;
     }
 
+    // Releases space of the previously packed rectangle, so that it can be reused by other rectangles fitting in it
+    // returns false if rectangle with given origin was not packed or was released already
+    bool Release(const TRect& rect)
+    {
+        META_FUNCTION_TASK();
+        if (!rect.size || !m_root_bin.Release(rect, m_rect_margins))
+            return false;
+
+        m_released_rects_count++;
+        return true;
+    }
+
+    // Count of released rectangle spaces which were not reused by packed rectangles yet
+    [[nodiscard]] size_t GetReleasedRectsCount() const noexcept { return m_released_rects_count; }
+
 private:
     class Bin
     {
@@ -110,9 +127,9 @@ private:
                     });
                 }
 
+                m_packed_size = char_size_with_margins;
                 rect.origin.SetX(m_rect.origin.GetX());
                 rect.origin.SetY(m_rect.origin.GetY());
-
                 return true;
             }
 
@@ -122,14 +139,59 @@ private:
             return m_large_bin_ptr->TryPack(rect, char_margins);
         }
 
+        // Released space of the rectangle packed in the bin keeps its size and is reused by any fitting rectangle,
+        // so that split of the bin remains unchanged
+        bool TryReuse(TRect& rect, const TSize& char_margins)
+        {
+            META_FUNCTION_TASK();
+            if (IsEmpty())
+                return false;
+
+            if (m_is_released && (rect.size + char_margins).ContainedInOrEqual(m_packed_size))
+            {
+                m_is_released = false;
+                rect.origin.SetX(m_rect.origin.GetX());
+                rect.origin.SetY(m_rect.origin.GetY());
+                return true;
+            }
+
+            return m_small_bin_ptr->TryReuse(rect, char_margins) ||
+                   m_large_bin_ptr->TryReuse(rect, char_margins);
+        }
+
+        bool Release(const TRect& rect, const TSize& char_margins)
+        {
+            META_FUNCTION_TASK();
+            if (IsEmpty() ||
+                rect.GetLeft() < m_rect.GetLeft() || rect.GetLeft() >= m_rect.GetRight() ||
+                rect.GetTop()  < m_rect.GetTop()  || rect.GetTop()  >= m_rect.GetBottom())
+                return false;
+
+            // Packed rectangle is placed at the origin of the split bin, which is unique among all bins of the tree
+            if (rect.origin == m_rect.origin)
+            {
+                if (m_is_released || !(rect.size + char_margins).ContainedInOrEqual(m_packed_size))
+                    return false;
+
+                m_is_released = true;
+                return true;
+            }
+
+            return m_small_bin_ptr->Release(rect, char_margins) ||
+                   m_large_bin_ptr->Release(rect, char_margins);
+        }
+
     private:
         const TRect    m_rect;
+        TSize          m_packed_size;
+        bool           m_is_released = false;
         UniquePtr<Bin> m_small_bin_ptr;
         UniquePtr<Bin> m_large_bin_ptr;
     };
 
     Bin         m_root_bin;
     const TSize m_rect_margins;
+    size_t      m_released_rects_count = 0U;
 };
 
 } // namespace Methane::Data
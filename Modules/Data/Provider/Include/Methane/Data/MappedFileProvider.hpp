@@ -0,0 +1,54 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Data/MappedFileProvider.hpp
+Singleton data provider of files on disk mapped to memory without copying.
+
+******************************************************************************/
+
+#pragma once
+
+#include "FileProvider.hpp"
+
+namespace Methane::Data
+{
+
+class MappedFileProvider : public FileProvider
+{
+public:
+    [[nodiscard]] static IProvider& Get()
+    {
+        META_FUNCTION_TASK();
+        static MappedFileProvider s_instance;
+        return s_instance;
+    }
+
+    // Returned chunk references memory mapped file, which is unmapped when the last copy of chunk is released
+    [[nodiscard]] Data::Chunk GetData(const std::string& path) const override
+    {
+        META_FUNCTION_TASK();
+        Platform::MappedFile mapped_file = Platform::MapFileToMemory(GetFullFilePath(path));
+        const Data::ConstRawPtr data_ptr = mapped_file.data_ptr.get();
+        return Data::Chunk(data_ptr, static_cast<Data::Size>(mapped_file.size), std::move(mapped_file.data_ptr));
+    }
+
+protected:
+    MappedFileProvider() = default;
+};
+
+} // namespace Methane::Data
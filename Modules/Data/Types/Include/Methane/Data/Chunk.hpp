@@ -26,6 +26,7 @@ Data chunk representing owning or non-owning memory container
 #include "Types.h"
 
 #include <concepts>
+#include <memory>
 
 namespace Methane::Data
 {
@@ -39,6 +40,13 @@ public:
         , m_data_size(size)
     { }
 
+    // Chunk of data owned by external shared owner, which keeps data alive while chunk copies exist (memory mapped file, for example)
+    Chunk(ConstRawPtr data_ptr, Size size, std::shared_ptr<const void> data_owner) noexcept
+        : m_data_owner(std::move(data_owner))
+        , m_data_ptr(data_ptr)
+        , m_data_size(size)
+    { }
+
     explicit Chunk(Bytes&& data) noexcept
         : m_data_storage(std::move(data))
         , m_data_ptr(m_data_storage.empty() ? nullptr : m_data_storage.data())
@@ -61,12 +69,14 @@ public:
 
     explicit Chunk(const Chunk& other)
         : m_data_storage(other.m_data_storage)
+        , m_data_owner(other.m_data_owner)
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
     { }
 
     explicit Chunk(Chunk&& other) noexcept
         : m_data_storage(std::move(other.m_data_storage))
+        , m_data_owner(std::move(other.m_data_owner))
         , m_data_ptr(m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data())
         , m_data_size(m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size()))
     { }
@@ -74,6 +84,7 @@ public:
     Chunk& operator=(const Chunk& other) noexcept
     {
         m_data_storage = other.m_data_storage;
+        m_data_owner   = other.m_data_owner;
         m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
         m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
         return *this;
@@ -82,6 +93,7 @@ public:
     Chunk& operator=(Chunk&& other) noexcept
     {
         m_data_storage = std::move(other.m_data_storage);
+        m_data_owner   = std::move(other.m_data_owner);
         m_data_ptr     = m_data_storage.empty() ? other.m_data_ptr : m_data_storage.data();
         m_data_size    = m_data_storage.empty() ? other.m_data_size : static_cast<Size>(m_data_storage.size());
         return *this;
@@ -141,9 +153,10 @@ private:
 
     // Data storage is used only when m_data_storage is not managed by m_data_storage provider and
     // returned with chunk (when m_data_storage is loaded from file, for example)
-    Bytes       m_data_storage;
-    ConstRawPtr m_data_ptr  = nullptr;
-    Size        m_data_size = 0U;
+    Bytes                       m_data_storage;
+    std::shared_ptr<const void> m_data_owner;
+    ConstRawPtr                 m_data_ptr  = nullptr;
+    Size                        m_data_size = 0U;
 };
 
 } // namespace Methane::Data
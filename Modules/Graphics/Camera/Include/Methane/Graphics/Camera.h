@@ -24,6 +24,7 @@ Camera helper implementation allowing to generate view and projection matrices.
 #pragma once
 
 #include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/FrustumCulling.h>
 
 #include <hlsl++_vector_float.h>
 #include <hlsl++_matrix_float.h>
@@ -78,6 +79,7 @@ public:
     const hlslpp::float4x4& GetViewMatrix() const noexcept;
     const hlslpp::float4x4& GetProjMatrix() const;
     const hlslpp::float4x4& GetViewProjMatrix() const noexcept;
+    CullingFrustum          GetCullingFrustum() const { return CullingFrustum(GetViewProjMatrix()); }
 
     hlslpp::float2 TransformScreenToProj(const Data::Point2I& screen_pos) const noexcept;
     hlslpp::float3 TransformScreenToView(const Data::Point2I& screen_pos) const noexcept;
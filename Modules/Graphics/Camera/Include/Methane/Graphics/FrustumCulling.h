@@ -0,0 +1,95 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCulling.h
+Batch frustum culling of bounding spheres and boxes stored in SoA layout with SIMD.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+
+#include <hlsl++_vector_float.h>
+#include <hlsl++_matrix_float.h>
+#include <array>
+#include <vector>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+// Bounding spheres in structure of arrays layout, so that 4 spheres are loaded to SIMD registers at once
+struct BoundingSpheres
+{
+    std::vector<float> centers_x;
+    std::vector<float> centers_y;
+    std::vector<float> centers_z;
+    std::vector<float> radii;
+
+    void Add(const hlslpp::float3& center, float radius);
+    void Clear() noexcept;
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(radii.size()); }
+};
+
+// Axis aligned bounding boxes in structure of arrays layout
+struct BoundingBoxes
+{
+    std::vector<float> mins_x;
+    std::vector<float> mins_y;
+    std::vector<float> mins_z;
+    std::vector<float> maxs_x;
+    std::vector<float> maxs_y;
+    std::vector<float> maxs_z;
+
+    void Add(const hlslpp::float3& min, const hlslpp::float3& max);
+    void Clear() noexcept;
+
+    [[nodiscard]] Data::Size GetCount() const noexcept { return static_cast<Data::Size>(mins_x.size()); }
+};
+
+using VisibleIndices = std::vector<Data::Index>;
+
+// Frustum planes in world space extracted from view-projection matrix with normals directed inside of frustum
+class CullingFrustum
+{
+public:
+    using Planes = std::array<hlslpp::float4, 6>;
+
+    explicit CullingFrustum(const hlslpp::float4x4& view_proj_matrix);
+
+    [[nodiscard]] const Planes& GetPlanes() const noexcept { return m_planes; }
+
+    [[nodiscard]] bool IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept;
+    [[nodiscard]] bool IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept;
+
+    // Visible indices are written in ascending order; objects are split into chunks culled in parallel when executor is provided
+    void CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr = nullptr) const;
+    void CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr = nullptr) const;
+
+private:
+    Planes m_planes;
+};
+
+} // namespace Methane::Graphics
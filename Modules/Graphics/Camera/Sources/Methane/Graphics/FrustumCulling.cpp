@@ -0,0 +1,315 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/FrustumCulling.cpp
+Batch frustum culling of bounding spheres and boxes stored in SoA layout with SIMD.
+
+******************************************************************************/
+
+#include <Methane/Graphics/FrustumCulling.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+
+namespace Methane::Graphics
+{
+
+// Objects are culled in chunks of this size by parallel tasks, chunk size is a multiple of SIMD width
+static constexpr Data::Size g_parallel_chunk_size = 16384U;
+static constexpr Data::Size g_simd_width = 4U;
+
+namespace // anonymous
+{
+
+// Plane components are broadcast to all SIMD lanes to be multiplied with 4 objects at once
+struct SimdPlane
+{
+    hlslpp::float4 normal_x;
+    hlslpp::float4 normal_y;
+    hlslpp::float4 normal_z;
+    hlslpp::float4 distance;
+    bool           positive_x;
+    bool           positive_y;
+    bool           positive_z;
+
+    explicit SimdPlane(const hlslpp::float4& plane)
+        : normal_x(static_cast<float>(plane.x))
+        , normal_y(static_cast<float>(plane.y))
+        , normal_z(static_cast<float>(plane.z))
+        , distance(static_cast<float>(plane.w))
+        , positive_x(static_cast<float>(plane.x) >= 0.F)
+        , positive_y(static_cast<float>(plane.y) >= 0.F)
+        , positive_z(static_cast<float>(plane.z) >= 0.F)
+    { }
+};
+
+using SimdPlanes = std::array<SimdPlane, std::tuple_size_v<CullingFrustum::Planes>>;
+
+[[nodiscard]] SimdPlanes GetSimdPlanes(const CullingFrustum::Planes& planes)
+{
+    return { SimdPlane(planes[0]), SimdPlane(planes[1]), SimdPlane(planes[2]),
+             SimdPlane(planes[3]), SimdPlane(planes[4]), SimdPlane(planes[5]) };
+}
+
+[[nodiscard]] hlslpp::float4 LoadSimd(const std::vector<float>& values, Data::Index index)
+{
+    return hlslpp::float4(values[index], values[index + 1], values[index + 2], values[index + 3]);
+}
+
+void AppendVisibleLanes(const hlslpp::float4& visible_mask, Data::Index first_index, VisibleIndices& visible_indices)
+{
+    std::array<float, g_simd_width> visible_lanes{};
+    hlslpp::store(visible_mask, visible_lanes.data());
+    for(Data::Index lane_index = 0U; lane_index < g_simd_width; ++lane_index)
+    {
+        if (visible_lanes[lane_index] != 0.F)
+            visible_indices.push_back(first_index + lane_index);
+    }
+}
+
+void CullSpheresRange(const CullingFrustum& frustum, const SimdPlanes& planes, const BoundingSpheres& spheres,
+                      Data::Index begin_index, Data::Index end_index, VisibleIndices& visible_indices)
+{
+    const Data::Index simd_end_index = begin_index + (end_index - begin_index) / g_simd_width * g_simd_width;
+    for(Data::Index index = begin_index; index < simd_end_index; index += g_simd_width)
+    {
+        const hlslpp::float4 centers_x = LoadSimd(spheres.centers_x, index);
+        const hlslpp::float4 centers_y = LoadSimd(spheres.centers_y, index);
+        const hlslpp::float4 centers_z = LoadSimd(spheres.centers_z, index);
+        const hlslpp::float4 neg_radii = -LoadSimd(spheres.radii, index);
+
+        // Sphere is visible when its center is not farther than radius behind any frustum plane
+        hlslpp::float4 visible_mask(1.F);
+        for(const SimdPlane& plane : planes)
+        {
+            const hlslpp::float4 distances = centers_x * plane.normal_x + centers_y * plane.normal_y + centers_z * plane.normal_z + plane.distance;
+            visible_mask *= distances >= neg_radii;
+            if (!hlslpp::any(visible_mask))
+                break;
+        }
+        AppendVisibleLanes(visible_mask, index, visible_indices);
+    }
+
+    for(Data::Index index = simd_end_index; index < end_index; ++index)
+    {
+        const hlslpp::float3 center(spheres.centers_x[index], spheres.centers_y[index], spheres.centers_z[index]);
+        if (frustum.IsSphereVisible(center, spheres.radii[index]))
+            visible_indices.push_back(index);
+    }
+}
+
+void CullBoxesRange(const CullingFrustum& frustum, const SimdPlanes& planes, const BoundingBoxes& boxes,
+                    Data::Index begin_index, Data::Index end_index, VisibleIndices& visible_indices)
+{
+    const Data::Index simd_end_index = begin_index + (end_index - begin_index) / g_simd_width * g_simd_width;
+    for(Data::Index index = begin_index; index < simd_end_index; index += g_simd_width)
+    {
+        const hlslpp::float4 mins_x = LoadSimd(boxes.mins_x, index);
+        const hlslpp::float4 mins_y = LoadSimd(boxes.mins_y, index);
+        const hlslpp::float4 mins_z = LoadSimd(boxes.mins_z, index);
+        const hlslpp::float4 maxs_x = LoadSimd(boxes.maxs_x, index);
+        const hlslpp::float4 maxs_y = LoadSimd(boxes.maxs_y, index);
+        const hlslpp::float4 maxs_z = LoadSimd(boxes.maxs_z, index);
+
+        // Box is visible when its corner farthest along plane normal is not behind any frustum plane
+        hlslpp::float4 visible_mask(1.F);
+        for(const SimdPlane& plane : planes)
+        {
+            const hlslpp::float4 distances = (plane.positive_x ? maxs_x : mins_x) * plane.normal_x
+                                           + (plane.positive_y ? maxs_y : mins_y) * plane.normal_y
+                                           + (plane.positive_z ? maxs_z : mins_z) * plane.normal_z
+                                           + plane.distance;
+            visible_mask *= distances >= hlslpp::float4(0.F);
+            if (!hlslpp::any(visible_mask))
+                break;
+        }
+        AppendVisibleLanes(visible_mask, index, visible_indices);
+    }
+
+    for(Data::Index index = simd_end_index; index < end_index; ++index)
+    {
+        const hlslpp::float3 min(boxes.mins_x[index], boxes.mins_y[index], boxes.mins_z[index]);
+        const hlslpp::float3 max(boxes.maxs_x[index], boxes.maxs_y[index], boxes.maxs_z[index]);
+        if (frustum.IsBoxVisible(min, max))
+            visible_indices.push_back(index);
+    }
+}
+
+template<typename CullRangeFunc>
+void CullObjects(Data::Size objects_count, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr, const CullRangeFunc& cull_range)
+{
+    visible_indices.clear();
+    if (!parallel_executor_ptr || objects_count <= g_parallel_chunk_size)
+    {
+        cull_range(0U, objects_count, visible_indices);
+        return;
+    }
+
+    // Chunks are culled to separate index lists, which are concatenated in order of chunks to keep indices sorted
+    const Data::Size chunks_count = (objects_count + g_parallel_chunk_size - 1U) / g_parallel_chunk_size;
+    std::vector<VisibleIndices> chunk_visible_indices(chunks_count);
+
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, chunks_count, 1U,
+        [objects_count, &chunk_visible_indices, &cull_range](const Data::Index chunk_index)
+        {
+            const Data::Index begin_index = chunk_index * g_parallel_chunk_size;
+            const Data::Index end_index   = std::min(begin_index + g_parallel_chunk_size, objects_count);
+            cull_range(begin_index, end_index, chunk_visible_indices[chunk_index]);
+        }
+    );
+    parallel_executor_ptr->run(task_flow).get();
+
+    size_t visible_count = 0U;
+    for(const VisibleIndices& chunk_indices : chunk_visible_indices)
+    {
+        visible_count += chunk_indices.size();
+    }
+
+    visible_indices.reserve(visible_count);
+    for(const VisibleIndices& chunk_indices : chunk_visible_indices)
+    {
+        visible_indices.insert(visible_indices.end(), chunk_indices.begin(), chunk_indices.end());
+    }
+}
+
+} // anonymous namespace
+
+void BoundingSpheres::Add(const hlslpp::float3& center, float radius)
+{
+    META_FUNCTION_TASK();
+    centers_x.push_back(static_cast<float>(center.x));
+    centers_y.push_back(static_cast<float>(center.y));
+    centers_z.push_back(static_cast<float>(center.z));
+    radii.push_back(radius);
+}
+
+void BoundingSpheres::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    centers_x.clear();
+    centers_y.clear();
+    centers_z.clear();
+    radii.clear();
+}
+
+void BoundingBoxes::Add(const hlslpp::float3& min, const hlslpp::float3& max)
+{
+    META_FUNCTION_TASK();
+    mins_x.push_back(static_cast<float>(min.x));
+    mins_y.push_back(static_cast<float>(min.y));
+    mins_z.push_back(static_cast<float>(min.z));
+    maxs_x.push_back(static_cast<float>(max.x));
+    maxs_y.push_back(static_cast<float>(max.y));
+    maxs_z.push_back(static_cast<float>(max.z));
+}
+
+void BoundingBoxes::Clear() noexcept
+{
+    META_FUNCTION_TASK();
+    mins_x.clear();
+    mins_y.clear();
+    mins_z.clear();
+    maxs_x.clear();
+    maxs_y.clear();
+    maxs_z.clear();
+}
+
+CullingFrustum::CullingFrustum(const hlslpp::float4x4& view_proj_matrix)
+{
+    META_FUNCTION_TASK();
+    // Points are transformed to clip space as row vectors, so clip coordinates are dot products with matrix columns;
+    // frustum in clip space is bound by -w <= x <= w, -w <= y <= w and 0 <= z <= w
+    const hlslpp::float4 column_x = hlslpp::mul(view_proj_matrix, hlslpp::float4(1.F, 0.F, 0.F, 0.F));
+    const hlslpp::float4 column_y = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 1.F, 0.F, 0.F));
+    const hlslpp::float4 column_z = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 0.F, 1.F, 0.F));
+    const hlslpp::float4 column_w = hlslpp::mul(view_proj_matrix, hlslpp::float4(0.F, 0.F, 0.F, 1.F));
+    m_planes = {
+        column_w + column_x, // left
+        column_w - column_x, // right
+        column_w + column_y, // bottom
+        column_w - column_y, // top
+        column_z,            // near
+        column_w - column_z, // far
+    };
+
+    // Planes are normalized to get distances from planes in world units
+    for(hlslpp::float4& plane : m_planes)
+    {
+        const float normal_length = hlslpp::length(plane.xyz);
+        META_CHECK_GREATER_DESCR(normal_length, 0.F, "view projection matrix is degenerate");
+        plane /= hlslpp::float4(normal_length);
+    }
+}
+
+bool CullingFrustum::IsSphereVisible(const hlslpp::float3& center, float radius) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::ranges::all_of(m_planes, [&center, radius](const hlslpp::float4& plane)
+    {
+        return static_cast<float>(hlslpp::dot(plane.xyz, center) + plane.w) >= -radius;
+    });
+}
+
+bool CullingFrustum::IsBoxVisible(const hlslpp::float3& min, const hlslpp::float3& max) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::ranges::all_of(m_planes, [&min, &max](const hlslpp::float4& plane)
+    {
+        const hlslpp::float3 positive_corner(static_cast<float>(plane.x) >= 0.F ? static_cast<float>(max.x) : static_cast<float>(min.x),
+                                             static_cast<float>(plane.y) >= 0.F ? static_cast<float>(max.y) : static_cast<float>(min.y),
+                                             static_cast<float>(plane.z) >= 0.F ? static_cast<float>(max.z) : static_cast<float>(min.z));
+        return static_cast<float>(hlslpp::dot(plane.xyz, positive_corner) + plane.w) >= 0.F;
+    });
+}
+
+void CullingFrustum::CullSpheres(const BoundingSpheres& spheres, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size spheres_count = spheres.GetCount();
+    META_CHECK_TRUE_DESCR(spheres.centers_x.size() == spheres_count && spheres.centers_y.size() == spheres_count && spheres.centers_z.size() == spheres_count,
+                          "all bounding sphere component arrays should have equal size");
+
+    const SimdPlanes planes = GetSimdPlanes(m_planes);
+    CullObjects(spheres_count, visible_indices, parallel_executor_ptr,
+        [this, &planes, &spheres](Data::Index begin_index, Data::Index end_index, VisibleIndices& range_visible_indices)
+        {
+            CullSpheresRange(*this, planes, spheres, begin_index, end_index, range_visible_indices);
+        });
+}
+
+void CullingFrustum::CullBoxes(const BoundingBoxes& boxes, VisibleIndices& visible_indices, tf::Executor* parallel_executor_ptr) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size boxes_count = boxes.GetCount();
+    META_CHECK_TRUE_DESCR(boxes.mins_y.size() == boxes_count && boxes.mins_z.size() == boxes_count &&
+                          boxes.maxs_x.size() == boxes_count && boxes.maxs_y.size() == boxes_count && boxes.maxs_z.size() == boxes_count,
+                          "all bounding box component arrays should have equal size");
+
+    const SimdPlanes planes = GetSimdPlanes(m_planes);
+    CullObjects(boxes_count, visible_indices, parallel_executor_ptr,
+        [this, &planes, &boxes](Data::Index begin_index, Data::Index end_index, VisibleIndices& range_visible_indices)
+        {
+            CullBoxesRange(*this, planes, boxes, begin_index, end_index, range_visible_indices);
+        });
+}
+
+} // namespace Methane::Graphics
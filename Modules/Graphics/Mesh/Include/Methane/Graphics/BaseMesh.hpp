@@ -24,9 +24,15 @@ Base mesh implementation with customizable vertex types
 #pragma once
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/MeshSimplifier.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+
 namespace Methane::Graphics
 {
 
@@ -49,6 +55,40 @@ public:
     [[nodiscard]] Data::Size        GetVertexDataSize() const noexcept final { return static_cast<Data::Size>(m_vertices.size() * GetVertexSize()); }
     [[nodiscard]] Data::ConstRawPtr GetVertexData() const noexcept final     { return reinterpret_cast<Data::ConstRawPtr>(m_vertices.data()); } // NOSONAR
 
+    // Reorders triangles and vertices of the whole mesh, rendered geometry is not changed
+    void Optimize(const OptimizationSettings& settings = {})
+    {
+        META_FUNCTION_TASK();
+        OptimizeSlice(settings, Subset::Slice(0U, GetIndexCount()), Subset::Slice(0U, GetVertexCount()), true);
+    }
+
+    [[nodiscard]] Meshlets BuildMeshlets(const MeshletSettings& settings = {}) const
+    {
+        META_FUNCTION_TASK();
+        Meshlets meshlets;
+        Graphics::BuildMeshlets(settings, GetIndices(), GetPositions(Subset::Slice(0U, GetVertexCount())), meshlets);
+        return meshlets;
+    }
+
+    // Levels of detail reference vertices of this mesh, so they can be drawn with the same vertex buffer
+    [[nodiscard]] Lods BuildLods(const LodSettings& settings = {}) const
+    {
+        META_FUNCTION_TASK();
+        return BuildSliceLods(settings, Subset::Slice(0U, GetIndexCount()), Subset::Slice(0U, GetVertexCount()), true);
+    }
+
+    [[nodiscard]] std::vector<Position> GetPositions(const Subset::Slice& vertex_slice) const
+    {
+        META_FUNCTION_TASK();
+        std::vector<Position> positions;
+        positions.reserve(vertex_slice.count);
+        for(Data::Index vertex_index = 0; vertex_index < vertex_slice.count; ++vertex_index)
+        {
+            positions.push_back(GetVertexField<Position>(m_vertices[vertex_slice.offset + vertex_index], VertexField::Position));
+        }
+        return positions;
+    }
+
 protected:
     template<typename FType>
     [[nodiscard]] FType& GetVertexField(VType& vertex, VertexField field) noexcept
@@ -59,21 +99,26 @@ protected:
     }
 
     template<typename FType>
-    [[nodiscard]] const FType& GetVertexField(const VType& vertex, VertexField field) noexcept
+    [[nodiscard]] const FType& GetVertexField(const VType& vertex, VertexField field) const noexcept
     {
         META_FUNCTION_TASK();
         const int32_t field_offset = GetVertexFieldOffset(field);
         return *reinterpret_cast<const FType*>(reinterpret_cast<const std::byte*>(&vertex) + field_offset); // NOSONAR
     }
 
-    using EdgeMidpoints = std::map<Mesh::Edge, Mesh::Index>;
     Index AddEdgeMidpoint(const Edge& edge, EdgeMidpoints& edge_midpoints)
     {
         META_FUNCTION_TASK();
-        if (const auto edge_midpoint_it = edge_midpoints.find(edge);
-            edge_midpoint_it != edge_midpoints.end())
-            return edge_midpoint_it->second;
+        const auto [v_mid_index, is_new_midpoint] = edge_midpoints.TryEmplace(edge, static_cast<Mesh::Index>(m_vertices.size()));
+        if (is_new_midpoint)
+        {
+            m_vertices.push_back(GetEdgeMidpoint(edge));
+        }
+        return v_mid_index;
+    }
 
+    [[nodiscard]] VType GetEdgeMidpoint(const Edge& edge)
+    {
         const VType& v1 = m_vertices[edge.first_index];
         const VType& v2 = m_vertices[edge.second_index];
         VType  v_mid{ };
@@ -107,68 +152,156 @@ protected:
             v_mid_texcoord = Mesh::TexCoord((v1_texcoord + v2_texcoord) / 2.F);
         }
 
-        const auto v_mid_index = static_cast<Mesh::Index>(m_vertices.size());
-        edge_midpoints.try_emplace(edge, v_mid_index);
-        m_vertices.push_back(v_mid);
-        return v_mid_index;
+        return v_mid;
     }
 
-    void ComputeAverageNormals()
+    // Average normals are computed in parallel when executor is provided and are equal to the serially computed normals,
+    // because face normals contributing to each vertex are summed up in the same order of triangles
+    void ComputeAverageNormals(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         CheckLayoutHasVertexField(VertexField::Normal);
         META_CHECK_DESCR(BaseMesh::GetIndexCount(), BaseMesh::GetIndexCount() % 3 == 0,
                          "mesh indices count should be a multiple of three representing triangles list");
 
-        for (VType& vertex : m_vertices)
+        const Indices&   indices         = GetIndices();
+        const Data::Size triangles_count = BaseMesh::GetIndexCount() / 3;
+        const auto       vertices_count  = static_cast<Data::Size>(m_vertices.size());
+
+        std::vector<HlslNormal> face_normals(triangles_count);
+        ForEachChunk(parallel_executor_ptr, triangles_count, [this, &indices, &face_normals](Data::Index begin_index, Data::Index end_index)
+        {
+            for (Data::Index triangle_index = begin_index; triangle_index < end_index; ++triangle_index)
+            {
+                const Mesh::HlslPosition p1 = GetVertexField<Mesh::Position>(m_vertices[indices[triangle_index * 3]],     Mesh::VertexField::Position).AsHlsl();
+                const Mesh::HlslPosition p2 = GetVertexField<Mesh::Position>(m_vertices[indices[triangle_index * 3 + 1]], Mesh::VertexField::Position).AsHlsl();
+                const Mesh::HlslPosition p3 = GetVertexField<Mesh::Position>(m_vertices[indices[triangle_index * 3 + 2]], Mesh::VertexField::Position).AsHlsl();
+
+                // NOTE: weight average by contributing face area
+                face_normals[triangle_index] = hlslpp::cross(p2 - p1, p3 - p1);
+            }
+        });
+
+        // Triangles adjacent to each vertex are listed in ascending order and grouped by vertex
+        std::vector<uint32_t> vertex_triangle_offsets(vertices_count + 1U, 0U);
+        for (Index vertex_index : indices)
         {
-            Mesh::Normal& vertex_normal = GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-            vertex_normal = { 0.F, 0.F, 0.F };
+            vertex_triangle_offsets[vertex_index + 1U]++;
+        }
+        for (Data::Index vertex_index = 0; vertex_index < vertices_count; ++vertex_index)
+        {
+            vertex_triangle_offsets[vertex_index + 1U] += vertex_triangle_offsets[vertex_index];
         }
 
-        const Data::Size triangles_count = BaseMesh::GetIndexCount() / 3;
-        for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
+        std::vector<uint32_t> vertex_triangles(indices.size());
+        std::vector<uint32_t> vertex_fill_offsets(vertex_triangle_offsets.begin(), vertex_triangle_offsets.end() - 1);
+        for (size_t index = 0; index < indices.size(); ++index)
         {
-            VType& v1 = GetMutableVertex(GetIndex(triangle_index * 3));
-            VType& v2 = GetMutableVertex(GetIndex(triangle_index * 3 + 1));
-            VType& v3 = GetMutableVertex(GetIndex(triangle_index * 3 + 2));
+            vertex_triangles[vertex_fill_offsets[indices[index]]++] = static_cast<uint32_t>(index / 3);
+        }
 
-            const Mesh::HlslPosition p1 = GetVertexField<Mesh::Position>(v1, Mesh::VertexField::Position).AsHlsl();
-            const Mesh::HlslPosition p2 = GetVertexField<Mesh::Position>(v2, Mesh::VertexField::Position).AsHlsl();
-            const Mesh::HlslPosition p3 = GetVertexField<Mesh::Position>(v3, Mesh::VertexField::Position).AsHlsl();
+        ForEachChunk(parallel_executor_ptr, vertices_count,
+            [this, &face_normals, &vertex_triangle_offsets, &vertex_triangles](Data::Index begin_index, Data::Index end_index)
+            {
+                for (Data::Index vertex_index = begin_index; vertex_index < end_index; ++vertex_index)
+                {
+                    HlslNormal vertex_normal(0.F, 0.F, 0.F);
+                    for (uint32_t offset = vertex_triangle_offsets[vertex_index]; offset < vertex_triangle_offsets[vertex_index + 1U]; ++offset)
+                    {
+                        vertex_normal = vertex_normal + face_normals[vertex_triangles[offset]];
+                    }
+                    GetVertexField<Mesh::Normal>(m_vertices[vertex_index], Mesh::VertexField::Normal) = Mesh::Normal(hlslpp::normalize(vertex_normal));
+                }
+            });
+    }
 
-            const Mesh::HlslPosition u = p2 - p1;
-            const Mesh::HlslPosition v = p3 - p1;
-            const Mesh::HlslNormal   n = hlslpp::cross(u, v);
+    void ValidateMeshData()
+    {
+        for(size_t index = 0; index < GetIndexCount(); ++index)
+        {
+            const Index vertex_index = GetIndex(index);
+            META_CHECK_LESS_DESCR(vertex_index, m_vertices.size(),
+                                  "mesh index buffer value at position {} is greater is out of vertex buffer bounds", index);
+        }
+    }
 
-            // NOTE: weight average by contributing face area
-            Mesh::Normal& n1 = GetVertexField<Mesh::Normal>(v1, Mesh::VertexField::Normal);
-            n1 = static_cast<Mesh::Normal>(n1.AsHlsl() + n);
+    void OptimizeSlice(const OptimizationSettings& settings, const Subset::Slice& index_slice, const Subset::Slice& vertex_slice, bool indices_adjusted)
+    {
+        META_FUNCTION_TASK();
+        const std::span<Index> indices = GetMutableIndices(index_slice);
+        const auto base_vertex_index = static_cast<Index>(indices_adjusted ? vertex_slice.offset : 0U);
+        if (base_vertex_index)
+            std::ranges::for_each(indices, [base_vertex_index](Index& index) { index -= base_vertex_index; });
 
-            Mesh::Normal& n2 = GetVertexField<Mesh::Normal>(v2, Mesh::VertexField::Normal);
-            n2 = static_cast<Mesh::Normal>(n2.AsHlsl() + n);
+        if (settings.reorder_triangles)
+        {
+            OptimizeVertexCache(indices, vertex_slice.count);
+        }
 
-            Mesh::Normal& n3 = GetVertexField<Mesh::Normal>(v3, Mesh::VertexField::Normal);
-            n3 = static_cast<Mesh::Normal>(n3.AsHlsl() + n);
+        if (settings.reorder_clusters)
+        {
+            OptimizeOverdraw(indices, GetPositions(vertex_slice), settings.overdraw_threshold);
         }
 
-        for (VType& vertex : m_vertices)
+        if (settings.remap_vertices)
         {
-            Mesh::Normal& vertex_normal = GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-            vertex_normal = Mesh::Normal(hlslpp::normalize(vertex_normal.AsHlsl()));
+            const Indices  vertex_remap = OptimizeVertexFetch(indices, vertex_slice.count);
+            const auto     slice_begin_it = m_vertices.begin() + vertex_slice.offset;
+            const Vertices slice_vertices(slice_begin_it, slice_begin_it + vertex_slice.count);
+            for(Data::Index vertex_index = 0; vertex_index < vertex_slice.count; ++vertex_index)
+            {
+                m_vertices[vertex_slice.offset + vertex_remap[vertex_index]] = slice_vertices[vertex_index];
+            }
         }
+
+        if (base_vertex_index)
+            std::ranges::for_each(indices, [base_vertex_index](Index& index) { index += base_vertex_index; });
     }
 
-    void ValidateMeshData()
+    [[nodiscard]] Lods BuildSliceLods(const LodSettings& settings, const Subset::Slice& index_slice, const Subset::Slice& vertex_slice, bool indices_adjusted) const
     {
-        for(size_t index = 0; index < GetIndexCount(); ++index)
+        META_FUNCTION_TASK();
+        const auto    indices_begin_it = GetIndices().begin() + index_slice.offset;
+        Indices       indices(indices_begin_it, indices_begin_it + index_slice.count);
+        const auto    base_vertex_index = static_cast<Index>(indices_adjusted ? vertex_slice.offset : 0U);
+        if (base_vertex_index)
+            std::ranges::for_each(indices, [base_vertex_index](Index& index) { index -= base_vertex_index; });
+
+        Lods lods = BuildMeshLods(settings, indices, GetPositions(vertex_slice));
+
+        if (base_vertex_index)
+            for(Lod& lod : lods)
+                std::ranges::for_each(lod.indices, [base_vertex_index](Index& index) { index += base_vertex_index; });
+
+        return lods;
+    }
+
+    // Splits items range into chunks processed in parallel with the given executor, or processes whole range serially without it
+    template<typename ProcessChunkFunc>
+    static void ForEachChunk(tf::Executor* parallel_executor_ptr, Data::Size items_count, const ProcessChunkFunc& process_chunk)
+    {
+        META_FUNCTION_TASK();
+        if (!parallel_executor_ptr || items_count <= s_parallel_chunk_size)
         {
-            const Index vertex_index = GetIndex(index);
-            META_CHECK_LESS_DESCR(vertex_index, m_vertices.size(),
-                                  "mesh index buffer value at position {} is greater is out of vertex buffer bounds", index);
+            process_chunk(0U, items_count);
+            return;
         }
+
+        const Data::Size chunks_count = (items_count + s_parallel_chunk_size - 1U) / s_parallel_chunk_size;
+        tf::Taskflow chunks_task_flow;
+        chunks_task_flow.for_each_index(0U, chunks_count, 1U,
+            [items_count, &process_chunk](const Data::Index chunk_index)
+            {
+                META_FUNCTION_TASK();
+                const Data::Index begin_index = chunk_index * s_parallel_chunk_size;
+                process_chunk(begin_index, std::min(begin_index + s_parallel_chunk_size, items_count));
+            }
+        );
+        parallel_executor_ptr->run(chunks_task_flow).get();
     }
 
+    static constexpr Data::Size s_parallel_chunk_size = 4096U;
+
     void   ResizeVertices(size_t vertex_count) noexcept  { m_vertices.resize(vertex_count, {}); }
     void   ReserveVertices(size_t vertex_count) noexcept { m_vertices.reserve(vertex_count); }
     VType& GetMutableVertex(size_t vertex_index)         { return m_vertices[vertex_index]; }
@@ -37,7 +37,8 @@ class IcosahedronMesh : public BaseMesh<VType>
 public:
     using BaseMeshT = BaseMesh<VType>;
 
-    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false)
+    explicit IcosahedronMesh(const Mesh::VertexLayout& vertex_layout, float radius = 1.F, uint32_t subdivisions_count = 0, bool spherify = false,
+                             tf::Executor* parallel_executor_ptr = nullptr)
         : BaseMeshT(Mesh::Type::Icosahedron, vertex_layout)
         , m_radius(radius)
     {
@@ -118,70 +119,107 @@ public:
 
         for(uint32_t subdivision = 0; subdivision < subdivisions_count; ++subdivision)
         {
-            Subdivide();
+            Subdivide(parallel_executor_ptr);
         }
 
         if (spherify)
         {
-            Spherify();
+            Spherify(parallel_executor_ptr);
         }
     }
 
     float GetRadius() const noexcept  { return m_radius; }
 
-    void Subdivide()
+    // Subdivision is done in parallel when executor is provided, while the mesh data is the same as after serial subdivision:
+    // midpoint vertices are enumerated in order of the triangle edges traversal, then filled and indexed chunk by chunk
+    void Subdivide(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         META_CHECK_DESCR(Mesh::GetIndexCount(), Mesh::GetIndexCount() % 3 == 0,
                          "icosahedron indices count should be a multiple of three representing triangles list");
 
-        Mesh::Indices new_indices;
-        new_indices.reserve(Mesh::GetIndexCount() * 4);
-        BaseMeshT::ReserveVertices(BaseMeshT::GetVertexCount() * 2);
+        const Mesh::Indices& indices         = Mesh::GetIndices();
+        const Data::Size     indices_count   = Mesh::GetIndexCount();
+        const Data::Size     triangles_count = indices_count / 3;
+        const Data::Size     vertices_count  = BaseMeshT::GetVertexCount();
 
-        typename BaseMeshT::EdgeMidpoints edge_midpoints;
+        // Every triangle edge is shared with one adjacent triangle in closed mesh, so there are half as many unique edges
+        Mesh::EdgeMidpoints          edge_midpoints(indices_count / 2);
+        std::vector<Mesh::Edge>      midpoint_edges;
+        Mesh::Indices                triangle_edge_midpoints(indices_count);
+        midpoint_edges.reserve(indices_count / 2);
 
-        const Data::Size triangles_count = Mesh::GetIndexCount() / 3;
-        for (Data::Index triangle_index = 0; triangle_index < triangles_count; ++triangle_index)
+        for (Data::Index index = 0; index < indices_count; ++index)
         {
-            const Mesh::Index vi1 = Mesh::GetIndex(triangle_index * 3);
-            const Mesh::Index vi2 = Mesh::GetIndex(triangle_index * 3 + 1);
-            const Mesh::Index vi3 = Mesh::GetIndex(triangle_index * 3 + 2);
-
-            const Mesh::Index vm1 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi1, vi2), edge_midpoints);
-            const Mesh::Index vm2 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi2, vi3), edge_midpoints);
-            const Mesh::Index vm3 = BaseMeshT::AddEdgeMidpoint(Mesh::Edge(vi3, vi1), edge_midpoints);
-
-            std::array<Mesh::Index, 3 * 4> indices{
-                vi1, vm1, vm3,
-                vm1, vi2, vm2,
-                vm1, vm2, vm3,
-                vm3, vm2, vi3,
-            };
-            new_indices.insert(new_indices.end(), indices.begin(), indices.end());
+            const Data::Index next_index = index % 3 == 2 ? index - 2 : index + 1;
+            const Mesh::Edge  edge(indices[index], indices[next_index]);
+            const auto [midpoint_index, is_new_midpoint] = edge_midpoints.TryEmplace(edge, static_cast<Mesh::Index>(vertices_count + midpoint_edges.size()));
+            if (is_new_midpoint)
+            {
+                midpoint_edges.push_back(edge);
+            }
+            triangle_edge_midpoints[index] = midpoint_index;
         }
 
+        BaseMeshT::ResizeVertices(vertices_count + midpoint_edges.size());
+        BaseMeshT::ForEachChunk(parallel_executor_ptr, static_cast<Data::Size>(midpoint_edges.size()),
+            [this, vertices_count, &midpoint_edges](Data::Index begin_index, Data::Index end_index)
+            {
+                for (Data::Index edge_index = begin_index; edge_index < end_index; ++edge_index)
+                {
+                    BaseMeshT::GetMutableVertex(vertices_count + edge_index) = BaseMeshT::GetEdgeMidpoint(midpoint_edges[edge_index]);
+                }
+            });
+
+        Mesh::Indices new_indices(indices_count * 4);
+        BaseMeshT::ForEachChunk(parallel_executor_ptr, triangles_count,
+            [&indices, &triangle_edge_midpoints, &new_indices](Data::Index begin_index, Data::Index end_index)
+            {
+                for (Data::Index triangle_index = begin_index; triangle_index < end_index; ++triangle_index)
+                {
+                    const Mesh::Index vi1 = indices[triangle_index * 3];
+                    const Mesh::Index vi2 = indices[triangle_index * 3 + 1];
+                    const Mesh::Index vi3 = indices[triangle_index * 3 + 2];
+
+                    const Mesh::Index vm1 = triangle_edge_midpoints[triangle_index * 3];
+                    const Mesh::Index vm2 = triangle_edge_midpoints[triangle_index * 3 + 1];
+                    const Mesh::Index vm3 = triangle_edge_midpoints[triangle_index * 3 + 2];
+
+                    const std::array<Mesh::Index, 3 * 4> triangle_indices{
+                        vi1, vm1, vm3,
+                        vm1, vi2, vm2,
+                        vm1, vm2, vm3,
+                        vm3, vm2, vi3,
+                    };
+                    std::ranges::copy(triangle_indices, new_indices.begin() + triangle_index * 12);
+                }
+            });
+
         BaseMeshT::SwapIndices(new_indices);
     }
 
-    void Spherify()
+    void Spherify(tf::Executor* parallel_executor_ptr = nullptr)
     {
         META_FUNCTION_TASK();
         const bool has_normals = BaseMeshT::HasVertexField(Mesh::VertexField::Normal);
 
-        for(size_t vertex_index = 0; vertex_index < BaseMeshT::GetVertexCount(); ++vertex_index)
-        {
-            VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
-            Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
-            const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
-            vertex_position = Mesh::Position(vertex_position_norm * m_radius);
-
-            if (has_normals)
+        BaseMeshT::ForEachChunk(parallel_executor_ptr, BaseMeshT::GetVertexCount(),
+            [this, has_normals](Data::Index begin_index, Data::Index end_index)
             {
-                Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
-                vertex_normal = Mesh::Normal(vertex_position_norm);
-            }
-        }
+                for (Data::Index vertex_index = begin_index; vertex_index < end_index; ++vertex_index)
+                {
+                    VType& vertex = BaseMeshT::GetMutableVertex(vertex_index);
+                    Mesh::Position& vertex_position = BaseMeshT::template GetVertexField<Mesh::Position>(vertex, Mesh::VertexField::Position);
+                    const Mesh::HlslPosition vertex_position_norm = hlslpp::normalize(vertex_position.AsHlsl());
+                    vertex_position = Mesh::Position(vertex_position_norm * m_radius);
+
+                    if (has_normals)
+                    {
+                        Mesh::Normal& vertex_normal = BaseMeshT::template GetVertexField<Mesh::Normal>(vertex, Mesh::VertexField::Normal);
+                        vertex_normal = Mesh::Normal(vertex_position_norm);
+                    }
+                }
+            });
     }
 
 private:
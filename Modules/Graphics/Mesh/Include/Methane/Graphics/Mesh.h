@@ -23,14 +23,18 @@ Abstract mesh class
 
 #pragma once
 
+#include <Methane/Graphics/Types.h>
 #include <Methane/Data/Types.h>
 #include <Methane/Data/Vector.hpp>
 
 #include <magic_enum/magic_enum.hpp>
 #include <vector>
 #include <array>
+#include <span>
 #include <string_view>
 #include <iterator>
+#include <optional>
+#include <utility>
 
 namespace Methane::Graphics
 {
@@ -43,7 +47,7 @@ public:
     using Normal     = Data::RawVector3F;
     using Color      = Data::RawVector3F;
     using TexCoord   = Data::RawVector2F;
-    using Index      = uint16_t;
+    using Index      = uint32_t; // indices are packed to the narrowest index format fitting the mesh on GPU upload
     using Indices    = std::vector<Index>;
 
     enum class Type
@@ -78,6 +82,38 @@ public:
 
     using Subsets = std::vector<Subset>;
 
+    struct VertexCacheStatistics
+    {
+        uint32_t transformed_vertices_count = 0U;
+        float    acmr = 0.F; // average cache miss ratio: transformed vertices per triangle, from 0.5 (best) to 3 (worst)
+        float    atvr = 0.F; // average transformed vertex ratio: transformed vertices per mesh vertex, 1 is optimal
+    };
+
+    struct OptimizationSettings
+    {
+        bool  reorder_triangles  = true;  // reorder triangles for post-transform vertex cache locality
+        bool  reorder_clusters   = false; // reorder triangle clusters front-to-back from mesh center to reduce overdraw
+        float overdraw_threshold = 1.05F; // max ACMR degradation allowed by splitting triangles into smaller clusters
+        bool  remap_vertices     = true;  // reorder vertices in order of first use by indices for vertex fetch locality
+    };
+
+    struct LodSettings
+    {
+        uint32_t max_lods_count     = 4U;    // max count of simplified levels of detail generated in addition to the original mesh
+        float    index_count_ratio  = 0.5F;  // target index count of each level relative to the index count of previous level
+        float    max_relative_error = 0.05F; // max geometric error of simplified surface relative to the mesh bounding box extent
+    };
+
+    struct Lod
+    {
+        Indices indices;     // simplified triangle list referencing vertices of the original mesh
+        float   error = 0.F; // geometric error of the simplified surface in mesh units
+    };
+
+    using Lods = std::vector<Lod>;
+
+    static constexpr uint32_t s_default_vertex_cache_size = 16U;
+
     enum class VertexField : size_t
     {
         Position,
@@ -116,7 +152,16 @@ public:
     [[nodiscard]] const Indices&      GetIndices() const noexcept            { return m_indices; }
     [[nodiscard]] Index               GetIndex(Data::Index i) const noexcept { return i < m_indices.size() ? m_indices[i] : 0; }
     [[nodiscard]] Data::Size          GetIndexCount() const noexcept         { return static_cast<Data::Size>(m_indices.size()); }
-    [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
+    [[nodiscard]] Index               GetMaxIndex() const noexcept;
+    [[nodiscard]] PixelFormat         GetIndexFormat() const noexcept;
+    [[nodiscard]] Data::Size          GetIndexSize() const noexcept;
+    [[nodiscard]] Data::Size          GetIndexDataSize() const noexcept      { return GetIndexCount() * GetIndexSize(); }
+    [[nodiscard]] Data::Bytes         GetIndexData() const                   { return GetIndexData(GetIndexFormat()); }
+    [[nodiscard]] Data::Bytes         GetIndexData(PixelFormat index_format) const   { return GetIndexData(m_indices, index_format); }
+    [[nodiscard]] VertexCacheStatistics GetVertexCacheStatistics(uint32_t cache_size = s_default_vertex_cache_size) const;
+
+    [[nodiscard]] static Data::Bytes  GetIndexData(std::span<const Index> indices, PixelFormat index_format);
+    [[nodiscard]] static Data::Size   GetVertexSize(const VertexLayout& vertex_layout) noexcept;
 
     // Mesh interface methods
     [[nodiscard]] virtual Data::Size        GetVertexCount() const noexcept = 0;
@@ -140,21 +185,41 @@ protected:
         [[nodiscard]] friend auto operator<=>(const Edge& left, const Edge& right) = default;
     };
 
+    // Open-addressing hash table with linear probing, which maps mesh edges to indices of their midpoint vertices
+    class EdgeMidpoints
+    {
+    public:
+        explicit EdgeMidpoints(Data::Size edges_count = 0U);
+
+        // Returns midpoint index of the existing edge and false, or adds the edge with given midpoint index and returns true
+        std::pair<Index, bool> TryEmplace(const Edge& edge, Index midpoint_index);
+
+        [[nodiscard]] Data::Size GetCount() const noexcept { return m_count; }
+
+    private:
+        void Rehash(size_t capacity);
+
+        std::vector<uint64_t> m_edge_keys;
+        std::vector<Index>    m_midpoint_indices;
+        Data::Size            m_count = 0U;
+    };
+
     using VertexFieldOffsets = std::array<int32_t, magic_enum::enum_count<VertexField>()>;
 
     void CheckLayoutHasVertexField(VertexField field) const;
     [[nodiscard]] bool HasVertexField(VertexField field) const noexcept;
     [[nodiscard]] int32_t GetVertexFieldOffset(VertexField field) const { return m_vertex_field_offsets[static_cast<size_t>(field)]; }
 
-    void ResizeIndices(size_t indices_count)             { m_indices.resize(indices_count, 0); }
-    void SetIndex(Data::Index index, Index vertex_index) { m_indices[index] = vertex_index; }
-    void SetIndices(Indices&& indices) noexcept          { m_indices = std::move(indices); }
-    void SwapIndices(Indices& indices)                   { m_indices.swap(indices); }
-    void AppendIndices(const Mesh::Indices& indices)     { m_indices.insert(m_indices.end(), indices.begin(), indices.end()); }
-    auto GetIndicesBackInserter()                        { return std::back_inserter(m_indices); }
+    // Cached max index is reset on any change of indices, including writes via returned back-inserter and mutable span
+    void ResizeIndices(size_t indices_count)             { m_indices.resize(indices_count, 0); m_max_index.reset(); }
+    void SetIndex(Data::Index index, Index vertex_index) { m_indices[index] = vertex_index; m_max_index.reset(); }
+    void SetIndices(Indices&& indices) noexcept          { m_indices = std::move(indices); m_max_index.reset(); }
+    void SwapIndices(Indices& indices)                   { m_indices.swap(indices); m_max_index.reset(); }
+    void AppendIndices(const Mesh::Indices& indices)     { m_indices.insert(m_indices.end(), indices.begin(), indices.end()); m_max_index.reset(); }
+    auto GetIndicesBackInserter()                        { m_max_index.reset(); return std::back_inserter(m_indices); }
+    auto GetMutableIndices(const Subset::Slice& slice)   { m_max_index.reset(); return std::span<Index>(m_indices).subspan(slice.offset, slice.count); }
 
     [[nodiscard]] static VertexFieldOffsets GetVertexFieldOffsets(const VertexLayout& vertex_layout);
-    [[nodiscard]] static Data::Size         GetVertexSize(const VertexLayout& vertex_layout) noexcept;
     [[nodiscard]] static Data::Size         GetVertexFieldSize(VertexField vertex_field)   { return GetVertexFieldSize(static_cast<size_t>(vertex_field)); }
     [[nodiscard]] static Data::Size         GetVertexFieldSize(size_t vertex_field_index);
     [[nodiscard]] static const Position2D&  GetFacePosition2D(size_t index);
@@ -166,11 +231,12 @@ protected:
     [[nodiscard]] static Data::Size         GetColorsCount() noexcept;
 
 private:
-    const Type               m_type;
-    const VertexLayout       m_vertex_layout;
-    const VertexFieldOffsets m_vertex_field_offsets;
-    const Data::Size         m_vertex_size;
-    Indices                  m_indices;
+    const Type                   m_type;
+    const VertexLayout           m_vertex_layout;
+    const VertexFieldOffsets     m_vertex_field_offsets;
+    const Data::Size             m_vertex_size;
+    Indices                      m_indices;
+    mutable std::optional<Index> m_max_index; // calculated on first request after indices change
 };
 
 } // namespace Methane::Graphics
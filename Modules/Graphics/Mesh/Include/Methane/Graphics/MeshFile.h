@@ -0,0 +1,77 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshFile.h
+Versioned binary mesh container with vertices and indices stored in GPU-ready layout,
+which is loaded without copying from data chunk of memory mapped file.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <Methane/Data/Chunk.hpp>
+
+namespace Methane::Graphics
+{
+
+// Mesh file layout: header, vertex layout fields, subsets, vertex data and index data packed to the narrowest index format;
+// all values are stored in native byte order of the writing platform, so mesh files are intended to be used as caches
+class MeshFile
+{
+public:
+    static constexpr uint32_t s_format_magic   = 0x4853454DU; // "MESH"
+    static constexpr uint32_t s_format_version = 1U;
+
+    // Mesh subsets are not written when empty, so the whole mesh is drawn as a single subset after loading
+    [[nodiscard]] static Data::Bytes Write(const Mesh& mesh, const Mesh::Subsets& mesh_subsets = {});
+
+    // Validates mesh file structure and references vertex and index data in the chunk without copying
+    explicit MeshFile(Data::Chunk&& data_chunk);
+
+    [[nodiscard]] Mesh::Type                GetType() const noexcept            { return m_type; }
+    [[nodiscard]] const Mesh::VertexLayout& GetVertexLayout() const noexcept    { return m_vertex_layout; }
+    [[nodiscard]] const Mesh::Subsets&      GetSubsets() const noexcept         { return m_subsets; }
+    [[nodiscard]] Data::Size                GetVertexSize() const noexcept      { return m_vertex_size; }
+    [[nodiscard]] Data::Size                GetVertexCount() const noexcept     { return m_vertex_count; }
+    [[nodiscard]] Data::Size                GetVertexDataSize() const noexcept  { return m_vertex_count * m_vertex_size; }
+    [[nodiscard]] Data::ConstRawPtr         GetVertexData() const noexcept      { return m_data_chunk.GetDataPtr() + m_vertex_data_offset; }
+    [[nodiscard]] PixelFormat               GetIndexFormat() const noexcept     { return m_index_format; }
+    [[nodiscard]] Data::Size                GetIndexSize() const noexcept;
+    [[nodiscard]] Data::Size                GetIndexCount() const noexcept      { return m_index_count; }
+    [[nodiscard]] Data::Size                GetIndexDataSize() const noexcept   { return m_index_count * GetIndexSize(); }
+    [[nodiscard]] Data::ConstRawPtr         GetIndexData() const noexcept       { return m_data_chunk.GetDataPtr() + m_index_data_offset; }
+    [[nodiscard]] Mesh::Index               GetIndex(Data::Index index) const;
+    [[nodiscard]] const Data::Chunk&        GetDataChunk() const noexcept       { return m_data_chunk; }
+
+private:
+    Data::Chunk        m_data_chunk;
+    Mesh::Type         m_type = Mesh::Type::Unknown;
+    Mesh::VertexLayout m_vertex_layout;
+    Mesh::Subsets      m_subsets;
+    Data::Size         m_vertex_size        = 0U;
+    Data::Size         m_vertex_count       = 0U;
+    Data::Size         m_vertex_data_offset = 0U;
+    PixelFormat        m_index_format       = PixelFormat::R16Uint;
+    Data::Size         m_index_count        = 0U;
+    Data::Size         m_index_data_offset  = 0U;
+};
+
+} // namespace Methane::Graphics
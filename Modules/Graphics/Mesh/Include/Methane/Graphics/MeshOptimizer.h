@@ -0,0 +1,50 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.h
+Mesh index and vertex reordering for post-transform vertex cache,
+overdraw and vertex fetch efficiency.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <span>
+
+namespace Methane::Graphics
+{
+
+// Simulates FIFO post-transform vertex cache of the given size on triangle list indices
+[[nodiscard]] Mesh::VertexCacheStatistics AnalyzeVertexCache(std::span<const Mesh::Index> indices, Data::Size vertex_count,
+                                                             uint32_t cache_size = Mesh::s_default_vertex_cache_size);
+
+// Reorders triangles in place with Forsyth linear-speed vertex cache optimization algorithm
+void OptimizeVertexCache(std::span<Mesh::Index> indices, Data::Size vertex_count);
+
+// Reorders clusters of vertex cache optimized triangles in place, so that outer clusters facing away from mesh center
+// are drawn first and occlude the rest; threshold limits ACMR degradation caused by splitting triangles into clusters
+void OptimizeOverdraw(std::span<Mesh::Index> indices, std::span<const Mesh::Position> positions, float threshold,
+                      uint32_t cache_size = Mesh::s_default_vertex_cache_size);
+
+// Remaps indices in place to number vertices in order of their first use and returns remap table
+// from old vertex index to new vertex index; vertices not referenced by indices are moved to the end
+[[nodiscard]] Mesh::Indices OptimizeVertexFetch(std::span<Mesh::Index> indices, Data::Size vertex_count);
+
+} // namespace Methane::Graphics
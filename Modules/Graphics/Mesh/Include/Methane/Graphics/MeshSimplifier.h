@@ -0,0 +1,40 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshSimplifier.h
+Mesh simplification with quadric error metrics for levels of detail generation.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <span>
+
+namespace Methane::Graphics
+{
+
+// Builds chain of simplified triangle lists by collapsing mesh edges with minimal quadric error metric, where each level
+// has index count reduced by the given ratio relative to the previous level. Vertices are collapsed into their neighbours,
+// so all levels reference the original vertices; vertices on attribute seams and open borders are never removed.
+// Simplification stops when max error is reached or when mesh can not be reduced any further, so less levels can be returned.
+[[nodiscard]] Mesh::Lods BuildMeshLods(const Mesh::LodSettings& settings, std::span<const Mesh::Index> indices,
+                                       std::span<const Mesh::Position> positions);
+
+} // namespace Methane::Graphics
@@ -0,0 +1,79 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.h
+Mesh partitioning into small triangle clusters (meshlets) with local index buffers,
+bounding spheres and normal cones for per-cluster culling.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Mesh.h"
+
+#include <span>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+struct MeshletSettings
+{
+    uint32_t max_vertices_count  = 64U;  // up to 256 vertices can be referenced by 8-bit local indices
+    uint32_t max_triangles_count = 124U; // 124 triangles fit into 128 bytes of local indices padded to 4 bytes
+};
+
+struct Meshlet
+{
+    uint32_t subset_index       = 0U;
+    uint32_t vertex_offset      = 0U; // offset in meshlet vertex indices
+    uint32_t vertices_count     = 0U;
+    uint32_t local_index_offset = 0U; // offset in meshlet local indices
+    uint32_t triangles_count    = 0U;
+};
+
+struct MeshletBounds
+{
+    Mesh::Position center;
+    float          radius = 0.F;
+
+    // Meshlet is back-facing and can be culled when dot(normalize(cone_apex - camera_position), cone_axis) >= cone_cutoff;
+    // cone cutoff equal to 1 means that normals spread is too wide and meshlet can not be culled by cone test
+    Mesh::Position cone_apex;
+    Mesh::Normal   cone_axis;
+    float          cone_cutoff = 1.F;
+};
+
+struct Meshlets
+{
+    std::vector<Meshlet>       meshlets;
+    std::vector<MeshletBounds> bounds;         // bounds per meshlet
+    Mesh::Indices              vertex_indices; // mesh vertex indices referenced by meshlets
+    std::vector<uint8_t>       local_indices;  // triangle list indices of meshlet vertices
+
+    [[nodiscard]] size_t GetCount() const noexcept { return meshlets.size(); }
+};
+
+// Splits triangle list indices into meshlets appended to the given meshlets collection;
+// vertex indices of meshlets are offset by base vertex index to reference mesh vertices
+void BuildMeshlets(const MeshletSettings& settings, std::span<const Mesh::Index> indices, std::span<const Mesh::Position> positions,
+                   Meshlets& meshlets, Mesh::Index base_vertex_index = 0U, uint32_t subset_index = 0U);
+
+[[nodiscard]] MeshletBounds ComputeMeshletBounds(const Meshlets& meshlets, const Meshlet& meshlet, std::span<const Mesh::Position> positions);
+
+} // namespace Methane::Graphics
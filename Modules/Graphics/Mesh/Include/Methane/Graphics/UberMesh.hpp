@@ -72,6 +72,40 @@ public:
         BaseMeshT::AppendVertices(sub_vertices);
     }
 
+    // Sub-meshes are optimized separately to keep subset index and vertex slices valid
+    void Optimize(const Mesh::OptimizationSettings& settings = {})
+    {
+        META_FUNCTION_TASK();
+        for(const Mesh::Subset& subset : m_subsets)
+        {
+            BaseMeshT::OptimizeSlice(settings, subset.indices, subset.vertices, subset.indices_adjusted);
+        }
+    }
+
+    // Meshlets are built per sub-mesh, so that each meshlet belongs to one subset
+    [[nodiscard]] Meshlets BuildMeshlets(const MeshletSettings& settings = {}) const
+    {
+        META_FUNCTION_TASK();
+        Meshlets meshlets;
+        const std::vector<Mesh::Position> positions = BaseMeshT::GetPositions(Mesh::Subset::Slice(0U, BaseMeshT::GetVertexCount()));
+        for(uint32_t subset_index = 0U; subset_index < m_subsets.size(); ++subset_index)
+        {
+            const Mesh::Subset& subset = m_subsets[subset_index];
+            const std::span<const Mesh::Index> subset_indices(Mesh::GetIndices().data() + subset.indices.offset, subset.indices.count);
+            const Mesh::Index base_vertex_index = subset.indices_adjusted ? 0U : subset.vertices.offset;
+            Graphics::BuildMeshlets(settings, subset_indices, positions, meshlets, base_vertex_index, subset_index);
+        }
+        return meshlets;
+    }
+
+    // Levels of detail of sub-mesh have indices in the same format as subset indices (adjusted or not)
+    [[nodiscard]] Mesh::Lods BuildSubsetLods(size_t subset_index, const Mesh::LodSettings& settings = {}) const
+    {
+        META_FUNCTION_TASK();
+        const Mesh::Subset& subset = GetSubset(subset_index);
+        return BaseMeshT::BuildSliceLods(settings, subset.indices, subset.vertices, subset.indices_adjusted);
+    }
+
     const Mesh::Subsets& GetSubsets() const                     { return m_subsets; }
     size_t               GetSubsetCount() const noexcept        { return m_subsets.size(); }
     const Mesh::Subset&  GetSubset(size_t subset_index) const
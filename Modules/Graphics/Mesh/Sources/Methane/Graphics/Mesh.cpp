@@ -22,12 +22,16 @@ Abstract mesh class
 ******************************************************************************/
 
 #include <Methane/Graphics/Mesh.h>
+#include <Methane/Graphics/MeshOptimizer.h>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <magic_enum/magic_enum.hpp>
 #include <array>
 #include <algorithm>
+#include <bit>
+#include <limits>
+#include <cstring>
 
 namespace Methane::Graphics
 {
@@ -35,6 +39,15 @@ namespace Methane::Graphics
 static constexpr Data::Size g_face_positions_count = 4;
 static constexpr Data::Size g_face_indices_count = 6;
 static constexpr Data::Size g_colors_count = 6;
+static constexpr size_t     g_min_edge_midpoints_capacity = 64U;
+static constexpr uint64_t   g_empty_edge_key = std::numeric_limits<uint64_t>::max();
+
+static size_t GetEdgeKeyHash(uint64_t edge_key) noexcept
+{
+    // Fibonacci hashing with high bits folded to low bits, which are used for slot selection
+    const uint64_t hash = edge_key * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(hash ^ (hash >> 32U));
+}
 
 Data::Size Mesh::GetVertexFieldSize(size_t vertex_field_index)
 {
@@ -186,6 +199,67 @@ Mesh::Mesh(Type type, const VertexLayout& vertex_layout)
     CheckLayoutHasVertexField(VertexField::Position);
 }
 
+Mesh::Index Mesh::GetMaxIndex() const noexcept
+{
+    META_FUNCTION_TASK();
+    // Max index is cached, so that index format, size and data size requests do not scan all indices every time
+    if (!m_max_index)
+    {
+        m_max_index = m_indices.empty() ? 0U : std::ranges::max(m_indices);
+    }
+    return *m_max_index;
+}
+
+PixelFormat Mesh::GetIndexFormat() const noexcept
+{
+    META_FUNCTION_TASK();
+    // Narrowest index format is selected to halve index buffer size and bandwidth for meshes with up to 65536 vertices
+    return GetMaxIndex() <= std::numeric_limits<uint16_t>::max()
+         ? PixelFormat::R16Uint
+         : PixelFormat::R32Uint;
+}
+
+Data::Size Mesh::GetIndexSize() const noexcept
+{
+    META_FUNCTION_TASK();
+    return GetIndexFormat() == PixelFormat::R16Uint
+         ? static_cast<Data::Size>(sizeof(uint16_t))
+         : static_cast<Data::Size>(sizeof(uint32_t));
+}
+
+Data::Bytes Mesh::GetIndexData(std::span<const Index> indices, PixelFormat index_format)
+{
+    META_FUNCTION_TASK();
+    switch(index_format)
+    {
+    case PixelFormat::R32Uint:
+    {
+        Data::Bytes index_data(indices.size() * sizeof(uint32_t));
+        std::memcpy(index_data.data(), indices.data(), index_data.size());
+        return index_data;
+    }
+
+    case PixelFormat::R16Uint:
+    {
+        META_CHECK_LESS_OR_EQUAL_DESCR(indices.empty() ? 0U : std::ranges::max(indices), std::numeric_limits<uint16_t>::max(),
+                                       "mesh indices do not fit into 16-bit index format");
+        Data::Bytes index_data(indices.size() * sizeof(uint16_t));
+        auto* index_16_ptr = reinterpret_cast<uint16_t*>(index_data.data()); // NOSONAR
+        std::ranges::transform(indices, index_16_ptr, [](Index index) { return static_cast<uint16_t>(index); });
+        return index_data;
+    }
+
+    default:
+        META_UNEXPECTED_RETURN_DESCR(index_format, Data::Bytes(), "mesh index format should be R16Uint or R32Uint");
+    }
+}
+
+Mesh::VertexCacheStatistics Mesh::GetVertexCacheStatistics(uint32_t cache_size) const
+{
+    META_FUNCTION_TASK();
+    return AnalyzeVertexCache(m_indices, GetVertexCount(), cache_size);
+}
+
 bool Mesh::HasVertexField(VertexField field) const noexcept
 {
     META_FUNCTION_TASK();
@@ -206,4 +280,58 @@ Mesh::Edge::Edge(Mesh::Index v1_index, Mesh::Index v2_index)
 {
 }
 
+Mesh::EdgeMidpoints::EdgeMidpoints(Data::Size edges_count)
+{
+    META_FUNCTION_TASK();
+    Rehash(std::bit_ceil(std::max(static_cast<size_t>(edges_count) * 2U, g_min_edge_midpoints_capacity)));
+}
+
+std::pair<Mesh::Index, bool> Mesh::EdgeMidpoints::TryEmplace(const Edge& edge, Index midpoint_index)
+{
+    // Load factor is kept below one half for short probing sequences
+    if ((m_count + 1U) * 2U > m_edge_keys.size())
+        Rehash(m_edge_keys.size() * 2U);
+
+    const uint64_t edge_key  = (static_cast<uint64_t>(edge.first_index) << 32U) | edge.second_index;
+    const size_t   slot_mask = m_edge_keys.size() - 1U;
+    for(size_t slot = GetEdgeKeyHash(edge_key) & slot_mask;; slot = (slot + 1U) & slot_mask)
+    {
+        if (m_edge_keys[slot] == edge_key)
+            return { m_midpoint_indices[slot], false };
+
+        if (m_edge_keys[slot] == g_empty_edge_key)
+        {
+            m_edge_keys[slot]        = edge_key;
+            m_midpoint_indices[slot] = midpoint_index;
+            m_count++;
+            return { midpoint_index, true };
+        }
+    }
+}
+
+void Mesh::EdgeMidpoints::Rehash(size_t capacity)
+{
+    META_FUNCTION_TASK();
+    std::vector<uint64_t> edge_keys(capacity, g_empty_edge_key);
+    std::vector<Index>    midpoint_indices(capacity, 0U);
+
+    const size_t slot_mask = capacity - 1U;
+    for(size_t prev_slot = 0; prev_slot < m_edge_keys.size(); ++prev_slot)
+    {
+        const uint64_t edge_key = m_edge_keys[prev_slot];
+        if (edge_key == g_empty_edge_key)
+            continue;
+
+        size_t slot = GetEdgeKeyHash(edge_key) & slot_mask;
+        while (edge_keys[slot] != g_empty_edge_key)
+            slot = (slot + 1U) & slot_mask;
+
+        edge_keys[slot]        = edge_key;
+        midpoint_indices[slot] = m_midpoint_indices[prev_slot];
+    }
+
+    m_edge_keys.swap(edge_keys);
+    m_midpoint_indices.swap(midpoint_indices);
+}
+
 } // namespace Methane::Graphics
@@ -0,0 +1,219 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshFile.cpp
+Versioned binary mesh container with vertices and indices stored in GPU-ready layout,
+which is loaded without copying from data chunk of memory mapped file.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshFile.h>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Methane::Graphics
+{
+
+// Vertex data is aligned to let vertex attributes be read directly from memory mapped file
+static constexpr uint64_t g_vertex_data_alignment = 16U;
+
+namespace // anonymous
+{
+
+struct MeshFileHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t mesh_type;
+    uint32_t vertex_fields_count;
+    uint32_t vertex_size;
+    uint32_t vertex_count;
+    uint32_t index_size;
+    uint32_t index_count;
+    uint32_t subsets_count;
+    uint32_t vertex_data_offset;
+    uint32_t index_data_offset;
+    uint32_t data_size;
+};
+
+struct MeshFileSubset
+{
+    uint32_t mesh_type;
+    uint32_t vertex_offset;
+    uint32_t vertex_count;
+    uint32_t index_offset;
+    uint32_t index_count;
+    uint32_t indices_adjusted;
+};
+
+static_assert(std::is_trivially_copyable_v<MeshFileHeader> && std::is_trivially_copyable_v<MeshFileSubset>);
+
+template<typename T>
+void WriteValue(Data::Bytes& data, const T& value)
+{
+    const auto* value_bytes_ptr = reinterpret_cast<const std::byte*>(&value); // NOSONAR
+    data.insert(data.end(), value_bytes_ptr, value_bytes_ptr + sizeof(T));
+}
+
+// Values are copied from data chunk, since it may not be aligned for direct access
+template<typename T>
+[[nodiscard]] T ReadValue(const Data::Chunk& data_chunk, uint64_t offset)
+{
+    META_CHECK_LESS_OR_EQUAL_DESCR(offset + sizeof(T), data_chunk.GetDataSize(), "mesh file data is truncated");
+    T value{};
+    std::memcpy(&value, data_chunk.GetDataPtr() + offset, sizeof(T));
+    return value;
+}
+
+[[nodiscard]] constexpr uint64_t AlignUp(uint64_t value, uint64_t alignment) noexcept
+{
+    return (value + alignment - 1U) / alignment * alignment;
+}
+
+} // anonymous namespace
+
+Data::Bytes MeshFile::Write(const Mesh& mesh, const Mesh::Subsets& mesh_subsets)
+{
+    META_FUNCTION_TASK();
+    const PixelFormat index_format = mesh.GetIndexFormat();
+    const Data::Bytes index_data   = mesh.GetIndexData(index_format);
+
+    const uint64_t tables_size        = sizeof(MeshFileHeader) + mesh.GetVertexLayout().size() * sizeof(uint32_t)
+                                      + mesh_subsets.size() * sizeof(MeshFileSubset);
+    const uint64_t vertex_data_offset = AlignUp(tables_size, g_vertex_data_alignment);
+    const uint64_t index_data_offset  = AlignUp(vertex_data_offset + mesh.GetVertexDataSize(), sizeof(uint32_t));
+    const uint64_t data_size          = index_data_offset + index_data.size();
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_size, std::numeric_limits<uint32_t>::max(), "mesh is too large to be written to mesh file");
+
+    const MeshFileHeader header{
+        s_format_magic,
+        s_format_version,
+        static_cast<uint32_t>(mesh.GetType()),
+        static_cast<uint32_t>(mesh.GetVertexLayout().size()),
+        mesh.GetVertexSize(),
+        mesh.GetVertexCount(),
+        mesh.GetIndexSize(),
+        mesh.GetIndexCount(),
+        static_cast<uint32_t>(mesh_subsets.size()),
+        static_cast<uint32_t>(vertex_data_offset),
+        static_cast<uint32_t>(index_data_offset),
+        static_cast<uint32_t>(data_size)
+    };
+
+    Data::Bytes data;
+    data.reserve(data_size);
+    WriteValue(data, header);
+
+    for(const Mesh::VertexField vertex_field : mesh.GetVertexLayout())
+    {
+        WriteValue(data, static_cast<uint32_t>(vertex_field));
+    }
+
+    for(const Mesh::Subset& subset : mesh_subsets)
+    {
+        WriteValue(data, MeshFileSubset{
+            static_cast<uint32_t>(subset.mesh_type),
+            subset.vertices.offset,
+            subset.vertices.count,
+            subset.indices.offset,
+            subset.indices.count,
+            static_cast<uint32_t>(subset.indices_adjusted)
+        });
+    }
+
+    data.resize(vertex_data_offset, std::byte{});
+    data.insert(data.end(), mesh.GetVertexData(), mesh.GetVertexData() + mesh.GetVertexDataSize());
+    data.resize(index_data_offset, std::byte{});
+    data.insert(data.end(), index_data.begin(), index_data.end());
+    return data;
+}
+
+MeshFile::MeshFile(Data::Chunk&& data_chunk)
+    : m_data_chunk(std::move(data_chunk))
+{
+    META_FUNCTION_TASK();
+    const auto header = ReadValue<MeshFileHeader>(m_data_chunk, 0U);
+    META_CHECK_EQUAL_DESCR(header.magic, s_format_magic, "data is not a mesh file");
+    META_CHECK_EQUAL_DESCR(header.version, s_format_version, "mesh file version is not supported");
+    META_CHECK_LESS_OR_EQUAL_DESCR(header.data_size, m_data_chunk.GetDataSize(), "mesh file data is truncated");
+    META_CHECK_LESS_DESCR(header.mesh_type, magic_enum::enum_count<Mesh::Type>(), "mesh file has invalid mesh type");
+    META_CHECK_TRUE_DESCR(header.index_size == sizeof(uint16_t) || header.index_size == sizeof(uint32_t),
+                          "mesh file has invalid index size {}", header.index_size);
+
+    m_type               = static_cast<Mesh::Type>(header.mesh_type);
+    m_vertex_size        = header.vertex_size;
+    m_vertex_count       = header.vertex_count;
+    m_vertex_data_offset = header.vertex_data_offset;
+    m_index_format       = header.index_size == sizeof(uint16_t) ? PixelFormat::R16Uint : PixelFormat::R32Uint;
+    m_index_count        = header.index_count;
+    m_index_data_offset  = header.index_data_offset;
+
+    uint64_t table_offset = sizeof(MeshFileHeader);
+    m_vertex_layout.reserve(header.vertex_fields_count);
+    for(uint32_t field_index = 0U; field_index < header.vertex_fields_count; ++field_index, table_offset += sizeof(uint32_t))
+    {
+        const auto vertex_field = ReadValue<uint32_t>(m_data_chunk, table_offset);
+        META_CHECK_LESS_DESCR(vertex_field, magic_enum::enum_count<Mesh::VertexField>(), "mesh file has invalid vertex field");
+        m_vertex_layout.push_back(static_cast<Mesh::VertexField>(vertex_field));
+    }
+    META_CHECK_EQUAL_DESCR(m_vertex_size, Mesh::GetVertexSize(m_vertex_layout), "mesh file vertex size does not match vertex layout");
+
+    m_subsets.reserve(header.subsets_count);
+    for(uint32_t subset_index = 0U; subset_index < header.subsets_count; ++subset_index, table_offset += sizeof(MeshFileSubset))
+    {
+        const auto subset = ReadValue<MeshFileSubset>(m_data_chunk, table_offset);
+        META_CHECK_LESS_DESCR(subset.mesh_type, magic_enum::enum_count<Mesh::Type>(), "mesh file has invalid subset mesh type");
+        META_CHECK_LESS_OR_EQUAL_DESCR(uint64_t{ subset.vertex_offset } + subset.vertex_count, m_vertex_count,
+                                       "mesh file subset {} vertices are out of mesh vertices range", subset_index);
+        META_CHECK_LESS_OR_EQUAL_DESCR(uint64_t{ subset.index_offset } + subset.index_count, m_index_count,
+                                       "mesh file subset {} indices are out of mesh indices range", subset_index);
+        m_subsets.emplace_back(static_cast<Mesh::Type>(subset.mesh_type),
+                               Mesh::Subset::Slice(subset.vertex_offset, subset.vertex_count),
+                               Mesh::Subset::Slice(subset.index_offset, subset.index_count),
+                               subset.indices_adjusted != 0U);
+    }
+
+    META_CHECK_LESS_OR_EQUAL_DESCR(table_offset, m_vertex_data_offset, "mesh file vertex data overlaps mesh tables");
+    META_CHECK_LESS_OR_EQUAL_DESCR(m_vertex_data_offset + uint64_t{ m_vertex_count } * m_vertex_size, m_index_data_offset,
+                                   "mesh file index data overlaps vertex data");
+    META_CHECK_LESS_OR_EQUAL_DESCR(m_index_data_offset + uint64_t{ m_index_count } * header.index_size, header.data_size,
+                                   "mesh file index data is truncated");
+}
+
+Data::Size MeshFile::GetIndexSize() const noexcept
+{
+    return m_index_format == PixelFormat::R16Uint ? sizeof(uint16_t) : sizeof(uint32_t);
+}
+
+Mesh::Index MeshFile::GetIndex(Data::Index index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(index, m_index_count);
+    const uint64_t index_offset = m_index_data_offset + uint64_t{ index } * GetIndexSize();
+    return m_index_format == PixelFormat::R16Uint
+         ? ReadValue<uint16_t>(m_data_chunk, index_offset)
+         : ReadValue<uint32_t>(m_data_chunk, index_offset);
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,403 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshOptimizer.cpp
+Mesh index and vertex reordering for post-transform vertex cache,
+overdraw and vertex fetch efficiency.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include "MeshTopology.hpp"
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+// Forsyth vertex cache optimization parameters, see https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+static constexpr uint32_t g_forsyth_cache_size           = 32U;
+static constexpr uint32_t g_forsyth_max_valence          = 32U;
+static constexpr float    g_forsyth_cache_decay_power    = 1.5F;
+static constexpr float    g_forsyth_last_triangle_score  = 0.75F;
+static constexpr float    g_forsyth_valence_boost_scale  = 2.F;
+static constexpr float    g_forsyth_valence_boost_power  = 0.5F;
+static constexpr uint32_t g_invalid_triangle             = std::numeric_limits<uint32_t>::max();
+static constexpr Mesh::Index g_invalid_index             = std::numeric_limits<Mesh::Index>::max();
+
+namespace // anonymous
+{
+
+class FifoVertexCache
+{
+public:
+    FifoVertexCache(Data::Size vertex_count, uint32_t cache_size)
+        : m_cache_size(cache_size)
+        , m_timestamps(vertex_count, 0U)
+        , m_time(cache_size + 1U)
+    { }
+
+    // Returns true on cache miss, when vertex has to be transformed
+    bool Access(Mesh::Index vertex_index) noexcept
+    {
+        if (m_time - m_timestamps[vertex_index] <= m_cache_size)
+            return false;
+
+        m_timestamps[vertex_index] = m_time++;
+        return true;
+    }
+
+    uint32_t AccessTriangle(TriangleIndices triangle) noexcept
+    {
+        return static_cast<uint32_t>(Access(triangle[0])) +
+               static_cast<uint32_t>(Access(triangle[1])) +
+               static_cast<uint32_t>(Access(triangle[2]));
+    }
+
+    void Reset() noexcept { m_time += m_cache_size + 1U; }
+
+private:
+    const uint32_t        m_cache_size;
+    std::vector<uint32_t> m_timestamps;
+    uint32_t              m_time;
+};
+
+} // anonymous namespace
+
+static float GetForsythVertexScore(int32_t cache_position, uint32_t live_triangles_count)
+{
+    // Vertex without live triangles is not used anymore
+    if (!live_triangles_count)
+        return -1.F;
+
+    static const std::array<float, g_forsyth_cache_size> s_cache_position_scores = []()
+    {
+        std::array<float, g_forsyth_cache_size> scores{};
+        constexpr float scaler = 1.F / static_cast<float>(g_forsyth_cache_size - 3U);
+        for(uint32_t position = 0; position < g_forsyth_cache_size; ++position)
+        {
+            // Vertices of the last triangle get fixed score, so that the same triangle is not favored by the next choice
+            scores[position] = position < 3U
+                             ? g_forsyth_last_triangle_score
+                             : std::pow(1.F - static_cast<float>(position - 3U) * scaler, g_forsyth_cache_decay_power);
+        }
+        return scores;
+    }();
+
+    static const std::array<float, g_forsyth_max_valence> s_valence_scores = []()
+    {
+        std::array<float, g_forsyth_max_valence> scores{};
+        for(uint32_t valence = 1; valence < g_forsyth_max_valence; ++valence)
+        {
+            scores[valence] = g_forsyth_valence_boost_scale * std::pow(static_cast<float>(valence), -g_forsyth_valence_boost_power);
+        }
+        return scores;
+    }();
+
+    // Vertices with few live triangles are boosted to get rid of lone triangles left behind
+    const float valence_score = live_triangles_count < g_forsyth_max_valence
+                              ? s_valence_scores[live_triangles_count]
+                              : g_forsyth_valence_boost_scale * std::pow(static_cast<float>(live_triangles_count), -g_forsyth_valence_boost_power);
+    return cache_position >= 0
+         ? s_cache_position_scores[cache_position] + valence_score
+         : valence_score;
+}
+
+// Splits vertex cache optimized triangles into clusters and returns first triangle index of each cluster
+static std::vector<uint32_t> SplitTriangleClusters(std::span<const Mesh::Index> indices, Data::Size vertex_count, float threshold, uint32_t cache_size)
+{
+    META_FUNCTION_TASK();
+    const auto triangles_count = static_cast<uint32_t>(indices.size() / 3);
+    FifoVertexCache vertex_cache(vertex_count, cache_size);
+
+    // Hard cluster boundaries are placed where all triangle vertices miss the cache,
+    // so reordering of these clusters does not affect vertex cache efficiency
+    std::vector<uint32_t> hard_clusters{ 0U };
+    vertex_cache.AccessTriangle(GetTriangle(indices, 0U));
+    for(uint32_t triangle_index = 1U; triangle_index < triangles_count; ++triangle_index)
+    {
+        if (vertex_cache.AccessTriangle(GetTriangle(indices, triangle_index)) == 3U)
+            hard_clusters.push_back(triangle_index);
+    }
+
+    // Soft cluster boundaries are placed where ACMR of the cluster started with cold cache
+    // drops below ACMR of the whole hard cluster multiplied by threshold
+    std::vector<uint32_t> clusters;
+    clusters.reserve(hard_clusters.size());
+    for(size_t hard_cluster_index = 0; hard_cluster_index < hard_clusters.size(); ++hard_cluster_index)
+    {
+        const uint32_t begin_triangle = hard_clusters[hard_cluster_index];
+        const uint32_t end_triangle   = hard_cluster_index + 1 < hard_clusters.size() ? hard_clusters[hard_cluster_index + 1] : triangles_count;
+
+        vertex_cache.Reset();
+        uint32_t cluster_misses_count = 0U;
+        for(uint32_t triangle_index = begin_triangle; triangle_index < end_triangle; ++triangle_index)
+        {
+            cluster_misses_count += vertex_cache.AccessTriangle(GetTriangle(indices, triangle_index));
+        }
+
+        const float cluster_acmr_threshold = threshold * static_cast<float>(cluster_misses_count) / static_cast<float>(end_triangle - begin_triangle);
+
+        vertex_cache.Reset();
+        clusters.push_back(begin_triangle);
+        uint32_t running_misses_count    = 0U;
+        uint32_t running_triangles_count = 0U;
+        for(uint32_t triangle_index = begin_triangle; triangle_index < end_triangle; ++triangle_index)
+        {
+            running_misses_count += vertex_cache.AccessTriangle(GetTriangle(indices, triangle_index));
+            running_triangles_count++;
+
+            if (triangle_index + 1 < end_triangle &&
+                static_cast<float>(running_misses_count) <= cluster_acmr_threshold * static_cast<float>(running_triangles_count))
+            {
+                clusters.push_back(triangle_index + 1);
+                vertex_cache.Reset();
+                running_misses_count    = 0U;
+                running_triangles_count = 0U;
+            }
+        }
+    }
+    return clusters;
+}
+
+Mesh::VertexCacheStatistics AnalyzeVertexCache(std::span<const Mesh::Index> indices, Data::Size vertex_count, uint32_t cache_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(cache_size, "vertex cache size can not be zero");
+    CheckTriangleIndices(indices, vertex_count);
+
+    Mesh::VertexCacheStatistics statistics;
+    if (indices.empty())
+        return statistics;
+
+    FifoVertexCache vertex_cache(vertex_count, cache_size);
+    for(Mesh::Index vertex_index : indices)
+    {
+        statistics.transformed_vertices_count += static_cast<uint32_t>(vertex_cache.Access(vertex_index));
+    }
+
+    statistics.acmr = static_cast<float>(statistics.transformed_vertices_count) / static_cast<float>(indices.size() / 3);
+    statistics.atvr = static_cast<float>(statistics.transformed_vertices_count) / static_cast<float>(vertex_count);
+    return statistics;
+}
+
+void OptimizeVertexCache(std::span<Mesh::Index> indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    CheckTriangleIndices(indices, vertex_count);
+
+    const auto triangles_count = static_cast<uint32_t>(indices.size() / 3);
+    if (!triangles_count)
+        return;
+
+    const Mesh::Indices input_indices(indices.begin(), indices.end());
+    TriangleAdjacency   adjacency(input_indices, vertex_count);
+
+    std::vector<float> vertex_scores(vertex_count);
+    for(Mesh::Index vertex_index = 0; vertex_index < vertex_count; ++vertex_index)
+    {
+        vertex_scores[vertex_index] = GetForsythVertexScore(-1, adjacency.GetTrianglesCount(vertex_index));
+    }
+
+    std::vector<float> triangle_scores(triangles_count);
+    std::vector<bool>  triangles_emitted(triangles_count, false);
+    uint32_t best_triangle = 0U;
+    for(uint32_t triangle_index = 0U; triangle_index < triangles_count; ++triangle_index)
+    {
+        const TriangleIndices triangle = GetTriangle(input_indices, triangle_index);
+        triangle_scores[triangle_index] = vertex_scores[triangle[0]] + vertex_scores[triangle[1]] + vertex_scores[triangle[2]];
+        if (triangle_scores[triangle_index] > triangle_scores[best_triangle])
+            best_triangle = triangle_index;
+    }
+
+    // Simulated LRU cache is extended by three entries to hold vertices pushed out of cache by the emitted triangle
+    std::array<Mesh::Index, g_forsyth_cache_size + 3U> cache{};
+    std::array<Mesh::Index, g_forsyth_cache_size + 3U> new_cache{};
+    uint32_t cache_count  = 0U;
+    uint32_t input_cursor = 0U;
+
+    for(uint32_t output_triangle = 0U; output_triangle < triangles_count; ++output_triangle)
+    {
+        if (best_triangle == g_invalid_triangle)
+        {
+            // Cached vertices have no live triangles left, so optimization continues from the next triangle in input order
+            while (triangles_emitted[input_cursor])
+                input_cursor++;
+
+            best_triangle = input_cursor;
+        }
+
+        const TriangleIndices triangle = GetTriangle(input_indices, best_triangle);
+        std::ranges::copy(triangle, indices.begin() + output_triangle * 3);
+        triangles_emitted[best_triangle] = true;
+
+        uint32_t new_cache_count = 0U;
+        for(Mesh::Index vertex_index : triangle)
+        {
+            if (std::find(new_cache.begin(), new_cache.begin() + new_cache_count, vertex_index) == new_cache.begin() + new_cache_count)
+                new_cache[new_cache_count++] = vertex_index;
+
+            adjacency.RemoveTriangle(vertex_index, best_triangle);
+        }
+        for(uint32_t cache_index = 0U; cache_index < cache_count; ++cache_index)
+        {
+            if (std::ranges::find(triangle, cache[cache_index]) == triangle.end())
+                new_cache[new_cache_count++] = cache[cache_index];
+        }
+
+        // Update scores of the cached vertices and vertices pushed out of cache with their live triangles
+        for(uint32_t cache_index = 0U; cache_index < new_cache_count; ++cache_index)
+        {
+            const Mesh::Index vertex_index   = new_cache[cache_index];
+            const int32_t     cache_position = cache_index < g_forsyth_cache_size ? static_cast<int32_t>(cache_index) : -1;
+            const float       vertex_score   = GetForsythVertexScore(cache_position, adjacency.GetTrianglesCount(vertex_index));
+            const float       score_delta    = vertex_score - vertex_scores[vertex_index];
+            vertex_scores[vertex_index] = vertex_score;
+
+            for(uint32_t triangle_index : adjacency.GetTriangles(vertex_index))
+            {
+                triangle_scores[triangle_index] += score_delta;
+            }
+        }
+
+        // Next triangle is selected among live triangles of the cached vertices only to keep linear complexity
+        cache_count   = std::min(new_cache_count, g_forsyth_cache_size);
+        best_triangle = g_invalid_triangle;
+        float best_triangle_score = 0.F;
+        for(uint32_t cache_index = 0U; cache_index < cache_count; ++cache_index)
+        {
+            for(uint32_t triangle_index : adjacency.GetTriangles(new_cache[cache_index]))
+            {
+                if (triangle_scores[triangle_index] > best_triangle_score)
+                {
+                    best_triangle       = triangle_index;
+                    best_triangle_score = triangle_scores[triangle_index];
+                }
+            }
+        }
+        std::swap(cache, new_cache);
+    }
+}
+
+void OptimizeOverdraw(std::span<Mesh::Index> indices, std::span<const Mesh::Position> positions, float threshold, uint32_t cache_size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_OR_EQUAL_DESCR(threshold, 1.F, "overdraw optimization threshold should not be less than one");
+    META_CHECK_NOT_ZERO_DESCR(cache_size, "vertex cache size can not be zero");
+    const auto vertex_count = static_cast<Data::Size>(positions.size());
+    CheckTriangleIndices(indices, vertex_count);
+    if (indices.empty())
+        return;
+
+    const Mesh::Indices         input_indices(indices.begin(), indices.end());
+    const std::vector<uint32_t> clusters = SplitTriangleClusters(input_indices, vertex_count, threshold, cache_size);
+    const auto                  triangles_count = static_cast<uint32_t>(input_indices.size() / 3);
+
+    hlslpp::float3 mesh_center(0.F, 0.F, 0.F);
+    for(const Mesh::Position& position : positions)
+    {
+        mesh_center += position.AsHlsl();
+    }
+    mesh_center = mesh_center / static_cast<float>(vertex_count);
+
+    // Clusters are sorted by distance from mesh center along cluster normal, so that outer clusters facing outside are drawn first
+    struct ClusterOrder
+    {
+        uint32_t cluster_index;
+        float    sort_key;
+    };
+
+    std::vector<ClusterOrder> cluster_orders;
+    cluster_orders.reserve(clusters.size());
+    for(uint32_t cluster_index = 0U; cluster_index < clusters.size(); ++cluster_index)
+    {
+        const uint32_t begin_triangle = clusters[cluster_index];
+        const uint32_t end_triangle   = cluster_index + 1 < clusters.size() ? clusters[cluster_index + 1] : triangles_count;
+
+        hlslpp::float3 cluster_centroid(0.F, 0.F, 0.F);
+        hlslpp::float3 cluster_normal(0.F, 0.F, 0.F);
+        float          cluster_area = 0.F;
+        for(uint32_t triangle_index = begin_triangle; triangle_index < end_triangle; ++triangle_index)
+        {
+            const TriangleIndices triangle = GetTriangle(input_indices, triangle_index);
+            const hlslpp::float3  p1 = positions[triangle[0]].AsHlsl();
+            const hlslpp::float3  p2 = positions[triangle[1]].AsHlsl();
+            const hlslpp::float3  p3 = positions[triangle[2]].AsHlsl();
+            const hlslpp::float3  n  = hlslpp::cross(p2 - p1, p3 - p1);
+            const auto            area = static_cast<float>(hlslpp::length(n));
+
+            cluster_centroid += (p1 + p2 + p3) * (area / 3.F);
+            cluster_normal   += n;
+            cluster_area     += area;
+        }
+
+        const float cluster_normal_length = static_cast<float>(hlslpp::length(cluster_normal));
+        const float sort_key = cluster_area > 0.F && cluster_normal_length > 0.F
+                             ? static_cast<float>(hlslpp::dot(cluster_centroid / cluster_area - mesh_center, cluster_normal / cluster_normal_length))
+                             : 0.F;
+        cluster_orders.push_back({ cluster_index, sort_key });
+    }
+
+    std::ranges::stable_sort(cluster_orders, [](const ClusterOrder& left, const ClusterOrder& right)
+    {
+        return left.sort_key > right.sort_key;
+    });
+
+    auto output_it = indices.begin();
+    for(const ClusterOrder& cluster_order : cluster_orders)
+    {
+        const uint32_t begin_triangle = clusters[cluster_order.cluster_index];
+        const uint32_t end_triangle   = cluster_order.cluster_index + 1 < clusters.size() ? clusters[cluster_order.cluster_index + 1] : triangles_count;
+        output_it = std::copy(input_indices.begin() + begin_triangle * 3, input_indices.begin() + end_triangle * 3, output_it);
+    }
+}
+
+Mesh::Indices OptimizeVertexFetch(std::span<Mesh::Index> indices, Data::Size vertex_count)
+{
+    META_FUNCTION_TASK();
+    if (!indices.empty())
+    {
+        META_CHECK_LESS_DESCR(std::ranges::max(indices), vertex_count, "mesh indices are out of vertex buffer bounds");
+    }
+
+    Mesh::Indices vertex_remap(vertex_count, g_invalid_index);
+    Mesh::Index   next_vertex_index = 0U;
+    for(Mesh::Index& vertex_index : indices)
+    {
+        Mesh::Index& new_vertex_index = vertex_remap[vertex_index];
+        if (new_vertex_index == g_invalid_index)
+            new_vertex_index = next_vertex_index++;
+
+        vertex_index = new_vertex_index;
+    }
+
+    for(Mesh::Index& new_vertex_index : vertex_remap)
+    {
+        if (new_vertex_index == g_invalid_index)
+            new_vertex_index = next_vertex_index++;
+    }
+    return vertex_remap;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,405 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshSimplifier.cpp
+Mesh simplification with quadric error metrics for levels of detail generation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshSimplifier.h>
+#include "MeshTopology.hpp"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+// Collapse is rejected when it turns any of the remaining triangles by more than ~75 degrees or makes it degenerate
+static constexpr float g_min_collapsed_normal_cos = 0.25F;
+
+namespace // anonymous
+{
+
+using HlslPosition = Mesh::Position::HlslVectorType;
+
+// Area weighted sum of squared distances to triangle planes: Q(p) = p * A * p + 2 * b * p + c,
+// where symmetric matrix A is stored with 6 coefficients
+class Quadric
+{
+public:
+    Quadric() = default;
+    Quadric(const Mesh::Normal& normal, float distance, float weight) noexcept
+        : m_a00(weight * normal.GetX() * normal.GetX())
+        , m_a01(weight * normal.GetX() * normal.GetY())
+        , m_a02(weight * normal.GetX() * normal.GetZ())
+        , m_a11(weight * normal.GetY() * normal.GetY())
+        , m_a12(weight * normal.GetY() * normal.GetZ())
+        , m_a22(weight * normal.GetZ() * normal.GetZ())
+        , m_b0(weight * distance * normal.GetX())
+        , m_b1(weight * distance * normal.GetY())
+        , m_b2(weight * distance * normal.GetZ())
+        , m_c(weight * distance * distance)
+        , m_weight(weight)
+    { }
+
+    Quadric& operator+=(const Quadric& other) noexcept
+    {
+        m_a00 += other.m_a00; m_a01 += other.m_a01; m_a02 += other.m_a02;
+        m_a11 += other.m_a11; m_a12 += other.m_a12; m_a22 += other.m_a22;
+        m_b0  += other.m_b0;  m_b1  += other.m_b1;  m_b2  += other.m_b2;
+        m_c   += other.m_c;
+        m_weight += other.m_weight;
+        return *this;
+    }
+
+    [[nodiscard]] friend Quadric operator+(Quadric left, const Quadric& right) noexcept { return left += right; }
+
+    // Returns squared distance to the planes averaged by their weights
+    [[nodiscard]] float GetError(const Mesh::Position& p) const noexcept
+    {
+        if (m_weight <= 0.F)
+            return 0.F;
+
+        const float x = p.GetX();
+        const float y = p.GetY();
+        const float z = p.GetZ();
+        const float error = x * (m_a00 * x + 2.F * (m_a01 * y + m_a02 * z + m_b0))
+                          + y * (m_a11 * y + 2.F * (m_a12 * z + m_b1))
+                          + z * (m_a22 * z + 2.F * m_b2)
+                          + m_c;
+        return std::max(error, 0.F) / m_weight;
+    }
+
+private:
+    float m_a00 = 0.F;
+    float m_a01 = 0.F;
+    float m_a02 = 0.F;
+    float m_a11 = 0.F;
+    float m_a12 = 0.F;
+    float m_a22 = 0.F;
+    float m_b0  = 0.F;
+    float m_b1  = 0.F;
+    float m_b2  = 0.F;
+    float m_c   = 0.F;
+    float m_weight = 0.F;
+};
+
+struct Collapse
+{
+    Mesh::Index source;
+    Mesh::Index target;
+    float       error; // squared geometric error
+
+    [[nodiscard]] friend bool operator<(const Collapse& left, const Collapse& right) noexcept
+    {
+        return std::tie(left.error, left.source, left.target) < std::tie(right.error, right.source, right.target);
+    }
+};
+
+class MeshSimplifier
+{
+public:
+    MeshSimplifier(std::span<const Mesh::Index> indices, std::span<const Mesh::Position> positions)
+        : m_positions(positions)
+        , m_vertex_count(static_cast<Data::Size>(positions.size()))
+        , m_vertex_locked(positions.size(), false)
+        , m_vertex_touched(positions.size(), false)
+        , m_vertex_remap(positions.size(), 0U)
+        , m_vertex_quadrics(positions.size())
+    {
+        META_FUNCTION_TASK();
+        m_indices.reserve(indices.size());
+        for(size_t triangle_index = 0; triangle_index < indices.size() / 3; ++triangle_index)
+        {
+            if (const TriangleIndices triangle = GetTriangle(indices, triangle_index);
+                !IsDegenerateTriangle(triangle))
+                m_indices.insert(m_indices.end(), triangle.begin(), triangle.end());
+        }
+
+        std::iota(m_vertex_remap.begin(), m_vertex_remap.end(), 0U);
+        LockSeamVertices();
+        LockBorderVertices();
+        ComputeVertexQuadrics();
+    }
+
+    [[nodiscard]] const Mesh::Indices& GetIndices() const noexcept    { return m_indices; }
+    [[nodiscard]] Data::Size           GetIndexCount() const noexcept { return static_cast<Data::Size>(m_indices.size()); }
+    [[nodiscard]] float                GetError() const noexcept      { return std::sqrt(m_max_error_sq); }
+
+    // Returns false when mesh can not be simplified to the target index count within max error
+    bool Simplify(Data::Size target_index_count, float max_error)
+    {
+        META_FUNCTION_TASK();
+        while (m_indices.size() > target_index_count)
+        {
+            if (!CollapseEdges(target_index_count, max_error * max_error))
+                return false;
+        }
+        return true;
+    }
+
+private:
+    [[nodiscard]] static bool IsDegenerateTriangle(TriangleIndices triangle) noexcept
+    {
+        return triangle[0] == triangle[1] || triangle[1] == triangle[2] || triangle[2] == triangle[0];
+    }
+
+    // Vertices sharing position with other vertices are placed on attribute seams and are locked to preserve the seams
+    void LockSeamVertices()
+    {
+        META_FUNCTION_TASK();
+        std::vector<Mesh::Index> sorted_vertices(m_vertex_count);
+        std::iota(sorted_vertices.begin(), sorted_vertices.end(), 0U);
+        std::ranges::sort(sorted_vertices, [this](Mesh::Index left, Mesh::Index right)
+        {
+            const Mesh::Position& left_position  = m_positions[left];
+            const Mesh::Position& right_position = m_positions[right];
+            return std::make_tuple(left_position.GetX(), left_position.GetY(), left_position.GetZ(), left)
+                 < std::make_tuple(right_position.GetX(), right_position.GetY(), right_position.GetZ(), right);
+        });
+
+        for(size_t sorted_index = 1; sorted_index < sorted_vertices.size(); ++sorted_index)
+        {
+            const Mesh::Index prev_vertex_index = sorted_vertices[sorted_index - 1];
+            const Mesh::Index vertex_index      = sorted_vertices[sorted_index];
+            if (m_positions[prev_vertex_index] != m_positions[vertex_index])
+                continue;
+
+            m_vertex_locked[prev_vertex_index] = true;
+            m_vertex_locked[vertex_index]      = true;
+        }
+    }
+
+    // Vertices of edges without opposite half-edge are placed on the open mesh border and are locked to preserve the border
+    void LockBorderVertices()
+    {
+        META_FUNCTION_TASK();
+        const auto get_half_edge_key = [](Mesh::Index from_index, Mesh::Index to_index)
+        {
+            return (static_cast<uint64_t>(from_index) << 32U) | to_index;
+        };
+
+        std::vector<uint64_t> half_edges;
+        half_edges.reserve(m_indices.size());
+        for(size_t index = 0; index < m_indices.size(); ++index)
+        {
+            half_edges.push_back(get_half_edge_key(m_indices[index], m_indices[index % 3 == 2 ? index - 2 : index + 1]));
+        }
+        std::ranges::sort(half_edges);
+
+        for(size_t index = 0; index < m_indices.size(); ++index)
+        {
+            const Mesh::Index from_index = m_indices[index];
+            const Mesh::Index to_index   = m_indices[index % 3 == 2 ? index - 2 : index + 1];
+            if (std::ranges::binary_search(half_edges, get_half_edge_key(to_index, from_index)))
+                continue;
+
+            m_vertex_locked[from_index] = true;
+            m_vertex_locked[to_index]   = true;
+        }
+    }
+
+    void ComputeVertexQuadrics()
+    {
+        META_FUNCTION_TASK();
+        for(size_t triangle_index = 0; triangle_index < m_indices.size() / 3; ++triangle_index)
+        {
+            const TriangleIndices triangle = GetTriangle(m_indices, triangle_index);
+            const HlslPosition    p1 = m_positions[triangle[0]].AsHlsl();
+            const HlslPosition    p2 = m_positions[triangle[1]].AsHlsl();
+            const HlslPosition    p3 = m_positions[triangle[2]].AsHlsl();
+            const HlslPosition    n  = hlslpp::cross(p2 - p1, p3 - p1);
+            const auto            n_length = static_cast<float>(hlslpp::length(n));
+            if (n_length <= 0.F)
+                continue;
+
+            const HlslPosition normal = n / n_length;
+            const Quadric      quadric(Mesh::Normal(normal), -static_cast<float>(hlslpp::dot(normal, p1)), n_length / 2.F);
+            for(Mesh::Index vertex_index : triangle)
+            {
+                m_vertex_quadrics[vertex_index] += quadric;
+            }
+        }
+    }
+
+    void AddCollapse(std::vector<Collapse>& collapses, Mesh::Index source, Mesh::Index target) const
+    {
+        if (m_vertex_locked[source])
+            return;
+
+        const Quadric quadric = m_vertex_quadrics[source] + m_vertex_quadrics[target];
+        collapses.push_back({ source, target, quadric.GetError(m_positions[target]) });
+    }
+
+    [[nodiscard]] bool IsCollapseFlippingTriangles(const Collapse& collapse, const TriangleAdjacency& adjacency) const
+    {
+        const HlslPosition target_position = m_positions[collapse.target].AsHlsl();
+        for(uint32_t triangle_index : adjacency.GetTriangles(collapse.source))
+        {
+            const TriangleIndices triangle = GetTriangle(m_indices, triangle_index);
+            if (std::ranges::find(triangle, collapse.target) != triangle.end())
+                continue; // triangle is removed by collapse
+
+            const size_t       source_corner = std::distance(triangle.begin(), std::ranges::find(triangle, collapse.source));
+            const HlslPosition p0 = m_positions[collapse.source].AsHlsl();
+            const HlslPosition p1 = m_positions[triangle[(source_corner + 1) % 3]].AsHlsl();
+            const HlslPosition p2 = m_positions[triangle[(source_corner + 2) % 3]].AsHlsl();
+            const HlslPosition normal_before = hlslpp::cross(p1 - p0, p2 - p0);
+            const HlslPosition normal_after  = hlslpp::cross(p1 - target_position, p2 - target_position);
+            const auto         normals_dot   = static_cast<float>(hlslpp::dot(normal_before, normal_after));
+            const auto         normals_scale = static_cast<float>(hlslpp::length(normal_before) * hlslpp::length(normal_after));
+            if (normals_dot <= g_min_collapsed_normal_cos * normals_scale)
+                return true;
+        }
+        return false;
+    }
+
+    // Collapses independent edges in order of increasing error, so that each collapse changes triangles
+    // not affected by other collapses in the same pass; returns false when no edges were collapsed
+    bool CollapseEdges(Data::Size target_index_count, float max_error_sq)
+    {
+        META_FUNCTION_TASK();
+        const TriangleAdjacency adjacency(m_indices, m_vertex_count);
+
+        std::vector<Collapse> collapses;
+        collapses.reserve(m_indices.size() * 2);
+        for(size_t index = 0; index < m_indices.size(); ++index)
+        {
+            const Mesh::Index from_index = m_indices[index];
+            const Mesh::Index to_index   = m_indices[index % 3 == 2 ? index - 2 : index + 1];
+            AddCollapse(collapses, from_index, to_index);
+            AddCollapse(collapses, to_index, from_index);
+        }
+        std::sort(collapses.begin(), collapses.end());
+
+        std::fill(m_vertex_touched.begin(), m_vertex_touched.end(), false);
+        Data::Size index_count       = GetIndexCount();
+        uint32_t   collapses_count   = 0U;
+        for(const Collapse& collapse : collapses)
+        {
+            if (index_count <= target_index_count || collapse.error > max_error_sq)
+                break;
+
+            if (m_vertex_touched[collapse.source] || m_vertex_touched[collapse.target] ||
+                IsCollapseFlippingTriangles(collapse, adjacency))
+                continue;
+
+            for(uint32_t triangle_index : adjacency.GetTriangles(collapse.source))
+            {
+                const TriangleIndices triangle = GetTriangle(m_indices, triangle_index);
+                if (std::ranges::find(triangle, collapse.target) != triangle.end())
+                    index_count -= 3;
+
+                for(Mesh::Index vertex_index : triangle)
+                {
+                    m_vertex_touched[vertex_index] = true;
+                }
+            }
+
+            m_vertex_remap[collapse.source] = collapse.target;
+            m_vertex_quadrics[collapse.target] += m_vertex_quadrics[collapse.source];
+            m_max_error_sq = std::max(m_max_error_sq, collapse.error);
+            collapses_count++;
+        }
+
+        if (!collapses_count)
+            return false;
+
+        Mesh::Indices simplified_indices;
+        simplified_indices.reserve(index_count);
+        for(size_t triangle_index = 0; triangle_index < m_indices.size() / 3; ++triangle_index)
+        {
+            const TriangleIndices triangle = GetTriangle(m_indices, triangle_index);
+            const std::array<Mesh::Index, 3> remapped_triangle{
+                m_vertex_remap[triangle[0]],
+                m_vertex_remap[triangle[1]],
+                m_vertex_remap[triangle[2]]
+            };
+            if (!IsDegenerateTriangle(remapped_triangle))
+                simplified_indices.insert(simplified_indices.end(), remapped_triangle.begin(), remapped_triangle.end());
+        }
+        m_indices.swap(simplified_indices);
+        return true;
+    }
+
+    const std::span<const Mesh::Position> m_positions;
+    const Data::Size                      m_vertex_count;
+    Mesh::Indices                         m_indices;
+    std::vector<bool>                     m_vertex_locked;
+    std::vector<bool>                     m_vertex_touched;
+    Mesh::Indices                         m_vertex_remap;
+    std::vector<Quadric>                  m_vertex_quadrics;
+    float                                 m_max_error_sq = 0.F;
+};
+
+float GetPositionsExtent(std::span<const Mesh::Position> positions)
+{
+    META_FUNCTION_TASK();
+    if (positions.empty())
+        return 0.F;
+
+    HlslPosition min_position = positions.front().AsHlsl();
+    HlslPosition max_position = min_position;
+    for(const Mesh::Position& position : positions)
+    {
+        min_position = hlslpp::min(min_position, position.AsHlsl());
+        max_position = hlslpp::max(max_position, position.AsHlsl());
+    }
+
+    const Mesh::Position extent(max_position - min_position);
+    return std::max({ extent.GetX(), extent.GetY(), extent.GetZ() });
+}
+
+} // anonymous namespace
+
+Mesh::Lods BuildMeshLods(const Mesh::LodSettings& settings, std::span<const Mesh::Index> indices,
+                         std::span<const Mesh::Position> positions)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_RANGE_DESCR(settings.index_count_ratio, 0.F, 1.F, "LOD index count ratio should be less than one to simplify mesh");
+    META_CHECK_GREATER_OR_EQUAL_DESCR(settings.max_relative_error, 0.F, "LOD max error can not be negative");
+    CheckTriangleIndices(indices, static_cast<Data::Size>(positions.size()));
+
+    Mesh::Lods lods;
+    if (indices.empty())
+        return lods;
+
+    const float    max_error = settings.max_relative_error * GetPositionsExtent(positions);
+    MeshSimplifier simplifier(indices, positions);
+    auto           lod_index_count = static_cast<Data::Size>(indices.size());
+    for(uint32_t lod_index = 0; lod_index < settings.max_lods_count; ++lod_index)
+    {
+        const auto target_index_count = static_cast<Data::Size>(static_cast<float>(lod_index_count) * settings.index_count_ratio) / 3U * 3U;
+        if (!simplifier.Simplify(target_index_count, max_error))
+            break;
+
+        lods.push_back({ simplifier.GetIndices(), simplifier.GetError() });
+        lod_index_count = simplifier.GetIndexCount();
+    }
+    return lods;
+}
+
+} // namespace Methane::Graphics
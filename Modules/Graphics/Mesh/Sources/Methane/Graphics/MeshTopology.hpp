@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MeshTopology.hpp
+Triangle list topology helpers shared by mesh optimization and clustering.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Mesh.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <span>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+using TriangleIndices = std::span<const Mesh::Index, 3>;
+
+inline TriangleIndices GetTriangle(std::span<const Mesh::Index> indices, size_t triangle_index)
+{
+    return indices.subspan(triangle_index * 3, 3).first<3>();
+}
+
+inline void CheckTriangleIndices(std::span<const Mesh::Index> indices, Data::Size vertex_count)
+{
+    META_CHECK_DESCR(indices.size(), indices.size() % 3 == 0, "mesh indices count should be a multiple of three representing triangles list");
+    if (!indices.empty())
+    {
+        META_CHECK_LESS_DESCR(std::ranges::max(indices), vertex_count, "mesh indices are out of vertex buffer bounds");
+    }
+}
+
+// Live triangles adjacent to each vertex stored in one list grouped by vertex
+class TriangleAdjacency
+{
+public:
+    TriangleAdjacency(std::span<const Mesh::Index> indices, Data::Size vertex_count)
+        : m_counts(vertex_count, 0U)
+        , m_offsets(vertex_count, 0U)
+        , m_triangles(indices.size(), 0U)
+    {
+        META_FUNCTION_TASK();
+        for(Mesh::Index vertex_index : indices)
+        {
+            m_counts[vertex_index]++;
+        }
+
+        std::exclusive_scan(m_counts.begin(), m_counts.end(), m_offsets.begin(), 0U);
+
+        std::vector<uint32_t> fill_offsets = m_offsets;
+        for(size_t i = 0; i < indices.size(); ++i)
+        {
+            m_triangles[fill_offsets[indices[i]]++] = static_cast<uint32_t>(i / 3);
+        }
+    }
+
+    [[nodiscard]] uint32_t GetTrianglesCount(Mesh::Index vertex_index) const noexcept
+    {
+        return m_counts[vertex_index];
+    }
+
+    [[nodiscard]] std::span<const uint32_t> GetTriangles(Mesh::Index vertex_index) const noexcept
+    {
+        return std::span<const uint32_t>(m_triangles).subspan(m_offsets[vertex_index], m_counts[vertex_index]);
+    }
+
+    // Removed triangle is swapped to the end of vertex triangles list, which is shrunk to keep live triangles only
+    void RemoveTriangle(Mesh::Index vertex_index, uint32_t triangle_index)
+    {
+        const auto vertex_triangles_begin_it = m_triangles.begin() + m_offsets[vertex_index];
+        const auto vertex_triangles_end_it   = vertex_triangles_begin_it + m_counts[vertex_index];
+        const auto triangle_it = std::find(vertex_triangles_begin_it, vertex_triangles_end_it, triangle_index);
+        META_CHECK_TRUE_DESCR(triangle_it != vertex_triangles_end_it, "triangle is not found in vertex adjacency list");
+        std::iter_swap(triangle_it, std::prev(vertex_triangles_end_it));
+        m_counts[vertex_index]--;
+    }
+
+private:
+    std::vector<uint32_t> m_counts;
+    std::vector<uint32_t> m_offsets;
+    std::vector<uint32_t> m_triangles;
+};
+
+} // namespace Methane::Graphics
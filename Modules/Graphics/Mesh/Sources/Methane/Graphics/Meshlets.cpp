@@ -0,0 +1,319 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Meshlets.cpp
+Mesh partitioning into small triangle clusters (meshlets) with local index buffers,
+bounding spheres and normal cones for per-cluster culling.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include "MeshTopology.hpp"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+namespace Methane::Graphics
+{
+
+static constexpr uint32_t g_max_local_vertices_count = std::numeric_limits<uint8_t>::max() + 1U;
+static constexpr uint32_t g_invalid_local_index      = std::numeric_limits<uint32_t>::max();
+static constexpr uint32_t g_invalid_triangle         = std::numeric_limits<uint32_t>::max();
+
+// Normal cone is not built when triangle normals spread over more than ~84 degrees from the cone axis
+static constexpr float g_min_cone_axis_dot = 0.1F;
+
+namespace // anonymous
+{
+
+class MeshletBuilder
+{
+public:
+    MeshletBuilder(const MeshletSettings& settings, std::span<const Mesh::Index> indices, std::span<const Mesh::Position> positions,
+                   Meshlets& meshlets, Mesh::Index base_vertex_index, uint32_t subset_index)
+        : m_settings(settings)
+        , m_indices(indices)
+        , m_positions(positions)
+        , m_meshlets(meshlets)
+        , m_base_vertex_index(base_vertex_index)
+        , m_subset_index(subset_index)
+        , m_adjacency(indices, static_cast<Data::Size>(positions.size() - base_vertex_index))
+        , m_triangles_used(indices.size() / 3, false)
+        , m_local_vertex_indices(positions.size() - base_vertex_index, g_invalid_local_index)
+    {
+        ResetMeshlet();
+    }
+
+    void Build()
+    {
+        META_FUNCTION_TASK();
+        const auto triangles_count = static_cast<uint32_t>(m_indices.size() / 3);
+        for(uint32_t added_triangles_count = 0U; added_triangles_count < triangles_count; ++added_triangles_count)
+        {
+            // Triangle adjacent to the meshlet is preferred to keep meshlet compact,
+            // otherwise next unused triangle in input order is taken, which is usually spatially close for optimized meshes
+            uint32_t triangle_index = FindAdjacentTriangle();
+            if (triangle_index == g_invalid_triangle)
+            {
+                while (m_triangles_used[m_input_cursor])
+                    m_input_cursor++;
+
+                triangle_index = m_input_cursor;
+            }
+
+            // Triangle which does not fit into the current meshlet starts the next one
+            if (!CanAddTriangle(triangle_index))
+                FlushMeshlet();
+
+            AddTriangle(triangle_index);
+        }
+        FlushMeshlet();
+    }
+
+private:
+    [[nodiscard]] uint32_t GetNewVerticesCount(TriangleIndices triangle) const noexcept
+    {
+        uint32_t new_vertices_count = 0U;
+        for(size_t i = 0; i < triangle.size(); ++i)
+        {
+            const bool is_duplicate = std::find(triangle.begin(), triangle.begin() + i, triangle[i]) != triangle.begin() + i;
+            if (!is_duplicate && m_local_vertex_indices[triangle[i]] == g_invalid_local_index)
+                new_vertices_count++;
+        }
+        return new_vertices_count;
+    }
+
+    [[nodiscard]] bool CanAddTriangle(uint32_t triangle_index) const noexcept
+    {
+        return m_meshlet.triangles_count < m_settings.max_triangles_count &&
+               m_meshlet.vertices_count + GetNewVerticesCount(GetTriangle(m_indices, triangle_index)) <= m_settings.max_vertices_count;
+    }
+
+    [[nodiscard]] uint32_t FindAdjacentTriangle() const noexcept
+    {
+        uint32_t best_triangle_index = g_invalid_triangle;
+        uint32_t best_new_vertices_count = std::numeric_limits<uint32_t>::max();
+        for(uint32_t vertex_index = 0U; vertex_index < m_meshlet.vertices_count; ++vertex_index)
+        {
+            const Mesh::Index mesh_vertex_index = m_meshlets.vertex_indices[m_meshlet.vertex_offset + vertex_index] - m_base_vertex_index;
+            for(uint32_t triangle_index : m_adjacency.GetTriangles(mesh_vertex_index))
+            {
+                // Triangle adding less new vertices to meshlet is preferred to maximize vertex reuse
+                const uint32_t new_vertices_count = GetNewVerticesCount(GetTriangle(m_indices, triangle_index));
+                if (new_vertices_count < best_new_vertices_count ||
+                    (new_vertices_count == best_new_vertices_count && triangle_index < best_triangle_index))
+                {
+                    best_triangle_index     = triangle_index;
+                    best_new_vertices_count = new_vertices_count;
+                }
+            }
+        }
+        return best_triangle_index;
+    }
+
+    void AddTriangle(uint32_t triangle_index)
+    {
+        for(Mesh::Index vertex_index : GetTriangle(m_indices, triangle_index))
+        {
+            uint32_t& local_vertex_index = m_local_vertex_indices[vertex_index];
+            if (local_vertex_index == g_invalid_local_index)
+            {
+                local_vertex_index = m_meshlet.vertices_count++;
+                m_meshlets.vertex_indices.push_back(vertex_index + m_base_vertex_index);
+            }
+            m_meshlets.local_indices.push_back(static_cast<uint8_t>(local_vertex_index));
+            m_adjacency.RemoveTriangle(vertex_index, triangle_index);
+        }
+        m_meshlet.triangles_count++;
+        m_triangles_used[triangle_index] = true;
+    }
+
+    void FlushMeshlet()
+    {
+        if (!m_meshlet.triangles_count)
+            return;
+
+        for(uint32_t vertex_index = 0U; vertex_index < m_meshlet.vertices_count; ++vertex_index)
+        {
+            const Mesh::Index mesh_vertex_index = m_meshlets.vertex_indices[m_meshlet.vertex_offset + vertex_index] - m_base_vertex_index;
+            m_local_vertex_indices[mesh_vertex_index] = g_invalid_local_index;
+        }
+
+        m_meshlets.meshlets.push_back(m_meshlet);
+        m_meshlets.bounds.push_back(ComputeMeshletBounds(m_meshlets, m_meshlet, m_positions));
+        ResetMeshlet();
+    }
+
+    void ResetMeshlet() noexcept
+    {
+        m_meshlet = Meshlet{
+            .subset_index       = m_subset_index,
+            .vertex_offset      = static_cast<uint32_t>(m_meshlets.vertex_indices.size()),
+            .vertices_count     = 0U,
+            .local_index_offset = static_cast<uint32_t>(m_meshlets.local_indices.size()),
+            .triangles_count    = 0U
+        };
+    }
+
+    const MeshletSettings&                m_settings;
+    const std::span<const Mesh::Index>    m_indices;
+    const std::span<const Mesh::Position> m_positions;
+    Meshlets&                             m_meshlets;
+    const Mesh::Index                     m_base_vertex_index;
+    const uint32_t                        m_subset_index;
+    TriangleAdjacency                     m_adjacency;
+    std::vector<bool>                     m_triangles_used;
+    std::vector<uint32_t>                 m_local_vertex_indices;
+    Meshlet                               m_meshlet;
+    uint32_t                              m_input_cursor = 0U;
+};
+
+} // anonymous namespace
+
+void BuildMeshlets(const MeshletSettings& settings, std::span<const Mesh::Index> indices, std::span<const Mesh::Position> positions,
+                   Meshlets& meshlets, Mesh::Index base_vertex_index, uint32_t subset_index)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_RANGE_INC_DESCR(settings.max_vertices_count, 3U, g_max_local_vertices_count,
+                               "meshlet vertices count should allow at least one triangle and fit into 8-bit local indices");
+    META_CHECK_NOT_ZERO_DESCR(settings.max_triangles_count, "meshlet triangles count can not be zero");
+    META_CHECK_LESS_OR_EQUAL_DESCR(base_vertex_index, positions.size(), "base vertex index is out of mesh vertices bounds");
+    CheckTriangleIndices(indices, static_cast<Data::Size>(positions.size() - base_vertex_index));
+    if (indices.empty())
+        return;
+
+    MeshletBuilder(settings, indices, positions, meshlets, base_vertex_index, subset_index).Build();
+}
+
+MeshletBounds ComputeMeshletBounds(const Meshlets& meshlets, const Meshlet& meshlet, std::span<const Mesh::Position> positions)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(meshlet.vertices_count, "meshlet should not be empty");
+    const std::span<const Mesh::Index> vertex_indices = std::span(meshlets.vertex_indices).subspan(meshlet.vertex_offset, meshlet.vertices_count);
+    const std::span<const uint8_t>     local_indices  = std::span(meshlets.local_indices).subspan(meshlet.local_index_offset, meshlet.triangles_count * 3);
+
+    // Ritter bounding sphere is initialized with the most distant pair of points extreme along coordinate axes
+    std::array<Mesh::Index, 3> min_vertex_indices{};
+    std::array<Mesh::Index, 3> max_vertex_indices{};
+    min_vertex_indices.fill(vertex_indices.front());
+    max_vertex_indices.fill(vertex_indices.front());
+    for(Mesh::Index vertex_index : vertex_indices)
+    {
+        const Mesh::Position& position = positions[vertex_index];
+        for(size_t axis = 0; axis < 3; ++axis)
+        {
+            if (position[axis] < positions[min_vertex_indices[axis]][axis])
+                min_vertex_indices[axis] = vertex_index;
+            if (position[axis] > positions[max_vertex_indices[axis]][axis])
+                max_vertex_indices[axis] = vertex_index;
+        }
+    }
+
+    hlslpp::float3 center(0.F, 0.F, 0.F);
+    float          radius = -1.F;
+    for(size_t axis = 0; axis < 3; ++axis)
+    {
+        const hlslpp::float3 min_position = positions[min_vertex_indices[axis]].AsHlsl();
+        const hlslpp::float3 max_position = positions[max_vertex_indices[axis]].AsHlsl();
+        const auto           half_span    = static_cast<float>(hlslpp::length(max_position - min_position)) / 2.F;
+        if (half_span > radius)
+        {
+            center = (min_position + max_position) / 2.F;
+            radius = half_span;
+        }
+    }
+
+    for(Mesh::Index vertex_index : vertex_indices)
+    {
+        const hlslpp::float3 position = positions[vertex_index].AsHlsl();
+        const auto           distance = static_cast<float>(hlslpp::length(position - center));
+        if (distance <= radius)
+            continue;
+
+        const float new_radius = (radius + distance) / 2.F;
+        center = center + (position - center) * ((new_radius - radius) / distance);
+        radius = new_radius;
+    }
+
+    MeshletBounds bounds{
+        .center      = Mesh::Position(center),
+        .radius      = radius,
+        .cone_apex   = Mesh::Position(center),
+        .cone_axis   = Mesh::Normal(0.F, 0.F, 0.F),
+        .cone_cutoff = 1.F
+    };
+
+    // Normal cone axis is an average of triangle normals, cone angle covers all triangle normals
+    struct TrianglePlane
+    {
+        hlslpp::float3 point;
+        hlslpp::float3 normal;
+    };
+
+    std::vector<TrianglePlane> triangle_planes;
+    triangle_planes.reserve(meshlet.triangles_count);
+    hlslpp::float3 normals_sum(0.F, 0.F, 0.F);
+    for(size_t index = 0; index < local_indices.size(); index += 3)
+    {
+        const hlslpp::float3 p1 = positions[vertex_indices[local_indices[index]]].AsHlsl();
+        const hlslpp::float3 p2 = positions[vertex_indices[local_indices[index + 1]]].AsHlsl();
+        const hlslpp::float3 p3 = positions[vertex_indices[local_indices[index + 2]]].AsHlsl();
+        const hlslpp::float3 n  = hlslpp::cross(p2 - p1, p3 - p1);
+        const auto           n_length = static_cast<float>(hlslpp::length(n));
+        if (n_length <= 0.F)
+            continue;
+
+        const TrianglePlane& triangle_plane = triangle_planes.emplace_back(TrianglePlane{ p1, n / n_length });
+        normals_sum = normals_sum + triangle_plane.normal;
+    }
+
+    const auto normals_sum_length = static_cast<float>(hlslpp::length(normals_sum));
+    if (triangle_planes.empty() || normals_sum_length <= 0.F)
+        return bounds;
+
+    const hlslpp::float3 cone_axis = normals_sum / normals_sum_length;
+    float min_axis_dot = 1.F;
+    for(const TrianglePlane& triangle_plane : triangle_planes)
+    {
+        min_axis_dot = std::min(min_axis_dot, static_cast<float>(hlslpp::dot(cone_axis, triangle_plane.normal)));
+    }
+
+    bounds.cone_axis = Mesh::Normal(cone_axis);
+    if (min_axis_dot <= g_min_cone_axis_dot)
+        return bounds;
+
+    // Cone apex is moved back from the sphere center along the axis until it lays in negative half-space of all triangles
+    float max_apex_offset = 0.F;
+    for(const TrianglePlane& triangle_plane : triangle_planes)
+    {
+        const float apex_offset = static_cast<float>(hlslpp::dot(center - triangle_plane.point, triangle_plane.normal))
+                                / static_cast<float>(hlslpp::dot(cone_axis, triangle_plane.normal));
+        max_apex_offset = std::max(max_apex_offset, apex_offset);
+    }
+
+    bounds.cone_apex   = Mesh::Position(center - cone_axis * max_apex_offset);
+    bounds.cone_cutoff = std::sqrt(1.F - min_axis_dot * min_axis_dot);
+    return bounds;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,51 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/HdrPixelConverter.h
+Conversion of 32-bit float pixels to compact HDR pixel formats and back:
+half-floats, packed R11G11B10 unsigned floats and RGB9E5 shared exponent floats.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Types.h>
+#include <Methane/Data/Types.h>
+
+#include <array>
+
+namespace Methane::Graphics
+{
+
+using HdrColor = std::array<float, 3>;
+
+[[nodiscard]] uint16_t ConvertFloatToHalf(float value) noexcept;
+[[nodiscard]] float    ConvertHalfToFloat(uint16_t half_value) noexcept;
+
+// Negative values are clamped to zero and values out of format range are clamped to the maximum finite value
+[[nodiscard]] uint32_t PackRG11B10Float(const HdrColor& color) noexcept;
+[[nodiscard]] HdrColor UnpackRG11B10Float(uint32_t packed_color) noexcept;
+[[nodiscard]] uint32_t PackRGB9E5Float(const HdrColor& color) noexcept;
+[[nodiscard]] HdrColor UnpackRGB9E5Float(uint32_t packed_color) noexcept;
+
+[[nodiscard]] bool IsHdrPixelFormat(PixelFormat pixel_format) noexcept;
+
+// Converts RGBA pixels with 32-bit float components to the given HDR pixel format, alpha is dropped by packed formats
+[[nodiscard]] Data::Bytes ConvertHdrPixels(const float* rgba_pixels_ptr, Data::Size pixels_count, PixelFormat target_pixel_format);
+
+} // namespace Methane::Graphics
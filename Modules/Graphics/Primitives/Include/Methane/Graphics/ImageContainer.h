@@ -0,0 +1,101 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ImageContainer.h
+Image container parses KTX2 and DDS files with pre-built mip chains of
+block-compressed or uncompressed pixels, which are uploaded to texture without decoding.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Data/Chunk.hpp>
+
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics
+{
+
+enum class ImageContainerFormat : uint32_t
+{
+    KTX2,
+    DDS
+};
+
+class ImageContainer // NOSONAR
+{
+public:
+    using Format = ImageContainerFormat;
+
+    [[nodiscard]] static Opt<Format> DetectFormat(const Data::Chunk& data) noexcept;
+
+    explicit ImageContainer(Data::Chunk&& data);
+    ImageContainer(ImageContainer&& other) noexcept = default;
+    ImageContainer(const ImageContainer& other) = delete;
+
+    [[nodiscard]] Format            GetFormat() const noexcept          { return m_format; }
+    [[nodiscard]] PixelFormat       GetPixelFormat() const noexcept     { return m_pixel_format; }
+    [[nodiscard]] const Dimensions& GetDimensions() const noexcept      { return m_dimensions; }
+    [[nodiscard]] uint32_t          GetArrayLength() const noexcept     { return m_array_length; }
+    [[nodiscard]] uint32_t          GetMipLevelsCount() const noexcept  { return m_mip_levels_count; }
+    [[nodiscard]] bool              IsCube() const noexcept             { return m_is_cube; }
+    [[nodiscard]] bool              IsArray() const noexcept            { return m_is_array; }
+    [[nodiscard]] const Data::Chunk& GetData() const noexcept           { return m_data; }
+    [[nodiscard]] Data::Size        GetPixelsDataSize() const noexcept;
+
+    [[nodiscard]] Dimensions        GetMipLevelDimensions(uint32_t mip_level) const noexcept;
+    [[nodiscard]] Data::Size        GetPixelsDataSize(uint32_t base_mip_level) const noexcept;
+
+    // Sub-resources reference pixels data stored in container, so container must outlive them.
+    // Non-zero base mip level selects the tail of mip chain, which is uploaded to the smaller texture.
+    [[nodiscard]] Rhi::SubResources    GetSubResources(uint32_t base_mip_level = 0U) const;
+    [[nodiscard]] Rhi::TextureSettings GetTextureSettings(bool srgb_color_space = false, uint32_t base_mip_level = 0U,
+                                                          Rhi::ResourceUsageMask usage = { Rhi::ResourceUsage::ShaderRead }) const;
+
+    // Creates texture and uploads all sub-resources as is, since block-compressed mip levels can not be generated on GPU
+    [[nodiscard]] Rhi::Texture CreateTexture(const Rhi::CommandQueue& target_cmd_queue, bool srgb_color_space = false,
+                                             std::string_view texture_name = {}, uint32_t base_mip_level = 0U) const;
+
+private:
+    struct SubResourceLocation
+    {
+        Rhi::SubResourceIndex index;
+        Data::Index           offset;
+        Data::Size            size;
+    };
+
+    void ParseKtx2();
+    void ParseDds();
+    void AddSubResource(const Rhi::SubResourceIndex& index, Data::Index offset, Data::Size size);
+    [[nodiscard]] Data::Size GetMipLevelSize(uint32_t mip_level) const;
+
+    Data::Chunk                      m_data;
+    Format                           m_format;
+    PixelFormat                      m_pixel_format = PixelFormat::Unknown;
+    Dimensions                       m_dimensions;
+    uint32_t                         m_array_length     = 1U;
+    uint32_t                         m_mip_levels_count = 1U;
+    bool                             m_is_cube          = false;
+    bool                             m_is_array         = false;
+    std::vector<SubResourceLocation> m_sub_resources;
+};
+
+} // namespace Methane::Graphics
@@ -25,6 +25,7 @@ by decoding them from popular image formats.
 #pragma once
 
 #include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/ImageContainer.h>
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Data/IProvider.h>
 #include <Methane/Data/EnumMask.hpp>
@@ -58,6 +59,7 @@ enum class ImageOption : uint32_t
 {
     Mipmapped,
     SrgbColorSpace,
+    CpuMipmapped, // mip levels are generated on CPU and uploaded with image in one batch instead of generating them on GPU
 };
 
 using ImageOptionMask = Data::EnumMask<ImageOption>;
@@ -82,14 +84,26 @@ public:
 
     using CubeFaceResources = std::array<std::string, static_cast<size_t>(CubeFace::Count)>;
 
-    explicit ImageLoader(Data::IProvider& data_provider);
+    // HDR images are converted on CPU to the given compact HDR pixel format, which is RGBA16Float by default
+    explicit ImageLoader(Data::IProvider& data_provider, PixelFormat hdr_pixel_format = PixelFormat::RGBA16Float);
 
+    [[nodiscard]] PixelFormat  GetHdrPixelFormat() const noexcept { return m_hdr_pixel_format; }
     [[nodiscard]] ImageData    LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const;
     [[nodiscard]] Rhi::Texture LoadImageToTexture2D(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path, ImageOptionMask options = {}, const std::string& texture_name = "") const;
     [[nodiscard]] Rhi::Texture LoadImagesToTextureCube(const Rhi::CommandQueue& target_cmd_queue, const CubeFaceResources& image_paths, ImageOptionMask options = {}, const std::string& texture_name = "") const;
 
+    // KTX2 and DDS images are uploaded to texture without decoding with mip levels stored in container, so Mipmapped option is ignored
+    [[nodiscard]] static bool IsImageContainerPath(const std::string& image_path);
+    [[nodiscard]] ImageContainer LoadImageContainer(const std::string& image_path) const;
+    [[nodiscard]] Rhi::Texture LoadImageContainerToTexture(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path, ImageOptionMask options = {}, const std::string& texture_name = "") const;
+
+    // Radiance HDR images are decoded by STB, while OpenEXR images can be decoded only with OpenImageIO; SrgbColorSpace option is ignored
+    [[nodiscard]] static bool IsHdrImagePath(const std::string& image_path);
+    [[nodiscard]] ImageData   LoadHdrImageData(const std::string& image_path) const;
+
 private:
     Data::IProvider& m_data_provider;
+    PixelFormat      m_hdr_pixel_format;
 };
 
 } // namespace Methane::Graphics
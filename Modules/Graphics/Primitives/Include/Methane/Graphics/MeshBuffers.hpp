@@ -29,10 +29,15 @@ Mesh buffers with texture extension structure.
 #include <Methane/Graphics/UberMesh.hpp>
 #include <Methane/Graphics/Types.h>
 #include <Methane/Data/AlignedAllocator.hpp>
+#include <Methane/Data/Math.hpp>
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
 #include <fmt/format.h>
+#include <algorithm>
+#include <bit>
+#include <numeric>
+#include <span>
 
 namespace Methane::Graphics
 {
@@ -47,25 +52,41 @@ private:
     using InstanceUniforms = std::vector<AlignedUniformsTypes,
                                          Data::AlignedAllocator<AlignedUniformsTypes, g_uniform_alignment>>;
 
+    using InstanceFramesMask = uint32_t;
+    static constexpr Data::Size s_max_frames_count = static_cast<Data::Size>(sizeof(InstanceFramesMask) * 8U);
+
     // Uniform buffers are created separately in Frame dependent resources
     InstanceUniforms m_final_pass_instance_uniforms;
     Rhi::SubResource m_final_pass_instance_uniforms_subresource;
 
+    // Bit masks of frames in flight with uniforms buffers not yet updated with the changed instance uniforms
+    std::vector<InstanceFramesMask> m_final_pass_instance_dirty_frames;
+    InstanceFramesMask              m_all_frames_mask = 1U;
+
 public:
     template<typename VertexType>
     MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VertexType>& mesh_data,
-                std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets())
-        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets)
+                std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets(),
+                const SubsetLods& mesh_subset_lods = SubsetLods())
+        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets, mesh_subset_lods)
     {
         META_FUNCTION_TASK();
         SetInstanceCount(GetSubsetsCount());
     }
 
     template<typename VertexType>
-    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data, std::string_view mesh_name)
-        : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets())
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data, std::string_view mesh_name,
+                const SubsetLods& mesh_subset_lods = SubsetLods())
+        : MeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets(), mesh_subset_lods)
     { }
 
+    MeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const MeshFile& mesh_file, std::string_view mesh_name)
+        : MeshBuffersBase(render_cmd_queue, mesh_file, mesh_name)
+    {
+        META_FUNCTION_TASK();
+        SetInstanceCount(GetSubsetsCount());
+    }
+
     [[nodiscard]] Data::Size GetInstanceCount() const noexcept
     {
         return static_cast<Data::Size>(m_final_pass_instance_uniforms.size());
@@ -89,6 +110,68 @@ public:
         META_FUNCTION_TASK();
         META_CHECK_LESS(instance_index, m_final_pass_instance_uniforms.size());
         static_cast<UniformsType&>(m_final_pass_instance_uniforms[instance_index]) = std::move(uniforms);
+        m_final_pass_instance_dirty_frames[instance_index] = m_all_frames_mask;
+    }
+
+    [[nodiscard]] Data::Size GetFramesInFlightCount() const noexcept
+    {
+        return static_cast<Data::Size>(std::popcount(m_all_frames_mask));
+    }
+
+    // Each frame in flight has its own uniforms buffer, so changed instance uniforms are tracked per frame
+    void SetFramesInFlightCount(Data::Size frames_count)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_RANGE_INC_DESCR(frames_count, 1U, s_max_frames_count, "frames in flight count is out of supported range");
+        m_all_frames_mask = frames_count == s_max_frames_count
+                          ? ~InstanceFramesMask{}
+                          : (InstanceFramesMask{ 1U } << frames_count) - 1U;
+        std::ranges::fill(m_final_pass_instance_dirty_frames, m_all_frames_mask);
+    }
+
+    [[nodiscard]]
+    bool IsFinalPassUniformsDirty(Data::Index frame_index, Data::Index instance_index = 0U) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS(frame_index, GetFramesInFlightCount());
+        META_CHECK_LESS(instance_index, m_final_pass_instance_dirty_frames.size());
+        return (m_final_pass_instance_dirty_frames[instance_index] & (InstanceFramesMask{ 1U } << frame_index)) != 0U;
+    }
+
+    // Uploads only ranges of instance uniforms changed since the previous update of the given frame uniforms buffer,
+    // contiguous changed instances are merged into single range; returns size of the uploaded data in bytes
+    Data::Size UpdateFinalPassUniformsBuffer(const Rhi::Buffer& uniforms_buffer, const Rhi::CommandQueue& cmd_queue, Data::Index frame_index)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS(frame_index, GetFramesInFlightCount());
+        META_CHECK_GREATER_OR_EQUAL(uniforms_buffer.GetSettings().size, GetUniformsBufferSize());
+
+        const InstanceFramesMask frame_mask    = InstanceFramesMask{ 1U } << frame_index;
+        const auto               instance_count = static_cast<Data::Index>(m_final_pass_instance_dirty_frames.size());
+        Data::Size               uploaded_size  = 0U;
+
+        for(Data::Index begin_index = 0U; begin_index < instance_count; ++begin_index)
+        {
+            if (!(m_final_pass_instance_dirty_frames[begin_index] & frame_mask))
+                continue;
+
+            Data::Index end_index = begin_index;
+            while(end_index < instance_count && (m_final_pass_instance_dirty_frames[end_index] & frame_mask))
+            {
+                m_final_pass_instance_dirty_frames[end_index] &= ~frame_mask;
+                ++end_index;
+            }
+
+            const Data::Size range_start = GetUniformsBufferOffset(begin_index);
+            const Data::Size range_end   = end_index < instance_count ? GetUniformsBufferOffset(end_index) : GetUniformsBufferSize();
+            uniforms_buffer.SetData(cmd_queue, Rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(&m_final_pass_instance_uniforms[begin_index]), // NOSONAR
+                range_end - range_start, Rhi::SubResourceIndex(), Rhi::BytesRange(range_start, range_end)
+            ));
+            uploaded_size += range_end - range_start;
+            begin_index = end_index;
+        }
+        return uploaded_size;
     }
 
     [[nodiscard]]
@@ -123,6 +206,7 @@ protected:
     {
         META_FUNCTION_TASK();
         m_final_pass_instance_uniforms.resize(instance_count);
+        m_final_pass_instance_dirty_frames.assign(instance_count, m_all_frames_mask);
         m_final_pass_instance_uniforms_subresource = Rhi::SubResource(
             reinterpret_cast<Data::ConstRawPtr>(m_final_pass_instance_uniforms.data()), // NOSONAR
             GetUniformsBufferSize()
@@ -130,6 +214,143 @@ protected:
     }
 };
 
+template<typename InstanceType>
+class InstancedMeshBuffers
+    : public MeshBuffersBase
+{
+public:
+    template<typename VertexType>
+    InstancedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const BaseMesh<VertexType>& mesh_data,
+                         std::string_view mesh_name, const Mesh::Subsets& mesh_subsets = Mesh::Subsets(),
+                         const SubsetLods& mesh_subset_lods = SubsetLods())
+        : MeshBuffersBase(render_cmd_queue, mesh_data, mesh_name, mesh_subsets, mesh_subset_lods)
+    {
+        META_FUNCTION_TASK();
+        SetSubsetInstanceCounts(std::vector<uint32_t>(GetSubsetsCount(), 1U));
+    }
+
+    template<typename VertexType>
+    InstancedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<VertexType>& uber_mesh_data, std::string_view mesh_name,
+                         const SubsetLods& mesh_subset_lods = SubsetLods())
+        : InstancedMeshBuffers(render_cmd_queue, uber_mesh_data, mesh_name, uber_mesh_data.GetSubsets(), mesh_subset_lods)
+    { }
+
+    InstancedMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const MeshFile& mesh_file, std::string_view mesh_name)
+        : MeshBuffersBase(render_cmd_queue, mesh_file, mesh_name)
+    {
+        META_FUNCTION_TASK();
+        SetSubsetInstanceCounts(std::vector<uint32_t>(GetSubsetsCount(), 1U));
+    }
+
+    // Instances of each subset are stored contiguously starting from the offset aligned for binding storage buffer view
+    void SetSubsetInstanceCounts(const std::vector<uint32_t>& subset_instance_counts)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_EQUAL_DESCR(subset_instance_counts.size(), GetSubsetsCount(), "instance count is required for each mesh subset");
+        m_subset_instance_counts = subset_instance_counts;
+        m_subset_instance_offsets.resize(subset_instance_counts.size());
+
+        Data::Index instance_offset = 0U;
+        for(size_t subset_index = 0U; subset_index < subset_instance_counts.size(); ++subset_index)
+        {
+            m_subset_instance_offsets[subset_index] = instance_offset;
+            instance_offset = Data::AlignUp(instance_offset + subset_instance_counts[subset_index], s_subset_instances_alignment);
+        }
+        m_instances.resize(instance_offset);
+    }
+
+    [[nodiscard]] std::span<const uint32_t> GetSubsetInstanceCounts() const noexcept { return m_subset_instance_counts; }
+
+    [[nodiscard]] Data::Size GetInstanceCount() const noexcept
+    {
+        return std::accumulate(m_subset_instance_counts.begin(), m_subset_instance_counts.end(), Data::Size(0U));
+    }
+
+    [[nodiscard]] uint32_t GetSubsetInstanceCount(Data::Index subset_index) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS(subset_index, m_subset_instance_counts.size());
+        return m_subset_instance_counts[subset_index];
+    }
+
+    [[nodiscard]]
+    const InstanceType& GetInstance(Data::Index subset_index, Data::Index instance_index) const
+    {
+        META_FUNCTION_TASK();
+        return m_instances[GetInstanceOffset(subset_index, instance_index)];
+    }
+
+    void SetInstance(InstanceType&& instance, Data::Index subset_index, Data::Index instance_index = 0U)
+    {
+        META_FUNCTION_TASK();
+        m_instances[GetInstanceOffset(subset_index, instance_index)] = std::move(instance);
+    }
+
+    [[nodiscard]]
+    static constexpr Data::Size GetInstanceSize() noexcept
+    {
+        return static_cast<Data::Size>(sizeof(InstanceType));
+    }
+
+    [[nodiscard]]
+    Data::Size GetInstancesBufferSize() const noexcept
+    {
+        return static_cast<Data::Size>(m_instances.size() * sizeof(InstanceType));
+    }
+
+    [[nodiscard]]
+    Data::Size GetSubsetInstancesBufferOffset(Data::Index subset_index) const
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS(subset_index, m_subset_instance_offsets.size());
+        return static_cast<Data::Size>(m_subset_instance_offsets[subset_index] * sizeof(InstanceType));
+    }
+
+    [[nodiscard]]
+    Data::Size GetSubsetInstancesBufferSize(Data::Index subset_index) const
+    {
+        META_FUNCTION_TASK();
+        return static_cast<Data::Size>(GetSubsetInstanceCount(subset_index) * sizeof(InstanceType));
+    }
+
+    [[nodiscard]]
+    Rhi::SubResource GetInstancesSubresource() const
+    {
+        META_FUNCTION_TASK();
+        return Rhi::SubResource(
+            reinterpret_cast<Data::ConstRawPtr>(m_instances.data()), // NOSONAR
+            GetInstancesBufferSize()
+        );
+    }
+
+    void Draw(const Rhi::RenderCommandList& cmd_list,
+              const InstancedProgramBindings& subset_program_bindings,
+              Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+              bool set_resource_barriers = true) const
+    {
+        META_FUNCTION_TASK();
+        DrawInstanced(cmd_list, subset_program_bindings, m_subset_instance_counts, bindings_apply_behavior, set_resource_barriers);
+    }
+
+private:
+    // Subset instances start from offset which is a multiple of both instance size and storage buffer view alignment
+    static constexpr Data::Size s_subset_instances_alignment = static_cast<Data::Size>(
+        g_uniform_alignment / std::gcd(g_uniform_alignment, sizeof(InstanceType)));
+
+    [[nodiscard]]
+    Data::Index GetInstanceOffset(Data::Index subset_index, Data::Index instance_index) const
+    {
+        META_CHECK_LESS(subset_index, m_subset_instance_counts.size());
+        META_CHECK_LESS(instance_index, m_subset_instance_counts[subset_index]);
+        return m_subset_instance_offsets[subset_index] + instance_index;
+    }
+
+    // Storage buffers with instances data are created separately in Frame dependent resources
+    std::vector<InstanceType> m_instances;
+    std::vector<uint32_t>     m_subset_instance_counts;
+    std::vector<Data::Index>  m_subset_instance_offsets;
+};
+
 template<typename UniformsType>
 class TexturedMeshBuffers
     : public MeshBuffers<UniformsType>
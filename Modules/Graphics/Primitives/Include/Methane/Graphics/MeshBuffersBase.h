@@ -29,7 +29,9 @@ Mesh buffers base implementation class.
 #include <Methane/Graphics/RHI/ProgramBindings.h>
 #include <Methane/Graphics/RHI/ResourceBarriers.h>
 #include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Graphics/MeshFile.h>
 
+#include <span>
 #include <vector>
 #include <string>
 
@@ -60,9 +62,16 @@ class MeshBuffersBase
 public:
     using InstancedProgramBindings = std::vector<Rhi::ProgramBindings>;
     using ProgramBindingsIteratorType = InstancedProgramBindings::const_iterator;
+    using SubsetLods = std::vector<Mesh::Lods>;
 
+    // Indices of levels of detail are appended to the mesh index buffer after mesh indices,
+    // they are expected in the same format as indices of the corresponding subset (adjusted or not)
     MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
-                    std::string_view mesh_name, const Mesh::Subsets& mesh_subsets);
+                    std::string_view mesh_name, const Mesh::Subsets& mesh_subsets,
+                    const SubsetLods& mesh_subset_lods = {});
+
+    // Mesh buffers are initialized with vertex and index data of mesh file without mesh generation and intermediate copies
+    MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshFile& mesh_file, std::string_view mesh_name);
 
     virtual ~MeshBuffersBase() = default;
 
@@ -72,13 +81,23 @@ public:
     [[nodiscard]] const Rhi::BufferSet& GetVertexBuffers() const noexcept  { return m_vertex_buffer_set; }
     [[nodiscard]] const Rhi::Buffer&    GetIndexBuffer() const noexcept    { return m_index_buffer; }
 
+    // Level of detail 0 is the original subset geometry, next levels are gradually simplified
+    [[nodiscard]] Data::Size  GetSubsetLodsCount(Data::Index subset_index) const;
+    [[nodiscard]] float       GetSubsetLodError(Data::Index subset_index, Data::Index lod_index) const;
+    [[nodiscard]] Data::Index SelectSubsetLod(Data::Index subset_index, float max_error) const;
+
+    // Level of detail drawn for the instance by instanced Draw calls
+    [[nodiscard]] Data::Index GetInstanceLod(Data::Index instance_index) const noexcept;
+    void SetInstanceLod(Data::Index instance_index, Data::Index lod_index);
+
     Rhi::ResourceBarriers CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr = nullptr) const;
 
     void Draw(const Rhi::RenderCommandList& cmd_list,
               const Rhi::ProgramBindings& program_bindings,
               uint32_t mesh_subset_index = 0U,
               uint32_t instance_count = 1U,
-              uint32_t start_instance = 0U) const;
+              uint32_t start_instance = 0U,
+              uint32_t mesh_lod_index = 0U) const;
 
     void Draw(const Rhi::RenderCommandList& cmd_list,
               const InstancedProgramBindings& instance_program_bindings,
@@ -91,6 +110,15 @@ public:
               Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
               uint32_t first_instance_index = 0U, bool retain_bindings_once = false, bool set_resource_barriers = true) const;
 
+    // Draws all instances of each mesh subset with a single draw call using one program bindings per subset;
+    // per-instance data is expected to be tightly packed in the storage buffer bound to subset program bindings
+    // and indexed in shaders by instance ID, so instance count does not increase the number of program bindings
+    void DrawInstanced(const Rhi::RenderCommandList& cmd_list,
+                       const InstancedProgramBindings& subset_program_bindings,
+                       std::span<const uint32_t> subset_instance_counts,
+                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
+                       bool set_resource_barriers = true) const;
+
     void DrawParallel(const Rhi::ParallelRenderCommandList& parallel_cmd_list,
                       const InstancedProgramBindings& instance_program_bindings,
                       Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior = Rhi::ProgramBindingsApplyBehaviorMask(~0U),
@@ -101,11 +129,28 @@ protected:
     virtual Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const { return instance_index; }
 
 private:
-    const Rhi::IContext& m_context;
-    const std::string    m_mesh_name;
-    const Mesh::Subsets  m_mesh_subsets;
-    Rhi::BufferSet       m_vertex_buffer_set;
-    Rhi::Buffer          m_index_buffer;
+    struct SubsetLod
+    {
+        Mesh::Subset::Slice indices;
+        float               error = 0.F;
+    };
+
+    using SubsetLodSlices = std::vector<std::vector<SubsetLod>>;
+
+    void InitializeVertexBuffer(const Rhi::CommandQueue& render_cmd_queue, Data::ConstRawPtr vertex_data_ptr,
+                                Data::Size vertex_data_size, Data::Size vertex_size);
+    void InitializeIndexBuffer(const Rhi::CommandQueue& render_cmd_queue, Data::ConstRawPtr index_data_ptr,
+                               Data::Size index_data_size, PixelFormat index_format);
+    void DrawSubsetLod(const Rhi::RenderCommandList& cmd_list, Data::Index subset_index, Data::Index lod_index,
+                       uint32_t instance_count, uint32_t start_instance) const;
+
+    const Rhi::IContext&     m_context;
+    const std::string        m_mesh_name;
+    const Mesh::Subsets      m_mesh_subsets;
+    SubsetLodSlices          m_mesh_subset_lods;
+    std::vector<Data::Index> m_instance_lods;
+    Rhi::BufferSet           m_vertex_buffer_set;
+    Rhi::Buffer              m_index_buffer;
 };
 
 } // namespace Methane::Graphics
\ No newline at end of file
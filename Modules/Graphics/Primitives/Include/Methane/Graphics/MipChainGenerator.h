@@ -0,0 +1,104 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MipChainGenerator.h
+Mip chain generator downsamples image on CPU with box or Kaiser filter,
+which is vectorized per pixel and parallelized by rows of mip level.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Types.h>
+#include <Methane/Graphics/RHI/ResourceView.h>
+#include <Methane/Data/Chunk.hpp>
+
+#include <vector>
+
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
+namespace Methane::Graphics
+{
+
+enum class MipFilter : uint32_t
+{
+    Box,    // average of 2x2 source pixels, fastest
+    Kaiser  // Kaiser-windowed sinc, sharper mip levels with less aliasing
+};
+
+struct MipChainSettings
+{
+    MipFilter filter        = MipFilter::Box;
+    float     kaiser_alpha  = 4.F;  // Kaiser window shape parameter
+    float     kaiser_radius = 1.5F; // Kaiser filter radius in pixels of the target mip level
+};
+
+class MipChain // NOSONAR
+{
+public:
+    // Base level pixels are not copied, so they must outlive the mip chain and its sub-resources
+    MipChain(PixelFormat pixel_format, const Dimensions& dimensions, const Data::Chunk& base_level_pixels,
+             std::vector<Data::Bytes>&& mip_levels_pixels);
+
+    [[nodiscard]] PixelFormat       GetPixelFormat() const noexcept    { return m_pixel_format; }
+    [[nodiscard]] const Dimensions& GetDimensions() const noexcept     { return m_dimensions; }
+    [[nodiscard]] uint32_t          GetMipLevelsCount() const noexcept { return static_cast<uint32_t>(m_mip_levels_pixels.size()) + 1U; }
+    [[nodiscard]] Dimensions        GetMipLevelDimensions(uint32_t mip_level) const noexcept;
+    [[nodiscard]] Data::Chunk       GetMipLevelPixels(uint32_t mip_level) const;
+    [[nodiscard]] Data::Size        GetDataSize() const noexcept;
+
+    // Sub-resources of all mip levels are set to texture in one batch, so that GPU mip generation is skipped
+    [[nodiscard]] Rhi::SubResources GetSubResources(Data::Index depth_slice = 0U, Data::Index array_index = 0U) const;
+
+private:
+    PixelFormat              m_pixel_format;
+    Dimensions               m_dimensions;
+    Data::ConstRawPtr        m_base_level_data_ptr;
+    Data::Size               m_base_level_data_size;
+    std::vector<Data::Bytes> m_mip_levels_pixels;
+};
+
+class MipChainGenerator
+{
+public:
+    using Settings = MipChainSettings;
+    using Filter   = MipFilter;
+
+    explicit MipChainGenerator(const Settings& settings = {}, tf::Executor* parallel_executor_ptr = nullptr);
+
+    // 8-bit unorm formats are filtered in linear space with gamma correction for sRGB formats, float formats as is
+    [[nodiscard]] static bool     IsPixelFormatSupported(PixelFormat pixel_format) noexcept;
+    [[nodiscard]] static uint32_t GetMipLevelsCount(const Dimensions& dimensions) noexcept;
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+
+    [[nodiscard]] MipChain Generate(const Data::Chunk& base_level_pixels, const Dimensions& dimensions, PixelFormat pixel_format) const;
+
+private:
+    void GenerateMipLevel(Data::ConstRawPtr source_pixels_ptr, const Dimensions& source_dimensions,
+                          Data::RawPtr target_pixels_ptr, const Dimensions& target_dimensions, PixelFormat pixel_format) const;
+
+    Settings      m_settings;
+    tf::Executor* m_parallel_executor_ptr;
+};
+
+} // namespace Methane::Graphics
@@ -24,6 +24,10 @@ Methane graphics extensions: all headers under one umbrella.
 #pragma once
 
 #include "ImageLoader.h"
+#include "ImageContainer.h"
+#include "TextureStreamer.h"
+#include "MipChainGenerator.h"
+#include "HdrPixelConverter.h"
 #include "MeshBuffers.hpp"
 #include "SkyBox.h"
 #include "ScreenQuad.h"
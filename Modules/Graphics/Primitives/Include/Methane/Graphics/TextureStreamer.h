@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/TextureStreamer.h
+Texture streamer loads images asynchronously: images are decoded in parallel
+with prioritized tasks of context executor, while textures are created and uploaded
+on render thread with limited bytes budget per frame and coarse previews.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Instrumentation.h>
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <mutex>
+#include <condition_variable>
+
+namespace Methane::Graphics
+{
+
+enum class TextureStreamingState : uint32_t
+{
+    Queued,    // waiting for decoding task
+    Decoding,  // image is being decoded on executor thread
+    Decoded,   // image is decoded and waiting for upload
+    Preview,   // coarse mip levels are uploaded to preview texture, full texture is waiting for upload
+    Complete,  // full texture is uploaded
+    Cancelled,
+    Failed
+};
+
+struct TextureStreamerSettings
+{
+    // Longest side of coarse preview texture uploaded for images which do not fit in frame upload budget,
+    // zero disables preview textures
+    uint32_t   preview_max_size        = 64U;
+    // Size of image data uploaded on each streamer update, at least one texture is uploaded per update
+    Data::Size upload_budget_per_frame = 32U * 1024U * 1024U;
+};
+
+class StreamedTexture
+{
+    friend class TextureStreamer;
+
+public:
+    using State = TextureStreamingState;
+    struct Request;
+
+    StreamedTexture() = default;
+
+    [[nodiscard]] bool IsInitialized() const noexcept { return static_cast<bool>(m_request_ptr); }
+    [[nodiscard]] State GetState() const noexcept;
+    [[nodiscard]] bool IsComplete() const noexcept    { return GetState() == State::Complete; }
+    [[nodiscard]] bool HasTexture() const noexcept;
+
+    // Returns preview texture until the full texture is uploaded, so program bindings should be updated on mip level change
+    [[nodiscard]] const Rhi::Texture& GetTexture() const;
+    [[nodiscard]] uint32_t GetStreamedMipLevel() const noexcept;
+    [[nodiscard]] const std::string& GetErrorMessage() const;
+
+    [[nodiscard]] int32_t GetPriority() const noexcept;
+    void SetPriority(int32_t priority) const noexcept;
+    void Cancel() const noexcept;
+
+private:
+    explicit StreamedTexture(const Ptr<Request>& request_ptr);
+
+    Ptr<Request> m_request_ptr;
+};
+
+class TextureStreamer // NOSONAR - custom destructor is required
+{
+public:
+    using Settings = TextureStreamerSettings;
+
+    TextureStreamer(const ImageLoader& image_loader, const Rhi::CommandQueue& target_cmd_queue, const Settings& settings = {});
+    TextureStreamer(const TextureStreamer&) = delete;
+    TextureStreamer(TextureStreamer&&) = delete;
+    ~TextureStreamer();
+
+    TextureStreamer& operator=(const TextureStreamer&) = delete;
+    TextureStreamer& operator=(TextureStreamer&&) = delete;
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+
+    // Images with higher priority are decoded and uploaded first, KTX2 and DDS containers are uploaded without decoding
+    [[nodiscard]] StreamedTexture LoadImageToTexture2DAsync(const std::string& image_path, ImageOptionMask options = {},
+                                                            const std::string& texture_name = "", int32_t priority = 0);
+
+    // Creates textures from decoded images and sets their data to upload command list of the target queue,
+    // which is executed by context with all other resource uploads; should be called on render thread once per frame
+    Data::Size Update();
+
+    // Blocks calling thread until all queued images are decoded, cancelled or failed
+    void WaitForDecoding();
+
+    [[nodiscard]] size_t GetPendingCount() const;
+
+private:
+    void DecodeNextRequest();
+    void DecodeRequest(StreamedTexture::Request& request) const;
+    Data::Size UploadPreviewTexture(StreamedTexture::Request& request) const;
+    Data::Size UploadFullTexture(StreamedTexture::Request& request) const;
+
+    using RequestPtrs = std::vector<Ptr<StreamedTexture::Request>>;
+
+    const ImageLoader&                m_image_loader;
+    Rhi::CommandQueue                 m_target_cmd_queue;
+    const Settings                    m_settings;
+    RequestPtrs                       m_queued_requests;
+    RequestPtrs                       m_decoded_requests;
+    uint64_t                          m_requests_count        = 0U;
+    size_t                            m_scheduled_tasks_count = 0U;
+    size_t                            m_decoding_count        = 0U;
+    mutable TracyLockable(std::mutex, m_mutex);
+    std::condition_variable_any       m_decoding_condition_var;
+};
+
+} // namespace Methane::Graphics
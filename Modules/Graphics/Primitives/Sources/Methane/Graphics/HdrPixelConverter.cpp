@@ -0,0 +1,223 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/HdrPixelConverter.cpp
+Conversion of 32-bit float pixels to compact HDR pixel formats and back:
+half-floats, packed R11G11B10 unsigned floats and RGB9E5 shared exponent floats.
+
+******************************************************************************/
+
+#include <Methane/Graphics/HdrPixelConverter.h>
+#include <Methane/Graphics/TypeFormatters.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstring>
+
+namespace Methane::Graphics
+{
+
+static constexpr uint32_t g_float_exponent_mask     = 0x7F800000U;
+static constexpr uint32_t g_float_min_normal_half   = 0x38800000U; // 2^-14 is the smallest normal value of half-float
+static constexpr uint32_t g_float_half_bias_delta   = 0x38000000U; // difference of float and half-float exponent biases: (127 - 15) << 23
+static constexpr uint32_t g_small_float_max_exp     = 0x1FU;
+static constexpr int      g_rgb9e5_mantissa_bits    = 9;
+static constexpr int      g_rgb9e5_exponent_bias    = 15;
+static constexpr int      g_rgb9e5_max_exponent     = 31;
+static constexpr float    g_rgb9e5_max_value        = static_cast<float>((1 << g_rgb9e5_mantissa_bits) - 1) / static_cast<float>(1 << g_rgb9e5_mantissa_bits)
+                                                    * static_cast<float>(1 << (g_rgb9e5_max_exponent - g_rgb9e5_exponent_bias));
+
+// Unsigned small floats of R11G11B10 format have the same 5-bit exponent as half-float, but less mantissa bits
+[[nodiscard]]
+static uint32_t ConvertFloatToSmallUnsignedFloat(float value, uint32_t mantissa_bits) noexcept
+{
+    if (!(value > 0.F)) // negative values, zero and NaN
+        return 0U;
+
+    const auto     value_bits     = std::bit_cast<uint32_t>(value);
+    const uint32_t max_finite     = ((g_small_float_max_exp - 1U) << mantissa_bits) | ((1U << mantissa_bits) - 1U);
+    if (value_bits >= g_float_exponent_mask)
+        return max_finite;
+
+    if (value_bits < g_float_min_normal_half)
+        return static_cast<uint32_t>(std::nearbyint(std::ldexp(value, 14 + static_cast<int>(mantissa_bits))));
+
+    // Round to nearest even mantissa, rounding carry overflows to exponent as expected
+    const uint32_t mantissa_shift = 23U - mantissa_bits;
+    const uint32_t rounded_bits   = value_bits + ((1U << (mantissa_shift - 1U)) - 1U) + ((value_bits >> mantissa_shift) & 1U);
+    return std::min((rounded_bits - g_float_half_bias_delta) >> mantissa_shift, max_finite);
+}
+
+[[nodiscard]]
+static float ConvertSmallUnsignedFloatToFloat(uint32_t small_value, uint32_t mantissa_bits) noexcept
+{
+    const uint32_t exponent = small_value >> mantissa_bits;
+    const uint32_t mantissa = small_value & ((1U << mantissa_bits) - 1U);
+    if (!exponent)
+        return std::ldexp(static_cast<float>(mantissa), -14 - static_cast<int>(mantissa_bits));
+
+    if (exponent == g_small_float_max_exp)
+        return std::bit_cast<float>(g_float_exponent_mask | (mantissa << (23U - mantissa_bits)));
+
+    return std::bit_cast<float>(((exponent + 112U) << 23U) | (mantissa << (23U - mantissa_bits)));
+}
+
+uint16_t ConvertFloatToHalf(float value) noexcept
+{
+    const auto     value_bits     = std::bit_cast<uint32_t>(value);
+    const uint32_t sign           = (value_bits >> 16U) & 0x8000U;
+    const uint32_t abs_value_bits = value_bits & 0x7FFFFFFFU;
+
+    if (abs_value_bits >= g_float_exponent_mask) // infinity and NaN
+        return static_cast<uint16_t>(sign | 0x7C00U | (abs_value_bits > g_float_exponent_mask ? 0x200U : 0U));
+
+    if (abs_value_bits >= 0x477FF000U) // values rounded above 65504 overflow to infinity
+        return static_cast<uint16_t>(sign | 0x7C00U);
+
+    if (abs_value_bits < g_float_min_normal_half)
+        return static_cast<uint16_t>(sign | static_cast<uint32_t>(std::nearbyint(std::ldexp(std::bit_cast<float>(abs_value_bits), 24))));
+
+    const uint32_t rounded_bits = abs_value_bits + 0xFFFU + ((abs_value_bits >> 13U) & 1U);
+    return static_cast<uint16_t>(sign | ((rounded_bits - g_float_half_bias_delta) >> 13U));
+}
+
+float ConvertHalfToFloat(uint16_t half_value) noexcept
+{
+    const float abs_value = ConvertSmallUnsignedFloatToFloat(half_value & 0x7FFFU, 10U);
+    return half_value & 0x8000U ? -abs_value : abs_value;
+}
+
+uint32_t PackRG11B10Float(const HdrColor& color) noexcept
+{
+    return  ConvertFloatToSmallUnsignedFloat(color[0], 6U)
+         | (ConvertFloatToSmallUnsignedFloat(color[1], 6U) << 11U)
+         | (ConvertFloatToSmallUnsignedFloat(color[2], 5U) << 22U);
+}
+
+HdrColor UnpackRG11B10Float(uint32_t packed_color) noexcept
+{
+    return HdrColor{
+        ConvertSmallUnsignedFloatToFloat(packed_color & 0x7FFU, 6U),
+        ConvertSmallUnsignedFloatToFloat((packed_color >> 11U) & 0x7FFU, 6U),
+        ConvertSmallUnsignedFloatToFloat(packed_color >> 22U, 5U)
+    };
+}
+
+// Shared exponent is selected by the largest component as defined by EXT_texture_shared_exponent specification
+uint32_t PackRGB9E5Float(const HdrColor& color) noexcept
+{
+    HdrColor clamped_color{};
+    std::ranges::transform(color, clamped_color.begin(), [](float value) { return value > 0.F ? std::min(value, g_rgb9e5_max_value) : 0.F; });
+
+    const float max_component = std::ranges::max(clamped_color);
+    if (max_component <= 0.F)
+        return 0U;
+
+    int shared_exponent = std::max(-g_rgb9e5_exponent_bias - 1, std::ilogb(max_component)) + 1 + g_rgb9e5_exponent_bias;
+    if (std::floor(std::ldexp(max_component, g_rgb9e5_exponent_bias + g_rgb9e5_mantissa_bits - shared_exponent) + 0.5F) ==
+        static_cast<float>(1 << g_rgb9e5_mantissa_bits))
+    {
+        shared_exponent++;
+    }
+
+    uint32_t packed_color = static_cast<uint32_t>(shared_exponent) << 27U;
+    for(uint32_t channel = 0U; channel < 3U; ++channel)
+    {
+        const auto mantissa = static_cast<uint32_t>(std::floor(std::ldexp(clamped_color[channel], g_rgb9e5_exponent_bias + g_rgb9e5_mantissa_bits - shared_exponent) + 0.5F));
+        packed_color |= mantissa << (channel * 9U);
+    }
+    return packed_color;
+}
+
+HdrColor UnpackRGB9E5Float(uint32_t packed_color) noexcept
+{
+    const int exponent = static_cast<int>(packed_color >> 27U) - g_rgb9e5_exponent_bias - g_rgb9e5_mantissa_bits;
+    return HdrColor{
+        std::ldexp(static_cast<float>(packed_color & 0x1FFU), exponent),
+        std::ldexp(static_cast<float>((packed_color >> 9U) & 0x1FFU), exponent),
+        std::ldexp(static_cast<float>((packed_color >> 18U) & 0x1FFU), exponent)
+    };
+}
+
+bool IsHdrPixelFormat(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    switch(pixel_format)
+    {
+    using enum PixelFormat;
+    case RGBA32Float:
+    case RGBA16Float:
+    case RG11B10Float:
+    case RGB9E5Float:
+        return true;
+
+    default:
+        return false;
+    }
+}
+
+Data::Bytes ConvertHdrPixels(const float* rgba_pixels_ptr, Data::Size pixels_count, PixelFormat target_pixel_format)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(IsHdrPixelFormat(target_pixel_format), "pixel format {} is not an HDR format", target_pixel_format);
+    META_CHECK_NOT_NULL(rgba_pixels_ptr);
+
+    Data::Bytes target_pixels(static_cast<size_t>(pixels_count) * GetPixelSize(target_pixel_format));
+    if (target_pixel_format == PixelFormat::RGBA32Float)
+    {
+        std::memcpy(target_pixels.data(), rgba_pixels_ptr, target_pixels.size());
+        return target_pixels;
+    }
+
+    Data::RawPtr target_pixel_ptr = target_pixels.data();
+    for(const float* pixel_ptr = rgba_pixels_ptr; pixel_ptr < rgba_pixels_ptr + static_cast<size_t>(pixels_count) * 4U; pixel_ptr += 4)
+    {
+        switch(target_pixel_format)
+        {
+        case PixelFormat::RGBA16Float:
+        {
+            const std::array<uint16_t, 4> half_color{
+                ConvertFloatToHalf(pixel_ptr[0]), ConvertFloatToHalf(pixel_ptr[1]),
+                ConvertFloatToHalf(pixel_ptr[2]), ConvertFloatToHalf(pixel_ptr[3])
+            };
+            std::memcpy(target_pixel_ptr, half_color.data(), sizeof(half_color));
+            target_pixel_ptr += sizeof(half_color);
+            break;
+        }
+        case PixelFormat::RG11B10Float:
+        case PixelFormat::RGB9E5Float:
+        {
+            const HdrColor color{ pixel_ptr[0], pixel_ptr[1], pixel_ptr[2] };
+            const uint32_t packed_color = target_pixel_format == PixelFormat::RG11B10Float
+                                        ? PackRG11B10Float(color)
+                                        : PackRGB9E5Float(color);
+            std::memcpy(target_pixel_ptr, &packed_color, sizeof(packed_color));
+            target_pixel_ptr += sizeof(packed_color);
+            break;
+        }
+        default:
+            META_UNEXPECTED(target_pixel_format);
+        }
+    }
+    return target_pixels;
+}
+
+} // namespace Methane::Graphics
@@ -0,0 +1,441 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/ImageContainer.cpp
+Image container parses KTX2 and DDS files with pre-built mip chains of
+block-compressed or uncompressed pixels, which are uploaded to texture without decoding.
+
+******************************************************************************/
+
+#include <Methane/Graphics/ImageContainer.h>
+#include <Methane/Graphics/TypeFormatters.hpp>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cstring>
+#include <numeric>
+
+namespace Methane::Graphics
+{
+
+static constexpr std::array<uint8_t, 12> g_ktx2_identifier{ 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x32, 0x30, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+static constexpr Data::Size g_ktx2_header_size      = 80U;
+static constexpr Data::Size g_ktx2_level_index_size = 24U;
+
+static constexpr uint32_t   g_dds_magic            = 0x20534444U; // "DDS "
+static constexpr Data::Size g_dds_header_offset    = 4U;
+static constexpr Data::Size g_dds_header_size      = 124U;
+static constexpr Data::Size g_dds_dx10_header_size = 20U;
+
+static constexpr uint32_t g_dds_flag_mip_map_count   = 0x20000U;
+static constexpr uint32_t g_dds_pixel_flag_four_cc   = 0x4U;
+static constexpr uint32_t g_dds_pixel_flag_rgb       = 0x40U;
+static constexpr uint32_t g_dds_caps2_cubemap        = 0x200U;
+static constexpr uint32_t g_dds_caps2_volume         = 0x200000U;
+static constexpr uint32_t g_dds_dx10_misc_cube       = 0x4U;
+static constexpr uint32_t g_dds_dx10_dimension_tex2d = 3U;
+
+[[nodiscard]]
+static constexpr uint32_t MakeFourCC(const char (&four_cc)[5]) noexcept
+{
+    return static_cast<uint32_t>(static_cast<uint8_t>(four_cc[0]))
+         | static_cast<uint32_t>(static_cast<uint8_t>(four_cc[1])) << 8U
+         | static_cast<uint32_t>(static_cast<uint8_t>(four_cc[2])) << 16U
+         | static_cast<uint32_t>(static_cast<uint8_t>(four_cc[3])) << 24U;
+}
+
+// Container headers are stored in little-endian byte order, same as on all supported platforms
+template<typename T>
+[[nodiscard]]
+static T ReadValue(const Data::Chunk& data, Data::Size offset)
+{
+    META_CHECK_LESS_OR_EQUAL_DESCR(offset + sizeof(T), data.GetDataSize(), "image container data is truncated");
+    T value{};
+    std::memcpy(&value, data.GetDataPtr() + offset, sizeof(T));
+    return value;
+}
+
+[[nodiscard]]
+static PixelFormat ConvertVulkanFormat(uint32_t vk_format)
+{
+    META_FUNCTION_TASK();
+    switch(vk_format)
+    {
+    using enum PixelFormat;
+    case 9U:   return R8Unorm;
+    case 37U:  return RGBA8Unorm;
+    case 43U:  return RGBA8Unorm_sRGB;
+    case 44U:  return BGRA8Unorm;
+    case 50U:  return BGRA8Unorm_sRGB;
+    case 76U:  return R16Float;
+    case 97U:  return RGBA16Float;
+    case 100U: return R32Float;
+    case 109U: return RGBA32Float;
+    case 122U: return RG11B10Float;
+    case 123U: return RGB9E5Float;
+    case 131U: // VK_FORMAT_BC1_RGB_UNORM_BLOCK
+    case 133U: return BC1Unorm;
+    case 132U: // VK_FORMAT_BC1_RGB_SRGB_BLOCK
+    case 134U: return BC1Unorm_sRGB;
+    case 135U: return BC2Unorm;
+    case 136U: return BC2Unorm_sRGB;
+    case 137U: return BC3Unorm;
+    case 138U: return BC3Unorm_sRGB;
+    case 139U: return BC4Unorm;
+    case 140U: return BC4Snorm;
+    case 141U: return BC5Unorm;
+    case 142U: return BC5Snorm;
+    case 143U: return BC6HUfloat;
+    case 144U: return BC6HSfloat;
+    case 145U: return BC7Unorm;
+    case 146U: return BC7Unorm_sRGB;
+    default:   META_UNEXPECTED_RETURN_DESCR(vk_format, Unknown, "KTX2 image pixel format is not supported");
+    }
+}
+
+[[nodiscard]]
+static PixelFormat ConvertDxgiFormat(uint32_t dxgi_format)
+{
+    META_FUNCTION_TASK();
+    switch(dxgi_format)
+    {
+    using enum PixelFormat;
+    case 2U:  return RGBA32Float;
+    case 10U: return RGBA16Float;
+    case 26U: return RG11B10Float;
+    case 28U: return RGBA8Unorm;
+    case 29U: return RGBA8Unorm_sRGB;
+    case 41U: return R32Float;
+    case 54U: return R16Float;
+    case 61U: return R8Unorm;
+    case 67U: return RGB9E5Float;
+    case 71U: return BC1Unorm;
+    case 72U: return BC1Unorm_sRGB;
+    case 74U: return BC2Unorm;
+    case 75U: return BC2Unorm_sRGB;
+    case 77U: return BC3Unorm;
+    case 78U: return BC3Unorm_sRGB;
+    case 80U: return BC4Unorm;
+    case 81U: return BC4Snorm;
+    case 83U: return BC5Unorm;
+    case 84U: return BC5Snorm;
+    case 87U: return BGRA8Unorm;
+    case 91U: return BGRA8Unorm_sRGB;
+    case 95U: return BC6HUfloat;
+    case 96U: return BC6HSfloat;
+    case 98U: return BC7Unorm;
+    case 99U: return BC7Unorm_sRGB;
+    default:  META_UNEXPECTED_RETURN_DESCR(dxgi_format, Unknown, "DDS image DXGI pixel format is not supported");
+    }
+}
+
+[[nodiscard]]
+static PixelFormat ConvertDdsFourCC(uint32_t four_cc)
+{
+    META_FUNCTION_TASK();
+    using enum PixelFormat;
+    if (four_cc == MakeFourCC("DXT1"))
+        return BC1Unorm;
+    if (four_cc == MakeFourCC("DXT2") || four_cc == MakeFourCC("DXT3"))
+        return BC2Unorm;
+    if (four_cc == MakeFourCC("DXT4") || four_cc == MakeFourCC("DXT5"))
+        return BC3Unorm;
+    if (four_cc == MakeFourCC("ATI1") || four_cc == MakeFourCC("BC4U"))
+        return BC4Unorm;
+    if (four_cc == MakeFourCC("BC4S"))
+        return BC4Snorm;
+    if (four_cc == MakeFourCC("ATI2") || four_cc == MakeFourCC("BC5U"))
+        return BC5Unorm;
+    if (four_cc == MakeFourCC("BC5S"))
+        return BC5Snorm;
+
+    // Legacy D3DFORMAT values of floating-point formats are stored in place of FourCC
+    if (four_cc == 113U) // D3DFMT_A16B16G16R16F
+        return RGBA16Float;
+    if (four_cc == 116U) // D3DFMT_A32B32G32R32F
+        return RGBA32Float;
+
+    META_UNEXPECTED_RETURN_DESCR(four_cc, Unknown, "DDS image FourCC pixel format is not supported");
+}
+
+[[nodiscard]]
+static PixelFormat ConvertToSrgbFormat(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    switch(pixel_format)
+    {
+    using enum PixelFormat;
+    case RGBA8Unorm: return RGBA8Unorm_sRGB;
+    case BGRA8Unorm: return BGRA8Unorm_sRGB;
+    case BC1Unorm:   return BC1Unorm_sRGB;
+    case BC2Unorm:   return BC2Unorm_sRGB;
+    case BC3Unorm:   return BC3Unorm_sRGB;
+    case BC7Unorm:   return BC7Unorm_sRGB;
+    default:         return pixel_format;
+    }
+}
+
+[[nodiscard]]
+static uint32_t GetFullMipLevelsCount(const Dimensions& dimensions) noexcept
+{
+    return static_cast<uint32_t>(std::bit_width(std::max(dimensions.GetWidth(), dimensions.GetHeight())));
+}
+
+Opt<ImageContainerFormat> ImageContainer::DetectFormat(const Data::Chunk& data) noexcept
+{
+    META_FUNCTION_TASK();
+    if (data.GetDataSize() >= g_ktx2_identifier.size() &&
+        std::equal(g_ktx2_identifier.begin(), g_ktx2_identifier.end(), data.GetDataPtr(),
+                   [](uint8_t identifier_byte, std::byte data_byte) { return identifier_byte == static_cast<uint8_t>(data_byte); }))
+        return Format::KTX2;
+
+    if (data.GetDataSize() >= sizeof(g_dds_magic) && ReadValue<uint32_t>(data, 0U) == g_dds_magic)
+        return Format::DDS;
+
+    return std::nullopt;
+}
+
+ImageContainer::ImageContainer(Data::Chunk&& data)
+    : m_data(std::move(data))
+{
+    META_FUNCTION_TASK();
+    const Opt<Format> format_opt = DetectFormat(m_data);
+    META_CHECK_TRUE_DESCR(format_opt.has_value(), "image data is neither KTX2 nor DDS container");
+    m_format = *format_opt;
+
+    switch(m_format)
+    {
+    case Format::KTX2: ParseKtx2(); break;
+    case Format::DDS:  ParseDds();  break;
+    default:           META_UNEXPECTED(m_format);
+    }
+
+    const uint32_t full_mip_levels_count = GetFullMipLevelsCount(m_dimensions);
+    META_CHECK_TRUE_DESCR(m_mip_levels_count == 1U || m_mip_levels_count == full_mip_levels_count,
+                          "image container should have either single mip level or full chain of {} mip levels, but it has {}",
+                          full_mip_levels_count, m_mip_levels_count);
+}
+
+Data::Size ImageContainer::GetPixelsDataSize() const noexcept
+{
+    META_FUNCTION_TASK();
+    return GetPixelsDataSize(0U);
+}
+
+Data::Size ImageContainer::GetPixelsDataSize(uint32_t base_mip_level) const noexcept
+{
+    META_FUNCTION_TASK();
+    return std::accumulate(m_sub_resources.begin(), m_sub_resources.end(), Data::Size(0U),
+                           [base_mip_level](Data::Size size, const SubResourceLocation& sub_resource)
+                           { return sub_resource.index.GetMipLevel() >= base_mip_level ? size + sub_resource.size : size; });
+}
+
+Dimensions ImageContainer::GetMipLevelDimensions(uint32_t mip_level) const noexcept
+{
+    META_FUNCTION_TASK();
+    return Dimensions(std::max(1U, m_dimensions.GetWidth()  >> mip_level),
+                      std::max(1U, m_dimensions.GetHeight() >> mip_level),
+                      m_dimensions.GetDepth());
+}
+
+Rhi::SubResources ImageContainer::GetSubResources(uint32_t base_mip_level) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_DESCR(base_mip_level, m_mip_levels_count, "base mip level is out of image container mip levels range");
+    Rhi::SubResources sub_resources;
+    sub_resources.reserve(m_sub_resources.size());
+    for(const SubResourceLocation& sub_resource : m_sub_resources)
+    {
+        const Rhi::SubResourceIndex& index = sub_resource.index;
+        if (index.GetMipLevel() < base_mip_level)
+            continue;
+
+        sub_resources.emplace_back(m_data.GetDataPtr() + sub_resource.offset, sub_resource.size,
+                                   Rhi::SubResourceIndex(index.GetDepthSlice(), index.GetArrayIndex(), index.GetMipLevel() - base_mip_level));
+    }
+    return sub_resources;
+}
+
+Rhi::TextureSettings ImageContainer::GetTextureSettings(bool srgb_color_space, uint32_t base_mip_level, Rhi::ResourceUsageMask usage) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_DESCR(base_mip_level, m_mip_levels_count, "base mip level is out of image container mip levels range");
+    const PixelFormat   pixel_format     = srgb_color_space ? ConvertToSrgbFormat(m_pixel_format) : m_pixel_format;
+    const bool          mipmapped        = m_mip_levels_count - base_mip_level > 1U;
+    const Dimensions    dimensions       = GetMipLevelDimensions(base_mip_level);
+    const Opt<uint32_t> array_length_opt = m_is_array ? Opt<uint32_t>(m_array_length) : std::nullopt;
+    return m_is_cube
+         ? Rhi::TextureSettings::ForCubeImage(dimensions.GetWidth(), array_length_opt, pixel_format, mipmapped, usage)
+         : Rhi::TextureSettings::ForImage(dimensions, array_length_opt, pixel_format, mipmapped, usage);
+}
+
+Rhi::Texture ImageContainer::CreateTexture(const Rhi::CommandQueue& target_cmd_queue, bool srgb_color_space,
+                                           std::string_view texture_name, uint32_t base_mip_level) const
+{
+    META_FUNCTION_TASK();
+    Rhi::Texture texture(target_cmd_queue.GetContext(), GetTextureSettings(srgb_color_space, base_mip_level));
+    texture.SetName(texture_name);
+    texture.SetData(target_cmd_queue, GetSubResources(base_mip_level));
+    return texture;
+}
+
+void ImageContainer::ParseKtx2()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_OR_EQUAL_DESCR(m_data.GetDataSize(), g_ktx2_header_size, "KTX2 image header is truncated");
+
+    const auto vk_format    = ReadValue<uint32_t>(m_data, 12U);
+    const auto pixel_width  = ReadValue<uint32_t>(m_data, 20U);
+    const auto pixel_height = ReadValue<uint32_t>(m_data, 24U);
+    const auto pixel_depth  = ReadValue<uint32_t>(m_data, 28U);
+    const auto layer_count  = ReadValue<uint32_t>(m_data, 32U);
+    const auto face_count   = ReadValue<uint32_t>(m_data, 36U);
+    const auto level_count  = ReadValue<uint32_t>(m_data, 40U);
+    const auto supercompression_scheme = ReadValue<uint32_t>(m_data, 44U);
+
+    META_CHECK_EQUAL_DESCR(supercompression_scheme, 0U, "KTX2 image supercompression is not supported");
+    META_CHECK_LESS_OR_EQUAL_DESCR(pixel_depth, 1U, "KTX2 volume images are not supported");
+    META_CHECK_NOT_ZERO_DESCR(pixel_width, "KTX2 image width can not be zero");
+    META_CHECK_TRUE_DESCR(face_count == 1U || face_count == 6U, "KTX2 image faces count should be 1 or 6, but it is {}", face_count);
+
+    m_pixel_format     = ConvertVulkanFormat(vk_format);
+    m_is_cube          = face_count == 6U;
+    m_is_array         = layer_count > 0U;
+    m_array_length     = std::max(1U, layer_count);
+    m_mip_levels_count = std::max(1U, level_count);
+    m_dimensions       = Dimensions(pixel_width, std::max(1U, pixel_height), face_count);
+
+    META_CHECK_LESS_OR_EQUAL_DESCR(m_mip_levels_count, GetFullMipLevelsCount(m_dimensions),
+                                   "KTX2 image has more mip levels than its dimensions allow");
+
+    // Level index lists levels starting from the base mip, each level contains images of all layers and faces.
+    // Level byte offset and length are validated against image data size in 64-bit before narrowing to data index and size
+    const auto data_size = static_cast<uint64_t>(m_data.GetDataSize());
+    for(uint32_t mip_level = 0U; mip_level < m_mip_levels_count; ++mip_level)
+    {
+        const Data::Size level_index_offset = g_ktx2_header_size + mip_level * g_ktx2_level_index_size;
+        const auto level_offset = ReadValue<uint64_t>(m_data, level_index_offset);
+        const auto level_length = ReadValue<uint64_t>(m_data, level_index_offset + 8U);
+        const Data::Size image_size = GetMipLevelSize(mip_level);
+        META_CHECK_EQUAL_DESCR(level_length, static_cast<uint64_t>(image_size) * m_array_length * face_count,
+                               "KTX2 image mip level {} data size does not match its pixel format and dimensions", mip_level);
+        META_CHECK_TRUE_DESCR(level_offset <= data_size && level_length <= data_size - level_offset,
+                              "KTX2 image mip level {} data is out of image data bounds", mip_level);
+
+        auto image_offset = static_cast<Data::Index>(level_offset);
+        for(uint32_t layer_index = 0U; layer_index < m_array_length; ++layer_index)
+        {
+            for(uint32_t face_index = 0U; face_index < face_count; ++face_index)
+            {
+                AddSubResource(Rhi::SubResourceIndex(face_index, layer_index, mip_level), image_offset, image_size);
+                image_offset += image_size;
+            }
+        }
+    }
+}
+
+void ImageContainer::ParseDds()
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_OR_EQUAL_DESCR(m_data.GetDataSize(), g_dds_header_offset + g_dds_header_size, "DDS image header is truncated");
+    META_CHECK_EQUAL_DESCR(ReadValue<uint32_t>(m_data, g_dds_header_offset), g_dds_header_size, "DDS image header size is invalid");
+
+    const auto flags          = ReadValue<uint32_t>(m_data, g_dds_header_offset + 4U);
+    const auto height         = ReadValue<uint32_t>(m_data, g_dds_header_offset + 8U);
+    const auto width          = ReadValue<uint32_t>(m_data, g_dds_header_offset + 12U);
+    const auto mip_map_count  = ReadValue<uint32_t>(m_data, g_dds_header_offset + 24U);
+    const auto pixel_flags    = ReadValue<uint32_t>(m_data, g_dds_header_offset + 76U);
+    const auto four_cc        = ReadValue<uint32_t>(m_data, g_dds_header_offset + 80U);
+    const auto rgb_bit_count  = ReadValue<uint32_t>(m_data, g_dds_header_offset + 84U);
+    const auto red_bit_mask   = ReadValue<uint32_t>(m_data, g_dds_header_offset + 88U);
+    const auto caps2          = ReadValue<uint32_t>(m_data, g_dds_header_offset + 108U);
+
+    META_CHECK_NOT_ZERO_DESCR(width, "DDS image width can not be zero");
+    META_CHECK_EQUAL_DESCR(caps2 & g_dds_caps2_volume, 0U, "DDS volume images are not supported");
+
+    Data::Index data_offset = g_dds_header_offset + g_dds_header_size;
+    if ((pixel_flags & g_dds_pixel_flag_four_cc) && four_cc == MakeFourCC("DX10"))
+    {
+        const auto dxgi_format        = ReadValue<uint32_t>(m_data, data_offset);
+        const auto resource_dimension = ReadValue<uint32_t>(m_data, data_offset + 4U);
+        const auto misc_flags         = ReadValue<uint32_t>(m_data, data_offset + 8U);
+        const auto array_size         = ReadValue<uint32_t>(m_data, data_offset + 12U);
+        META_CHECK_EQUAL_DESCR(resource_dimension, g_dds_dx10_dimension_tex2d, "only 2D DDS images are supported");
+
+        m_pixel_format = ConvertDxgiFormat(dxgi_format);
+        m_is_cube      = (misc_flags & g_dds_dx10_misc_cube) != 0U;
+        m_array_length = std::max(1U, array_size);
+        m_is_array     = m_array_length > 1U;
+        data_offset   += g_dds_dx10_header_size;
+    }
+    else if (pixel_flags & g_dds_pixel_flag_four_cc)
+    {
+        m_pixel_format = ConvertDdsFourCC(four_cc);
+        m_is_cube      = (caps2 & g_dds_caps2_cubemap) != 0U;
+    }
+    else
+    {
+        META_CHECK_TRUE_DESCR((pixel_flags & g_dds_pixel_flag_rgb) && rgb_bit_count == 32U,
+                              "only 32-bit RGBA uncompressed DDS images are supported");
+        m_pixel_format = red_bit_mask == 0x000000FFU ? PixelFormat::RGBA8Unorm : PixelFormat::BGRA8Unorm;
+        m_is_cube      = (caps2 & g_dds_caps2_cubemap) != 0U;
+    }
+
+    const uint32_t faces_count = m_is_cube ? 6U : 1U;
+    m_mip_levels_count = (flags & g_dds_flag_mip_map_count) ? std::max(1U, mip_map_count) : 1U;
+    m_dimensions       = Dimensions(width, std::max(1U, height), faces_count);
+
+    META_CHECK_LESS_OR_EQUAL_DESCR(m_mip_levels_count, GetFullMipLevelsCount(m_dimensions),
+                                   "DDS image has more mip levels than its dimensions allow");
+
+    // DDS images are stored with all mip levels of each face in each array item
+    for(uint32_t array_index = 0U; array_index < m_array_length; ++array_index)
+    {
+        for(uint32_t face_index = 0U; face_index < faces_count; ++face_index)
+        {
+            for(uint32_t mip_level = 0U; mip_level < m_mip_levels_count; ++mip_level)
+            {
+                const Data::Size image_size = GetMipLevelSize(mip_level);
+                AddSubResource(Rhi::SubResourceIndex(face_index, array_index, mip_level), data_offset, image_size);
+                data_offset += image_size;
+            }
+        }
+    }
+}
+
+void ImageContainer::AddSubResource(const Rhi::SubResourceIndex& index, Data::Index offset, Data::Size size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_OR_EQUAL_DESCR(static_cast<uint64_t>(offset) + size, static_cast<uint64_t>(m_data.GetDataSize()),
+                                   "image container pixels data is truncated");
+    m_sub_resources.push_back({ index, offset, size });
+}
+
+Data::Size ImageContainer::GetMipLevelSize(uint32_t mip_level) const
+{
+    META_FUNCTION_TASK();
+    const Dimensions mip_dimensions = GetMipLevelDimensions(mip_level);
+    return GetImageSlicePitch(m_pixel_format, mip_dimensions.GetWidth(), mip_dimensions.GetHeight());
+}
+
+} // namespace Methane::Graphics
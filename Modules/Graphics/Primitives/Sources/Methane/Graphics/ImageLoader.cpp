@@ -23,6 +23,8 @@ by decoding them from popular image formats.
 ******************************************************************************/
 
 #include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/HdrPixelConverter.h>
 #include <Methane/Graphics/TypeFormatters.hpp>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/IContext.h>
@@ -31,6 +33,8 @@ by decoding them from popular image formats.
 #include <Methane/Checks.hpp>
 
 #include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <cctype>
 
 #ifdef USE_OPEN_IMAGE_IO
 
@@ -54,6 +58,24 @@ static PixelFormat GetDefaultImageFormat(bool srgb)
     return srgb ? PixelFormat::RGBA8Unorm_sRGB : PixelFormat::RGBA8Unorm;
 }
 
+[[nodiscard]]
+static bool IsMipmapped(ImageOptionMask options)
+{
+    return options.HasAnyBits({ ImageOption::Mipmapped, ImageOption::CpuMipmapped });
+}
+
+[[nodiscard]]
+static std::string GetLowerCaseExtension(const std::string& image_path)
+{
+    const size_t extension_pos = image_path.rfind('.');
+    if (extension_pos == std::string::npos)
+        return {};
+
+    std::string extension = image_path.substr(extension_pos + 1);
+    std::ranges::transform(extension, extension.begin(), [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); });
+    return extension;
+}
+
 ImageData::ImageData(const Dimensions& dimensions, uint32_t channels_count, Data::Chunk&& pixels) noexcept
     : m_dimensions(dimensions)
     , m_channels_count(channels_count)
@@ -81,9 +103,13 @@ ImageData::~ImageData()
 #endif
 }
 
-ImageLoader::ImageLoader(Data::IProvider& data_provider)
+ImageLoader::ImageLoader(Data::IProvider& data_provider, PixelFormat hdr_pixel_format)
     : m_data_provider(data_provider)
-{ }
+    , m_hdr_pixel_format(hdr_pixel_format)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(IsHdrPixelFormat(hdr_pixel_format), "pixel format {} is not an HDR format", hdr_pixel_format);
+}
 
 ImageData ImageLoader::LoadImageData(const std::string& image_path, Data::Size channels_count, bool create_copy) const
 {
@@ -162,15 +188,29 @@ Rhi::Texture ImageLoader::LoadImageToTexture2D(const Rhi::CommandQueue& target_c
                                                ImageOptionMask options, const std::string& texture_name) const
 {
     META_FUNCTION_TASK();
-    const ImageData    image_data   = LoadImageData(image_path, 4, false);
-    const PixelFormat  image_format = GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
+    if (IsImageContainerPath(image_path))
+        return LoadImageContainerToTexture(target_cmd_queue, image_path, options, texture_name);
+
+    const bool         is_hdr_image = IsHdrImagePath(image_path);
+    const ImageData    image_data   = is_hdr_image ? LoadHdrImageData(image_path) : LoadImageData(image_path, 4, false);
+    const PixelFormat  image_format = is_hdr_image ? m_hdr_pixel_format : GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
 
     Rhi::Texture texture(target_cmd_queue.GetContext(),
                          Rhi::TextureSettings::ForImage(
                              image_data.GetDimensions(), std::nullopt, image_format,
-                             options.HasAnyBit(ImageOption::Mipmapped)));
+                             IsMipmapped(options)));
     texture.SetName(texture_name);
-    texture.SetData(target_cmd_queue, { { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } });
+
+    if (options.HasAnyBit(ImageOption::CpuMipmapped))
+    {
+        const MipChainGenerator mip_chain_generator({}, &target_cmd_queue.GetContext().GetParallelExecutor());
+        const MipChain mip_chain = mip_chain_generator.Generate(image_data.GetPixels(), image_data.GetDimensions(), image_format);
+        texture.SetData(target_cmd_queue, mip_chain.GetSubResources());
+    }
+    else
+    {
+        texture.SetData(target_cmd_queue, { { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } });
+    }
 
     return texture;
 }
@@ -185,15 +225,20 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
     std::vector<std::pair<Data::Index, ImageData>> face_images_data;
     face_images_data.reserve(image_paths.size());
 
+    // All faces are loaded as HDR images when the first face is an HDR image
+    const bool is_hdr_image = IsHdrImagePath(image_paths.front());
+
     tf::Taskflow load_task_flow;
     load_task_flow.for_each_index(0U, static_cast<uint32_t>(image_paths.size()), 1U,
-        [this, &image_paths, &face_images_data, &data_mutex](const uint32_t face_index)
+        [this, &image_paths, &face_images_data, &data_mutex, is_hdr_image](const uint32_t face_index)
         {
             META_FUNCTION_TASK();
             // We create a copy of the loaded image data (via 3-rd argument of LoadImageData)
             // to resolve a problem of STB image loader which requires an image data to be freed before next image is loaded
             constexpr uint32_t desired_channels_count = 4;
-            ImageData image_data = LoadImageData(image_paths[face_index], desired_channels_count, true);
+            ImageData image_data = is_hdr_image
+                                 ? LoadHdrImageData(image_paths[face_index])
+                                 : LoadImageData(image_paths[face_index], desired_channels_count, true);
 
             std::scoped_lock data_lock(data_mutex);
             face_images_data.emplace_back(face_index, std::move(image_data));
@@ -207,25 +252,118 @@ Rhi::Texture ImageLoader::LoadImagesToTextureCube(const Rhi::CommandQueue& targe
     const uint32_t   face_channels_count = face_images_data.front().second.GetChannelsCount();
     META_CHECK_EQUAL_DESCR(face_dimensions.GetWidth(), face_dimensions.GetHeight(), "all images of cube texture faces must have equal width and height");
 
+    const PixelFormat image_format = is_hdr_image ? m_hdr_pixel_format : GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
+    const MipChainGenerator mip_chain_generator({}, &target_cmd_queue.GetContext().GetParallelExecutor());
+    std::vector<MipChain> face_mip_chains;
+
     Rhi::IResource::SubResources face_sub_resources;
     face_sub_resources.reserve(face_images_data.size());
     for(const auto& [face_index, image_data] : face_images_data)
     {
         META_CHECK_EQUAL_DESCR(face_dimensions,     image_data.GetDimensions(),    "all face image of cube texture must have equal dimensions");
         META_CHECK_EQUAL_DESCR(face_channels_count, image_data.GetChannelsCount(), "all face image of cube texture must have equal channels count");
-        face_sub_resources.emplace_back(image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize(), Rhi::IResource::SubResource::Index(face_index));
+        if (options.HasAnyBit(ImageOption::CpuMipmapped))
+        {
+            const MipChain& face_mip_chain = face_mip_chains.emplace_back(mip_chain_generator.Generate(image_data.GetPixels(), face_dimensions, image_format));
+            const Rhi::SubResources face_mip_sub_resources = face_mip_chain.GetSubResources(face_index);
+            face_sub_resources.insert(face_sub_resources.end(), face_mip_sub_resources.begin(), face_mip_sub_resources.end());
+        }
+        else
+        {
+            face_sub_resources.emplace_back(image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize(), Rhi::IResource::SubResource::Index(face_index));
+        }
     }
 
     // Load face images to cube texture
-    const PixelFormat  image_format = GetDefaultImageFormat(options.HasAnyBit(ImageOption::SrgbColorSpace));
     Rhi::Texture texture(target_cmd_queue.GetContext(),
                          Rhi::TextureSettings::ForCubeImage(
                              face_dimensions.GetWidth(), std::nullopt,
-                             image_format, options.HasAnyBit(Option::Mipmapped)));
+                             image_format, IsMipmapped(options)));
     texture.SetName(texture_name);
     texture.SetData(target_cmd_queue, face_sub_resources);
 
     return texture;
 }
 
+bool ImageLoader::IsImageContainerPath(const std::string& image_path)
+{
+    META_FUNCTION_TASK();
+    const std::string extension = GetLowerCaseExtension(image_path);
+    return extension == "ktx2" || extension == "dds";
+}
+
+ImageContainer ImageLoader::LoadImageContainer(const std::string& image_path) const
+{
+    META_FUNCTION_TASK();
+    return ImageContainer(m_data_provider.GetData(image_path));
+}
+
+Rhi::Texture ImageLoader::LoadImageContainerToTexture(const Rhi::CommandQueue& target_cmd_queue, const std::string& image_path,
+                                                      ImageOptionMask options, const std::string& texture_name) const
+{
+    META_FUNCTION_TASK();
+    const ImageContainer image_container = LoadImageContainer(image_path);
+    return image_container.CreateTexture(target_cmd_queue, options.HasAnyBit(ImageOption::SrgbColorSpace), texture_name);
+}
+
+bool ImageLoader::IsHdrImagePath(const std::string& image_path)
+{
+    META_FUNCTION_TASK();
+    const std::string extension = GetLowerCaseExtension(image_path);
+    return extension == "hdr" || extension == "exr";
+}
+
+ImageData ImageLoader::LoadHdrImageData(const std::string& image_path) const
+{
+    META_FUNCTION_TASK();
+    constexpr uint32_t channels_count = 4U;
+
+#ifdef USE_OPEN_IMAGE_IO
+
+    const std::string image_file_path = Platform::GetResourceDir() + "/" + image_path;
+    OIIO::ImageBuf image_buf(image_file_path.c_str());
+
+    const OIIO::ImageSpec& image_spec = image_buf.spec();
+    META_CHECK_DESCR(image_path, !image_spec.undefined(), "failed to load image specification");
+
+    const bool read_success = image_buf.read();
+    META_CHECK_DESCR(image_path, read_success, "failed to read image data from file, error: {}", image_buf.geterror());
+
+    // Missing alpha channel is filled with ones
+    const OIIO::ROI image_roi = OIIO::get_roi(image_spec);
+    std::vector<float> float_pixels(channels_count * image_roi.npixels(), 1.F);
+    const bool decode_success = image_buf.get_pixels(image_roi, OIIO::TypeDesc::FLOAT, float_pixels.data(), channels_count * sizeof(float));
+    META_CHECK_DESCR(image_path, decode_success, "failed to decode image pixels, error: {}", image_buf.geterror());
+
+    const Dimensions image_dimensions(static_cast<uint32_t>(image_spec.width), static_cast<uint32_t>(image_spec.height));
+    return ImageData(image_dimensions, channels_count,
+                     Data::Chunk(ConvertHdrPixels(float_pixels.data(), image_dimensions.GetPixelsCount(), m_hdr_pixel_format)));
+
+#else
+
+    META_CHECK_FALSE_DESCR(GetLowerCaseExtension(image_path) == "exr", "OpenEXR image '{}' can be loaded only with OpenImageIO", image_path);
+    const Data::Chunk raw_image_data = m_data_provider.GetData(image_path);
+
+    int image_width = 0;
+    int image_height = 0;
+    int image_channels_count = 0;
+    float* image_data_ptr = stbi_loadf_from_memory(reinterpret_cast<const stbi_uc *>(raw_image_data.GetDataPtr()), // NOSONAR
+                                                   static_cast<int>(raw_image_data.GetDataSize()),
+                                                   &image_width, &image_height, &image_channels_count,
+                                                   static_cast<int>(channels_count));
+
+    META_CHECK_NOT_NULL_DESCR(image_data_ptr, "failed to load HDR image data from memory");
+    META_CHECK_GREATER_OR_EQUAL_DESCR(image_width, 1, "invalid image width");
+    META_CHECK_GREATER_OR_EQUAL_DESCR(image_height, 1, "invalid image height");
+
+    // Float pixels are converted to compact HDR format right after decoding, so that STB image data is freed early
+    const Dimensions image_dimensions(static_cast<uint32_t>(image_width), static_cast<uint32_t>(image_height));
+    Data::Bytes hdr_pixels = ConvertHdrPixels(image_data_ptr, image_dimensions.GetPixelsCount(), m_hdr_pixel_format);
+    stbi_image_free(image_data_ptr);
+
+    return ImageData(image_dimensions, channels_count, Data::Chunk(std::move(hdr_pixels)));
+
+#endif
+}
+
 } // namespace Methane::Graphics
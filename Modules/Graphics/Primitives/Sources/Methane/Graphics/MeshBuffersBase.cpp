@@ -34,40 +34,119 @@ Mesh buffers base implementation class.
 namespace Methane::Graphics
 {
 
+namespace // anonymous
+{
+
+[[nodiscard]] Mesh::Subsets GetMeshSubsets(const Mesh::Subsets& mesh_subsets, Mesh::Type mesh_type, Data::Size vertex_count, Data::Size index_count)
+{
+    if (!mesh_subsets.empty())
+        return mesh_subsets;
+
+    return Mesh::Subsets{
+        Mesh::Subset(mesh_type, { 0, vertex_count }, { 0, index_count }, true)
+    };
+}
+
+} // anonymous namespace
+
 MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const Mesh& mesh_data,
-                                 std::string_view mesh_name, const Mesh::Subsets& mesh_subsets)
+                                 std::string_view mesh_name, const Mesh::Subsets& mesh_subsets,
+                                 const SubsetLods& mesh_subset_lods)
     : m_context(render_cmd_queue.GetContext())
     , m_mesh_name(mesh_name)
-    , m_mesh_subsets(!mesh_subsets.empty()
-                    ? mesh_subsets
-                    : Mesh::Subsets{
-                        Mesh::Subset(mesh_data.GetType(),
-                                     { 0, mesh_data.GetVertexCount() },
-                                     { 0, mesh_data.GetIndexCount()  }, true )
-                      })
+    , m_mesh_subsets(GetMeshSubsets(mesh_subsets, mesh_data.GetType(), mesh_data.GetVertexCount(), mesh_data.GetIndexCount()))
 {
     META_FUNCTION_TASK();
+    InitializeVertexBuffer(render_cmd_queue, mesh_data.GetVertexData(), mesh_data.GetVertexDataSize(), mesh_data.GetVertexSize());
 
-    Rhi::Buffer vertex_buffer(m_context,
-        Rhi::BufferSettings::ForVertexBuffer(
-            mesh_data.GetVertexDataSize(),
-            mesh_data.GetVertexSize()));
-    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", mesh_name));
-    vertex_buffer.SetData(render_cmd_queue, {
-        mesh_data.GetVertexData(),
-        mesh_data.GetVertexDataSize()
-    });
-    m_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
+    META_CHECK_LESS_OR_EQUAL_DESCR(mesh_subset_lods.size(), m_mesh_subsets.size(), "levels of detail count is greater than mesh subsets count");
+    m_mesh_subset_lods.resize(m_mesh_subsets.size());
 
-    m_index_buffer = Rhi::Buffer(m_context,
-        Rhi::BufferSettings::ForIndexBuffer(
-            mesh_data.GetIndexDataSize(),
-            GetIndexFormat(mesh_data.GetIndex(0))));
-    m_index_buffer.SetName(fmt::format("{} Index Buffer", mesh_name));
-    m_index_buffer.SetData(render_cmd_queue, {
-        reinterpret_cast<Data::ConstRawPtr>(mesh_data.GetIndices().data()), // NOSONAR
-        mesh_data.GetIndexDataSize()
-    });
+    Mesh::Indices indices = mesh_data.GetIndices();
+    for(Data::Index subset_index = 0U; subset_index < m_mesh_subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
+        std::vector<SubsetLod>& subset_lods = m_mesh_subset_lods[subset_index];
+        subset_lods.push_back({ mesh_subset.indices, 0.F });
+        if (subset_index >= mesh_subset_lods.size())
+            continue;
+
+        for(const Mesh::Lod& lod : mesh_subset_lods[subset_index])
+        {
+            subset_lods.push_back({ Mesh::Subset::Slice(static_cast<Data::Size>(indices.size()), static_cast<Data::Size>(lod.indices.size())), lod.error });
+            indices.insert(indices.end(), lod.indices.begin(), lod.indices.end());
+        }
+    }
+
+    // Index buffer uses the narrowest index format, so meshes with more than 65536 vertices are drawn without splitting;
+    // levels of detail reference the same vertices as mesh indices, so they fit into the same index format
+    const PixelFormat index_format = mesh_data.GetIndexFormat();
+    const Data::Bytes index_data   = Mesh::GetIndexData(indices, index_format);
+    InitializeIndexBuffer(render_cmd_queue, index_data.data(), static_cast<Data::Size>(index_data.size()), index_format);
+}
+
+MeshBuffersBase::MeshBuffersBase(const Rhi::CommandQueue& render_cmd_queue, const MeshFile& mesh_file, std::string_view mesh_name)
+    : m_context(render_cmd_queue.GetContext())
+    , m_mesh_name(mesh_name)
+    , m_mesh_subsets(GetMeshSubsets(mesh_file.GetSubsets(), mesh_file.GetType(), mesh_file.GetVertexCount(), mesh_file.GetIndexCount()))
+{
+    META_FUNCTION_TASK();
+    // Vertex and index data of mesh file is uploaded to GPU directly from the file data chunk without intermediate copies
+    InitializeVertexBuffer(render_cmd_queue, mesh_file.GetVertexData(), mesh_file.GetVertexDataSize(), mesh_file.GetVertexSize());
+    InitializeIndexBuffer(render_cmd_queue, mesh_file.GetIndexData(), mesh_file.GetIndexDataSize(), mesh_file.GetIndexFormat());
+
+    m_mesh_subset_lods.reserve(m_mesh_subsets.size());
+    for(const Mesh::Subset& mesh_subset : m_mesh_subsets)
+    {
+        m_mesh_subset_lods.push_back({ SubsetLod{ mesh_subset.indices, 0.F } });
+    }
+}
+
+Data::Size MeshBuffersBase::GetSubsetLodsCount(Data::Index subset_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(subset_index, m_mesh_subset_lods.size());
+    return static_cast<Data::Size>(m_mesh_subset_lods[subset_index].size());
+}
+
+float MeshBuffersBase::GetSubsetLodError(Data::Index subset_index, Data::Index lod_index) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(subset_index, m_mesh_subset_lods.size());
+    META_CHECK_LESS(lod_index, m_mesh_subset_lods[subset_index].size());
+    return m_mesh_subset_lods[subset_index][lod_index].error;
+}
+
+Data::Index MeshBuffersBase::SelectSubsetLod(Data::Index subset_index, float max_error) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(subset_index, m_mesh_subset_lods.size());
+    const std::vector<SubsetLod>& subset_lods = m_mesh_subset_lods[subset_index];
+
+    // Errors grow with level of detail index, so the coarsest level within error limit is selected
+    Data::Index lod_index = 0U;
+    while(lod_index + 1U < subset_lods.size() && subset_lods[lod_index + 1U].error <= max_error)
+    {
+        ++lod_index;
+    }
+    return lod_index;
+}
+
+Data::Index MeshBuffersBase::GetInstanceLod(Data::Index instance_index) const noexcept
+{
+    return instance_index < m_instance_lods.size() ? m_instance_lods[instance_index] : 0U;
+}
+
+void MeshBuffersBase::SetInstanceLod(Data::Index instance_index, Data::Index lod_index)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_DESCR(lod_index, GetSubsetLodsCount(GetSubsetByInstanceIndex(instance_index)),
+                          "level of detail index is out of bounds of instance mesh subset levels");
+    if (instance_index >= m_instance_lods.size())
+    {
+        m_instance_lods.resize(instance_index + 1U, 0U);
+    }
+    m_instance_lods[instance_index] = lod_index;
 }
 
 Rhi::ResourceBarriers MeshBuffersBase::CreateBeginningResourceBarriers(const Rhi::Buffer* constants_buffer_ptr) const
@@ -99,19 +178,16 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
                            const Rhi::ProgramBindings& program_bindings,
                            uint32_t mesh_subset_index,
                            uint32_t instance_count,
-                           uint32_t start_instance) const
+                           uint32_t start_instance,
+                           uint32_t mesh_lod_index) const
 {
     META_FUNCTION_TASK();
     META_CHECK_LESS_DESCR(mesh_subset_index, m_mesh_subsets.size(), "can not draw mesh subset because its index is out of bounds");
 
-    const Mesh::Subset& mesh_subset = m_mesh_subsets[mesh_subset_index];
     cmd_list.SetProgramBindings(program_bindings);
     cmd_list.SetVertexBuffers(GetVertexBuffers());
     cmd_list.SetIndexBuffer(GetIndexBuffer());
-    cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
-                         mesh_subset.indices.count, mesh_subset.indices.offset,
-                         mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
-                         instance_count, start_instance);
+    DrawSubsetLod(cmd_list, mesh_subset_index, mesh_lod_index, instance_count, start_instance);
 }
 
 void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
@@ -145,19 +221,42 @@ void MeshBuffersBase::Draw(const Rhi::RenderCommandList& cmd_list,
 
         const uint32_t instance_index = first_instance_index + static_cast<uint32_t>(std::distance(instance_program_bindings_begin, instance_program_bindings_it));
         const uint32_t subset_index = GetSubsetByInstanceIndex(instance_index);
-
         META_CHECK_LESS(subset_index, m_mesh_subsets.size());
-        const Mesh::Subset& mesh_subset = m_mesh_subsets[subset_index];
 
         Rhi::ProgramBindingsApplyBehaviorMask apply_behavior = bindings_apply_behavior;
         apply_behavior.SetBit(Rhi::ProgramBindingsApplyBehavior::RetainResources,
                               !retain_bindings_once || instance_program_bindings_it == instance_program_bindings_begin);
 
         cmd_list.SetProgramBindings(program_bindings, apply_behavior);
-        cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
-                             mesh_subset.indices.count, mesh_subset.indices.offset,
-                             mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
-                             1, 0);
+        DrawSubsetLod(cmd_list, subset_index, GetInstanceLod(instance_index), 1U, 0U);
+    }
+}
+
+void MeshBuffersBase::DrawInstanced(const Rhi::RenderCommandList& cmd_list,
+                                    const InstancedProgramBindings& subset_program_bindings,
+                                    std::span<const uint32_t> subset_instance_counts,
+                                    Rhi::ProgramBindingsApplyBehaviorMask bindings_apply_behavior,
+                                    bool set_resource_barriers) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL_DESCR(subset_program_bindings.size(), m_mesh_subsets.size(), "program bindings are required for each mesh subset");
+    META_CHECK_EQUAL_DESCR(subset_instance_counts.size(), m_mesh_subsets.size(), "instance count is required for each mesh subset");
+
+    cmd_list.SetVertexBuffers(GetVertexBuffers(), set_resource_barriers);
+    cmd_list.SetIndexBuffer(GetIndexBuffer(), set_resource_barriers);
+
+    for(Data::Index subset_index = 0U; subset_index < m_mesh_subsets.size(); ++subset_index)
+    {
+        const uint32_t instance_count = subset_instance_counts[subset_index];
+        if (!instance_count)
+            continue;
+
+        const Rhi::ProgramBindings& program_bindings = subset_program_bindings[subset_index];
+        META_CHECK_TRUE(program_bindings.IsInitialized());
+
+        // Storage buffer view of subset program bindings starts from the first instance of subset, so instance ID starts from zero
+        cmd_list.SetProgramBindings(program_bindings, bindings_apply_behavior);
+        DrawSubsetLod(cmd_list, subset_index, 0U, instance_count, 0U);
     }
 }
 
@@ -190,4 +289,49 @@ void MeshBuffersBase::DrawParallel(const Rhi::ParallelRenderCommandList& paralle
     m_context.GetParallelExecutor().run(render_task_flow).get();
 }
 
+void MeshBuffersBase::DrawSubsetLod(const Rhi::RenderCommandList& cmd_list, Data::Index subset_index, Data::Index lod_index,
+                                    uint32_t instance_count, uint32_t start_instance) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_DESCR(lod_index, m_mesh_subset_lods[subset_index].size(), "can not draw mesh subset level of detail because its index is out of bounds");
+
+    const Mesh::Subset&        mesh_subset = m_mesh_subsets[subset_index];
+    const Mesh::Subset::Slice& lod_indices = m_mesh_subset_lods[subset_index][lod_index].indices;
+    cmd_list.DrawIndexed(Rhi::RenderPrimitive::Triangle,
+                         lod_indices.count, lod_indices.offset,
+                         mesh_subset.indices_adjusted ? 0 : mesh_subset.vertices.offset,
+                         instance_count, start_instance);
+}
+
+void MeshBuffersBase::InitializeVertexBuffer(const Rhi::CommandQueue& render_cmd_queue, Data::ConstRawPtr vertex_data_ptr,
+                                             Data::Size vertex_data_size, Data::Size vertex_size)
+{
+    META_FUNCTION_TASK();
+    Rhi::Buffer vertex_buffer(m_context,
+        Rhi::BufferSettings::ForVertexBuffer(
+            vertex_data_size,
+            vertex_size));
+    vertex_buffer.SetName(fmt::format("{} Vertex Buffer", m_mesh_name));
+    vertex_buffer.SetData(render_cmd_queue, {
+        vertex_data_ptr,
+        vertex_data_size
+    });
+    m_vertex_buffer_set = Rhi::BufferSet(Rhi::BufferType::Vertex, { vertex_buffer });
+}
+
+void MeshBuffersBase::InitializeIndexBuffer(const Rhi::CommandQueue& render_cmd_queue, Data::ConstRawPtr index_data_ptr,
+                                            Data::Size index_data_size, PixelFormat index_format)
+{
+    META_FUNCTION_TASK();
+    m_index_buffer = Rhi::Buffer(m_context,
+        Rhi::BufferSettings::ForIndexBuffer(
+            index_data_size,
+            index_format));
+    m_index_buffer.SetName(fmt::format("{} Index Buffer", m_mesh_name));
+    m_index_buffer.SetData(render_cmd_queue, {
+        index_data_ptr,
+        index_data_size
+    });
+}
+
 } // namespace Methane::Graphics
@@ -0,0 +1,579 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/MipChainGenerator.cpp
+Mip chain generator downsamples image on CPU with box or Kaiser filter,
+which is vectorized per pixel and parallelized by rows of mip level.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/HdrPixelConverter.h>
+#include <Methane/Graphics/TypeFormatters.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <hlsl++_vector_float.h>
+#include <taskflow/taskflow.hpp>
+#include <taskflow/algorithm/for_each.hpp>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <numbers>
+#include <optional>
+
+namespace Methane::Graphics
+{
+
+static constexpr uint32_t g_parallel_chunk_pixels_count = 64U * 1024U;
+static constexpr uint32_t g_srgb_encode_table_size      = 4096U;
+
+namespace
+{
+
+[[nodiscard]]
+float ConvertSrgbToLinear(float value) noexcept
+{
+    return value <= 0.04045F ? value / 12.92F : std::pow((value + 0.055F) / 1.055F, 2.4F);
+}
+
+[[nodiscard]]
+float ConvertLinearToSrgb(float value) noexcept
+{
+    return value <= 0.0031308F ? value * 12.92F : 1.055F * std::pow(value, 1.F / 2.4F) - 0.055F;
+}
+
+// Tables are used for fast gamma correction of 8-bit colors: linear values are quantized to 12 bits on encoding
+struct SrgbTables
+{
+    std::array<float,   256U>                      decode;
+    std::array<uint8_t, g_srgb_encode_table_size> encode;
+
+    SrgbTables() noexcept
+    {
+        for(uint32_t index = 0U; index < decode.size(); ++index)
+        {
+            decode[index] = ConvertSrgbToLinear(static_cast<float>(index) / 255.F);
+        }
+        for(uint32_t index = 0U; index < encode.size(); ++index)
+        {
+            const float srgb_value = ConvertLinearToSrgb(static_cast<float>(index) / static_cast<float>(g_srgb_encode_table_size - 1U));
+            encode[index] = static_cast<uint8_t>(std::clamp(srgb_value, 0.F, 1.F) * 255.F + 0.5F);
+        }
+    }
+
+    [[nodiscard]] static const SrgbTables& Get() noexcept
+    {
+        static const SrgbTables s_srgb_tables;
+        return s_srgb_tables;
+    }
+};
+
+[[nodiscard]]
+uint8_t ToByte(Data::Byte byte) noexcept
+{
+    return std::to_integer<uint8_t>(byte);
+}
+
+[[nodiscard]]
+std::array<float, 4> StoreUnorm(const hlslpp::float4& color, float max_value) noexcept
+{
+    std::array<float, 4> components{};
+    hlslpp::store(hlslpp::saturate(color) * hlslpp::float4(max_value) + hlslpp::float4(0.5F), components.data());
+    return components;
+}
+
+// Pixel codecs convert pixels of supported formats to 4-component float vectors and back
+
+struct Unorm8x4Codec
+{
+    static constexpr uint32_t pixel_size = 4U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        return hlslpp::float4(static_cast<float>(ToByte(pixel_ptr[0])), static_cast<float>(ToByte(pixel_ptr[1])),
+                              static_cast<float>(ToByte(pixel_ptr[2])), static_cast<float>(ToByte(pixel_ptr[3])))
+             * hlslpp::float4(1.F / 255.F);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        const std::array<float, 4> components = StoreUnorm(color, 255.F);
+        for(uint32_t channel = 0U; channel < pixel_size; ++channel)
+        {
+            pixel_ptr[channel] = static_cast<Data::Byte>(components[channel]);
+        }
+    }
+};
+
+// Color channels are converted to linear space, while alpha channel is linear already
+struct Srgb8x4Codec
+{
+    static constexpr uint32_t pixel_size = 4U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        const SrgbTables& srgb_tables = SrgbTables::Get();
+        return hlslpp::float4(srgb_tables.decode[ToByte(pixel_ptr[0])], srgb_tables.decode[ToByte(pixel_ptr[1])],
+                              srgb_tables.decode[ToByte(pixel_ptr[2])], static_cast<float>(ToByte(pixel_ptr[3])) / 255.F);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        const SrgbTables& srgb_tables = SrgbTables::Get();
+        const std::array<float, 4> encode_indices = StoreUnorm(color, static_cast<float>(g_srgb_encode_table_size - 1U));
+        for(uint32_t channel = 0U; channel < 3U; ++channel)
+        {
+            pixel_ptr[channel] = static_cast<Data::Byte>(srgb_tables.encode[static_cast<uint32_t>(encode_indices[channel])]);
+        }
+        pixel_ptr[3] = static_cast<Data::Byte>(StoreUnorm(color, 255.F)[3]);
+    }
+};
+
+struct Unorm8x1Codec
+{
+    static constexpr uint32_t pixel_size = 1U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        return hlslpp::float4(static_cast<float>(ToByte(pixel_ptr[0])) / 255.F, 0.F, 0.F, 0.F);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        pixel_ptr[0] = static_cast<Data::Byte>(StoreUnorm(color, 255.F)[0]);
+    }
+};
+
+struct Float32x1Codec
+{
+    static constexpr uint32_t pixel_size = 4U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        float value = 0.F;
+        std::memcpy(&value, pixel_ptr, sizeof(float));
+        return hlslpp::float4(value, 0.F, 0.F, 0.F);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        std::array<float, 4> components{};
+        hlslpp::store(color, components.data());
+        std::memcpy(pixel_ptr, components.data(), sizeof(float));
+    }
+};
+
+struct Float32x4Codec
+{
+    static constexpr uint32_t pixel_size = 16U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        std::array<float, 4> components{};
+        std::memcpy(components.data(), pixel_ptr, pixel_size);
+        return hlslpp::float4(components[0], components[1], components[2], components[3]);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        std::array<float, 4> components{};
+        hlslpp::store(color, components.data());
+        std::memcpy(pixel_ptr, components.data(), pixel_size);
+    }
+};
+
+struct Half16x4Codec
+{
+    static constexpr uint32_t pixel_size = 8U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        std::array<uint16_t, 4> components{};
+        std::memcpy(components.data(), pixel_ptr, pixel_size);
+        return hlslpp::float4(ConvertHalfToFloat(components[0]), ConvertHalfToFloat(components[1]),
+                              ConvertHalfToFloat(components[2]), ConvertHalfToFloat(components[3]));
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        std::array<float, 4> components{};
+        hlslpp::store(color, components.data());
+        const std::array<uint16_t, 4> half_components{
+            ConvertFloatToHalf(components[0]), ConvertFloatToHalf(components[1]),
+            ConvertFloatToHalf(components[2]), ConvertFloatToHalf(components[3])
+        };
+        std::memcpy(pixel_ptr, half_components.data(), pixel_size);
+    }
+};
+
+template<HdrColor(*unpack)(uint32_t), uint32_t(*pack)(const HdrColor&)>
+struct PackedFloatCodec
+{
+    static constexpr uint32_t pixel_size = 4U;
+
+    [[nodiscard]] static hlslpp::float4 Decode(Data::ConstRawPtr pixel_ptr) noexcept
+    {
+        uint32_t packed_color = 0U;
+        std::memcpy(&packed_color, pixel_ptr, pixel_size);
+        const HdrColor color = unpack(packed_color);
+        return hlslpp::float4(color[0], color[1], color[2], 1.F);
+    }
+
+    static void Encode(const hlslpp::float4& color, Data::RawPtr pixel_ptr) noexcept
+    {
+        std::array<float, 4> components{};
+        hlslpp::store(color, components.data());
+        const uint32_t packed_color = pack(HdrColor{ components[0], components[1], components[2] });
+        std::memcpy(pixel_ptr, &packed_color, pixel_size);
+    }
+};
+
+using RG11B10FloatCodec = PackedFloatCodec<&UnpackRG11B10Float, &PackRG11B10Float>;
+using RGB9E5FloatCodec  = PackedFloatCodec<&UnpackRGB9E5Float, &PackRGB9E5Float>;
+
+// Zero-order modified Bessel function of the first kind
+[[nodiscard]]
+float GetBesselI0(float x) noexcept
+{
+    float sum  = 1.F;
+    float term = 1.F;
+    const float half_x_squared = x * x / 4.F;
+    for(uint32_t k = 1U; k < 32U && term > sum * 1E-7F; ++k)
+    {
+        term *= half_x_squared / static_cast<float>(k * k);
+        sum  += term;
+    }
+    return sum;
+}
+
+[[nodiscard]]
+float GetKaiserWeight(float x, float radius, float alpha) noexcept
+{
+    const float window_x = x / radius;
+    if (std::abs(window_x) >= 1.F)
+        return 0.F;
+
+    const float sinc = x == 0.F ? 1.F : std::sin(std::numbers::pi_v<float> * x) / (std::numbers::pi_v<float> * x);
+    return sinc * GetBesselI0(alpha * std::sqrt(1.F - window_x * window_x)) / GetBesselI0(alpha);
+}
+
+// Filter taps of all target pixels along one axis with equal taps count, weights are normalized
+struct FilterTaps
+{
+    uint32_t              taps_count = 0U;
+    std::vector<uint32_t> source_indices;
+    std::vector<float>    weights;
+
+    FilterTaps(uint32_t source_size, uint32_t target_size, const MipChainSettings& settings)
+    {
+        const float scale   = static_cast<float>(source_size) / static_cast<float>(target_size);
+        const float support = settings.kaiser_radius * scale;
+        taps_count = static_cast<uint32_t>(std::ceil(support * 2.F)) + 1U;
+        source_indices.resize(static_cast<size_t>(taps_count) * target_size);
+        weights.resize(static_cast<size_t>(taps_count) * target_size);
+
+        for(uint32_t target_index = 0U; target_index < target_size; ++target_index)
+        {
+            const float center      = (static_cast<float>(target_index) + 0.5F) * scale;
+            const auto  first_index = static_cast<int32_t>(std::floor(center - support));
+            const size_t taps_offset = static_cast<size_t>(target_index) * taps_count;
+            float weights_sum = 0.F;
+
+            for(uint32_t tap_index = 0U; tap_index < taps_count; ++tap_index)
+            {
+                const int32_t source_index = first_index + static_cast<int32_t>(tap_index);
+                const float   tap_x        = (static_cast<float>(source_index) + 0.5F - center) / scale;
+                const float   weight       = GetKaiserWeight(tap_x, settings.kaiser_radius, settings.kaiser_alpha);
+                source_indices[taps_offset + tap_index] = static_cast<uint32_t>(std::clamp(source_index, 0, static_cast<int32_t>(source_size) - 1));
+                weights[taps_offset + tap_index] = weight;
+                weights_sum += weight;
+            }
+            for(uint32_t tap_index = 0U; tap_index < taps_count; ++tap_index)
+            {
+                weights[taps_offset + tap_index] /= weights_sum;
+            }
+        }
+    }
+};
+
+struct LevelDescription
+{
+    Data::ConstRawPtr source_pixels_ptr;
+    Dimensions        source_dimensions;
+    Data::RawPtr      target_pixels_ptr;
+    Dimensions        target_dimensions;
+};
+
+template<typename Codec>
+void DownsampleBoxRows(const LevelDescription& level, uint32_t begin_row, uint32_t end_row)
+{
+    const uint32_t source_width     = level.source_dimensions.GetWidth();
+    const uint32_t source_row_pitch = source_width * Codec::pixel_size;
+    const uint32_t target_row_pitch = level.target_dimensions.GetWidth() * Codec::pixel_size;
+    const hlslpp::float4 quarter(0.25F);
+
+    for(uint32_t y = begin_row; y < end_row; ++y)
+    {
+        const Data::ConstRawPtr source_row_0_ptr = level.source_pixels_ptr + std::min(y * 2U,      level.source_dimensions.GetHeight() - 1U) * source_row_pitch;
+        const Data::ConstRawPtr source_row_1_ptr = level.source_pixels_ptr + std::min(y * 2U + 1U, level.source_dimensions.GetHeight() - 1U) * source_row_pitch;
+        Data::RawPtr target_pixel_ptr = level.target_pixels_ptr + y * target_row_pitch;
+
+        for(uint32_t x = 0U; x < level.target_dimensions.GetWidth(); ++x, target_pixel_ptr += Codec::pixel_size)
+        {
+            const uint32_t x_0 = std::min(x * 2U,      source_width - 1U) * Codec::pixel_size;
+            const uint32_t x_1 = std::min(x * 2U + 1U, source_width - 1U) * Codec::pixel_size;
+            const hlslpp::float4 color = (Codec::Decode(source_row_0_ptr + x_0) + Codec::Decode(source_row_0_ptr + x_1) +
+                                          Codec::Decode(source_row_1_ptr + x_0) + Codec::Decode(source_row_1_ptr + x_1)) * quarter;
+            Codec::Encode(color, target_pixel_ptr);
+        }
+    }
+}
+
+// Separable filter: source rows of vertical taps are filtered horizontally and accumulated with vertical weights
+template<typename Codec>
+void DownsampleKaiserRows(const LevelDescription& level, const FilterTaps& horizontal_taps, const FilterTaps& vertical_taps,
+                          uint32_t begin_row, uint32_t end_row)
+{
+    const uint32_t target_width     = level.target_dimensions.GetWidth();
+    const uint32_t source_row_pitch = level.source_dimensions.GetWidth() * Codec::pixel_size;
+    const uint32_t target_row_pitch = target_width * Codec::pixel_size;
+    std::vector<hlslpp::float4> accumulated_row(target_width);
+
+    for(uint32_t y = begin_row; y < end_row; ++y)
+    {
+        std::ranges::fill(accumulated_row, hlslpp::float4(0.F));
+        const size_t vertical_taps_offset = static_cast<size_t>(y) * vertical_taps.taps_count;
+
+        for(uint32_t vertical_tap = 0U; vertical_tap < vertical_taps.taps_count; ++vertical_tap)
+        {
+            const float vertical_weight = vertical_taps.weights[vertical_taps_offset + vertical_tap];
+            if (vertical_weight == 0.F)
+                continue;
+
+            const Data::ConstRawPtr source_row_ptr = level.source_pixels_ptr + vertical_taps.source_indices[vertical_taps_offset + vertical_tap] * source_row_pitch;
+            const hlslpp::float4 vertical_weights(vertical_weight);
+            for(uint32_t x = 0U; x < target_width; ++x)
+            {
+                const size_t horizontal_taps_offset = static_cast<size_t>(x) * horizontal_taps.taps_count;
+                hlslpp::float4 color(0.F);
+                for(uint32_t horizontal_tap = 0U; horizontal_tap < horizontal_taps.taps_count; ++horizontal_tap)
+                {
+                    const uint32_t source_x = horizontal_taps.source_indices[horizontal_taps_offset + horizontal_tap];
+                    color += Codec::Decode(source_row_ptr + source_x * Codec::pixel_size) *
+                             hlslpp::float4(horizontal_taps.weights[horizontal_taps_offset + horizontal_tap]);
+                }
+                accumulated_row[x] += color * vertical_weights;
+            }
+        }
+
+        Data::RawPtr target_pixel_ptr = level.target_pixels_ptr + y * target_row_pitch;
+        for(uint32_t x = 0U; x < target_width; ++x, target_pixel_ptr += Codec::pixel_size)
+        {
+            Codec::Encode(accumulated_row[x], target_pixel_ptr);
+        }
+    }
+}
+
+template<typename Codec>
+void GenerateMipLevelWithCodec(const LevelDescription& level, const MipChainSettings& settings, tf::Executor* parallel_executor_ptr)
+{
+    META_FUNCTION_TASK();
+    std::optional<FilterTaps> horizontal_taps_opt;
+    std::optional<FilterTaps> vertical_taps_opt;
+    if (settings.filter == MipFilter::Kaiser)
+    {
+        horizontal_taps_opt.emplace(level.source_dimensions.GetWidth(),  level.target_dimensions.GetWidth(),  settings);
+        vertical_taps_opt.emplace(level.source_dimensions.GetHeight(), level.target_dimensions.GetHeight(), settings);
+    }
+
+    const auto downsample_rows = [&level, &horizontal_taps_opt, &vertical_taps_opt](uint32_t begin_row, uint32_t end_row)
+    {
+        if (horizontal_taps_opt)
+            DownsampleKaiserRows<Codec>(level, *horizontal_taps_opt, *vertical_taps_opt, begin_row, end_row);
+        else
+            DownsampleBoxRows<Codec>(level, begin_row, end_row);
+    };
+
+    const uint32_t target_height = level.target_dimensions.GetHeight();
+    const uint32_t chunk_rows_count = std::max(1U, g_parallel_chunk_pixels_count / level.target_dimensions.GetWidth());
+    if (!parallel_executor_ptr || chunk_rows_count >= target_height)
+    {
+        downsample_rows(0U, target_height);
+        return;
+    }
+
+    const uint32_t chunks_count = (target_height + chunk_rows_count - 1U) / chunk_rows_count;
+    tf::Taskflow task_flow;
+    task_flow.for_each_index(0U, chunks_count, 1U,
+        [chunk_rows_count, target_height, &downsample_rows](const uint32_t chunk_index)
+        {
+            const uint32_t begin_row = chunk_index * chunk_rows_count;
+            downsample_rows(begin_row, std::min(begin_row + chunk_rows_count, target_height));
+        }
+    );
+    parallel_executor_ptr->run(task_flow).get();
+}
+
+} // anonymous namespace
+
+MipChain::MipChain(PixelFormat pixel_format, const Dimensions& dimensions, const Data::Chunk& base_level_pixels,
+                   std::vector<Data::Bytes>&& mip_levels_pixels)
+    : m_pixel_format(pixel_format)
+    , m_dimensions(dimensions)
+    , m_base_level_data_ptr(base_level_pixels.GetDataPtr())
+    , m_base_level_data_size(base_level_pixels.GetDataSize())
+    , m_mip_levels_pixels(std::move(mip_levels_pixels))
+{ }
+
+Dimensions MipChain::GetMipLevelDimensions(uint32_t mip_level) const noexcept
+{
+    META_FUNCTION_TASK();
+    return Dimensions(std::max(1U, m_dimensions.GetWidth()  >> mip_level),
+                      std::max(1U, m_dimensions.GetHeight() >> mip_level));
+}
+
+Data::Chunk MipChain::GetMipLevelPixels(uint32_t mip_level) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_LESS_DESCR(mip_level, GetMipLevelsCount(), "mip level is out of mip chain range");
+    if (!mip_level)
+        return Data::Chunk(m_base_level_data_ptr, m_base_level_data_size);
+
+    const Data::Bytes& mip_level_pixels = m_mip_levels_pixels[mip_level - 1U];
+    return Data::Chunk(mip_level_pixels.data(), static_cast<Data::Size>(mip_level_pixels.size()));
+}
+
+Data::Size MipChain::GetDataSize() const noexcept
+{
+    META_FUNCTION_TASK();
+    Data::Size data_size = m_base_level_data_size;
+    for(const Data::Bytes& mip_level_pixels : m_mip_levels_pixels)
+    {
+        data_size += static_cast<Data::Size>(mip_level_pixels.size());
+    }
+    return data_size;
+}
+
+Rhi::SubResources MipChain::GetSubResources(Data::Index depth_slice, Data::Index array_index) const
+{
+    META_FUNCTION_TASK();
+    Rhi::SubResources sub_resources;
+    sub_resources.reserve(GetMipLevelsCount());
+    sub_resources.emplace_back(m_base_level_data_ptr, m_base_level_data_size, Rhi::SubResourceIndex(depth_slice, array_index, 0U));
+    for(uint32_t mip_level = 1U; mip_level < GetMipLevelsCount(); ++mip_level)
+    {
+        const Data::Bytes& mip_level_pixels = m_mip_levels_pixels[mip_level - 1U];
+        sub_resources.emplace_back(mip_level_pixels.data(), static_cast<Data::Size>(mip_level_pixels.size()),
+                                   Rhi::SubResourceIndex(depth_slice, array_index, mip_level));
+    }
+    return sub_resources;
+}
+
+MipChainGenerator::MipChainGenerator(const Settings& settings, tf::Executor* parallel_executor_ptr)
+    : m_settings(settings)
+    , m_parallel_executor_ptr(parallel_executor_ptr)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_GREATER_DESCR(m_settings.kaiser_radius, 0.F, "Kaiser filter radius should be positive");
+}
+
+bool MipChainGenerator::IsPixelFormatSupported(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    switch(pixel_format)
+    {
+    using enum PixelFormat;
+    case RGBA8Unorm:
+    case RGBA8Unorm_sRGB:
+    case BGRA8Unorm:
+    case BGRA8Unorm_sRGB:
+    case R8Unorm:
+    case R32Float:
+    case RGBA32Float:
+    case RGBA16Float:
+    case RG11B10Float:
+    case RGB9E5Float:
+        return true;
+    default:
+        return false;
+    }
+}
+
+uint32_t MipChainGenerator::GetMipLevelsCount(const Dimensions& dimensions) noexcept
+{
+    META_FUNCTION_TASK();
+    return static_cast<uint32_t>(std::bit_width(std::max(dimensions.GetWidth(), dimensions.GetHeight())));
+}
+
+MipChain MipChainGenerator::Generate(const Data::Chunk& base_level_pixels, const Dimensions& dimensions, PixelFormat pixel_format) const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(IsPixelFormatSupported(pixel_format), "pixel format {} is not supported by mip chain generator", pixel_format);
+    META_CHECK_NOT_ZERO_DESCR(dimensions.GetWidth() * dimensions.GetHeight(), "image dimensions should not be zero");
+    META_CHECK_EQUAL_DESCR(base_level_pixels.GetDataSize(), GetImageSlicePitch(pixel_format, dimensions.GetWidth(), dimensions.GetHeight()),
+                           "base level pixels data size does not match image dimensions {}", static_cast<std::string>(dimensions));
+
+    const uint32_t mip_levels_count = GetMipLevelsCount(dimensions);
+    std::vector<Data::Bytes> mip_levels_pixels;
+    mip_levels_pixels.reserve(mip_levels_count - 1U);
+
+    // Each mip level is downsampled from the previous one
+    Data::ConstRawPtr source_pixels_ptr = base_level_pixels.GetDataPtr();
+    Dimensions        source_dimensions(dimensions.GetWidth(), dimensions.GetHeight());
+    for(uint32_t mip_level = 1U; mip_level < mip_levels_count; ++mip_level)
+    {
+        const Dimensions target_dimensions(std::max(1U, source_dimensions.GetWidth() / 2U),
+                                           std::max(1U, source_dimensions.GetHeight() / 2U));
+        Data::Bytes& target_pixels = mip_levels_pixels.emplace_back(
+            GetImageSlicePitch(pixel_format, target_dimensions.GetWidth(), target_dimensions.GetHeight()));
+        GenerateMipLevel(source_pixels_ptr, source_dimensions, target_pixels.data(), target_dimensions, pixel_format);
+
+        source_pixels_ptr = target_pixels.data();
+        source_dimensions = target_dimensions;
+    }
+
+    return MipChain(pixel_format, Dimensions(dimensions.GetWidth(), dimensions.GetHeight()), base_level_pixels, std::move(mip_levels_pixels));
+}
+
+void MipChainGenerator::GenerateMipLevel(Data::ConstRawPtr source_pixels_ptr, const Dimensions& source_dimensions,
+                                         Data::RawPtr target_pixels_ptr, const Dimensions& target_dimensions,
+                                         PixelFormat pixel_format) const
+{
+    META_FUNCTION_TASK();
+    const LevelDescription level{ source_pixels_ptr, source_dimensions, target_pixels_ptr, target_dimensions };
+    switch(pixel_format)
+    {
+    using enum PixelFormat;
+    case RGBA8Unorm:
+    case BGRA8Unorm:      GenerateMipLevelWithCodec<Unorm8x4Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case RGBA8Unorm_sRGB:
+    case BGRA8Unorm_sRGB: GenerateMipLevelWithCodec<Srgb8x4Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case R8Unorm:         GenerateMipLevelWithCodec<Unorm8x1Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case R32Float:        GenerateMipLevelWithCodec<Float32x1Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case RGBA32Float:     GenerateMipLevelWithCodec<Float32x4Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case RGBA16Float:     GenerateMipLevelWithCodec<Half16x4Codec>(level, m_settings, m_parallel_executor_ptr); break;
+    case RG11B10Float:    GenerateMipLevelWithCodec<RG11B10FloatCodec>(level, m_settings, m_parallel_executor_ptr); break;
+    case RGB9E5Float:     GenerateMipLevelWithCodec<RGB9E5FloatCodec>(level, m_settings, m_parallel_executor_ptr); break;
+    default:              META_UNEXPECTED(pixel_format);
+    }
+}
+
+} // namespace Methane::Graphics
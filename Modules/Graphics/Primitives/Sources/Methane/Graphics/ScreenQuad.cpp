@@ -217,13 +217,14 @@ public:
         m_index_buffer = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::Buffer>(s_index_buffer_name);
         if (!m_index_buffer.IsInitialized())
         {
+            const Data::Bytes quad_index_data = s_quad_mesh.GetIndexData();
             m_index_buffer = render_context.CreateBuffer(
                 Rhi::BufferSettings::ForIndexBuffer(
                     s_quad_mesh.GetIndexDataSize(),
-                    GetIndexFormat(s_quad_mesh.GetIndex(0))));
+                    s_quad_mesh.GetIndexFormat()));
             m_index_buffer.SetName(s_index_buffer_name);
             m_index_buffer.SetData(m_render_cmd_queue, {
-                reinterpret_cast<Data::ConstRawPtr>(s_quad_mesh.GetIndices().data()), // NOSONAR
+                quad_index_data.data(),
                 s_quad_mesh.GetIndexDataSize()
             });
             render_context.GetObjectRegistry().AddGraphicsObject(m_index_buffer);
@@ -0,0 +1,477 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/TextureStreamer.cpp
+Texture streamer loads images asynchronously: images are decoded in parallel
+with prioritized tasks of context executor, while textures are created and uploaded
+on render thread with limited bytes budget per frame and coarse previews.
+
+******************************************************************************/
+
+#include <Methane/Graphics/TextureStreamer.h>
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/RHI/IContext.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <functional>
+#include <atomic>
+#include <exception>
+#include <utility>
+
+namespace Methane::Graphics
+{
+
+static constexpr uint32_t g_image_channels_count = 4U;
+
+struct StreamedTexture::Request
+{
+    Request(const std::string& image_path, const std::string& texture_name, ImageOptionMask options,
+            int32_t priority, uint64_t sequence_index)
+        : image_path(image_path)
+        , texture_name(texture_name)
+        , options(options)
+        , sequence_index(sequence_index)
+        , priority(priority)
+    { }
+
+    const std::string     image_path;
+    const std::string     texture_name;
+    const ImageOptionMask options;
+    const uint64_t        sequence_index;
+    std::atomic<int32_t>  priority;
+    std::atomic<State>    state{ State::Queued };
+
+    // Decoded data is written on executor thread before setting Decoded state and is used on render thread after that
+    Opt<ImageData>        image_data_opt;
+    Opt<ImageContainer>   image_container_opt;
+    Opt<MipChain>         mip_chain_opt; // references pixels of decoded image data
+    Data::Bytes           preview_pixels;
+    Dimensions            preview_dimensions;
+    uint32_t              preview_mip_level = 0U;
+    std::string           error_message;
+
+    // Texture is created on render thread only
+    Rhi::Texture          texture;
+    std::atomic<uint32_t> streamed_mip_level{ 0U };
+
+    bool TrySetState(State from_state, State to_state) noexcept
+    {
+        return state.compare_exchange_strong(from_state, to_state);
+    }
+
+    [[nodiscard]] bool IsCancelled() const noexcept
+    {
+        return state == State::Cancelled;
+    }
+
+    [[nodiscard]] bool IsStreamingFinished() const noexcept
+    {
+        const State current_state = state;
+        return current_state == State::Complete || current_state == State::Cancelled || current_state == State::Failed;
+    }
+
+    [[nodiscard]] bool HasPreview() const noexcept
+    {
+        return preview_mip_level > 0U;
+    }
+
+    [[nodiscard]] Data::Size GetFullDataSize() const noexcept
+    {
+        if (mip_chain_opt)
+            return mip_chain_opt->GetDataSize();
+        if (image_container_opt)
+            return image_container_opt->GetPixelsDataSize();
+        return image_data_opt ? image_data_opt->GetPixels().GetDataSize() : 0U;
+    }
+};
+
+[[nodiscard]]
+static bool IsHigherPriority(const Ptr<StreamedTexture::Request>& left_ptr, const Ptr<StreamedTexture::Request>& right_ptr) noexcept
+{
+    const int32_t left_priority  = left_ptr->priority;
+    const int32_t right_priority = right_ptr->priority;
+    return left_priority == right_priority
+         ? left_ptr->sequence_index < right_ptr->sequence_index
+         : left_priority > right_priority;
+}
+
+[[nodiscard]]
+static PixelFormat GetImagePixelFormat(ImageOptionMask options) noexcept
+{
+    return options.HasAnyBit(ImageOption::SrgbColorSpace) ? PixelFormat::RGBA8Unorm_sRGB : PixelFormat::RGBA8Unorm;
+}
+
+// Box filter of 2x2 pixel blocks with edge pixels clamping for odd image dimensions
+[[nodiscard]]
+static Data::Bytes DownsampleImage(const Data::Byte* pixels_ptr, const Dimensions& dimensions, const Dimensions& half_dimensions)
+{
+    META_FUNCTION_TASK();
+    const uint32_t row_pitch      = dimensions.GetWidth() * g_image_channels_count;
+    const uint32_t half_row_pitch = half_dimensions.GetWidth() * g_image_channels_count;
+    Data::Bytes half_pixels(static_cast<size_t>(half_row_pitch) * half_dimensions.GetHeight());
+
+    for(uint32_t y = 0U; y < half_dimensions.GetHeight(); ++y)
+    {
+        const Data::Byte* row_0_ptr = pixels_ptr + std::min(y * 2U,      dimensions.GetHeight() - 1U) * row_pitch;
+        const Data::Byte* row_1_ptr = pixels_ptr + std::min(y * 2U + 1U, dimensions.GetHeight() - 1U) * row_pitch;
+        Data::Byte*       half_row_ptr = half_pixels.data() + y * half_row_pitch;
+
+        for(uint32_t x = 0U; x < half_dimensions.GetWidth(); ++x)
+        {
+            const uint32_t x_0 = std::min(x * 2U,      dimensions.GetWidth() - 1U) * g_image_channels_count;
+            const uint32_t x_1 = std::min(x * 2U + 1U, dimensions.GetWidth() - 1U) * g_image_channels_count;
+            for(uint32_t channel = 0U; channel < g_image_channels_count; ++channel)
+            {
+                const uint32_t sum = std::to_integer<uint32_t>(row_0_ptr[x_0 + channel]) + std::to_integer<uint32_t>(row_0_ptr[x_1 + channel])
+                                   + std::to_integer<uint32_t>(row_1_ptr[x_0 + channel]) + std::to_integer<uint32_t>(row_1_ptr[x_1 + channel]);
+                half_row_ptr[x * g_image_channels_count + channel] = static_cast<Data::Byte>((sum + 2U) / 4U);
+            }
+        }
+    }
+    return half_pixels;
+}
+
+StreamedTexture::StreamedTexture(const Ptr<Request>& request_ptr)
+    : m_request_ptr(request_ptr)
+{ }
+
+StreamedTexture::State StreamedTexture::GetState() const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_request_ptr ? m_request_ptr->state.load() : State::Cancelled;
+}
+
+bool StreamedTexture::HasTexture() const noexcept
+{
+    META_FUNCTION_TASK();
+    const State state = GetState();
+    return state == State::Preview || state == State::Complete;
+}
+
+const Rhi::Texture& StreamedTexture::GetTexture() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(HasTexture(), "streamed texture '{}' is not uploaded yet", m_request_ptr ? m_request_ptr->image_path : "");
+    return m_request_ptr->texture;
+}
+
+uint32_t StreamedTexture::GetStreamedMipLevel() const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_request_ptr ? m_request_ptr->streamed_mip_level.load() : 0U;
+}
+
+const std::string& StreamedTexture::GetErrorMessage() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL(m_request_ptr);
+    return m_request_ptr->error_message;
+}
+
+int32_t StreamedTexture::GetPriority() const noexcept
+{
+    META_FUNCTION_TASK();
+    return m_request_ptr ? m_request_ptr->priority.load() : 0;
+}
+
+void StreamedTexture::SetPriority(int32_t priority) const noexcept
+{
+    META_FUNCTION_TASK();
+    if (m_request_ptr)
+        m_request_ptr->priority = priority;
+}
+
+void StreamedTexture::Cancel() const noexcept
+{
+    META_FUNCTION_TASK();
+    if (!m_request_ptr)
+        return;
+
+    State state = m_request_ptr->state;
+    while(state != State::Complete && state != State::Failed && state != State::Cancelled &&
+          !m_request_ptr->state.compare_exchange_weak(state, State::Cancelled)) { }
+}
+
+TextureStreamer::TextureStreamer(const ImageLoader& image_loader, const Rhi::CommandQueue& target_cmd_queue, const Settings& settings)
+    : m_image_loader(image_loader)
+    , m_target_cmd_queue(target_cmd_queue)
+    , m_settings(settings)
+{ }
+
+TextureStreamer::~TextureStreamer()
+{
+    META_FUNCTION_TASK();
+    {
+        std::scoped_lock lock(m_mutex);
+        for(const Ptr<StreamedTexture::Request>& request_ptr : m_queued_requests)
+        {
+            StreamedTexture(request_ptr).Cancel();
+        }
+        m_queued_requests.clear();
+    }
+
+    // Scheduled decoding tasks reference this streamer, so it can not be destroyed before they finish
+    WaitForDecoding();
+}
+
+StreamedTexture TextureStreamer::LoadImageToTexture2DAsync(const std::string& image_path, ImageOptionMask options,
+                                                           const std::string& texture_name, int32_t priority)
+{
+    META_FUNCTION_TASK();
+    Ptr<StreamedTexture::Request> request_ptr;
+    {
+        std::scoped_lock lock(m_mutex);
+        request_ptr = std::make_shared<StreamedTexture::Request>(image_path, texture_name, options, priority, m_requests_count++);
+        m_queued_requests.push_back(request_ptr);
+        m_scheduled_tasks_count++;
+    }
+
+    // Each task decodes the image with the highest priority among queued images at the moment of task start
+    m_target_cmd_queue.GetContext().GetParallelExecutor().silent_async([this] { DecodeNextRequest(); });
+    return StreamedTexture(request_ptr);
+}
+
+Data::Size TextureStreamer::Update()
+{
+    META_FUNCTION_TASK();
+    // Priorities are captured before sorting, because they can be changed from other threads
+    std::vector<std::pair<int32_t, Ptr<StreamedTexture::Request>>> decoded_requests;
+    {
+        std::scoped_lock lock(m_mutex);
+        std::erase_if(m_decoded_requests, [](const Ptr<StreamedTexture::Request>& request_ptr) { return request_ptr->IsCancelled(); });
+        decoded_requests.reserve(m_decoded_requests.size());
+        for(const Ptr<StreamedTexture::Request>& request_ptr : m_decoded_requests)
+        {
+            decoded_requests.emplace_back(request_ptr->priority.load(), request_ptr);
+        }
+    }
+    if (decoded_requests.empty())
+        return 0U;
+
+    std::ranges::stable_sort(decoded_requests, std::ranges::greater{}, &std::pair<int32_t, Ptr<StreamedTexture::Request>>::first);
+
+    // Full textures are uploaded in priority order while they fit in upload budget of this frame,
+    // and images which do not fit get coarse preview textures to be shown until their full textures are uploaded
+    Data::Size full_data_size = 0U;
+    Data::Size preview_data_size = 0U;
+    bool       is_budget_exceeded = false;
+    for(const auto& [priority, request_ptr] : decoded_requests)
+    {
+        const StreamedTexture::State state = request_ptr->state;
+        if (state != StreamedTexture::State::Decoded && state != StreamedTexture::State::Preview)
+            continue;
+
+        is_budget_exceeded |= full_data_size > 0U &&
+                              full_data_size + request_ptr->GetFullDataSize() > m_settings.upload_budget_per_frame;
+        if (!is_budget_exceeded)
+            full_data_size += UploadFullTexture(*request_ptr);
+        else if (state == StreamedTexture::State::Decoded && request_ptr->HasPreview())
+            preview_data_size += UploadPreviewTexture(*request_ptr);
+    }
+
+    std::scoped_lock lock(m_mutex);
+    std::erase_if(m_decoded_requests, [](const Ptr<StreamedTexture::Request>& request_ptr) { return request_ptr->IsStreamingFinished(); });
+    return full_data_size + preview_data_size;
+}
+
+void TextureStreamer::WaitForDecoding()
+{
+    META_FUNCTION_TASK();
+    std::unique_lock lock(m_mutex);
+    m_decoding_condition_var.wait(lock, [this] { return m_scheduled_tasks_count == 0U; });
+}
+
+size_t TextureStreamer::GetPendingCount() const
+{
+    META_FUNCTION_TASK();
+    std::scoped_lock lock(m_mutex);
+    const auto queued_count = std::ranges::count_if(m_queued_requests,
+        [](const Ptr<StreamedTexture::Request>& request_ptr) { return !request_ptr->IsCancelled(); });
+    const auto decoded_count = std::ranges::count_if(m_decoded_requests,
+        [](const Ptr<StreamedTexture::Request>& request_ptr) { return !request_ptr->IsStreamingFinished(); });
+    return static_cast<size_t>(queued_count + decoded_count) + m_decoding_count;
+}
+
+void TextureStreamer::DecodeNextRequest()
+{
+    META_FUNCTION_TASK();
+    Ptr<StreamedTexture::Request> request_ptr;
+    {
+        std::scoped_lock lock(m_mutex);
+        std::erase_if(m_queued_requests, [](const Ptr<StreamedTexture::Request>& request_ptr) { return request_ptr->IsCancelled(); });
+        if (const auto request_it = std::ranges::min_element(m_queued_requests, IsHigherPriority);
+            request_it != m_queued_requests.end())
+        {
+            request_ptr = *request_it;
+            m_queued_requests.erase(request_it);
+            m_decoding_count++;
+        }
+    }
+
+    if (request_ptr)
+        DecodeRequest(*request_ptr);
+
+    // Condition variable is notified under lock, because streamer may be destroyed right after the lock is released
+    std::scoped_lock lock(m_mutex);
+    if (request_ptr)
+    {
+        m_decoding_count--;
+        if (request_ptr->state == StreamedTexture::State::Decoded)
+            m_decoded_requests.push_back(request_ptr);
+    }
+    m_scheduled_tasks_count--;
+    m_decoding_condition_var.notify_all();
+}
+
+void TextureStreamer::DecodeRequest(StreamedTexture::Request& request) const
+{
+    META_FUNCTION_TASK();
+    if (!request.TrySetState(StreamedTexture::State::Queued, StreamedTexture::State::Decoding))
+        return;
+
+    try
+    {
+        if (ImageLoader::IsImageContainerPath(request.image_path))
+        {
+            // Preview texture is created from the tail of mip chain stored in container
+            const ImageContainer& image_container = request.image_container_opt.emplace(m_image_loader.LoadImageContainer(request.image_path));
+            const uint32_t last_mip_level = image_container.GetMipLevelsCount() - 1U;
+            uint32_t preview_mip_level = 0U;
+            while(m_settings.preview_max_size && preview_mip_level < last_mip_level &&
+                  image_container.GetMipLevelDimensions(preview_mip_level).GetLongestSide() > m_settings.preview_max_size)
+            {
+                preview_mip_level++;
+            }
+            request.preview_mip_level = preview_mip_level;
+        }
+        else
+        {
+            // Image data copy is created to let STB loader decode next image in parallel before this one is uploaded
+            const ImageData& image_data = request.image_data_opt.emplace(m_image_loader.LoadImageData(request.image_path, g_image_channels_count, true));
+            Dimensions preview_dimensions = image_data.GetDimensions();
+            while(m_settings.preview_max_size && preview_dimensions.GetLongestSide() > m_settings.preview_max_size)
+            {
+                const Dimensions half_dimensions(std::max(1U, preview_dimensions.GetWidth() / 2U),
+                                                 std::max(1U, preview_dimensions.GetHeight() / 2U));
+                const Data::Byte* pixels_ptr = request.preview_pixels.empty() ? image_data.GetPixels().GetDataPtr() : request.preview_pixels.data();
+                request.preview_pixels = DownsampleImage(pixels_ptr, preview_dimensions, half_dimensions);
+                request.preview_dimensions = half_dimensions;
+                request.preview_mip_level++;
+                preview_dimensions = half_dimensions;
+            }
+
+            // Mip levels are generated serially, since decoding of other images runs in parallel on the same executor
+            if (request.options.HasAnyBit(ImageOption::CpuMipmapped))
+                request.mip_chain_opt.emplace(MipChainGenerator().Generate(image_data.GetPixels(), image_data.GetDimensions(),
+                                                                           GetImagePixelFormat(request.options)));
+        }
+    }
+    catch(const std::exception& error)
+    {
+        request.error_message = error.what();
+        request.mip_chain_opt.reset();
+        request.image_data_opt.reset();
+        request.image_container_opt.reset();
+        request.TrySetState(StreamedTexture::State::Decoding, StreamedTexture::State::Failed);
+        return;
+    }
+
+    if (!request.TrySetState(StreamedTexture::State::Decoding, StreamedTexture::State::Decoded))
+    {
+        // Request was cancelled while image was being decoded
+        request.mip_chain_opt.reset();
+        request.image_data_opt.reset();
+        request.image_container_opt.reset();
+        request.preview_pixels.clear();
+    }
+}
+
+Data::Size TextureStreamer::UploadPreviewTexture(StreamedTexture::Request& request) const
+{
+    META_FUNCTION_TASK();
+    Data::Size preview_data_size = 0U;
+    Rhi::Texture preview_texture;
+    if (request.image_container_opt)
+    {
+        const ImageContainer& image_container = *request.image_container_opt;
+        preview_texture = image_container.CreateTexture(m_target_cmd_queue, request.options.HasAnyBit(ImageOption::SrgbColorSpace),
+                                                        request.texture_name, request.preview_mip_level);
+        preview_data_size = image_container.GetPixelsDataSize(request.preview_mip_level);
+    }
+    else
+    {
+        preview_texture = Rhi::Texture(m_target_cmd_queue.GetContext(),
+                                       Rhi::TextureSettings::ForImage(request.preview_dimensions, std::nullopt,
+                                                                      GetImagePixelFormat(request.options), false));
+        preview_texture.SetName(request.texture_name);
+        preview_texture.SetData(m_target_cmd_queue, { { request.preview_pixels.data(), static_cast<Data::Size>(request.preview_pixels.size()) } });
+        preview_data_size = static_cast<Data::Size>(request.preview_pixels.size());
+    }
+
+    // Texture data is copied to upload resources on SetData, so preview pixels are not needed anymore
+    request.preview_pixels = {};
+    request.texture = preview_texture;
+    request.streamed_mip_level = request.preview_mip_level;
+    if (!request.TrySetState(StreamedTexture::State::Decoded, StreamedTexture::State::Preview))
+        request.texture = {};
+
+    return preview_data_size;
+}
+
+Data::Size TextureStreamer::UploadFullTexture(StreamedTexture::Request& request) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size full_data_size = request.GetFullDataSize();
+    Rhi::Texture full_texture;
+    if (request.image_container_opt)
+    {
+        full_texture = request.image_container_opt->CreateTexture(m_target_cmd_queue, request.options.HasAnyBit(ImageOption::SrgbColorSpace),
+                                                                  request.texture_name);
+    }
+    else
+    {
+        const ImageData& image_data = *request.image_data_opt;
+        full_texture = Rhi::Texture(m_target_cmd_queue.GetContext(),
+                                    Rhi::TextureSettings::ForImage(image_data.GetDimensions(), std::nullopt,
+                                                                   GetImagePixelFormat(request.options),
+                                                                   request.options.HasAnyBits({ ImageOption::Mipmapped, ImageOption::CpuMipmapped })));
+        full_texture.SetName(request.texture_name);
+        if (request.mip_chain_opt)
+            full_texture.SetData(m_target_cmd_queue, request.mip_chain_opt->GetSubResources());
+        else
+            full_texture.SetData(m_target_cmd_queue, { { image_data.GetPixels().GetDataPtr(), image_data.GetPixels().GetDataSize() } });
+    }
+
+    request.mip_chain_opt.reset();
+    request.image_data_opt.reset();
+    request.image_container_opt.reset();
+    request.preview_pixels = {};
+    request.texture = full_texture;
+    request.streamed_mip_level = 0U;
+
+    const StreamedTexture::State state = request.state;
+    if (state == StreamedTexture::State::Cancelled || !request.TrySetState(state, StreamedTexture::State::Complete))
+        request.texture = {};
+
+    return full_data_size;
+}
+
+} // namespace Methane::Graphics
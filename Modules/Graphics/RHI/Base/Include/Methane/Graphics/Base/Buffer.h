@@ -48,6 +48,9 @@ public:
     Rhi::ResourceView GetBufferView(Data::Size offset, Data::Size size) final;
     void              SetData(Rhi::ICommandQueue&, const SubResource& sub_resource) override;
 
+    // Range of buffer items covered by the view with offset and size aligned to item stride, zero view size covers buffer till the end
+    [[nodiscard]] Data::Range<Data::Index> GetViewItemsRange(const Rhi::ResourceView::Settings& view_settings) const;
+
 private:
     Settings m_settings;
 };
@@ -26,6 +26,7 @@ Base implementation of the texture interface.
 #include "Resource.h"
 
 #include <Methane/Graphics/RHI/ITexture.h>
+#include <Methane/Graphics/Rect.hpp>
 
 namespace Methane::Graphics::Base
 {
@@ -53,9 +54,13 @@ public:
 protected:
     // Resource overrides
     Data::Size CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const;
+    Dimensions GetMipLevelDimensions(uint32_t mip_level) const;
 
     static void ValidateDimensions(DimensionType dimension_type, const Dimensions& dimensions, bool mipmapped);
 
+    // Region of mip-level updated by sub-resource data: full mip-level or band of rows addressed by sub-resource data range
+    [[nodiscard]] FrameRect GetSubResourceUpdateRect(const Rhi::SubResource& sub_resource) const;
+
     void ValidateSubResource(const Rhi::SubResource& sub_resource) const;
     void ValidateSubResource(const SubResource::Index& sub_resource_index, const std::optional<BytesRange>& sub_resource_data_range) const;
 
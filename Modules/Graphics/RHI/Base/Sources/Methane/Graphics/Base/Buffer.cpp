@@ -27,6 +27,8 @@ Base implementation of the buffer interface.
 #include <Methane/Checks.hpp>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Base
 {
 
@@ -57,6 +59,22 @@ Rhi::ResourceView Buffer::GetBufferView(Data::Size offset, Data::Size size)
     return Rhi::ResourceView(dynamic_cast<Rhi::IResource&>(*this), offset, size);
 }
 
+Data::Range<Data::Index> Buffer::GetViewItemsRange(const Rhi::ResourceView::Settings& view_settings) const
+{
+    META_FUNCTION_TASK();
+    const Data::Size item_stride_size = m_settings.item_stride_size;
+    META_CHECK_NOT_ZERO_DESCR(item_stride_size, "buffer item stride size must be set to get range of items in buffer view");
+    META_CHECK_LESS_OR_EQUAL_DESCR(view_settings.offset, m_settings.size, "buffer view offset is out of buffer bounds");
+
+    const Data::Size view_size = view_settings.size ? view_settings.size : m_settings.size - view_settings.offset;
+    META_CHECK_LESS_OR_EQUAL_DESCR(view_size, m_settings.size - view_settings.offset, "buffer view size is out of buffer bounds");
+    META_CHECK_EQUAL_DESCR(view_settings.offset % item_stride_size, 0U,
+                           "buffer view offset {} is not aligned to item stride size {}", view_settings.offset, item_stride_size);
+    META_CHECK_EQUAL_DESCR(view_size % item_stride_size, 0U,
+                           "buffer view size {} is not aligned to item stride size {}", view_size, item_stride_size);
+    return Data::Range<Data::Index>(view_settings.offset / item_stride_size, (view_settings.offset + view_size) / item_stride_size);
+}
+
 void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
 {
     META_FUNCTION_TASK();
@@ -65,8 +83,18 @@ void Buffer::SetData(Rhi::ICommandQueue&, const SubResource& sub_resource)
 
     const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
     META_UNUSED(reserved_data_size);
-    META_CHECK_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
-    SetInitializedDataSize(sub_resource.GetDataSize());
+    if (!sub_resource.HasDataRange())
+    {
+        META_CHECK_LESS_OR_EQUAL_DESCR(sub_resource.GetDataSize(), reserved_data_size, "can not set more data than allocated buffer size");
+        SetInitializedDataSize(sub_resource.GetDataSize());
+        return;
+    }
+
+    // Data range allows to update part of the buffer, which is initialized up to the end of the largest updated range
+    const BytesRange& data_range = sub_resource.GetDataRange();
+    META_CHECK_EQUAL_DESCR(sub_resource.GetDataSize(), data_range.GetLength(), "subresource data size should be equal to data range length");
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_range.GetEnd(), reserved_data_size, "can not set data out of allocated buffer range");
+    SetInitializedDataSize(std::max(GetDataSize(Data::MemoryState::Initialized), data_range.GetEnd()));
 }
 
 } // namespace Methane::Graphics::Base
\ No newline at end of file
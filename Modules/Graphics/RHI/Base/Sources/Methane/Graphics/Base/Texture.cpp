@@ -29,6 +29,9 @@ Base implementation of the texture interface.
 #include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <numeric>
+
 namespace Methane::Graphics::Base
 {
 
@@ -98,7 +101,7 @@ Data::Size Texture::GetDataSize(Data::MemoryState size_type) const noexcept
 {
     META_FUNCTION_TASK();
     return size_type == Data::MemoryState::Reserved
-            ? m_settings.dimensions.GetPixelsCount() * GetPixelSize(m_settings.pixel_format) * m_settings.array_length
+            ? std::accumulate(m_sub_resource_sizes.begin(), m_sub_resource_sizes.end(), Data::Size(0U))
             : GetInitializedDataSize();
 }
 
@@ -123,18 +126,45 @@ void Texture::SetData(Rhi::ICommandQueue&, const SubResources& sub_resources)
     META_CHECK_NOT_EMPTY_DESCR(sub_resources, "can not set buffer data from empty sub-resources");
 
     Data::Size sub_resources_data_size = 0U;
+    bool       is_partial_update       = false;
     for(const Rhi::SubResource& sub_resource : sub_resources)
     {
         META_CHECK_NAME_DESCR("sub_resource", !sub_resource.IsEmptyOrNull(), "can not set empty subresource data to buffer");
         sub_resources_data_size += sub_resource.GetDataSize();
         META_CHECK_LESS(sub_resource.GetIndex(), m_sub_resource_count);
+        if (sub_resource.HasDataRange())
+        {
+            META_CHECK_FALSE_DESCR(m_settings.mipmapped, "partial update of texture with generated mip levels is not supported");
+            is_partial_update = true;
+        }
     }
 
     const Data::Size reserved_data_size = GetDataSize(Data::MemoryState::Reserved);
     META_UNUSED(reserved_data_size);
 
     META_CHECK_LESS_OR_EQUAL_DESCR(sub_resources_data_size, reserved_data_size, "can not set more data than allocated buffer size");
-    SetInitializedDataSize(sub_resources_data_size);
+    META_CHECK_TRUE_DESCR(!m_settings.mipmapped || !IsCompressedFormat(m_settings.pixel_format) || sub_resources.size() == m_sub_resource_count.GetRawCount(),
+                          "mip levels of block-compressed texture can not be generated, so all sub-resources should be provided");
+    SetInitializedDataSize(is_partial_update ? std::max(GetInitializedDataSize(), sub_resources_data_size) : sub_resources_data_size);
+}
+
+FrameRect Texture::GetSubResourceUpdateRect(const Rhi::SubResource& sub_resource) const
+{
+    META_FUNCTION_TASK();
+    const Dimensions mip_dimensions = GetMipLevelDimensions(sub_resource.GetIndex().GetMipLevel());
+    if (!sub_resource.HasDataRange())
+        return FrameRect(FramePoint(), mip_dimensions.AsRectSize());
+
+    META_CHECK_FALSE_DESCR(IsCompressedFormat(m_settings.pixel_format), "partial update of block-compressed texture is not supported");
+    META_CHECK_EQUAL_DESCR(mip_dimensions.GetDepth(), 1U, "partial update of volume texture is not supported");
+
+    const Data::Size  row_pitch  = GetImageRowPitch(m_settings.pixel_format, mip_dimensions.GetWidth());
+    const BytesRange& data_range = sub_resource.GetDataRange();
+    META_CHECK_EQUAL_DESCR(data_range.GetStart()  % row_pitch, 0U, "sub-resource data range should start at the beginning of pixel row");
+    META_CHECK_EQUAL_DESCR(data_range.GetLength() % row_pitch, 0U, "sub-resource data range should contain whole pixel rows");
+
+    return FrameRect(FramePoint(0, static_cast<int32_t>(data_range.GetStart() / row_pitch)),
+                     FrameSize(mip_dimensions.GetWidth(), data_range.GetLength() / row_pitch));
 }
 
 Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_resource_index) const
@@ -142,18 +172,21 @@ Data::Size Texture::CalculateSubResourceDataSize(const SubResource::Index& sub_r
     META_FUNCTION_TASK();
     ValidateSubResource(sub_resource_index, {});
 
-    const Data::Size pixel_size = GetPixelSize(m_settings.pixel_format);
-    if (sub_resource_index.GetMipLevel() == 0U)
-    {
-        return pixel_size * static_cast<const Data::FrameSize&>(m_settings.dimensions).GetPixelsCount();
-    }
+    const Dimensions mip_dimensions = GetMipLevelDimensions(sub_resource_index.GetMipLevel());
+    return GetImageSlicePitch(m_settings.pixel_format, mip_dimensions.GetWidth(), mip_dimensions.GetHeight());
+}
+
+Dimensions Texture::GetMipLevelDimensions(uint32_t mip_level) const
+{
+    META_FUNCTION_TASK();
+    if (mip_level == 0U)
+        return m_settings.dimensions;
 
-    const double mip_divider = std::pow(2.0, sub_resource_index.GetMipLevel());
-    const Data::FrameSize mip_frame_size(
-        static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetWidth()) / mip_divider)),
-        static_cast<uint32_t>(std::ceil(static_cast<double>(m_settings.dimensions.GetHeight()) / mip_divider))
+    return Dimensions(
+        std::max(1U, m_settings.dimensions.GetWidth()  >> mip_level),
+        std::max(1U, m_settings.dimensions.GetHeight() >> mip_level),
+        m_settings.dimensions.GetDepth()
     );
-    return pixel_size * mip_frame_size.GetPixelsCount();
 }
 
 void Texture::ValidateSubResource(const Rhi::SubResource& sub_resource) const
@@ -49,6 +49,7 @@ public:
     D3D12_VERTEX_BUFFER_VIEW        GetNativeVertexBufferView() const;
     D3D12_INDEX_BUFFER_VIEW         GetNativeIndexBufferView() const;
     D3D12_CONSTANT_BUFFER_VIEW_DESC GetNativeConstantBufferViewDesc() const;
+    D3D12_SHADER_RESOURCE_VIEW_DESC GetNativeShaderResourceViewDesc(const View::Settings& view_settings) const;
 
 private:
     wrl::ComPtr<ID3D12Resource> m_upload_resource_cptr;
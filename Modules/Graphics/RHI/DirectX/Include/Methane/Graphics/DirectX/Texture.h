@@ -79,6 +79,7 @@ private:
     void CreateRenderTargetView(const Descriptor& descriptor, const View::Id& view_id) const;
     void CreateDepthStencilView(const Descriptor& descriptor) const;
     void GenerateMipLevels(std::vector<D3D12_SUBRESOURCE_DATA>& dx_sub_resources, ::DirectX::ScratchImage& scratch_image) const;
+    void UploadSubResourceRows(ID3D12GraphicsCommandList& d3d12_command_list, const SubResource& sub_resource) const;
 
     // Upload & Read-back resources are created for TextureType::Image only
     wrl::ComPtr<ID3D12Resource> m_upload_resource_cptr;
@@ -43,8 +43,8 @@ namespace Methane::Graphics::DirectX
 static Rhi::BufferSettings UpdateBufferSettings(const Rhi::BufferSettings& settings)
 {
     META_FUNCTION_TASK();
-    if (settings.type != Rhi::BufferType::Constant &&
-        settings.type != Rhi::BufferType::Storage)
+    // Storage buffer items are tightly packed in structured buffer, so only constant buffers are aligned
+    if (settings.type != Rhi::BufferType::Constant)
         return settings;
 
     Rhi::BufferSettings new_settings = settings;
@@ -135,7 +135,8 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
     );
 
     META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::span target_data_span(sub_resource_data_ptr, sub_resource.GetDataSize());
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::span target_data_span(sub_resource_data_ptr + data_offset, sub_resource.GetDataSize());
     std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), target_data_span.begin());
 
     if (sub_resource.HasDataRange())
@@ -153,7 +154,10 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& su
 
     // In case of private GPU storage, copy buffer data from intermediate upload resource to the private GPU resource
     const TransferCommandList& upload_cmd_list = PrepareResourceTransfer(TransferOperation::Upload, target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_upload_resource_cptr.Get(), 0U, settings.size);
+    if (sub_resource.HasDataRange())
+        upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), data_offset, m_upload_resource_cptr.Get(), data_offset, sub_resource.GetDataSize());
+    else
+        upload_cmd_list.GetNativeCommandList().CopyBufferRegion(GetNativeResource(), 0U, m_upload_resource_cptr.Get(), 0U, settings.size);
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
@@ -225,10 +229,33 @@ D3D12_CONSTANT_BUFFER_VIEW_DESC Buffer::GetNativeConstantBufferViewDesc() const
     return buffer_view_desc;
 }
 
+D3D12_SHADER_RESOURCE_VIEW_DESC Buffer::GetNativeShaderResourceViewDesc(const View::Settings& view_settings) const
+{
+    META_FUNCTION_TASK();
+    const Rhi::BufferSettings& settings = GetSettings();
+    META_CHECK_EQUAL(settings.type, Rhi::BufferType::Storage);
+    META_CHECK_NOT_ZERO_DESCR(settings.item_stride_size, "storage buffer item stride size must be set to create structured buffer view");
+
+    // Structured buffer view covers only the range of items selected by the view offset and size
+    const Data::Range<Data::Index> view_items_range = GetViewItemsRange(view_settings);
+
+    D3D12_SHADER_RESOURCE_VIEW_DESC srv_desc{};
+    srv_desc.Format                     = DXGI_FORMAT_UNKNOWN;
+    srv_desc.ViewDimension              = D3D12_SRV_DIMENSION_BUFFER;
+    srv_desc.Shader4ComponentMapping    = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
+    srv_desc.Buffer.FirstElement        = view_items_range.GetStart();
+    srv_desc.Buffer.NumElements         = view_items_range.GetLength();
+    srv_desc.Buffer.StructureByteStride = settings.item_stride_size;
+    srv_desc.Buffer.Flags               = D3D12_BUFFER_SRV_FLAG_NONE;
+    return srv_desc;
+}
+
 Opt<Rhi::IResource::Descriptor> Buffer::InitializeNativeViewDescriptor(const View::Id& view_id)
 {
     META_FUNCTION_TASK();
-    if (GetSettings().type != Rhi::BufferType::Constant)
+    const Rhi::BufferType buffer_type = GetSettings().type;
+    if (buffer_type != Rhi::BufferType::Constant &&
+        buffer_type != Rhi::BufferType::Storage)
         return std::nullopt;
 
     // NOTE: Addressable resources are bound to pipeline using GPU Address and byte offset
@@ -238,6 +265,13 @@ Opt<Rhi::IResource::Descriptor> Buffer::InitializeNativeViewDescriptor(const Vie
 
     const Rhi::IResource::Descriptor& descriptor = GetDescriptorByViewId(view_id);
     const D3D12_CPU_DESCRIPTOR_HANDLE cpu_descriptor_handle = GetNativeCpuDescriptorHandle(descriptor);
+    if (buffer_type == Rhi::BufferType::Storage)
+    {
+        const D3D12_SHADER_RESOURCE_VIEW_DESC view_desc = GetNativeShaderResourceViewDesc(view_id);
+        GetDirectContext().GetDirectDevice().GetNativeDevice()->CreateShaderResourceView(GetNativeResource(), &view_desc, cpu_descriptor_handle);
+        return descriptor;
+    }
+
     const D3D12_CONSTANT_BUFFER_VIEW_DESC view_desc = GetNativeConstantBufferViewDesc();
     GetDirectContext().GetDirectDevice().GetNativeDevice()->CreateConstantBufferView(&view_desc, cpu_descriptor_handle);
     return descriptor;
@@ -41,6 +41,7 @@ DirectX 12 implementation of the texture interface.
 
 #include <fmt/format.h>
 #include <fmt/ranges.h>
+#include <algorithm>
 #include <span>
 
 namespace Methane::Graphics::DirectX
@@ -360,22 +361,29 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     Base::Texture::SetData(target_cmd_queue, sub_resources);
 
     const Settings&  settings                    = GetSettings();
-    const Data::Size pixel_size                  = GetPixelSize(settings.pixel_format);
     const SubResource::Count& sub_resource_count = GetSubresourceCount();
     const uint32_t       sub_resources_raw_count = sub_resource_count.GetRawCount();
 
     std::vector<D3D12_SUBRESOURCE_DATA> dx_sub_resources(sub_resources_raw_count, D3D12_SUBRESOURCE_DATA{});
+    std::vector<Ref<const SubResource>> partial_sub_resources;
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
+        if (sub_resource.HasDataRange())
+        {
+            partial_sub_resources.emplace_back(sub_resource);
+            continue;
+        }
 
         const uint32_t sub_resource_raw_index = sub_resource.GetIndex().GetRawIndex(sub_resource_count);
         META_CHECK_LESS(sub_resource_raw_index, dx_sub_resources.size());
 
+        // Pitches are calculated in rows of pixel blocks to support both uncompressed and block-compressed formats
+        const Dimensions mip_dimensions = GetMipLevelDimensions(sub_resource.GetIndex().GetMipLevel());
         D3D12_SUBRESOURCE_DATA& dx_sub_resource = dx_sub_resources[sub_resource_raw_index];
         dx_sub_resource.pData      = sub_resource.GetDataPtr();
-        dx_sub_resource.RowPitch   = static_cast<int64_t>(settings.dimensions.GetWidth())  * pixel_size;
-        dx_sub_resource.SlicePitch = dx_sub_resource.RowPitch * settings.dimensions.GetHeight();
+        dx_sub_resource.RowPitch   = static_cast<int64_t>(GetImageRowPitch(settings.pixel_format, mip_dimensions.GetWidth()));
+        dx_sub_resource.SlicePitch = static_cast<int64_t>(GetImageSlicePitch(settings.pixel_format, mip_dimensions.GetWidth(), mip_dimensions.GetHeight()));
 
         META_CHECK_GREATER_OR_EQUAL_DESCR(sub_resource.GetDataSize(), dx_sub_resource.SlicePitch,
                                           "sub-resource data size is less than computed MIP slice size, possibly due to pixel format mismatch");
@@ -390,12 +398,60 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
 
     // Upload texture subresources data to GPU via intermediate upload resource
     const TransferCommandList& upload_cmd_list = PrepareResourceTransfer(TransferOperation::Upload, target_cmd_queue, State::CopyDest);
-    UpdateSubresources(&upload_cmd_list.GetNativeCommandList(),
-                       GetNativeResource(), m_upload_resource_cptr.Get(), 0, 0,
-                       static_cast<UINT>(dx_sub_resources.size()), dx_sub_resources.data());
+    if (partial_sub_resources.size() < sub_resources.size())
+    {
+        UpdateSubresources(&upload_cmd_list.GetNativeCommandList(),
+                           GetNativeResource(), m_upload_resource_cptr.Get(), 0, 0,
+                           static_cast<UINT>(dx_sub_resources.size()), dx_sub_resources.data());
+    }
+    for(const SubResource& partial_sub_resource : partial_sub_resources)
+    {
+        UploadSubResourceRows(upload_cmd_list.GetNativeCommandList(), partial_sub_resource);
+    }
     GetContext().RequestDeferredAction(Rhi::IContext::DeferredAction::UploadResources);
 }
 
+void Texture::UploadSubResourceRows(ID3D12GraphicsCommandList& d3d12_command_list, const SubResource& sub_resource) const
+{
+    META_FUNCTION_TASK();
+    const FrameRect   update_rect            = GetSubResourceUpdateRect(sub_resource);
+    const Data::Size  source_row_pitch       = GetImageRowPitch(GetSettings().pixel_format, update_rect.size.GetWidth());
+    const uint32_t    sub_resource_raw_index = sub_resource.GetIndex().GetRawIndex(GetSubresourceCount());
+    const wrl::ComPtr<ID3D12Device>& device_cptr = GetDirectContext().GetDirectDevice().GetNativeDevice();
+
+    // Rows are placed in upload resource at the same offsets as with full sub-resource upload,
+    // so that several bands of the same sub-resource uploaded at once do not overlap
+    std::vector<D3D12_PLACED_SUBRESOURCE_FOOTPRINT> dx_footprints(GetSubresourceCount().GetRawCount());
+    const D3D12_RESOURCE_DESC dx_resource_desc = GetNativeResource()->GetDesc();
+    device_cptr->GetCopyableFootprints(&dx_resource_desc, 0U, static_cast<UINT>(dx_footprints.size()), 0U,
+                                       dx_footprints.data(), nullptr, nullptr, nullptr);
+
+    const D3D12_PLACED_SUBRESOURCE_FOOTPRINT& dx_footprint = dx_footprints[sub_resource_raw_index];
+    const UINT64 rows_offset = dx_footprint.Offset + static_cast<UINT64>(update_rect.origin.GetY()) * dx_footprint.Footprint.RowPitch;
+    const UINT64 rows_size   = static_cast<UINT64>(update_rect.size.GetHeight()) * dx_footprint.Footprint.RowPitch;
+
+    Data::RawPtr upload_data_ptr = nullptr;
+    const CD3DX12_RANGE zero_read_range(0, 0);
+    ThrowIfFailed(m_upload_resource_cptr->Map(0, &zero_read_range, reinterpret_cast<void**>(&upload_data_ptr)), // NOSONAR
+                  device_cptr.Get());
+    META_CHECK_NOT_NULL_DESCR(upload_data_ptr, "failed to map texture upload resource");
+
+    for(uint32_t row = 0U; row < update_rect.size.GetHeight(); ++row)
+    {
+        std::copy_n(sub_resource.GetDataPtr() + static_cast<size_t>(row) * source_row_pitch, source_row_pitch,
+                    upload_data_ptr + rows_offset + static_cast<UINT64>(row) * dx_footprint.Footprint.RowPitch);
+    }
+
+    const CD3DX12_RANGE write_range(rows_offset, rows_offset + rows_size);
+    m_upload_resource_cptr->Unmap(0, &write_range);
+
+    const auto top_row    = static_cast<UINT>(update_rect.origin.GetY());
+    const D3D12_BOX src_box { 0U, top_row, 0U, update_rect.size.GetWidth(), top_row + update_rect.size.GetHeight(), 1U };
+    const CD3DX12_TEXTURE_COPY_LOCATION src_copy_location(m_upload_resource_cptr.Get(), dx_footprint);
+    const CD3DX12_TEXTURE_COPY_LOCATION dst_copy_location(GetNativeResource(), sub_resource_raw_index);
+    d3d12_command_list.CopyTextureRegion(&dst_copy_location, 0U, top_row, 0U, &src_copy_location, &src_box);
+}
+
 Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
 {
     META_FUNCTION_TASK();
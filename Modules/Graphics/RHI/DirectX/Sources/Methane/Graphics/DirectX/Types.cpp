@@ -71,6 +71,24 @@ DXGI_FORMAT TypeConverter::PixelFormatToDxgi(const PixelFormat& pixel_format)
     case PixelFormat::R8Unorm:          return DXGI_FORMAT_R8_UNORM;
     case PixelFormat::R8Snorm:          return DXGI_FORMAT_R8_SNORM;
     case PixelFormat::A8Unorm:          return DXGI_FORMAT_A8_UNORM;
+    case PixelFormat::RGBA32Float:      return DXGI_FORMAT_R32G32B32A32_FLOAT;
+    case PixelFormat::RGBA16Float:      return DXGI_FORMAT_R16G16B16A16_FLOAT;
+    case PixelFormat::RG11B10Float:     return DXGI_FORMAT_R11G11B10_FLOAT;
+    case PixelFormat::RGB9E5Float:      return DXGI_FORMAT_R9G9B9E5_SHAREDEXP;
+    case PixelFormat::BC1Unorm:         return DXGI_FORMAT_BC1_UNORM;
+    case PixelFormat::BC1Unorm_sRGB:    return DXGI_FORMAT_BC1_UNORM_SRGB;
+    case PixelFormat::BC2Unorm:         return DXGI_FORMAT_BC2_UNORM;
+    case PixelFormat::BC2Unorm_sRGB:    return DXGI_FORMAT_BC2_UNORM_SRGB;
+    case PixelFormat::BC3Unorm:         return DXGI_FORMAT_BC3_UNORM;
+    case PixelFormat::BC3Unorm_sRGB:    return DXGI_FORMAT_BC3_UNORM_SRGB;
+    case PixelFormat::BC4Unorm:         return DXGI_FORMAT_BC4_UNORM;
+    case PixelFormat::BC4Snorm:         return DXGI_FORMAT_BC4_SNORM;
+    case PixelFormat::BC5Unorm:         return DXGI_FORMAT_BC5_UNORM;
+    case PixelFormat::BC5Snorm:         return DXGI_FORMAT_BC5_SNORM;
+    case PixelFormat::BC6HUfloat:       return DXGI_FORMAT_BC6H_UF16;
+    case PixelFormat::BC6HSfloat:       return DXGI_FORMAT_BC6H_SF16;
+    case PixelFormat::BC7Unorm:         return DXGI_FORMAT_BC7_UNORM;
+    case PixelFormat::BC7Unorm_sRGB:    return DXGI_FORMAT_BC7_UNORM_SRGB;
     default:                            META_UNEXPECTED_RETURN(pixel_format, DXGI_FORMAT_UNKNOWN);
     }
 }
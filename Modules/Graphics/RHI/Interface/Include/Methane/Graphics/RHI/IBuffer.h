@@ -57,6 +57,7 @@ struct BufferSettings
     [[nodiscard]] static BufferSettings ForVertexBuffer(Data::Size size, Data::Size stride, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForIndexBuffer(Data::Size size, PixelFormat format, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForConstantBuffer(Data::Size size, bool addressable = false, bool is_volatile = false);
+    [[nodiscard]] static BufferSettings ForStorageBuffer(Data::Size size, Data::Size stride, bool addressable = false, bool is_volatile = false);
     [[nodiscard]] static BufferSettings ForReadBackBuffer(Data::Size size);
 
     [[nodiscard]] friend bool operator==(const BufferSettings& left, const BufferSettings& right) = default;
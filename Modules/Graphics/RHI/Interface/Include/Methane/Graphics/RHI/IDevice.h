@@ -30,6 +30,7 @@ Methane device interface, used to create graphics context for rendering.
 #include <Methane/Memory.hpp>
 
 #include <functional>
+#include <string>
 
 namespace tf
 {
@@ -65,10 +66,20 @@ struct DeviceCaps
     uint32_t transfer_queues_count { 1U };
     uint32_t compute_queues_count  { 1U };
 
+    // Path to the file used to load and save the native pipeline cache between application runs,
+    // pipeline cache is kept in memory only when path is empty (used by Vulkan only)
+    std::string pipeline_cache_file_path;
+
+    // Path to the file used to load and save the shader reflection cache between application runs,
+    // reflection cache is kept in memory only when path is empty (used by Vulkan only)
+    std::string shader_reflection_cache_file_path;
+
     DeviceCaps& SetFeatures(DeviceFeatureMask new_features) noexcept;
     DeviceCaps& SetRenderQueuesCount(uint32_t new_render_queues_count) noexcept;
     DeviceCaps& SetTransferQueuesCount(uint32_t new_transfer_queues_count) noexcept;
     DeviceCaps& SetComputeQueuesCount(uint32_t new_compute_queues_count) noexcept;
+    DeviceCaps& SetPipelineCacheFilePath(std::string new_pipeline_cache_file_path) noexcept;
+    DeviceCaps& SetShaderReflectionCacheFilePath(std::string new_shader_reflection_cache_file_path) noexcept;
 
     [[nodiscard]] friend auto operator<=>(const DeviceCaps& left, const DeviceCaps& right) noexcept = default;
 };
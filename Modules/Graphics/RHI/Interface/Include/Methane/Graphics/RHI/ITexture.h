@@ -118,6 +118,9 @@ struct ITexture
     [[nodiscard]] virtual SubResource        GetData(ICommandQueue& target_cmd_queue,
                                                      const SubResourceIndex& sub_resource_index = {},
                                                      const BytesRangeOpt& data_range = {}) = 0;
+
+    // Sub-resource with data range updates only the band of whole pixel rows addressed by this range in tightly packed
+    // sub-resource data, which is supported for uncompressed 2D textures without automatic mip-levels generation
     virtual void SetData(ICommandQueue& target_cmd_queue, const SubResources& sub_resources) = 0;
 };
 
@@ -80,6 +80,19 @@ BufferSettings BufferSettings::ForConstantBuffer(Data::Size size, bool addressab
     };
 }
 
+BufferSettings BufferSettings::ForStorageBuffer(Data::Size size, Data::Size stride, bool addressable, bool is_volatile)
+{
+    META_FUNCTION_TASK();
+    return Rhi::BufferSettings{
+        Rhi::BufferType::Storage,
+        Rhi::ResourceUsageMask(Rhi::ResourceUsage::ShaderRead).SetBit(Rhi::ResourceUsage::Addressable, addressable),
+        size,
+        stride,
+        PixelFormat::Unknown,
+        GetBufferStorageMode(is_volatile)
+    };
+}
+
 BufferSettings BufferSettings::ForReadBackBuffer(Data::Size size)
 {
     META_FUNCTION_TASK();
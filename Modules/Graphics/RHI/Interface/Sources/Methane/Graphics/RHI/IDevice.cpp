@@ -56,4 +56,18 @@ DeviceCaps& DeviceCaps::SetComputeQueuesCount(uint32_t new_compute_queues_count)
     return *this;
 }
 
+DeviceCaps& DeviceCaps::SetPipelineCacheFilePath(std::string new_pipeline_cache_file_path) noexcept
+{
+    META_FUNCTION_TASK();
+    pipeline_cache_file_path = std::move(new_pipeline_cache_file_path);
+    return *this;
+}
+
+DeviceCaps& DeviceCaps::SetShaderReflectionCacheFilePath(std::string new_shader_reflection_cache_file_path) noexcept
+{
+    META_FUNCTION_TASK();
+    shader_reflection_cache_file_path = std::move(new_shader_reflection_cache_file_path);
+    return *this;
+}
+
 } // namespace Methane::Graphics::Rhi
@@ -111,13 +111,23 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     const id<MTLBlitCommandEncoder>& mtl_blit_encoder = transfer_command_list.GetNativeCommandEncoder();
     META_CHECK_NOT_NULL(mtl_blit_encoder);
 
-    const Settings& settings        = GetSettings();
-    const uint32_t  bytes_per_row   = settings.dimensions.GetWidth()  * GetPixelSize(settings.pixel_format);
-    const uint32_t  bytes_per_image = settings.dimensions.GetHeight() * bytes_per_row;
-    const MTLRegion texture_region  = GetTextureRegion(settings.dimensions, settings.dimension_type);
-
+    const Settings& settings = GetSettings();
     for(const SubResource& sub_resource : sub_resources)
     {
+        // Pitches are calculated in rows of pixel blocks to support both uncompressed and block-compressed formats
+        const Dimensions mip_dimensions  = GetMipLevelDimensions(sub_resource.GetIndex().GetMipLevel());
+        const auto       bytes_per_row   = static_cast<uint32_t>(GetImageRowPitch(settings.pixel_format, mip_dimensions.GetWidth()));
+        auto             bytes_per_image = static_cast<uint32_t>(GetImageSlicePitch(settings.pixel_format, mip_dimensions.GetWidth(), mip_dimensions.GetHeight()));
+        MTLRegion        texture_region  = GetTextureRegion(mip_dimensions, settings.dimension_type);
+        if (sub_resource.HasDataRange())
+        {
+            // Only the band of rows addressed by sub-resource data range is copied to texture
+            const FrameRect update_rect = GetSubResourceUpdateRect(sub_resource);
+            texture_region.origin.y    = static_cast<NSUInteger>(update_rect.origin.GetY());
+            texture_region.size.height = update_rect.size.GetHeight();
+            bytes_per_image            = sub_resource.GetDataSize();
+        }
+
         uint32_t slice = 0;
         switch(settings.dimension_type)
         {
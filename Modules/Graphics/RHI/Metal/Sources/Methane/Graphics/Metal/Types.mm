@@ -73,6 +73,26 @@ MTLPixelFormat TypeConverter::DataFormatToMetalPixelType(PixelFormat data_format
     case R8Snorm:          return MTLPixelFormatR8Snorm;
     case A8Unorm:          return MTLPixelFormatA8Unorm;
     case Depth32Float:     return MTLPixelFormatDepth32Float;
+    case RGBA32Float:      return MTLPixelFormatRGBA32Float;
+    case RGBA16Float:      return MTLPixelFormatRGBA16Float;
+    case RG11B10Float:     return MTLPixelFormatRG11B10Float;
+    case RGB9E5Float:      return MTLPixelFormatRGB9E5Float;
+#ifdef APPLE_MACOS
+    case BC1Unorm:         return MTLPixelFormatBC1_RGBA;
+    case BC1Unorm_sRGB:    return MTLPixelFormatBC1_RGBA_sRGB;
+    case BC2Unorm:         return MTLPixelFormatBC2_RGBA;
+    case BC2Unorm_sRGB:    return MTLPixelFormatBC2_RGBA_sRGB;
+    case BC3Unorm:         return MTLPixelFormatBC3_RGBA;
+    case BC3Unorm_sRGB:    return MTLPixelFormatBC3_RGBA_sRGB;
+    case BC4Unorm:         return MTLPixelFormatBC4_RUnorm;
+    case BC4Snorm:         return MTLPixelFormatBC4_RSnorm;
+    case BC5Unorm:         return MTLPixelFormatBC5_RGUnorm;
+    case BC5Snorm:         return MTLPixelFormatBC5_RGSnorm;
+    case BC6HUfloat:       return MTLPixelFormatBC6H_RGBUfloat;
+    case BC6HSfloat:       return MTLPixelFormatBC6H_RGBFloat;
+    case BC7Unorm:         return MTLPixelFormatBC7_RGBAUnorm;
+    case BC7Unorm_sRGB:    return MTLPixelFormatBC7_RGBAUnorm_sRGB;
+#endif // APPLE_MACOS
     // MTLPixelFormatRG8Unorm;
     // MTLPixelFormatRG8Snorm;
     // MTLPixelFormatRG8Uint;
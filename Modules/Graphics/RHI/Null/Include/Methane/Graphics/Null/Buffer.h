@@ -36,7 +36,18 @@ class Buffer final // NOSONAR - inheritance hierarchy is greater than 5
 public:
     Buffer(const Base::Context& context, const Settings& settings);
 
-    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt&) override;
+    // IBuffer overrides
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource) override;
+    SubResource GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range = {}) override;
+
+    // Buffer data is stored in CPU memory to let tests verify uploaded data and its size
+    [[nodiscard]] const Data::Bytes& GetStoredData() const noexcept    { return m_data; }
+    [[nodiscard]] Data::Size GetUploadedDataSize() const noexcept      { return m_uploaded_data_size; }
+    void ResetUploadedDataSize() noexcept                              { m_uploaded_data_size = 0U; }
+
+private:
+    Data::Bytes m_data;
+    Data::Size  m_uploaded_data_size = 0U;
 };
 
 } // namespace Methane::Graphics::Null
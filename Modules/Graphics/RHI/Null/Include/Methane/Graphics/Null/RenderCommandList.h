@@ -28,6 +28,8 @@ Null implementation of the render command list interface.
 
 #include <Methane/Graphics/Base/RenderCommandList.h>
 
+#include <vector>
+
 namespace Methane::Graphics::Null
 {
 
@@ -39,6 +41,19 @@ class RenderCommandList final // NOSONAR - inheritance hierarchy is greater than
     : public CommandList<Base::RenderCommandList>
 {
 public:
+    // Draw calls are recorded to let tests verify commands encoded by higher level primitives
+    struct DrawCall
+    {
+        bool     is_indexed;
+        uint32_t count;          // index count of indexed draw or vertex count otherwise
+        uint32_t start_index;    // start index of indexed draw or zero otherwise
+        uint32_t start_vertex;
+        uint32_t instance_count;
+        uint32_t start_instance;
+    };
+
+    using DrawCalls = std::vector<DrawCall>;
+
     explicit RenderCommandList(CommandQueue& command_queue);
     RenderCommandList(CommandQueue& command_queue, RenderPass& render_pass);
     explicit RenderCommandList(ParallelRenderCommandList& parallel_render_command_list);
@@ -55,6 +70,11 @@ public:
 
     using Base::RenderCommandList::GetDrawingState;
     using Base::CommandList::GetCommandState;
+
+    [[nodiscard]] const DrawCalls& GetDrawCalls() const noexcept { return m_draw_calls; }
+
+private:
+    DrawCalls m_draw_calls;
 };
 
 } // namespace Methane::Graphics::Null
@@ -27,6 +27,8 @@ Null implementation of the texture interface.
 
 #include <Methane/Graphics/Base/Texture.h>
 
+#include <vector>
+
 namespace Methane::Graphics::Null
 {
 
@@ -39,7 +41,18 @@ public:
     Texture(const Base::Context& context, const Settings& settings);
     Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index);
 
-    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&) override;
+    // ITexture overrides
+    void SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources) override;
+    SubResource GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range) override;
+
+    // Texture sub-resources data is stored in CPU memory to let tests verify uploaded data and its size
+    [[nodiscard]] const Data::Bytes& GetStoredData(const SubResource::Index& sub_resource_index) const;
+    [[nodiscard]] Data::Size GetUploadedDataSize() const noexcept { return m_uploaded_data_size; }
+    void ResetUploadedDataSize() noexcept                         { m_uploaded_data_size = 0U; }
+
+private:
+    std::vector<Data::Bytes> m_sub_resources_data;
+    Data::Size               m_uploaded_data_size = 0U;
 };
 
 } // namespace Methane::Graphics::Null
@@ -23,6 +23,10 @@ Null implementation of the buffer interface.
 
 #include <Methane/Graphics/Null/Buffer.h>
 
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
 #include <iterator>
 
 namespace Methane::Graphics::Null
@@ -30,12 +34,28 @@ namespace Methane::Graphics::Null
 
 Buffer::Buffer(const Base::Context& context, const Settings& settings)
     : Resource(context, settings)
+    , m_data(settings.size, std::byte{})
 {
 }
 
-Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt&)
+void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResource& sub_resource)
+{
+    META_FUNCTION_TASK();
+    Resource::SetData(target_cmd_queue, sub_resource);
+
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), std::next(m_data.begin(), data_offset));
+    m_uploaded_data_size += sub_resource.GetDataSize();
+}
+
+Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue&, const BytesRangeOpt& data_range)
 {
-    return {};
+    META_FUNCTION_TASK();
+    const Data::Size data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Size data_end   = data_range ? data_range->GetEnd()   : GetDataSize(Data::MemoryState::Initialized);
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_end, static_cast<Data::Size>(m_data.size()), "can not get data out of buffer range");
+    return SubResource(Data::Bytes(std::next(m_data.begin(), data_start), std::next(m_data.begin(), data_end)),
+                       Rhi::SubResourceIndex(), data_range);
 }
 
 } // namespace Methane::Graphics::Null
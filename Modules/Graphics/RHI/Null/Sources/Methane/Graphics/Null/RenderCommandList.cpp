@@ -60,6 +60,7 @@ void RenderCommandList::Reset(IDebugGroup* debug_group_ptr)
     META_FUNCTION_TASK();
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
+    m_draw_calls.clear();
 }
 
 void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGroup* debug_group_ptr)
@@ -68,6 +69,7 @@ void RenderCommandList::ResetWithState(Rhi::IRenderState& render_state, IDebugGr
     CommandList::ResetCommandState();
     CommandList::Reset(debug_group_ptr);
     CommandList::SetRenderState(render_state);
+    m_draw_calls.clear();
 }
 
 bool RenderCommandList::SetVertexBuffers(Rhi::IBufferSet& vertex_buffers, bool set_resource_barriers)
@@ -99,6 +101,7 @@ void RenderCommandList::DrawIndexed(Primitive primitive, uint32_t index_count, u
     }
 
     Base::RenderCommandList::DrawIndexed(primitive, index_count, start_index, start_vertex, instance_count, start_instance);
+    m_draw_calls.push_back({ true, index_count, start_index, start_vertex, instance_count, start_instance });
 }
 
 void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_t start_vertex,
@@ -106,6 +109,7 @@ void RenderCommandList::Draw(Primitive primitive, uint32_t vertex_count, uint32_
 {
     META_FUNCTION_TASK();
     Base::RenderCommandList::Draw(primitive, vertex_count, start_vertex, instance_count, start_instance);
+    m_draw_calls.push_back({ false, vertex_count, 0U, start_vertex, instance_count, start_instance });
 }
 
 } // namespace Methane::Graphics::Null
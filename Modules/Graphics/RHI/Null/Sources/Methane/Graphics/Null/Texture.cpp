@@ -24,26 +24,70 @@ Null implementation of the texture interface.
 #include <Methane/Graphics/Null/Texture.h>
 #include <Methane/Graphics/Null/RenderContext.h>
 
+#include <Methane/Instrumentation.h>
 #include <Methane/Checks.hpp>
 
+#include <algorithm>
+#include <iterator>
+
 namespace Methane::Graphics::Null
 {
 
 Texture::Texture(const Base::Context& context, const Settings& settings)
     : Resource(context, settings)
+    , m_sub_resources_data(GetSubresourceCount().GetRawCount())
 {
 }
 
 Texture::Texture(const RenderContext& render_context, const Settings& settings, Data::Index frame_index)
     : Resource(render_context, settings)
+    , m_sub_resources_data(GetSubresourceCount().GetRawCount())
 {
     META_CHECK_TRUE(settings.frame_index_opt.has_value());
     META_CHECK_EQUAL(frame_index, settings.frame_index_opt.value());
 }
 
-Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index&, const BytesRangeOpt&)
+void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources& sub_resources)
+{
+    META_FUNCTION_TASK();
+    Resource::SetData(target_cmd_queue, sub_resources);
+
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        Data::Bytes& sub_resource_data = m_sub_resources_data[sub_resource.GetIndex().GetRawIndex(GetSubresourceCount())];
+        m_uploaded_data_size += sub_resource.GetDataSize();
+        if (!sub_resource.HasDataRange())
+        {
+            sub_resource_data = Data::Bytes(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr());
+            continue;
+        }
+
+        // Partial update overwrites the band of rows in stored sub-resource data,
+        // update rectangle is requested to validate that data range contains whole pixel rows
+        const FrameRect update_rect = GetSubResourceUpdateRect(sub_resource);
+        META_UNUSED(update_rect);
+        sub_resource_data.resize(GetSubResourceDataSize(sub_resource.GetIndex()), Data::Byte{});
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(),
+                  std::next(sub_resource_data.begin(), sub_resource.GetDataRange().GetStart()));
+    }
+}
+
+Rhi::SubResource Texture::GetData(Rhi::ICommandQueue&, const SubResource::Index& sub_resource_index, const BytesRangeOpt& data_range)
+{
+    META_FUNCTION_TASK();
+    const Data::Bytes& sub_resource_data = GetStoredData(sub_resource_index);
+    const Data::Size   data_start = data_range ? data_range->GetStart() : 0U;
+    const Data::Size   data_end   = data_range ? data_range->GetEnd()   : static_cast<Data::Size>(sub_resource_data.size());
+    META_CHECK_LESS_OR_EQUAL_DESCR(data_end, static_cast<Data::Size>(sub_resource_data.size()), "can not get data out of sub-resource range");
+    return SubResource(Data::Bytes(std::next(sub_resource_data.begin(), data_start), std::next(sub_resource_data.begin(), data_end)),
+                       sub_resource_index, data_range);
+}
+
+const Data::Bytes& Texture::GetStoredData(const SubResource::Index& sub_resource_index) const
 {
-    return {};
+    META_FUNCTION_TASK();
+    META_CHECK_LESS(sub_resource_index, GetSubresourceCount());
+    return m_sub_resources_data[sub_resource_index.GetRawIndex(GetSubresourceCount())];
 }
 
 } // namespace Methane::Graphics::Null
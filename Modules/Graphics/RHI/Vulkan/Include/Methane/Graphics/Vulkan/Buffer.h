@@ -54,9 +54,8 @@ private:
     Data::Bytes GetDataFromSharedBuffer(const BytesRange& data_range) const;
     Data::Bytes GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue);
 
-    vk::UniqueBuffer       m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory m_vk_unique_staging_memory;
-    vk::BufferCopy         m_vk_copy_region;
+    vk::UniqueBuffer       m_vk_unique_readback_buffer;
+    MemoryAllocation       m_readback_memory_allocation;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -0,0 +1,89 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/CacheFile.hpp
+Reading of Vulkan cache files with data validated by file header.
+
+******************************************************************************/
+
+#pragma once
+
+#include "Utils.hpp"
+
+#include <Methane/Instrumentation.h>
+
+#include <nowide/fstream.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <ios>
+
+namespace Methane::Graphics::Vulkan
+{
+
+// Reads cache data following the file header with magic, version, data size and data hash fields,
+// data is allocated only when its size fits in the file, so that corrupted header does not lead to huge allocation;
+// empty data is returned when file is missing, or when it is invalid and ignored with a warning
+template<typename FileHeader, typename ByteType>
+std::vector<ByteType> ReadCacheFileData(const std::string& file_path, std::string_view file_description)
+{
+    META_FUNCTION_TASK();
+    static_assert(sizeof(ByteType) == 1U, "cache file data should be read as bytes");
+    if (file_path.empty())
+        return {};
+
+    nowide::ifstream file_stream(file_path, std::ios::binary);
+    if (!file_stream.is_open())
+        return {};
+
+    FileHeader file_header;
+    file_stream.read(reinterpret_cast<char*>(&file_header), sizeof(file_header)); // NOSONAR
+    if (!file_stream.good() ||
+        file_header.magic != FileHeader::s_magic ||
+        file_header.version != FileHeader::s_version ||
+        !file_header.data_size)
+    {
+        META_LOG("WARNING: Vulkan {} file '{}' has invalid header and is ignored.", file_description, file_path);
+        return {};
+    }
+
+    const std::streamoff data_offset = file_stream.tellg();
+    file_stream.seekg(0, std::ios::end);
+    const std::streamoff file_size = file_stream.tellg();
+    file_stream.seekg(data_offset);
+    if (!file_stream.good() || data_offset < 0 || file_size < data_offset ||
+        file_header.data_size > static_cast<uint64_t>(file_size - data_offset))
+    {
+        META_LOG("WARNING: Vulkan {} file '{}' is truncated or corrupted and is ignored.", file_description, file_path);
+        return {};
+    }
+
+    std::vector<ByteType> data(static_cast<size_t>(file_header.data_size));
+    file_stream.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size())); // NOSONAR
+    if (!file_stream.good() ||
+        ComputeDataHash(reinterpret_cast<const uint8_t*>(data.data()), data.size()) != file_header.data_hash) // NOSONAR
+    {
+        META_LOG("WARNING: Vulkan {} file '{}' is truncated or corrupted and is ignored.", file_description, file_path);
+        return {};
+    }
+
+    return data;
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -25,6 +25,8 @@ Vulkan implementation of the compute state interface.
 
 #include <Methane/Graphics/Base/ComputeState.h>
 
+#include <Methane/Memory.hpp>
+
 #include <vulkan/vulkan.hpp>
 
 namespace Methane::Graphics::Vulkan
@@ -50,13 +52,13 @@ public:
 
     const vk::Pipeline& GetNativePipeline() const noexcept
     {
-        return m_vk_unique_pipeline.get();
+        return m_vk_pipeline_ptr->get();
     }
 
 private:
-    const Device&      m_device;
-    const IContext&    m_vk_context;
-    vk::UniquePipeline m_vk_unique_pipeline;
+    const Device&           m_device;
+    const IContext&         m_vk_context;
+    Ptr<vk::UniquePipeline> m_vk_pipeline_ptr;
 };
 
 } // namespace Methane::Graphics::Vulkan
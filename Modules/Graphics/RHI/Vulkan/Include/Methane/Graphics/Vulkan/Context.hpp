@@ -33,6 +33,8 @@ Vulkan template implementation of the base context interface.
 #include "Texture.h"
 #include "Sampler.h"
 #include "DescriptorManager.h"
+#include "StagingRingBuffer.h"
+#include "ShaderRegistry.h"
 
 #include <Methane/Graphics/RHI/IRenderContext.h>
 #include <Methane/Graphics/RHI/ICommandKit.h>
@@ -40,6 +42,7 @@ Vulkan template implementation of the base context interface.
 
 #include <string>
 #include <map>
+#include <mutex>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -62,6 +65,12 @@ public:
         // to release all descriptor sets using live device instance
         ContextBaseT::GetDescriptorManager().Release();
 
+        // Staging ring buffer memory has to be released before destroying device memory allocator
+        {
+            std::lock_guard lock(m_staging_ring_buffer_mutex);
+            m_staging_ring_buffer_ptr.reset();
+        }
+
         ContextBaseT::Release();
     }
 
@@ -125,6 +134,41 @@ public:
     {
         return static_cast<DescriptorManager&>(ContextBaseT::GetDescriptorManager());
     }
+
+    StagingRingBuffer& GetVulkanStagingRingBuffer() const final
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_staging_ring_buffer_mutex);
+        if (!m_staging_ring_buffer_ptr)
+        {
+            // Staging ring is partitioned between frames in flight, so that uploads of the next frames
+            // do not wait for completion of the previous frame uploads
+            StagingRingBufferSettings staging_ring_settings;
+            if constexpr (requires { ContextBaseT::GetSettings().frame_buffers_count; })
+                staging_ring_settings.frames_count = ContextBaseT::GetSettings().frame_buffers_count;
+
+            m_staging_ring_buffer_ptr = std::make_unique<StagingRingBuffer>(GetVulkanDevice(), staging_ring_settings);
+        }
+        return *m_staging_ring_buffer_ptr;
+    }
+
+    ShaderRegistry& GetVulkanShaderRegistry() const final
+    {
+        META_FUNCTION_TASK();
+        std::lock_guard lock(m_shader_registry_mutex);
+        if (!m_shader_registry_ptr)
+        {
+            m_shader_registry_ptr = std::make_unique<ShaderRegistry>(
+                ContextBaseT::GetBaseDevice().GetCapabilities().shader_reflection_cache_file_path);
+        }
+        return *m_shader_registry_ptr;
+    }
+
+private:
+    mutable UniquePtr<StagingRingBuffer>        m_staging_ring_buffer_ptr;
+    mutable TracyLockable(std::mutex,           m_staging_ring_buffer_mutex);
+    mutable UniquePtr<ShaderRegistry>           m_shader_registry_ptr;
+    mutable TracyLockable(std::mutex,           m_shader_registry_mutex);
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -17,19 +17,27 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.h
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator using per-thread pools
+and descriptor type ratios adapted to allocations.
 
 ******************************************************************************/
 
 #pragma once
 
 #include <Methane/Graphics/Base/DescriptorManager.h>
+#include <Methane/Memory.hpp>
 #include <Methane/Instrumentation.h>
 
 #include <vulkan/vulkan.hpp>
+#include <array>
+#include <atomic>
 #include <map>
 #include <optional>
 #include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <thread>
+#include <unordered_map>
 
 namespace Methane::Graphics::Rhi
 {
@@ -50,11 +58,24 @@ namespace Methane::Graphics::Vulkan
 
 struct IContext;
 
+struct DescriptorManagerStatistics
+{
+    uint32_t pools_count          = 0U; // all descriptor pools created by manager
+    uint32_t used_pools_count     = 0U; // pools with allocated descriptor sets
+    uint32_t free_pools_count     = 0U; // reset pools available for reuse
+    uint32_t threads_count        = 0U; // threads with cached descriptor pools since manager release
+    uint32_t allocated_sets_count = 0U; // descriptor sets allocated since manager release
+
+    [[nodiscard]] friend bool operator==(const DescriptorManagerStatistics& left, const DescriptorManagerStatistics& right) noexcept = default;
+};
+
 class DescriptorManager final
     : public Base::DescriptorManager
 {
 public:
     using PoolSizeRatioByDescType = std::map<vk::DescriptorType, float>;
+    using LayoutBindings          = std::span<const vk::DescriptorSetLayoutBinding>;
+    using Statistics              = DescriptorManagerStatistics;
 
     DescriptorManager(Base::Context& context, uint32_t pool_sets_count = 1000U,
                       const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type = {
@@ -74,22 +95,47 @@ public:
     // IDescriptorManager overrides
     void Release() override;
 
+    // Size ratio is used for new pools until enough allocations are observed to adapt it
     void SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio);
-    vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout);
+
+    // Descriptor set is valid until manager release,
+    // layout bindings are counted to adapt descriptor type ratios of the new pools
+    vk::DescriptorSet AllocDescriptorSet(vk::DescriptorSetLayout layout, LayoutBindings layout_bindings = {});
+
+    [[nodiscard]] Statistics GetStatistics() const;
 
 private:
+    // Descriptor pool cached by allocating thread, so that parallel allocations do not contend for the shared pools lock;
+    // thread pools are removed on manager release, so that pools of the finished threads are not kept forever
+    struct ThreadPool
+    {
+        vk::DescriptorPool        pool;
+        TracyLockable(std::mutex, mutex);
+    };
+
+    static constexpr size_t s_core_descriptor_types_count = static_cast<size_t>(vk::DescriptorType::eInputAttachment) + 1U;
+    using DescriptorCounts = std::array<std::atomic<uint64_t>, s_core_descriptor_types_count>;
+
+    ThreadPool&        GetThreadPool(std::shared_lock<std::shared_mutex>& thread_pools_lock);
+    vk::DescriptorSet  AllocDescriptorSetFromPool(vk::DescriptorPool& vk_current_pool, const vk::DescriptorSetLayout& layout);
+    void               CountLayoutBindings(LayoutBindings layout_bindings);
+    float              GetAdaptiveSizeRatio(vk::DescriptorType descriptor_type, float default_size_ratio) const;
     vk::DescriptorPool CreateDescriptorPool();
     vk::DescriptorPool AcquireDescriptorPool();
     const IContext&    GetContextVk();
 
-    const IContext*                       m_vk_context_ptr = nullptr;
-    uint32_t                              m_pool_sets_count;
-    PoolSizeRatioByDescType               m_pool_size_ratio_by_desc_type;
-    std::vector<vk::UniqueDescriptorPool> m_vk_descriptor_pools;
-    std::vector<vk::DescriptorPool>       m_vk_used_pools;
-    std::vector<vk::DescriptorPool>       m_vk_free_pools;
-    vk::DescriptorPool                    m_vk_current_pool;
-    TracyLockable(std::mutex,             m_descriptor_pool_mutex);
+    const IContext*                                                 m_vk_context_ptr = nullptr;
+    uint32_t                                                        m_pool_sets_count;
+    PoolSizeRatioByDescType                                         m_pool_size_ratio_by_desc_type;
+    DescriptorCounts                                                m_observed_descriptors_count{};
+    std::atomic<uint64_t>                                           m_observed_sets_count      = 0U;
+    std::atomic<uint32_t>                                           m_allocated_sets_count     = 0U;
+    std::vector<vk::UniqueDescriptorPool>                           m_vk_descriptor_pools;
+    std::vector<vk::DescriptorPool>                                 m_vk_used_pools;
+    std::vector<vk::DescriptorPool>                                 m_vk_free_pools;
+    mutable TracyLockable(std::mutex,                               m_descriptor_pool_mutex);
+    std::unordered_map<std::thread::id, UniquePtr<ThreadPool>>      m_thread_pools;
+    mutable std::shared_mutex                                       m_thread_pools_mutex;
 };
 
 } // namespace Methane::Graphics::Vulkan
@@ -23,6 +23,9 @@ Vulkan implementation of the device interface.
 
 #pragma once
 
+#include "PipelineCache.h"
+#include "MemoryAllocator.h"
+
 #include <Methane/Graphics/Base/Device.h>
 #include <Methane/Graphics/RHI/ICommandQueue.h>
 #include <Methane/Platform/AppEnvironment.h>
@@ -94,13 +97,14 @@ public:
     [[nodiscard]] const QueueFamilyReservation* GetQueueFamilyReservationPtr(Rhi::CommandListType cmd_queue_type) const noexcept;
     [[nodiscard]] const QueueFamilyReservation& GetQueueFamilyReservation(Rhi::CommandListType cmd_queue_type) const;
     [[nodiscard]] SwapChainSupport GetSwapChainSupportForSurface(const vk::SurfaceKHR& vk_surface) const noexcept;
-    [[nodiscard]] Opt<uint32_t> FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept;
 
     const vk::PhysicalDevice&        GetNativePhysicalDevice() const noexcept { return m_vk_physical_device; }
     const vk::Device&                GetNativeDevice() const noexcept         { return m_vk_unique_device.get(); }
     const vk::QueueFamilyProperties& GetNativeQueueFamilyProperties(uint32_t queue_family_index) const;
     bool                             IsExtensionSupported(std::string_view required_extension) const;
     bool                             IsDynamicStateSupported() const noexcept { return m_is_dynamic_state_supported; }
+    PipelineCache&                   GetPipelineCache() const;
+    MemoryAllocator&                 GetMemoryAllocator() const;
 
 private:
     using QueueFamilyReservationByType = std::map<Rhi::CommandListType, Ptr<QueueFamilyReservation>>;
@@ -117,6 +121,8 @@ private:
     const bool                             m_is_dynamic_state_supported = false;
     std::vector<vk::QueueFamilyProperties> m_vk_queue_family_properties;
     vk::UniqueDevice                       m_vk_unique_device;
+    UniquePtr<PipelineCache>               m_pipeline_cache_ptr;   // must be destroyed before device
+    UniquePtr<MemoryAllocator>             m_memory_allocator_ptr; // must be destroyed before device
     QueueFamilyReservationByType           m_queue_family_reservation_by_type;
 };
 
@@ -31,12 +31,16 @@ namespace Methane::Graphics::Vulkan
 class Device;
 class CommandQueue;
 class DescriptorManager;
+class StagingRingBuffer;
+class ShaderRegistry;
 
 struct IContext
 {
     virtual const Device& GetVulkanDevice() const noexcept = 0;
     virtual CommandQueue& GetVulkanDefaultCommandQueue(Rhi::CommandListType type) = 0;
     virtual DescriptorManager& GetVulkanDescriptorManager() const = 0;
+    virtual StagingRingBuffer& GetVulkanStagingRingBuffer() const = 0;
+    virtual ShaderRegistry& GetVulkanShaderRegistry() const = 0;
 
     virtual ~IContext() = default;
 };
@@ -0,0 +1,175 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.h
+Vulkan device memory sub-allocator with memory blocks per memory type.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/BlockAllocator.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <map>
+#include <mutex>
+#include <variant>
+
+namespace Methane::Graphics::Vulkan
+{
+
+enum class MemoryAllocationStrategy : uint32_t
+{
+    Buddy,  // general purpose allocations with merging of freed ranges
+    Linear, // transient allocations, block space is reused when all its allocations are freed
+};
+
+// Linear buffers and optimal images are placed in separate memory blocks to avoid bufferImageGranularity conflicts
+enum class MemoryResourceKind : uint32_t
+{
+    Buffer,
+    Image,
+};
+
+struct MemoryAllocatorSettings
+{
+    vk::DeviceSize           device_local_block_size   = 64U * 1024U * 1024U;
+    vk::DeviceSize           host_visible_block_size   = 16U * 1024U * 1024U;
+    vk::DeviceSize           min_allocation_size       = 256U;
+    float                    dedicated_allocation_ratio = 0.5F; // allocations larger than block size ratio get dedicated memory
+    MemoryAllocationStrategy strategy                  = MemoryAllocationStrategy::Buddy;
+};
+
+struct MemoryAllocatorStatistics
+{
+    uint32_t       blocks_count                = 0U;
+    uint32_t       dedicated_allocations_count = 0U;
+    uint32_t       allocations_count           = 0U; // live allocations in blocks, excluding dedicated
+    uint32_t       device_allocations_count    = 0U; // total calls of vkAllocateMemory made by allocator
+    vk::DeviceSize device_memory_size          = 0U; // size of all device memory allocated by allocator
+    vk::DeviceSize used_size                   = 0U; // size of memory ranges used by live allocations
+    vk::DeviceSize requested_size              = 0U; // size requested by live allocations
+    vk::DeviceSize free_size                   = 0U; // free size in all blocks
+    vk::DeviceSize largest_free_size           = 0U; // largest free range among all blocks
+    float          fragmentation               = 0.F; // free memory ratio not usable for the largest allocation
+};
+
+class MemoryAllocator;
+
+class MemoryBlock
+{
+public:
+    using Policy = std::variant<Data::BuddyBlockAllocator<vk::DeviceSize>, Data::LinearBlockAllocator<vk::DeviceSize>>;
+
+    MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, MemoryResourceKind resource_kind, vk::DeviceSize size,
+                bool is_host_visible, bool is_dedicated, const MemoryAllocatorSettings& settings);
+
+    [[nodiscard]] Opt<vk::DeviceSize> Allocate(vk::DeviceSize size, vk::DeviceSize alignment);
+    void Free(vk::DeviceSize offset);
+
+    [[nodiscard]] bool                    IsEmpty() const;
+    [[nodiscard]] bool                    IsDedicated() const noexcept          { return m_is_dedicated; }
+    [[nodiscard]] uint32_t                GetMemoryTypeIndex() const noexcept   { return m_memory_type_index; }
+    [[nodiscard]] MemoryResourceKind      GetResourceKind() const noexcept      { return m_resource_kind; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept              { return m_size; }
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept { return m_vk_unique_memory.get(); }
+    [[nodiscard]] Data::RawPtr            GetMappedDataPtr() const noexcept     { return m_mapped_data_ptr; }
+    [[nodiscard]] Data::BlockAllocatorStatistics<vk::DeviceSize> GetStatistics() const;
+
+private:
+    const uint32_t           m_memory_type_index;
+    const MemoryResourceKind m_resource_kind;
+    const vk::DeviceSize     m_size;
+    const bool               m_is_dedicated;
+    vk::UniqueDeviceMemory   m_vk_unique_memory;
+    Data::RawPtr             m_mapped_data_ptr = nullptr;
+    Policy                   m_policy;
+};
+
+class MemoryAllocation // NOSONAR - custom destructor is required
+{
+public:
+    MemoryAllocation() = default;
+    MemoryAllocation(MemoryAllocator& allocator, MemoryBlock& block, vk::DeviceSize offset, vk::DeviceSize size) noexcept;
+    MemoryAllocation(const MemoryAllocation&) = delete;
+    MemoryAllocation(MemoryAllocation&& other) noexcept;
+    ~MemoryAllocation();
+
+    MemoryAllocation& operator=(const MemoryAllocation&) = delete;
+    MemoryAllocation& operator=(MemoryAllocation&& other) noexcept;
+
+    [[nodiscard]] explicit operator bool() const noexcept { return m_block_ptr != nullptr; }
+
+    [[nodiscard]] const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept;
+    [[nodiscard]] vk::DeviceSize          GetOffset() const noexcept { return m_offset; }
+    [[nodiscard]] vk::DeviceSize          GetSize() const noexcept   { return m_size; }
+    [[nodiscard]] bool                    IsDedicated() const noexcept;
+
+    // Host visible memory is persistently mapped, so mapped pointer is returned without vkMapMemory call,
+    // which is not allowed to be done concurrently for the same memory block shared by multiple resources
+    [[nodiscard]] Data::RawPtr GetMappedDataPtr() const noexcept;
+
+    void Release();
+
+private:
+    MemoryAllocator* m_allocator_ptr = nullptr;
+    MemoryBlock*     m_block_ptr     = nullptr;
+    vk::DeviceSize   m_offset        = 0U;
+    vk::DeviceSize   m_size          = 0U;
+};
+
+class MemoryAllocator
+{
+public:
+    using Settings   = MemoryAllocatorSettings;
+    using Statistics = MemoryAllocatorStatistics;
+
+    MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings = {});
+
+    [[nodiscard]] MemoryAllocation Allocate(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                            MemoryResourceKind resource_kind);
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept { return m_settings; }
+    [[nodiscard]] Statistics      GetStatistics() const;
+
+private:
+    friend class MemoryAllocation;
+
+    void Free(MemoryBlock& block, vk::DeviceSize offset);
+
+    [[nodiscard]] Opt<uint32_t>  FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept;
+    [[nodiscard]] vk::DeviceSize GetBlockSize(uint32_t memory_type_index) const noexcept;
+    [[nodiscard]] bool           IsHostVisible(uint32_t memory_type_index) const noexcept;
+
+    using PoolId = std::pair<uint32_t, MemoryResourceKind>;
+    using BlockPools = std::map<PoolId, UniquePtrs<MemoryBlock>>;
+
+    const vk::Device                         m_vk_device;
+    const vk::PhysicalDeviceMemoryProperties m_vk_memory_props;
+    const Settings                           m_settings;
+    BlockPools                               m_block_pools;
+    UniquePtrs<MemoryBlock>                  m_dedicated_blocks;
+    uint32_t                                 m_device_allocations_count = 0U;
+    mutable TracyLockable(std::mutex,        m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
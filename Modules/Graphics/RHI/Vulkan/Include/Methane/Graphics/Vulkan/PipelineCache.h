@@ -0,0 +1,114 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.h
+Vulkan device pipeline cache with on-disk serialization
+and in-process deduplication of identical pipelines.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <map>
+#include <mutex>
+#include <cstddef>
+
+namespace Methane::Graphics::Vulkan
+{
+
+struct PipelineCacheStatistics
+{
+    uint32_t graphics_pipelines_created = 0U;
+    uint32_t compute_pipelines_created  = 0U;
+    uint32_t pipeline_cache_hits        = 0U;
+    size_t   loaded_data_size           = 0U;
+    size_t   saved_data_size            = 0U;
+    bool     is_loaded_from_file        = false;
+
+    [[nodiscard]] friend bool operator==(const PipelineCacheStatistics& left, const PipelineCacheStatistics& right) noexcept = default;
+};
+
+class PipelineCache
+{
+public:
+    using Statistics = PipelineCacheStatistics;
+    using Key        = std::vector<std::byte>;
+
+    // Methane header prepended to the native Vulkan pipeline cache data in file
+    struct FileHeader
+    {
+        static constexpr uint32_t s_magic   = 0x4350544DU; // 'MTPC'
+        static constexpr uint32_t s_version = 1U;
+
+        uint32_t magic     = s_magic;
+        uint32_t version   = s_version;
+        uint64_t data_size = 0U;
+        uint64_t data_hash = 0U;
+    };
+
+    PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, std::string file_path);
+    PipelineCache(const PipelineCache&) = delete;
+    PipelineCache(PipelineCache&&) = delete;
+    ~PipelineCache();
+
+    PipelineCache& operator=(const PipelineCache&) = delete;
+    PipelineCache& operator=(PipelineCache&&) = delete;
+
+    [[nodiscard]] static Key MakeGraphicsPipelineKey(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info);
+    [[nodiscard]] static Key MakeComputePipelineKey(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info);
+    [[nodiscard]] static bool IsNativeCacheDataCompatible(const std::vector<uint8_t>& vk_cache_data,
+                                                          const vk::PhysicalDeviceProperties& vk_device_props) noexcept;
+
+    [[nodiscard]] Ptr<vk::UniquePipeline> CreateGraphicsPipeline(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info);
+    [[nodiscard]] Ptr<vk::UniquePipeline> CreateComputePipeline(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info);
+
+    // Deduplicated pipeline shared by several states is not renamed, so that it keeps the name of the state which created it
+    void SetPipelineName(const Ptr<vk::UniquePipeline>& pipeline_ptr, std::string_view name) const;
+
+    bool Save();
+
+    [[nodiscard]] const std::string&       GetFilePath() const noexcept          { return m_file_path; }
+    [[nodiscard]] const vk::PipelineCache& GetNativePipelineCache() const noexcept { return m_vk_unique_pipeline_cache.get(); }
+    [[nodiscard]] Statistics               GetStatistics() const;
+
+private:
+    using PipelineByKey = std::map<Key, WeakPtr<vk::UniquePipeline>>;
+
+    std::vector<uint8_t> LoadNativeCacheData();
+
+    template<typename CreatePipelineFunc>
+    Ptr<vk::UniquePipeline> GetOrCreatePipeline(Key&& key, uint32_t& created_pipelines_count, const CreatePipelineFunc& create_pipeline);
+
+    const vk::PhysicalDeviceProperties m_vk_device_props;
+    const vk::Device                   m_vk_device;
+    const std::string                  m_file_path;
+    Statistics                         m_statistics;
+    vk::UniquePipelineCache            m_vk_unique_pipeline_cache;
+    PipelineByKey                      m_pipeline_by_key;
+    mutable TracyLockable(std::mutex,  m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
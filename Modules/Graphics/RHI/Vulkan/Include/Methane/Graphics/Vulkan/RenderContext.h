@@ -91,7 +91,7 @@ public:
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore(uint32_t frame_buffer_index) const;
     const vk::Semaphore&    GetNativeFrameImageAvailableSemaphore(Opt<uint32_t> frame_buffer_index_opt) const;
 
-    void DeferredRelease(vk::UniquePipeline&& pipeline) const { m_vk_deferred_release_pipelines.emplace_back(std::move(pipeline)); }
+    void DeferredRelease(Ptr<vk::UniquePipeline>&& pipeline_ptr) const { m_vk_deferred_release_pipelines.emplace_back(std::move(pipeline_ptr)); }
 
 protected:
     // Base::RenderContext overrides
@@ -129,7 +129,7 @@ private:
     std::vector<vk::Image>                  m_vk_frame_images;
     std::vector<FrameSync>                  m_frame_sync_pool;
     std::vector<vk::Semaphore>              m_vk_frame_image_available_semaphores;
-    mutable std::deque<vk::UniquePipeline>  m_vk_deferred_release_pipelines;
+    mutable std::deque<Ptr<vk::UniquePipeline>> m_vk_deferred_release_pipelines;
 };
 
 } // namespace Methane::Graphics::Vulkan
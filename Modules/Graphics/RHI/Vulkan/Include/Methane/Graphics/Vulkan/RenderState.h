@@ -75,17 +75,17 @@ public:
     const vk::Pipeline& GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state);
 
 private:
-    vk::UniquePipeline CreateNativePipeline(const ViewState* viewState = nullptr, Opt<Rhi::RenderPrimitive> renderPrimitive = {}) const;
+    Ptr<vk::UniquePipeline> CreateNativePipeline(const ViewState* viewState = nullptr, Opt<Rhi::RenderPrimitive> renderPrimitive = {}) const;
 
     // IViewStateCallback overrides
     void OnViewStateChanged(Rhi::IViewState& view_state) override;
     void OnViewStateDestroyed(Rhi::IViewState& view_state) override;
 
     using PipelineId = std::tuple<Rhi::IViewState*, Rhi::RenderPrimitive>;
-    using MonolithicPipelineById = std::map<PipelineId, vk::UniquePipeline>;
+    using MonolithicPipelineById = std::map<PipelineId, Ptr<vk::UniquePipeline>>;
 
     const RenderContext&      m_vk_render_context;
-    vk::UniquePipeline        m_vk_pipeline_dynamic;
+    Ptr<vk::UniquePipeline>   m_vk_pipeline_dynamic_ptr;
     MonolithicPipelineById    m_vk_pipeline_monolithic_by_id;
     TracyLockable(std::mutex, m_mutex);
 };
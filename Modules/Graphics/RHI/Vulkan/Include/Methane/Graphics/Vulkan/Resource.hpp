@@ -145,7 +145,7 @@ public:
 
     const vk::DeviceMemory& GetNativeDeviceMemory() const noexcept final
     {
-        return m_vk_unique_device_memory.get();
+        return m_memory_allocation.GetNativeDeviceMemory();
     }
 
     const vk::Device& GetNativeDevice() const noexcept final
@@ -178,17 +178,19 @@ public:
             return m_vk_resource;
     }
 
+    const MemoryAllocation& GetMemoryAllocation() const noexcept
+    {
+        return m_memory_allocation;
+    }
+
 protected:
-    vk::UniqueDeviceMemory AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
+    MemoryAllocation AllocateDeviceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                          MemoryResourceKind resource_kind = MemoryResourceKind::Buffer)
     {
         META_FUNCTION_TASK();
-        const Opt<uint32_t> memory_type_opt = GetVulkanContext().GetVulkanDevice().FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
-        if (!memory_type_opt)
-            throw IResource::AllocationError(*this, "suitable memory type was not found");
-
         try
         {
-            return GetNativeDevice().allocateMemoryUnique(vk::MemoryAllocateInfo(memory_requirements.size, *memory_type_opt));
+            return GetVulkanContext().GetVulkanDevice().GetMemoryAllocator().Allocate(memory_requirements, memory_property_flags, resource_kind);
         }
         catch(const vk::SystemError& error)
         {
@@ -199,8 +201,10 @@ protected:
     void AllocateResourceMemory(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags)
     {
         META_FUNCTION_TASK();
-        m_vk_unique_device_memory.release();
-        m_vk_unique_device_memory = AllocateDeviceMemory(memory_requirements, memory_property_flags);
+        constexpr MemoryResourceKind resource_kind = std::is_same_v<NativeResourceType, vk::Buffer>
+                                                   ? MemoryResourceKind::Buffer
+                                                   : MemoryResourceKind::Image;
+        m_memory_allocation = AllocateDeviceMemory(memory_requirements, memory_property_flags, resource_kind);
     }
 
     template<typename T = ResourceStorageType>
@@ -264,7 +268,7 @@ private:
     using ViewDescriptorByViewId = std::map<ResourceView::Id, Ptr<ResourceView::ViewDescriptorVariant>>;
 
     vk::Device                   m_vk_device;
-    vk::UniqueDeviceMemory       m_vk_unique_device_memory;
+    MemoryAllocation             m_memory_allocation;
     ResourceStorageType          m_vk_resource;
     ViewDescriptorByViewId       m_view_descriptor_by_view_id;
     TracyLockable(std::mutex,    m_view_descriptors_mutex);
@@ -23,6 +23,8 @@ Vulkan implementation of the shader interface.
 
 #pragma once
 
+#include "ShaderRegistry.h"
+
 #include <Methane/Graphics/Base/Shader.h>
 #include <Methane/Data/MutableChunk.hpp>
 #include <Methane/Memory.hpp>
@@ -62,6 +64,7 @@ public:
     const Data::Chunk&                     GetNativeByteCode() const noexcept { return m_byte_code_chunk.AsConstChunk(); }
     const vk::ShaderModule&                GetNativeModule() const;
     const spirv_cross::Compiler&           GetNativeCompiler() const;
+    const ShaderReflection&                GetReflection() const noexcept { return m_compiled_shader_ptr->reflection; }
     vk::PipelineShaderStageCreateInfo      GetNativeStageCreateInfo() const;
     vk::PipelineVertexInputStateCreateInfo GetNativeVertexInputStateCreateInfo(const Program& program);
 
@@ -73,6 +76,7 @@ private:
     void InitializeVertexInputDescriptions(const Program& program);
 
     const IContext&                                  m_vk_context;
+    const Ptr<const CompiledShader>                  m_compiled_shader_ptr;
     Data::MutableChunk                               m_byte_code_chunk;
     mutable vk::UniqueShaderModule                   m_vk_unique_module;
     mutable UniquePtr<spirv_cross::Compiler>         m_spirv_compiler_ptr;
@@ -0,0 +1,150 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ShaderRegistry.h
+Vulkan registry of compiled shaders shared by all programs of the context
+with cached SPIR-V reflection, which is optionally persisted in file.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/Types.h>
+#include <Methane/Memory.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <string>
+#include <vector>
+#include <map>
+#include <mutex>
+
+namespace Methane::Data
+{
+struct IProvider;
+class Chunk;
+}
+
+namespace Methane::Graphics::Vulkan
+{
+
+struct ShaderResourceReflection
+{
+    std::string        name;
+    vk::DescriptorType descriptor_type       = vk::DescriptorType::eUniformBuffer;
+    uint32_t           descriptor_set_id     = 0U;
+    uint32_t           array_size            = 1U;
+    uint32_t           buffer_size           = 0U;
+    uint32_t           descriptor_set_offset = 0U; // byte code word offset of descriptor set decoration
+    uint32_t           binding_offset        = 0U; // byte code word offset of binding decoration
+
+    [[nodiscard]] friend bool operator==(const ShaderResourceReflection& left, const ShaderResourceReflection& right) noexcept = default;
+};
+
+struct ShaderStageInputReflection
+{
+    std::string semantic_name;
+    uint32_t    location    = 0U;
+    vk::Format  format      = vk::Format::eUndefined;
+    uint32_t    vector_size = 0U;
+
+    [[nodiscard]] friend bool operator==(const ShaderStageInputReflection& left, const ShaderStageInputReflection& right) noexcept = default;
+};
+
+struct ShaderReflection
+{
+    std::vector<ShaderResourceReflection>   resources;    // resources statically used by shader code only
+    std::vector<ShaderStageInputReflection> stage_inputs;
+
+    [[nodiscard]] friend bool operator==(const ShaderReflection& left, const ShaderReflection& right) noexcept = default;
+};
+
+// Original byte code loaded from data provider, which is copied by shaders before patching descriptor bindings
+struct CompiledShader
+{
+    Data::Bytes      byte_code;
+    uint64_t         byte_code_hash = 0U;
+    ShaderReflection reflection;
+};
+
+struct ShaderRegistryStatistics
+{
+    uint32_t byte_code_loads_count       = 0U; // byte code loads from data providers
+    uint32_t byte_code_hits_count        = 0U; // shader creations which reused loaded byte code
+    uint32_t reflections_count           = 0U; // byte code parsings with SPIRV-Cross
+    uint32_t reflection_cache_hits_count = 0U; // reflections loaded from cache file
+    uint32_t loaded_reflections_count    = 0U;
+    uint32_t saved_reflections_count     = 0U;
+
+    [[nodiscard]] friend bool operator==(const ShaderRegistryStatistics& left, const ShaderRegistryStatistics& right) noexcept = default;
+};
+
+class ShaderRegistry
+{
+public:
+    using Statistics = ShaderRegistryStatistics;
+
+    struct FileHeader
+    {
+        static constexpr uint32_t s_magic   = 0x5253544DU; // 'MTSR'
+        static constexpr uint32_t s_version = 1U;
+
+        uint32_t magic     = s_magic;
+        uint32_t version   = s_version;
+        uint64_t data_size = 0U;
+        uint64_t data_hash = 0U;
+    };
+
+    explicit ShaderRegistry(std::string reflection_cache_file_path);
+    ShaderRegistry(const ShaderRegistry&) = delete;
+    ShaderRegistry(ShaderRegistry&&) = delete;
+    ~ShaderRegistry();
+
+    ShaderRegistry& operator=(const ShaderRegistry&) = delete;
+    ShaderRegistry& operator=(ShaderRegistry&&) = delete;
+
+    // Compiled entry function name includes macro definitions, so it identifies byte code in the data provider
+    [[nodiscard]] Ptr<const CompiledShader> GetCompiledShader(const Data::IProvider& data_provider, const std::string& compiled_entry_name);
+
+    [[nodiscard]] static ShaderReflection ReflectByteCode(const Data::Chunk& spirv_byte_code);
+    [[nodiscard]] static Data::Bytes      SerializeReflections(const std::map<uint64_t, ShaderReflection>& reflection_by_hash);
+    [[nodiscard]] static bool             DeserializeReflections(const Data::Bytes& data, std::map<uint64_t, ShaderReflection>& reflection_by_hash);
+
+    bool Save();
+
+    [[nodiscard]] const std::string& GetReflectionCacheFilePath() const noexcept { return m_reflection_cache_file_path; }
+    [[nodiscard]] Statistics         GetStatistics() const;
+
+private:
+    using ShaderKey             = std::pair<const Data::IProvider*, std::string>;
+    using CompiledShaderByKey   = std::map<ShaderKey, Ptr<const CompiledShader>>;
+    using ReflectionByHash      = std::map<uint64_t, ShaderReflection>;
+
+    void LoadReflectionCache();
+    ShaderReflection GetReflection(const Data::Chunk& byte_code, uint64_t byte_code_hash);
+
+    const std::string                 m_reflection_cache_file_path;
+    CompiledShaderByKey               m_compiled_shader_by_key;
+    ReflectionByHash                  m_reflection_by_hash;
+    bool                              m_reflection_cache_changed = false;
+    Statistics                        m_statistics;
+    mutable TracyLockable(std::mutex, m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
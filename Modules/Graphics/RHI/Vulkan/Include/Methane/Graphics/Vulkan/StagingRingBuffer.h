@@ -0,0 +1,140 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRingBuffer.h
+Vulkan persistently mapped staging ring buffer shared by all resource uploads
+of the context, ring ranges are retired on upload command list completion.
+
+******************************************************************************/
+
+#pragma once
+
+#include "MemoryAllocator.h"
+
+#include <Methane/Graphics/RHI/ICommandList.h>
+#include <Methane/Data/BlockAllocator.hpp>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <vulkan/vulkan.hpp>
+
+#include <deque>
+#include <mutex>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class Device;
+
+struct StagingRingBufferSettings
+{
+    vk::DeviceSize frame_size   = 8U * 1024U * 1024U; // ring partition size per frame in flight
+    uint32_t       frames_count = 3U;                 // count of frames in flight
+
+    [[nodiscard]] vk::DeviceSize GetRingSize() const noexcept { return frame_size * frames_count; }
+};
+
+struct StagingRingBufferStatistics
+{
+    vk::DeviceSize ring_size                = 0U;
+    vk::DeviceSize ring_used_size           = 0U; // size of ring ranges not retired yet
+    vk::DeviceSize staged_size              = 0U; // total size of data staged through the ring
+    vk::DeviceSize dedicated_staged_size    = 0U; // total size of data staged through temporary dedicated buffers
+    uint32_t       staged_uploads_count     = 0U;
+    uint32_t       dedicated_uploads_count  = 0U; // uploads which did not fit into the ring
+    uint32_t       ring_wraps_count         = 0U;
+    uint32_t       pending_segments_count   = 0U; // upload command list submissions not completed yet
+
+    [[nodiscard]] friend bool operator==(const StagingRingBufferStatistics& left, const StagingRingBufferStatistics& right) noexcept = default;
+};
+
+struct StagingRegion
+{
+    vk::Buffer     vk_buffer;
+    vk::DeviceSize offset   = 0U;
+    vk::DeviceSize size     = 0U;
+    Data::RawPtr   data_ptr = nullptr; // mapped pointer to the region beginning
+};
+
+class StagingRingBuffer final
+    : private Data::Receiver<Rhi::ICommandListCallback> //NOSONAR
+{
+public:
+    using Settings   = StagingRingBufferSettings;
+    using Statistics = StagingRingBufferStatistics;
+
+    StagingRingBuffer(const Device& device, const Settings& settings = {});
+    StagingRingBuffer(const StagingRingBuffer&) = delete;
+    StagingRingBuffer(StagingRingBuffer&&) = delete;
+    ~StagingRingBuffer() override = default;
+
+    StagingRingBuffer& operator=(const StagingRingBuffer&) = delete;
+    StagingRingBuffer& operator=(StagingRingBuffer&&) = delete;
+
+    // Returns mapped staging region valid until the given upload command list completes execution
+    [[nodiscard]] StagingRegion Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size);
+
+    [[nodiscard]] const Settings&     GetSettings() const noexcept       { return m_settings; }
+    [[nodiscard]] const vk::Buffer&   GetNativeBuffer() const noexcept   { return m_vk_unique_buffer.get(); }
+    [[nodiscard]] Statistics          GetStatistics() const;
+
+private:
+    // ICommandListCallback overrides
+    void OnCommandListStateChanged(Rhi::ICommandList& command_list) override;
+    void OnCommandListExecutionCompleted(Rhi::ICommandList& command_list) override;
+
+    struct DedicatedStaging
+    {
+        vk::UniqueBuffer vk_unique_buffer;
+        MemoryAllocation memory_allocation;
+    };
+
+    enum class SegmentState
+    {
+        Encoding,
+        Executing,
+        Completed
+    };
+
+    // Ring ranges and dedicated buffers staged by one submission of the upload command list;
+    // segments are kept in ring allocation order, so they are retired from the front only
+    struct Segment
+    {
+        Rhi::ICommandList*            cmd_list_ptr = nullptr;
+        SegmentState                  state        = SegmentState::Encoding;
+        Opt<vk::DeviceSize>           ring_end_offset_opt;
+        std::vector<DedicatedStaging> dedicated_stagings;
+    };
+
+    Segment&      GetEncodingSegment(Rhi::ICommandList& upload_cmd_list);
+    StagingRegion AllocateDedicated(Segment& segment, vk::DeviceSize size);
+    void          RetireCompletedSegments();
+
+    const Settings                           m_settings;
+    const vk::Device                         m_vk_device;
+    MemoryAllocator&                         m_memory_allocator;
+    const vk::DeviceSize                     m_alignment;
+    vk::UniqueBuffer                         m_vk_unique_buffer;
+    MemoryAllocation                         m_memory_allocation;
+    Data::RingBlockAllocator<vk::DeviceSize> m_ring_allocator;
+    std::deque<Segment>                      m_segments;
+    Statistics                               m_statistics;
+    mutable TracyLockable(std::mutex,        m_mutex);
+};
+
+} // namespace Methane::Graphics::Vulkan
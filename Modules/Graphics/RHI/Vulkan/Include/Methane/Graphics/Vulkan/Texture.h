@@ -75,8 +75,8 @@ private:
     void GenerateMipLevels(Rhi::ICommandQueue& target_cmd_queue, State target_resource_state);
 
     vk::UniqueImage                  m_vk_unique_image;
-    vk::UniqueBuffer                 m_vk_unique_staging_buffer;
-    vk::UniqueDeviceMemory           m_vk_unique_staging_memory;
+    vk::UniqueBuffer                 m_vk_unique_readback_buffer;
+    MemoryAllocation                 m_readback_memory_allocation;
     std::vector<vk::BufferImageCopy> m_vk_copy_regions;
 };
 
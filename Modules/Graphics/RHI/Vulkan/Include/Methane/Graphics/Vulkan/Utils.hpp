@@ -28,6 +28,7 @@ Methane graphics utils for Vulkan API.
 #include <vulkan/vulkan.hpp>
 
 #include <stdint.h>
+#include <stddef.h>
 
 namespace Methane::Graphics::Vulkan
 {
@@ -54,4 +55,16 @@ void SetVulkanObjectName(const vk::Device& vk_device, const VulkanObjectType& vk
     SetVulkanObjectName<VulkanObjectType>(vk_device, vk_object, name.data());
 }
 
+// FNV-1a 64-bit hash is enough to detect truncated or corrupted cache files and changed shader byte code
+inline uint64_t ComputeDataHash(const uint8_t* data_ptr, size_t data_size) noexcept
+{
+    uint64_t hash = 14695981039346656037ULL;
+    for(size_t i = 0; i < data_size; ++i)
+    {
+        hash ^= data_ptr[i];
+        hash *= 1099511628211ULL;
+    }
+    return hash;
+}
+
 } // namespace Methane::Graphics
\ No newline at end of file
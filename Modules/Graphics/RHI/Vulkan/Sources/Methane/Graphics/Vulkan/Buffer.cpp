@@ -23,6 +23,7 @@ Vulkan implementation of the buffer interface.
 
 #include <Methane/Graphics/Vulkan/Buffer.h>
 #include <Methane/Graphics/Vulkan/IContext.h>
+#include <Methane/Graphics/Vulkan/StagingRingBuffer.h>
 
 #include <Methane/Graphics/Types.h>
 #include <Methane/Graphics/Base/Context.h>
@@ -87,21 +88,23 @@ Buffer::Buffer(const Base::Context& context, const Settings& settings)
 
     // Allocate resource primary memory
     AllocateResourceMemory(GetNativeDevice().getBufferMemoryRequirements(GetNativeResource()), vk_memory_property_flags);
-    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    GetNativeDevice().bindBufferMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 
-    if (!is_private_storage)
+    // Private buffer data is uploaded via context staging ring buffer,
+    // so only read-back buffers need their own host-visible buffer
+    if (!is_private_storage || !GetUsage().HasAnyBit(Rhi::ResourceUsage::ReadBack))
         return;
 
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = GetNativeDevice().createBufferUnique(
+    // Create read-back buffer and allocate its memory
+    m_vk_unique_readback_buffer = GetNativeDevice().createBufferUnique(
         vk::BufferCreateInfo(vk::BufferCreateFlags{},
             settings.size,
-            vk::BufferUsageFlagBits::eTransferSrc,
+            vk::BufferUsageFlagBits::eTransferDst,
             vk::SharingMode::eExclusive)
     );
 
-    m_vk_unique_staging_memory = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    GetNativeDevice().bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    m_readback_memory_allocation = AllocateDeviceMemory(GetNativeDevice().getBufferMemoryRequirements(m_vk_unique_readback_buffer.get()), vk_staging_memory_flags);
+    GetNativeDevice().bindBufferMemory(m_vk_unique_readback_buffer.get(), m_readback_memory_allocation.GetNativeDeviceMemory(), m_readback_memory_allocation.GetOffset());
 }
 
 void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResource& sub_resource)
@@ -111,30 +114,24 @@ void Buffer::SetData(Rhi::ICommandQueue& target_cmd_queue, const Rhi::SubResourc
 
     const Settings& buffer_settings = GetSettings();
     const bool is_private_storage = buffer_settings.storage_mode == Rhi::IBuffer::StorageMode::Private;
-    const vk::DeviceMemory& vk_device_memory = is_private_storage ? m_vk_unique_staging_memory.get() : GetNativeDeviceMemory();
-
-    const vk::DeviceSize sub_resource_offset = 0U;
-    Data::RawPtr sub_resource_data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    if (is_private_storage)
-    {
-        m_vk_copy_region = vk::BufferCopy(sub_resource_offset, sub_resource_offset, static_cast<vk::DeviceSize>(sub_resource.GetDataSize()));
-    }
-
+    const Data::Size data_offset = sub_resource.HasDataRange() ? sub_resource.GetDataRange().GetStart() : 0U;
     if (!is_private_storage)
+    {
+        // Host visible memory is persistently mapped by the device memory allocator
+        Data::RawPtr sub_resource_data_ptr = GetMemoryAllocation().GetMappedDataPtr();
+        META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr + data_offset);
         return;
+    }
 
-    // In case of private GPU storage, copy buffer data from staging upload resource to the device-local GPU resource
+    // In case of private GPU storage, copy buffer data to the context staging ring region
+    // retired on upload completion and copy it from there to the device-local GPU resource
     TransferCommandList& upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
-    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(m_vk_unique_staging_buffer.get(), GetNativeResource(), 1U, &m_vk_copy_region);
+    const StagingRegion staging_region = GetVulkanContext().GetVulkanStagingRingBuffer().Allocate(upload_cmd_list, sub_resource.GetDataSize());
+    std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_region.data_ptr);
+
+    const vk::BufferCopy vk_copy_region(staging_region.offset, data_offset, staging_region.size);
+    upload_cmd_list.GetNativeCommandBufferDefault().copyBuffer(staging_region.vk_buffer, GetNativeResource(), 1U, &vk_copy_region);
     CompleteResourceTransfer(upload_cmd_list, GetTargetResourceStateByBufferType(buffer_settings.type), target_cmd_queue);
     GetContext().RequestDeferredAction(Rhi::ContextDeferredAction::UploadResources);
 }
@@ -162,17 +159,10 @@ Rhi::SubResource Buffer::GetData(Rhi::ICommandQueue& target_cmd_queue, const Byt
 Data::Bytes Buffer::GetDataFromSharedBuffer(const BytesRange& data_range) const
 {
     META_FUNCTION_TASK();
-    Data::RawPtr data_ptr = nullptr;
-    const vk::DeviceMemory& vk_device_memory = GetNativeDeviceMemory();
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, data_range.GetStart(), data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(vk_device_memory);
-
-    return data;
+    const Data::RawPtr mapped_data_ptr = GetMemoryAllocation().GetMappedDataPtr();
+    META_CHECK_NOT_NULL_DESCR(mapped_data_ptr, "failed to map buffer subresource");
+    const Data::RawPtr data_ptr = mapped_data_ptr + data_range.GetStart();
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::ICommandQueue& target_cmd_queue)
@@ -182,23 +172,17 @@ Data::Bytes Buffer::GetDataFromPrivateBuffer(const BytesRange& data_range, Rhi::
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     const vk::BufferCopy vk_buffer_copy(data_range.GetStart(), 0U, data_range.GetLength());
-    vk_cmd_buffer.copyBuffer(GetNativeResource(), m_vk_unique_staging_buffer.get(), 1U, &vk_buffer_copy);
+    vk_cmd_buffer.copyBuffer(GetNativeResource(), m_vk_unique_readback_buffer.get(), 1U, &vk_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_buffer_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
 
-    // Copy buffer data from mapped staging resource
-    Data::RawPtr data_ptr = nullptr;
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(m_vk_unique_staging_memory.get(), 0U, data_range.GetLength(),
-                                                                 vk::MemoryMapFlags{}, reinterpret_cast<void**>(&data_ptr)); // NOSONAR
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map buffer subresource");
+    // Copy buffer data from mapped read-back buffer
+    const Data::RawPtr data_ptr = m_readback_memory_allocation.GetMappedDataPtr();
     META_CHECK_NOT_NULL_DESCR(data_ptr, "failed to map buffer subresource");
-    Data::Bytes data(data_ptr, data_ptr + data_range.GetLength());
-    GetNativeDevice().unmapMemory(m_vk_unique_staging_memory.get());
-
-    return data;
+    return Data::Bytes(data_ptr, data_ptr + data_range.GetLength());
 }
 
 bool Buffer::SetName(std::string_view name)
@@ -207,9 +191,9 @@ bool Buffer::SetName(std::string_view name)
     if (!Resource::SetName(name))
         return false;
 
-    if (m_vk_unique_staging_buffer)
+    if (m_vk_unique_readback_buffer)
     {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
+        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_readback_buffer.get(), fmt::format("{} Read-back Buffer", name));
     }
     return true;
 }
@@ -75,9 +75,7 @@ void ComputeState::Reset(const Settings& settings)
         program.AcquireNativePipelineLayout()
     );
 
-    auto pipe = m_vk_context.GetVulkanDevice().GetNativeDevice().createComputePipelineUnique(nullptr, vk_pipeline_create_info);
-    META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-    m_vk_unique_pipeline = std::move(pipe.value);
+    m_vk_pipeline_ptr = m_vk_context.GetVulkanDevice().GetPipelineCache().CreateComputePipeline(vk_pipeline_create_info);
 }
 
 void ComputeState::Apply(Base::ComputeCommandList& compute_command_list)
@@ -93,7 +91,7 @@ bool ComputeState::SetName(std::string_view name)
     if (!Base::ComputeState::SetName(name))
         return false;
 
-    SetVulkanObjectName(m_vk_context.GetVulkanDevice().GetNativeDevice(), m_vk_unique_pipeline.get(), name);
+    m_vk_context.GetVulkanDevice().GetPipelineCache().SetPipelineName(m_vk_pipeline_ptr, name);
     return true;
 }
 
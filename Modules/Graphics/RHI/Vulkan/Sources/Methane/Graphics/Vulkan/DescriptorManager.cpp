@@ -17,7 +17,8 @@ limitations under the License.
 *******************************************************************************
 
 FILE: Methane/Graphics/Vulkan/DescriptorManager.cpp
-Vulkan descriptor manager with descriptor sets allocator.
+Vulkan descriptor manager with descriptor sets allocator using per-thread pools
+and descriptor type ratios adapted to allocations.
 
 ******************************************************************************/
 
@@ -31,9 +32,36 @@ Vulkan descriptor manager with descriptor sets allocator.
 #include <Methane/Graphics/RHI/ICommandList.h>
 #include <Methane/Instrumentation.h>
 
+#include <algorithm>
+
 namespace Methane::Graphics::Vulkan
 {
 
+// Descriptor type ratios are adapted only after enough descriptor sets were allocated to be representative
+static constexpr uint64_t g_min_adaptive_sets_count  = 64U;
+static constexpr float    g_adaptive_ratio_headroom  = 1.5F;
+static constexpr float    g_min_adaptive_size_ratio  = 0.125F;
+
+static Opt<vk::DescriptorSet> TryAllocDescriptorSet(const vk::Device& vk_device, const vk::DescriptorPool& vk_pool, const vk::DescriptorSetLayout& layout)
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(vk_pool, 1, &layout));
+        if (!descriptor_sets.empty())
+            return descriptor_sets.back();
+    }
+    catch(const vk::OutOfPoolMemoryError&)
+    {
+        META_LOG("Out of descriptor pool memory, reallocating.");
+    }
+    catch(const vk::FragmentedPoolError&)
+    {
+        META_LOG("Fragmented descriptor pool, reallocating.");
+    }
+    return std::nullopt;
+}
+
 DescriptorManager::DescriptorManager(Base::Context& context, uint32_t pool_sets_count, const PoolSizeRatioByDescType& pool_size_ratio_by_desc_type)
     : Base::DescriptorManager(context, false)
     , m_pool_sets_count(pool_sets_count)
@@ -45,56 +73,132 @@ void DescriptorManager::Release()
     META_FUNCTION_TASK();
     Base::DescriptorManager::Release();
 
+    {
+        // Descriptor sets are allocated under shared lock of the thread pools,
+        // so that thread pools can be removed here without invalidating pools in use
+        std::unique_lock thread_pools_lock(m_thread_pools_mutex);
+        m_thread_pools.clear();
+    }
+
     std::scoped_lock lock_guard(m_descriptor_pool_mutex);
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
-    for(vk::DescriptorPool& vk_pool : m_vk_used_pools)
+    for(const vk::DescriptorPool& vk_pool : m_vk_used_pools)
     {
         vk_device.resetDescriptorPool(vk_pool);
         m_vk_free_pools.emplace_back(vk_pool);
     }
     m_vk_used_pools.clear();
-    m_vk_current_pool = nullptr;
+    m_allocated_sets_count = 0U;
 }
 
 void DescriptorManager::SetDescriptorPoolSizeRatio(vk::DescriptorType descriptor_type, float size_ratio)
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
     m_pool_size_ratio_by_desc_type[descriptor_type] = size_ratio;
 }
 
-vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout)
+vk::DescriptorSet DescriptorManager::AllocDescriptorSet(vk::DescriptorSetLayout layout, LayoutBindings layout_bindings)
 {
     META_FUNCTION_TASK();
-    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
-    if (!m_vk_current_pool)
-        m_vk_current_pool = AcquireDescriptorPool();
-
-    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    CountLayoutBindings(layout_bindings);
+
+    std::shared_lock<std::shared_mutex> thread_pools_lock;
+    ThreadPool& thread_pool = GetThreadPool(thread_pools_lock);
+    std::scoped_lock lock_guard(thread_pool.mutex);
+    const vk::DescriptorSet descriptor_set = AllocDescriptorSetFromPool(thread_pool.pool, layout);
+    m_allocated_sets_count++;
+    return descriptor_set;
+}
 
-    try
+DescriptorManagerStatistics DescriptorManager::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    Statistics statistics;
     {
-        const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
-        if (!descriptor_sets.empty())
-            return descriptor_sets.back();
+        std::shared_lock thread_pools_lock(m_thread_pools_mutex);
+        statistics.threads_count = static_cast<uint32_t>(m_thread_pools.size());
     }
-    catch(const vk::OutOfPoolMemoryError&)
+
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+    statistics.pools_count          = static_cast<uint32_t>(m_vk_descriptor_pools.size());
+    statistics.used_pools_count     = static_cast<uint32_t>(m_vk_used_pools.size());
+    statistics.free_pools_count     = static_cast<uint32_t>(m_vk_free_pools.size());
+    statistics.allocated_sets_count = m_allocated_sets_count;
+    return statistics;
+}
+
+DescriptorManager::ThreadPool& DescriptorManager::GetThreadPool(std::shared_lock<std::shared_mutex>& thread_pools_lock)
+{
+    META_FUNCTION_TASK();
+    const std::thread::id thread_id = std::this_thread::get_id();
+    thread_pools_lock = std::shared_lock(m_thread_pools_mutex);
+
+    // Thread pool is returned under shared lock, so that it is not removed by concurrent release while in use;
+    // pool added under unique lock may be removed by release before shared lock is taken again, so it is added once more
+    for(;;)
     {
-        // Exception is handled below try-catch block
-        META_LOG("Out of descriptor pool memory, reallocating.");
+        if (const auto thread_pool_it = m_thread_pools.find(thread_id);
+            thread_pool_it != m_thread_pools.end())
+            return *thread_pool_it->second;
+
+        thread_pools_lock.unlock();
+        {
+            std::unique_lock thread_pools_unique_lock(m_thread_pools_mutex);
+            m_thread_pools.try_emplace(thread_id, std::make_unique<ThreadPool>());
+        }
+        thread_pools_lock.lock();
     }
-    catch(const vk::FragmentedPoolError&)
+}
+
+vk::DescriptorSet DescriptorManager::AllocDescriptorSetFromPool(vk::DescriptorPool& vk_current_pool, const vk::DescriptorSetLayout& layout)
+{
+    META_FUNCTION_TASK();
+    const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
+    if (vk_current_pool)
     {
-        // Exception is handled below try-catch block
-        META_LOG("Fragmented descriptor pool, reallocating.");
+        if (const Opt<vk::DescriptorSet> descriptor_set_opt = TryAllocDescriptorSet(vk_device, vk_current_pool, layout);
+            descriptor_set_opt)
+            return *descriptor_set_opt;
     }
 
-    // Reallocate descriptor set for the new pool
-    m_vk_current_pool = AcquireDescriptorPool();
-    const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(m_vk_current_pool, 1, &layout));
+    // Allocate descriptor set from the new pool
+    vk_current_pool = AcquireDescriptorPool();
+    const auto descriptor_sets = vk_device.allocateDescriptorSets(vk::DescriptorSetAllocateInfo(vk_current_pool, 1, &layout));
     META_CHECK_NOT_EMPTY(descriptor_sets);
     return descriptor_sets.back();
 }
 
+void DescriptorManager::CountLayoutBindings(LayoutBindings layout_bindings)
+{
+    META_FUNCTION_TASK();
+    if (layout_bindings.empty())
+        return;
+
+    for(const vk::DescriptorSetLayoutBinding& layout_binding : layout_bindings)
+    {
+        if (const auto desc_type_index = static_cast<size_t>(layout_binding.descriptorType);
+            desc_type_index < s_core_descriptor_types_count)
+            m_observed_descriptors_count[desc_type_index].fetch_add(layout_binding.descriptorCount, std::memory_order_relaxed);
+    }
+    m_observed_sets_count.fetch_add(1U, std::memory_order_relaxed);
+}
+
+float DescriptorManager::GetAdaptiveSizeRatio(vk::DescriptorType descriptor_type, float default_size_ratio) const
+{
+    META_FUNCTION_TASK();
+    const uint64_t observed_sets_count = m_observed_sets_count.load(std::memory_order_relaxed);
+    const auto     desc_type_index     = static_cast<size_t>(descriptor_type);
+    if (observed_sets_count < g_min_adaptive_sets_count ||
+        desc_type_index >= s_core_descriptor_types_count)
+        return default_size_ratio;
+
+    // Average descriptors count per set with headroom for allocations which differ from the observed ones
+    const uint64_t observed_descriptors_count = m_observed_descriptors_count[desc_type_index].load(std::memory_order_relaxed);
+    const float    observed_size_ratio        = static_cast<float>(observed_descriptors_count) / static_cast<float>(observed_sets_count);
+    return std::max(observed_size_ratio * g_adaptive_ratio_headroom, g_min_adaptive_size_ratio);
+}
+
 vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
 {
     META_FUNCTION_TASK();
@@ -102,7 +206,8 @@ vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
     pool_sizes.reserve(m_pool_size_ratio_by_desc_type.size());
     for (const auto& [desc_type, size_ratio] : m_pool_size_ratio_by_desc_type)
     {
-        pool_sizes.emplace_back(desc_type, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * size_ratio));
+        const float adaptive_size_ratio = GetAdaptiveSizeRatio(desc_type, size_ratio);
+        pool_sizes.emplace_back(desc_type, std::max(1U, static_cast<uint32_t>(static_cast<float>(m_pool_sets_count) * adaptive_size_ratio)));
     }
     const vk::Device& vk_device = GetContextVk().GetVulkanDevice().GetNativeDevice();
     m_vk_descriptor_pools.emplace_back(vk_device.createDescriptorPoolUnique(vk::DescriptorPoolCreateInfo({}, m_pool_sets_count, pool_sizes)));
@@ -112,16 +217,21 @@ vk::DescriptorPool DescriptorManager::CreateDescriptorPool()
 vk::DescriptorPool DescriptorManager::AcquireDescriptorPool()
 {
     META_FUNCTION_TASK();
+    std::scoped_lock lock_guard(m_descriptor_pool_mutex);
+
+    vk::DescriptorPool vk_pool;
     if (m_vk_free_pools.empty())
     {
-        vk::DescriptorPool new_pool = CreateDescriptorPool();
-        m_vk_used_pools.emplace_back(new_pool);
-        return new_pool;
+        vk_pool = CreateDescriptorPool();
+    }
+    else
+    {
+        vk_pool = m_vk_free_pools.back();
+        m_vk_free_pools.pop_back();
     }
 
-    vk::DescriptorPool free_pool = m_vk_free_pools.back();
-    m_vk_free_pools.pop_back();
-    return free_pool;
+    m_vk_used_pools.emplace_back(vk_pool);
+    return vk_pool;
 }
 
 const IContext& DescriptorManager::GetContextVk()
@@ -282,6 +282,10 @@ Device::Device(const vk::PhysicalDevice& vk_physical_device, const vk::SurfaceKH
 
     m_vk_unique_device = vk_physical_device.createDeviceUnique(vk_device_info);
     VULKAN_HPP_DEFAULT_DISPATCHER.init(m_vk_unique_device.get());
+
+    m_pipeline_cache_ptr = std::make_unique<PipelineCache>(m_vk_physical_device, m_vk_unique_device.get(),
+                                                           capabilities.pipeline_cache_file_path);
+    m_memory_allocator_ptr = std::make_unique<MemoryAllocator>(m_vk_physical_device, m_vk_unique_device.get());
 }
 
 Ptr<Rhi::IRenderContext> Device::CreateRenderContext(const Methane::Platform::AppEnvironment& env, tf::Executor& parallel_executor, const Rhi::RenderContextSettings& settings)
@@ -316,6 +320,20 @@ bool Device::IsExtensionSupported(std::string_view required_extension) const
     return m_supported_extension_names_set.contains(required_extension);
 }
 
+PipelineCache& Device::GetPipelineCache() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(m_pipeline_cache_ptr, "device pipeline cache is not initialized");
+    return *m_pipeline_cache_ptr;
+}
+
+MemoryAllocator& Device::GetMemoryAllocator() const
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_NULL_DESCR(m_memory_allocator_ptr, "device memory allocator is not initialized");
+    return *m_memory_allocator_ptr;
+}
+
 const QueueFamilyReservation* Device::GetQueueFamilyReservationPtr(Rhi::CommandListType cmd_list_type) const noexcept
 {
     META_FUNCTION_TASK();
@@ -345,19 +363,6 @@ Device::SwapChainSupport Device::GetSwapChainSupportForSurface(const vk::Surface
     };
 }
 
-Opt<uint32_t> Device::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept
-{
-    META_FUNCTION_TASK();
-    const vk::PhysicalDeviceMemoryProperties vk_memory_props = m_vk_physical_device.getMemoryProperties();
-    for(uint32_t type_index = 0U; type_index < vk_memory_props.memoryTypeCount; ++type_index)
-    {
-        if (type_filter & (1 << type_index) &&
-            (vk_memory_props.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
-            return type_index;
-    }
-    return std::nullopt;
-}
-
 const vk::QueueFamilyProperties& Device::GetNativeQueueFamilyProperties(uint32_t queue_family_index) const
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,306 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/MemoryAllocator.cpp
+Vulkan device memory sub-allocator with memory blocks per memory type.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/MemoryAllocator.h>
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+#include <bit>
+#include <utility>
+#include <cassert>
+
+namespace Methane::Graphics::Vulkan
+{
+
+static MemoryBlock::Policy CreateBlockPolicy(vk::DeviceSize block_size, bool is_dedicated, const MemoryAllocatorSettings& settings)
+{
+    META_FUNCTION_TASK();
+    // Dedicated block contains a single allocation, so the simplest policy is used for it
+    if (is_dedicated || settings.strategy == MemoryAllocationStrategy::Linear)
+        return MemoryBlock::Policy(std::in_place_type<Data::LinearBlockAllocator<vk::DeviceSize>>, block_size);
+
+    return MemoryBlock::Policy(std::in_place_type<Data::BuddyBlockAllocator<vk::DeviceSize>>, block_size, settings.min_allocation_size);
+}
+
+MemoryBlock::MemoryBlock(const vk::Device& vk_device, uint32_t memory_type_index, MemoryResourceKind resource_kind, vk::DeviceSize size,
+                         bool is_host_visible, bool is_dedicated, const MemoryAllocatorSettings& settings)
+    : m_memory_type_index(memory_type_index)
+    , m_resource_kind(resource_kind)
+    , m_size(size)
+    , m_is_dedicated(is_dedicated)
+    , m_vk_unique_memory(vk_device.allocateMemoryUnique(vk::MemoryAllocateInfo(size, memory_type_index)))
+    , m_policy(CreateBlockPolicy(size, is_dedicated, settings))
+{
+    META_FUNCTION_TASK();
+    if (!is_host_visible)
+        return;
+
+    // Memory block is mapped once for its whole lifetime, since the same memory object
+    // can not be mapped multiple times simultaneously by resources sharing it
+    m_mapped_data_ptr = static_cast<Data::RawPtr>(vk_device.mapMemory(m_vk_unique_memory.get(), 0U, VK_WHOLE_SIZE));
+    META_CHECK_NOT_NULL_DESCR(m_mapped_data_ptr, "failed to map host visible memory block");
+}
+
+Opt<vk::DeviceSize> MemoryBlock::Allocate(vk::DeviceSize size, vk::DeviceSize alignment)
+{
+    META_FUNCTION_TASK();
+    return std::visit([size, alignment](auto& policy) { return policy.Allocate(size, alignment); }, m_policy);
+}
+
+void MemoryBlock::Free(vk::DeviceSize offset)
+{
+    META_FUNCTION_TASK();
+    std::visit([offset](auto& policy) { policy.Free(offset); }, m_policy);
+}
+
+bool MemoryBlock::IsEmpty() const
+{
+    META_FUNCTION_TASK();
+    return std::visit([](const auto& policy) { return policy.IsEmpty(); }, m_policy);
+}
+
+Data::BlockAllocatorStatistics<vk::DeviceSize> MemoryBlock::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    return std::visit([](const auto& policy) { return policy.GetStatistics(); }, m_policy);
+}
+
+MemoryAllocation::MemoryAllocation(MemoryAllocator& allocator, MemoryBlock& block, vk::DeviceSize offset, vk::DeviceSize size) noexcept
+    : m_allocator_ptr(&allocator)
+    , m_block_ptr(&block)
+    , m_offset(offset)
+    , m_size(size)
+{ }
+
+MemoryAllocation::MemoryAllocation(MemoryAllocation&& other) noexcept
+    : m_allocator_ptr(std::exchange(other.m_allocator_ptr, nullptr))
+    , m_block_ptr(std::exchange(other.m_block_ptr, nullptr))
+    , m_offset(std::exchange(other.m_offset, 0U))
+    , m_size(std::exchange(other.m_size, 0U))
+{ }
+
+MemoryAllocation::~MemoryAllocation()
+{
+    try
+    {
+        Release();
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during memory allocation release: {}", e.what());
+        assert(false);
+    }
+}
+
+MemoryAllocation& MemoryAllocation::operator=(MemoryAllocation&& other) noexcept
+{
+    if (this == &other)
+        return *this;
+
+    Release();
+    m_allocator_ptr = std::exchange(other.m_allocator_ptr, nullptr);
+    m_block_ptr     = std::exchange(other.m_block_ptr, nullptr);
+    m_offset        = std::exchange(other.m_offset, 0U);
+    m_size          = std::exchange(other.m_size, 0U);
+    return *this;
+}
+
+const vk::DeviceMemory& MemoryAllocation::GetNativeDeviceMemory() const noexcept
+{
+    static const vk::DeviceMemory s_empty_memory;
+    return m_block_ptr ? m_block_ptr->GetNativeDeviceMemory() : s_empty_memory;
+}
+
+bool MemoryAllocation::IsDedicated() const noexcept
+{
+    return m_block_ptr && m_block_ptr->IsDedicated();
+}
+
+Data::RawPtr MemoryAllocation::GetMappedDataPtr() const noexcept
+{
+    if (!m_block_ptr || !m_block_ptr->GetMappedDataPtr())
+        return nullptr;
+
+    return m_block_ptr->GetMappedDataPtr() + m_offset;
+}
+
+void MemoryAllocation::Release()
+{
+    META_FUNCTION_TASK();
+    if (!m_block_ptr)
+        return;
+
+    m_allocator_ptr->Free(*m_block_ptr, m_offset);
+    m_allocator_ptr = nullptr;
+    m_block_ptr     = nullptr;
+    m_offset        = 0U;
+    m_size          = 0U;
+}
+
+MemoryAllocator::MemoryAllocator(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, const Settings& settings)
+    : m_vk_device(vk_device)
+    , m_vk_memory_props(vk_physical_device.getMemoryProperties())
+    , m_settings(settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_TRUE_DESCR(Data::IsPowerOfTwo(settings.device_local_block_size), "device local memory block size must be a power of two");
+    META_CHECK_TRUE_DESCR(Data::IsPowerOfTwo(settings.host_visible_block_size), "host visible memory block size must be a power of two");
+    META_CHECK_TRUE_DESCR(Data::IsPowerOfTwo(settings.min_allocation_size), "minimum memory allocation size must be a power of two");
+    META_CHECK_RANGE_INC_DESCR(settings.dedicated_allocation_ratio, 0.F, 1.F, "dedicated allocation ratio must be in range [0, 1]");
+}
+
+MemoryAllocation MemoryAllocator::Allocate(const vk::MemoryRequirements& memory_requirements, vk::MemoryPropertyFlags memory_property_flags,
+                                           MemoryResourceKind resource_kind)
+{
+    META_FUNCTION_TASK();
+    const Opt<uint32_t> memory_type_opt = FindMemoryType(memory_requirements.memoryTypeBits, memory_property_flags);
+    if (!memory_type_opt)
+        throw vk::OutOfDeviceMemoryError("suitable memory type was not found");
+
+    const uint32_t       memory_type_index = *memory_type_opt;
+    const bool           is_host_visible   = IsHostVisible(memory_type_index);
+    const vk::DeviceSize block_size        = GetBlockSize(memory_type_index);
+
+    std::lock_guard lock(m_mutex);
+
+    // Large resources get their own device memory to avoid wasting space of the shared blocks
+    if (static_cast<float>(memory_requirements.size) > static_cast<float>(block_size) * m_settings.dedicated_allocation_ratio)
+    {
+        MemoryBlock& dedicated_block = *m_dedicated_blocks.emplace_back(
+            std::make_unique<MemoryBlock>(m_vk_device, memory_type_index, resource_kind, memory_requirements.size, is_host_visible, true, m_settings));
+        m_device_allocations_count++;
+        const Opt<vk::DeviceSize> offset_opt = dedicated_block.Allocate(memory_requirements.size, 1U);
+        META_CHECK_TRUE(offset_opt.has_value());
+        return MemoryAllocation(*this, dedicated_block, *offset_opt, memory_requirements.size);
+    }
+
+    UniquePtrs<MemoryBlock>& blocks = m_block_pools[PoolId(memory_type_index, resource_kind)];
+    for(const UniquePtr<MemoryBlock>& block_ptr : blocks)
+    {
+        if (const Opt<vk::DeviceSize> offset_opt = block_ptr->Allocate(memory_requirements.size, memory_requirements.alignment);
+            offset_opt)
+            return MemoryAllocation(*this, *block_ptr, *offset_opt, memory_requirements.size);
+    }
+
+    MemoryBlock& new_block = *blocks.emplace_back(
+        std::make_unique<MemoryBlock>(m_vk_device, memory_type_index, resource_kind, block_size, is_host_visible, false, m_settings));
+    m_device_allocations_count++;
+    const Opt<vk::DeviceSize> offset_opt = new_block.Allocate(memory_requirements.size, memory_requirements.alignment);
+    META_CHECK_TRUE_DESCR(offset_opt.has_value(), "failed to allocate {} bytes in the new memory block", memory_requirements.size);
+    return MemoryAllocation(*this, new_block, *offset_opt, memory_requirements.size);
+}
+
+MemoryAllocatorStatistics MemoryAllocator::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    Statistics statistics;
+    statistics.device_allocations_count    = m_device_allocations_count;
+    statistics.dedicated_allocations_count = static_cast<uint32_t>(m_dedicated_blocks.size());
+    for(const UniquePtr<MemoryBlock>& dedicated_block_ptr : m_dedicated_blocks)
+    {
+        statistics.device_memory_size += dedicated_block_ptr->GetSize();
+        statistics.used_size          += dedicated_block_ptr->GetSize();
+        statistics.requested_size     += dedicated_block_ptr->GetSize();
+    }
+
+    for(const auto& [pool_id, blocks] : m_block_pools)
+    {
+        for(const UniquePtr<MemoryBlock>& block_ptr : blocks)
+        {
+            const Data::BlockAllocatorStatistics<vk::DeviceSize> block_stats = block_ptr->GetStatistics();
+            statistics.blocks_count++;
+            statistics.allocations_count  += block_stats.allocations_count;
+            statistics.device_memory_size += block_stats.block_size;
+            statistics.used_size          += block_stats.used_size;
+            statistics.requested_size     += block_stats.requested_size;
+            statistics.free_size          += block_stats.GetFreeSize();
+            statistics.largest_free_size   = std::max(statistics.largest_free_size, block_stats.largest_free_size);
+        }
+    }
+
+    statistics.fragmentation = statistics.free_size
+                             ? 1.F - static_cast<float>(statistics.largest_free_size) / static_cast<float>(statistics.free_size)
+                             : 0.F;
+    return statistics;
+}
+
+void MemoryAllocator::Free(MemoryBlock& block, vk::DeviceSize offset)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    block.Free(offset);
+    if (!block.IsEmpty())
+        return;
+
+    const auto is_same_block = [&block](const UniquePtr<MemoryBlock>& block_ptr) { return block_ptr.get() == &block; };
+    if (block.IsDedicated())
+    {
+        std::erase_if(m_dedicated_blocks, is_same_block);
+        return;
+    }
+
+    // Keep one empty block per pool to avoid device memory allocation churn on resource re-creation
+    UniquePtrs<MemoryBlock>& blocks = m_block_pools.at(PoolId(block.GetMemoryTypeIndex(), block.GetResourceKind()));
+    const auto empty_blocks_count = std::ranges::count_if(blocks, [](const UniquePtr<MemoryBlock>& block_ptr) { return block_ptr->IsEmpty(); });
+    if (empty_blocks_count > 1)
+    {
+        std::erase_if(blocks, is_same_block);
+    }
+}
+
+Opt<uint32_t> MemoryAllocator::FindMemoryType(uint32_t type_filter, vk::MemoryPropertyFlags property_flags) const noexcept
+{
+    META_FUNCTION_TASK();
+    for(uint32_t type_index = 0U; type_index < m_vk_memory_props.memoryTypeCount; ++type_index)
+    {
+        if (type_filter & (1 << type_index) &&
+            (m_vk_memory_props.memoryTypes[type_index].propertyFlags & property_flags) == property_flags)
+            return type_index;
+    }
+    return std::nullopt;
+}
+
+vk::DeviceSize MemoryAllocator::GetBlockSize(uint32_t memory_type_index) const noexcept
+{
+    META_FUNCTION_TASK();
+    const vk::DeviceSize block_size = IsHostVisible(memory_type_index)
+                                    ? m_settings.host_visible_block_size
+                                    : m_settings.device_local_block_size;
+
+    // Limit block size to 1/8 of the memory heap, so that small heaps are not exhausted by a few blocks
+    const uint32_t       heap_index     = m_vk_memory_props.memoryTypes[memory_type_index].heapIndex;
+    const vk::DeviceSize heap_block_max = std::bit_floor(m_vk_memory_props.memoryHeaps[heap_index].size / 8U);
+    return std::max(std::min(block_size, heap_block_max), m_settings.min_allocation_size);
+}
+
+bool MemoryAllocator::IsHostVisible(uint32_t memory_type_index) const noexcept
+{
+    return static_cast<bool>(m_vk_memory_props.memoryTypes[memory_type_index].propertyFlags & vk::MemoryPropertyFlagBits::eHostVisible);
+}
+
+} // namespace Methane::Graphics::Vulkan
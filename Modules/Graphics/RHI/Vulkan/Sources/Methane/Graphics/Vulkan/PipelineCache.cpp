@@ -0,0 +1,375 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/PipelineCache.cpp
+Vulkan device pipeline cache with on-disk serialization
+and in-process deduplication of identical pipelines.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/PipelineCache.h>
+#include <Methane/Graphics/Vulkan/CacheFile.hpp>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <nowide/fstream.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class PipelineKeyWriter
+{
+public:
+    explicit PipelineKeyWriter(PipelineCache::Key& key) : m_key(key) { }
+
+    // NOTE: native handles are written by value, which is unique while pipeline using them is alive
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void Write(const T& value)
+    {
+        const auto* value_bytes_ptr = reinterpret_cast<const std::byte*>(&value); // NOSONAR
+        m_key.insert(m_key.end(), value_bytes_ptr, value_bytes_ptr + sizeof(T));
+    }
+
+    template<typename T>
+    void WriteArray(const T* items_ptr, uint32_t items_count)
+    {
+        Write(items_count);
+        if (!items_ptr)
+            return;
+
+        for(uint32_t item_index = 0U; item_index < items_count; ++item_index)
+            WriteItem(items_ptr[item_index]);
+    }
+
+    template<typename T>
+    void WriteItem(const T& item)
+    {
+        Write(item);
+    }
+
+    // Structure fields are written one by one, so that uninitialized padding bytes do not get into the key
+    void WriteItem(const vk::SpecializationMapEntry& vk_map_entry)
+    {
+        Write(vk_map_entry.constantID);
+        Write(vk_map_entry.offset);
+        Write(static_cast<uint64_t>(vk_map_entry.size));
+    }
+
+    void WriteString(const char* str)
+    {
+        const std::string_view str_view = str ? std::string_view(str) : std::string_view();
+        Write(static_cast<uint32_t>(str_view.size()));
+        const auto* str_bytes_ptr = reinterpret_cast<const std::byte*>(str_view.data()); // NOSONAR
+        m_key.insert(m_key.end(), str_bytes_ptr, str_bytes_ptr + str_view.size());
+    }
+
+    void WriteShaderStage(const vk::PipelineShaderStageCreateInfo& vk_stage_info)
+    {
+        Write(vk_stage_info.flags);
+        Write(vk_stage_info.stage);
+        Write(static_cast<VkShaderModule>(vk_stage_info.module));
+        WriteString(vk_stage_info.pName);
+
+        const vk::SpecializationInfo* vk_spec_info_ptr = vk_stage_info.pSpecializationInfo;
+        Write(static_cast<bool>(vk_spec_info_ptr));
+        if (!vk_spec_info_ptr)
+            return;
+
+        WriteArray(vk_spec_info_ptr->pMapEntries, vk_spec_info_ptr->mapEntryCount);
+        WriteArray(static_cast<const uint8_t*>(vk_spec_info_ptr->pData), static_cast<uint32_t>(vk_spec_info_ptr->dataSize));
+    }
+
+private:
+    PipelineCache::Key& m_key;
+};
+
+PipelineCache::PipelineCache(const vk::PhysicalDevice& vk_physical_device, const vk::Device& vk_device, std::string file_path)
+    : m_vk_device_props(vk_physical_device.getProperties())
+    , m_vk_device(vk_device)
+    , m_file_path(std::move(file_path))
+{
+    META_FUNCTION_TASK();
+    const std::vector<uint8_t> vk_cache_data = LoadNativeCacheData();
+    m_statistics.is_loaded_from_file = !vk_cache_data.empty();
+    m_statistics.loaded_data_size    = vk_cache_data.size();
+    m_vk_unique_pipeline_cache = m_vk_device.createPipelineCacheUnique(
+        vk::PipelineCacheCreateInfo(vk::PipelineCacheCreateFlags{}, vk_cache_data.size(), vk_cache_data.data())
+    );
+}
+
+PipelineCache::~PipelineCache()
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        Save();
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Failed to save Vulkan pipeline cache to file '{}': {}", m_file_path, e.what());
+    }
+}
+
+PipelineCache::Key PipelineCache::MakeGraphicsPipelineKey(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    Key key;
+    key.reserve(512);
+
+    PipelineKeyWriter writer(key);
+    writer.Write(vk::PipelineBindPoint::eGraphics);
+    writer.Write(vk_pipeline_create_info.flags);
+
+    writer.Write(vk_pipeline_create_info.stageCount);
+    for(uint32_t stage_index = 0U; stage_index < vk_pipeline_create_info.stageCount; ++stage_index)
+        writer.WriteShaderStage(vk_pipeline_create_info.pStages[stage_index]);
+
+    if (const vk::PipelineVertexInputStateCreateInfo* vk_vertex_input_ptr = vk_pipeline_create_info.pVertexInputState;
+        vk_vertex_input_ptr)
+    {
+        writer.WriteArray(vk_vertex_input_ptr->pVertexBindingDescriptions, vk_vertex_input_ptr->vertexBindingDescriptionCount);
+        writer.WriteArray(vk_vertex_input_ptr->pVertexAttributeDescriptions, vk_vertex_input_ptr->vertexAttributeDescriptionCount);
+    }
+
+    if (const vk::PipelineInputAssemblyStateCreateInfo* vk_assembly_ptr = vk_pipeline_create_info.pInputAssemblyState;
+        vk_assembly_ptr)
+    {
+        writer.Write(vk_assembly_ptr->topology);
+        writer.Write(vk_assembly_ptr->primitiveRestartEnable);
+    }
+
+    if (const vk::PipelineViewportStateCreateInfo* vk_viewport_ptr = vk_pipeline_create_info.pViewportState;
+        vk_viewport_ptr)
+    {
+        writer.WriteArray(vk_viewport_ptr->pViewports, vk_viewport_ptr->viewportCount);
+        writer.WriteArray(vk_viewport_ptr->pScissors, vk_viewport_ptr->scissorCount);
+    }
+
+    if (const vk::PipelineRasterizationStateCreateInfo* vk_rasterizer_ptr = vk_pipeline_create_info.pRasterizationState;
+        vk_rasterizer_ptr)
+    {
+        writer.Write(vk_rasterizer_ptr->depthClampEnable);
+        writer.Write(vk_rasterizer_ptr->rasterizerDiscardEnable);
+        writer.Write(vk_rasterizer_ptr->polygonMode);
+        writer.Write(vk_rasterizer_ptr->cullMode);
+        writer.Write(vk_rasterizer_ptr->frontFace);
+        writer.Write(vk_rasterizer_ptr->depthBiasEnable);
+        writer.Write(vk_rasterizer_ptr->depthBiasConstantFactor);
+        writer.Write(vk_rasterizer_ptr->depthBiasClamp);
+        writer.Write(vk_rasterizer_ptr->depthBiasSlopeFactor);
+        writer.Write(vk_rasterizer_ptr->lineWidth);
+    }
+
+    if (const vk::PipelineMultisampleStateCreateInfo* vk_multisample_ptr = vk_pipeline_create_info.pMultisampleState;
+        vk_multisample_ptr)
+    {
+        writer.Write(vk_multisample_ptr->rasterizationSamples);
+        writer.Write(vk_multisample_ptr->sampleShadingEnable);
+        writer.Write(vk_multisample_ptr->minSampleShading);
+        writer.Write(vk_multisample_ptr->alphaToCoverageEnable);
+        writer.Write(vk_multisample_ptr->alphaToOneEnable);
+    }
+
+    if (const vk::PipelineDepthStencilStateCreateInfo* vk_depth_stencil_ptr = vk_pipeline_create_info.pDepthStencilState;
+        vk_depth_stencil_ptr)
+    {
+        writer.Write(vk_depth_stencil_ptr->depthTestEnable);
+        writer.Write(vk_depth_stencil_ptr->depthWriteEnable);
+        writer.Write(vk_depth_stencil_ptr->depthCompareOp);
+        writer.Write(vk_depth_stencil_ptr->depthBoundsTestEnable);
+        writer.Write(vk_depth_stencil_ptr->stencilTestEnable);
+        writer.Write(vk_depth_stencil_ptr->front);
+        writer.Write(vk_depth_stencil_ptr->back);
+        writer.Write(vk_depth_stencil_ptr->minDepthBounds);
+        writer.Write(vk_depth_stencil_ptr->maxDepthBounds);
+    }
+
+    if (const vk::PipelineColorBlendStateCreateInfo* vk_blending_ptr = vk_pipeline_create_info.pColorBlendState;
+        vk_blending_ptr)
+    {
+        writer.Write(vk_blending_ptr->logicOpEnable);
+        writer.Write(vk_blending_ptr->logicOp);
+        writer.WriteArray(vk_blending_ptr->pAttachments, vk_blending_ptr->attachmentCount);
+        writer.Write(vk_blending_ptr->blendConstants);
+    }
+
+    if (const vk::PipelineDynamicStateCreateInfo* vk_dynamic_ptr = vk_pipeline_create_info.pDynamicState;
+        vk_dynamic_ptr)
+    {
+        writer.WriteArray(vk_dynamic_ptr->pDynamicStates, vk_dynamic_ptr->dynamicStateCount);
+    }
+
+    writer.Write(static_cast<VkPipelineLayout>(vk_pipeline_create_info.layout));
+    writer.Write(static_cast<VkRenderPass>(vk_pipeline_create_info.renderPass));
+    writer.Write(vk_pipeline_create_info.subpass);
+    return key;
+}
+
+PipelineCache::Key PipelineCache::MakeComputePipelineKey(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    Key key;
+    key.reserve(64);
+
+    PipelineKeyWriter writer(key);
+    writer.Write(vk::PipelineBindPoint::eCompute);
+    writer.Write(vk_pipeline_create_info.flags);
+    writer.WriteShaderStage(vk_pipeline_create_info.stage);
+    writer.Write(static_cast<VkPipelineLayout>(vk_pipeline_create_info.layout));
+    return key;
+}
+
+bool PipelineCache::IsNativeCacheDataCompatible(const std::vector<uint8_t>& vk_cache_data,
+                                                const vk::PhysicalDeviceProperties& vk_device_props) noexcept
+{
+    META_FUNCTION_TASK();
+    VkPipelineCacheHeaderVersionOne vk_cache_header{};
+    if (vk_cache_data.size() < sizeof(vk_cache_header))
+        return false;
+
+    std::memcpy(&vk_cache_header, vk_cache_data.data(), sizeof(vk_cache_header));
+    return vk_cache_header.headerSize >= sizeof(vk_cache_header) &&
+           vk_cache_header.headerSize <= vk_cache_data.size() &&
+           vk_cache_header.headerVersion == VK_PIPELINE_CACHE_HEADER_VERSION_ONE &&
+           vk_cache_header.vendorID == vk_device_props.vendorID &&
+           vk_cache_header.deviceID == vk_device_props.deviceID &&
+           std::equal(std::begin(vk_cache_header.pipelineCacheUUID), std::end(vk_cache_header.pipelineCacheUUID),
+                      vk_device_props.pipelineCacheUUID.begin());
+}
+
+Ptr<vk::UniquePipeline> PipelineCache::CreateGraphicsPipeline(const vk::GraphicsPipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    return GetOrCreatePipeline(MakeGraphicsPipelineKey(vk_pipeline_create_info), m_statistics.graphics_pipelines_created,
+        [this, &vk_pipeline_create_info]()
+        {
+            auto pipe = m_vk_device.createGraphicsPipelineUnique(m_vk_unique_pipeline_cache.get(), vk_pipeline_create_info);
+            META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan graphics pipeline creation has failed");
+            return std::move(pipe.value);
+        });
+}
+
+Ptr<vk::UniquePipeline> PipelineCache::CreateComputePipeline(const vk::ComputePipelineCreateInfo& vk_pipeline_create_info)
+{
+    META_FUNCTION_TASK();
+    return GetOrCreatePipeline(MakeComputePipelineKey(vk_pipeline_create_info), m_statistics.compute_pipelines_created,
+        [this, &vk_pipeline_create_info]()
+        {
+            auto pipe = m_vk_device.createComputePipelineUnique(m_vk_unique_pipeline_cache.get(), vk_pipeline_create_info);
+            META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan compute pipeline creation has failed");
+            return std::move(pipe.value);
+        });
+}
+
+void PipelineCache::SetPipelineName(const Ptr<vk::UniquePipeline>& pipeline_ptr, std::string_view name) const
+{
+    META_FUNCTION_TASK();
+    if (!pipeline_ptr || name.empty() || pipeline_ptr.use_count() > 1)
+        return;
+
+    SetVulkanObjectName(m_vk_device, pipeline_ptr->get(), name);
+}
+
+template<typename CreatePipelineFunc>
+Ptr<vk::UniquePipeline> PipelineCache::GetOrCreatePipeline(Key&& key, uint32_t& created_pipelines_count, const CreatePipelineFunc& create_pipeline)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+
+    auto [pipeline_it, is_new_pipeline] = m_pipeline_by_key.try_emplace(std::move(key));
+    if (!is_new_pipeline)
+    {
+        if (Ptr<vk::UniquePipeline> pipeline_ptr = pipeline_it->second.lock())
+        {
+            m_statistics.pipeline_cache_hits++;
+            return pipeline_ptr;
+        }
+    }
+
+    auto pipeline_ptr = std::make_shared<vk::UniquePipeline>(create_pipeline());
+    pipeline_it->second = pipeline_ptr;
+    created_pipelines_count++;
+
+    // Cleanup expired pipeline entries to keep the deduplication map compact
+    std::erase_if(m_pipeline_by_key, [](const auto& key_and_pipeline) { return key_and_pipeline.second.expired(); });
+    return pipeline_ptr;
+}
+
+bool PipelineCache::Save()
+{
+    META_FUNCTION_TASK();
+    if (m_file_path.empty() || !m_vk_unique_pipeline_cache)
+        return false;
+
+    std::lock_guard lock(m_mutex);
+    const std::vector<uint8_t> vk_cache_data = m_vk_device.getPipelineCacheData(m_vk_unique_pipeline_cache.get());
+    if (vk_cache_data.empty())
+        return false;
+
+    nowide::ofstream file_stream(m_file_path, std::ios::binary | std::ios::trunc);
+    if (!file_stream.is_open())
+    {
+        META_LOG("WARNING: Failed to open Vulkan pipeline cache file '{}' for writing.", m_file_path);
+        return false;
+    }
+
+    FileHeader file_header;
+    file_header.data_size = vk_cache_data.size();
+    file_header.data_hash = ComputeDataHash(vk_cache_data.data(), vk_cache_data.size());
+
+    file_stream.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header)); // NOSONAR
+    file_stream.write(reinterpret_cast<const char*>(vk_cache_data.data()), static_cast<std::streamsize>(vk_cache_data.size())); // NOSONAR
+    if (!file_stream.good())
+        return false;
+
+    m_statistics.saved_data_size = vk_cache_data.size();
+    return true;
+}
+
+PipelineCache::Statistics PipelineCache::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    return m_statistics;
+}
+
+std::vector<uint8_t> PipelineCache::LoadNativeCacheData()
+{
+    META_FUNCTION_TASK();
+    std::vector<uint8_t> vk_cache_data = ReadCacheFileData<FileHeader, uint8_t>(m_file_path, "pipeline cache");
+    if (vk_cache_data.empty())
+        return {};
+
+    if (!IsNativeCacheDataCompatible(vk_cache_data, m_vk_device_props))
+    {
+        META_LOG("WARNING: Vulkan pipeline cache file '{}' was created by incompatible device or driver and is ignored.", m_file_path);
+        return {};
+    }
+
+    return vk_cache_data;
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -155,7 +155,7 @@ const vk::DescriptorSet& Program::AcquireConstantDescriptorSet()
 
     const vk::DescriptorSetLayout& layout = GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Constant);
     m_vk_constant_descriptor_set_opt = layout
-                                     ? GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(layout)
+                                     ? GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(layout, GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Constant).bindings)
                                      : vk::DescriptorSet();
 
     UpdateConstantDescriptorSetName();
@@ -184,9 +184,10 @@ const vk::DescriptorSet& Program::AcquireFrameConstantDescriptorSet(Data::Index
         return m_vk_frame_constant_descriptor_sets.at(frame_index);
 
     DescriptorManager& descriptor_manager = GetVulkanContext().GetVulkanDescriptorManager();
+    const DescriptorSetLayoutInfo& layout_info = GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::FrameConstant);
     for(vk::DescriptorSet& frame_descriptor_set : m_vk_frame_constant_descriptor_sets)
     {
-        frame_descriptor_set = descriptor_manager.AllocDescriptorSet(layout);
+        frame_descriptor_set = descriptor_manager.AllocDescriptorSet(layout, layout_info.bindings);
     }
 
     UpdateFrameConstantDescriptorSetNames();
@@ -70,7 +70,8 @@ ProgramBindings::ProgramBindings(Program& program,
         vk_mutable_descriptor_set_layout)
     {
         DescriptorManager& descriptor_manager = program.GetVulkanContext().GetVulkanDescriptorManager();
-        m_descriptor_sets.emplace_back(descriptor_manager.AllocDescriptorSet(vk_mutable_descriptor_set_layout));
+        const Program::DescriptorSetLayoutInfo& mutable_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
+        m_descriptor_sets.emplace_back(descriptor_manager.AllocDescriptorSet(vk_mutable_descriptor_set_layout, mutable_layout_info.bindings));
         m_has_mutable_descriptor_set = true;
     }
 
@@ -149,11 +150,11 @@ ProgramBindings::ProgramBindings(const ProgramBindings& other_program_bindings,
         const auto& program = static_cast<const Program&>(GetProgram());
         const vk::DescriptorSetLayout& vk_mutable_desc_set_layout = program.GetNativeDescriptorSetLayout(Rhi::ProgramArgumentAccessType::Mutable);
         META_CHECK_NOT_NULL(vk_mutable_desc_set_layout);
-        vk::DescriptorSet copy_mutable_descriptor_set = program.GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(vk_mutable_desc_set_layout);
+        const Program::DescriptorSetLayoutInfo& mutable_desc_set_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
+        vk::DescriptorSet copy_mutable_descriptor_set = program.GetVulkanContext().GetVulkanDescriptorManager().AllocDescriptorSet(vk_mutable_desc_set_layout, mutable_desc_set_layout_info.bindings);
 
         // Copy descriptors from original to new mutable descriptor set
         const vk::Device& vk_device = program.GetVulkanContext().GetVulkanDevice().GetNativeDevice();
-        const Program::DescriptorSetLayoutInfo& mutable_desc_set_layout_info = program.GetDescriptorSetLayoutInfo(Rhi::ProgramArgumentAccessType::Mutable);
         vk_device.updateDescriptorSets({}, {
             vk::CopyDescriptorSet(other_program_bindings.m_descriptor_sets.back(), {}, {}, copy_mutable_descriptor_set, {}, mutable_desc_set_layout_info.descriptors_count)
         });
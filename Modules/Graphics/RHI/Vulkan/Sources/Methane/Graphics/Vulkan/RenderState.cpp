@@ -200,7 +200,7 @@ void RenderState::Reset(const Settings& settings)
 
     if (IsNativePipelineDynamic())
     {
-        m_vk_pipeline_dynamic = CreateNativePipeline();
+        m_vk_pipeline_dynamic_ptr = CreateNativePipeline();
     }
     else
     {
@@ -224,15 +224,16 @@ bool RenderState::SetName(std::string_view name)
     if (!Base::RenderState::SetName(name))
         return false;
 
+    const PipelineCache& pipeline_cache = m_vk_render_context.GetVulkanDevice().GetPipelineCache();
     if (IsNativePipelineDynamic())
     {
-        SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), m_vk_pipeline_dynamic.get(), name);
+        pipeline_cache.SetPipelineName(m_vk_pipeline_dynamic_ptr, name);
     }
     else
     {
         for(const auto& [pipeline_id, vk_pipeline_monolithic] : m_vk_pipeline_monolithic_by_id)
         {
-            SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), vk_pipeline_monolithic.get(), name);
+            pipeline_cache.SetPipelineName(vk_pipeline_monolithic, name);
         }
     }
     return true;
@@ -242,7 +243,8 @@ const vk::Pipeline& RenderState::GetNativePipelineDynamic() const
 {
     META_FUNCTION_TASK();
     META_CHECK_TRUE_DESCR(IsNativePipelineDynamic(), "dynamic pipeline is not supported by device");
-    return m_vk_pipeline_dynamic.get();
+    META_CHECK_NOT_NULL(m_vk_pipeline_dynamic_ptr);
+    return m_vk_pipeline_dynamic_ptr->get();
 }
 
 const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_state, Rhi::RenderPrimitive render_primitive)
@@ -256,10 +258,10 @@ const vk::Pipeline& RenderState::GetNativePipelineMonolithic(ViewState& view_sta
     if (pipeline_monolithic_by_id_it == m_vk_pipeline_monolithic_by_id.end())
     {
         view_state.Connect(*this);
-        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, CreateNativePipeline(&view_state, render_primitive)).first->second.get();
+        return m_vk_pipeline_monolithic_by_id.try_emplace(pipeline_id, CreateNativePipeline(&view_state, render_primitive)).first->second->get();
     }
 
-    return pipeline_monolithic_by_id_it->second.get();
+    return pipeline_monolithic_by_id_it->second->get();
 }
 
 const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderDrawingState& drawing_state)
@@ -270,7 +272,7 @@ const vk::Pipeline& RenderState::GetNativePipelineMonolithic(const Base::RenderD
     return GetNativePipelineMonolithic(static_cast<ViewState&>(*drawing_state.view_state_ptr), drawing_state.primitive_type_opt.value());
 }
 
-vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state_ptr, Opt<Rhi::RenderPrimitive> render_primitive_opt) const
+Ptr<vk::UniquePipeline> RenderState::CreateNativePipeline(const ViewState* view_state_ptr, Opt<Rhi::RenderPrimitive> render_primitive_opt) const
 {
     META_FUNCTION_TASK();
     const Settings& settings = GetSettings();
@@ -407,11 +409,11 @@ vk::UniquePipeline RenderState::CreateNativePipeline(const ViewState* view_state
         render_pattern.GetNativeRenderPass()
     );
 
-    auto pipe = m_vk_render_context.GetVulkanDevice().GetNativeDevice().createGraphicsPipelineUnique(nullptr, vk_pipeline_create_info);
-    META_CHECK_EQUAL_DESCR(pipe.result, vk::Result::eSuccess, "Vulkan pipeline creation has failed");
-
-    SetVulkanObjectName(m_vk_render_context.GetVulkanDevice().GetNativeDevice(), pipe.value.get(), Base::Object::GetName());
-    return std::move(pipe.value);
+    // Pipeline is created with device pipeline cache, which also returns previously created pipeline for identical settings
+    PipelineCache& pipeline_cache = m_vk_render_context.GetVulkanDevice().GetPipelineCache();
+    Ptr<vk::UniquePipeline> pipeline_ptr = pipeline_cache.CreateGraphicsPipeline(vk_pipeline_create_info);
+    pipeline_cache.SetPipelineName(pipeline_ptr, Base::Object::GetName());
+    return pipeline_ptr;
 }
 
 void RenderState::OnViewStateChanged(Rhi::IViewState& view_state)
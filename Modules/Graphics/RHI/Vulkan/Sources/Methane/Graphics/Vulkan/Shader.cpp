@@ -50,71 +50,6 @@ static vk::VertexInputRate ConvertInputBufferLayoutStepTypeToVertexInputRate(Rhi
     }
 }
 
-static vk::Format GetFloatVectorFormat(uint32_t vector_size)
-{
-    META_FUNCTION_TASK();
-    switch (vector_size)
-    {
-    using enum vk::Format;
-    case 1: return eR32Sfloat;
-    case 2: return eR32G32Sfloat;
-    case 3: return eR32G32B32Sfloat;
-    case 4: return eR32G32B32A32Sfloat;
-    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
-    }
-}
-
-static vk::Format GetSignedIntegerVectorFormat(uint32_t vector_size)
-{
-    META_FUNCTION_TASK();
-    switch (vector_size)
-    {
-    using enum vk::Format;
-    case 1: return eR32Sint;
-    case 2: return eR32G32Sint;
-    case 3: return eR32G32B32Sint;
-    case 4: return eR32G32B32A32Sint;
-    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
-    }
-}
-
-static vk::Format GetUnsignedIntegerVectorFormat(uint32_t vector_size)
-{
-    META_FUNCTION_TASK();
-    switch (vector_size)
-    {
-    using enum vk::Format;
-    case 1: return eR32Uint;
-    case 2: return eR32G32Uint;
-    case 3: return eR32G32B32Uint;
-    case 4: return eR32G32B32A32Uint;
-    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
-    }
-}
-
-static vk::Format GetVertexAttributeFormatFromSpirvType(const spirv_cross::SPIRType& attribute_type)
-{
-    META_FUNCTION_TASK();
-    switch(attribute_type.basetype)
-    {
-    case spirv_cross::SPIRType::Float: return GetFloatVectorFormat(attribute_type.vecsize);
-    case spirv_cross::SPIRType::UInt:  return GetSignedIntegerVectorFormat(attribute_type.vecsize);
-    case spirv_cross::SPIRType::Int:   return GetUnsignedIntegerVectorFormat(attribute_type.vecsize);
-    default:                           META_UNEXPECTED_RETURN(attribute_type.basetype, vk::Format::eUndefined);
-    }
-}
-
-static uint32_t GetArraySize(const spirv_cross::SPIRType& resource_type) noexcept
-{
-    META_FUNCTION_TASK();
-    if (resource_type.array.empty())
-        return 1;
-
-    return resource_type.array.front()
-           ? resource_type.array.front()
-           : std::numeric_limits<uint32_t>::max();
-}
-
 static Rhi::IResource::Type ConvertDescriptorTypeToResourceType(vk::DescriptorType vk_descriptor_type)
 {
     META_FUNCTION_TASK();
@@ -155,42 +90,30 @@ static vk::DescriptorType UpdateDescriptorType(vk::DescriptorType vk_shader_desc
     }
 }
 
-static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spirv_compiler,
-                                                const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
-                                                const vk::DescriptorType vk_descriptor_type,
-                                                const Rhi::ProgramArgumentAccessors& argument_accessors,
-                                                const Shader& shader,
-                                                Ptrs<Base::ProgramArgumentBinding>& argument_bindings)
+static void AddResourceReflectionsToArgumentBindings(const std::vector<ShaderResourceReflection>& resource_reflections,
+                                                    const Rhi::ProgramArgumentAccessors& argument_accessors,
+                                                    const Shader& shader,
+                                                    Ptrs<Base::ProgramArgumentBinding>& argument_bindings)
 {
     META_FUNCTION_TASK();
-    if (spirv_resources.begin() == spirv_resources.end())
-        return;
-
-    const Rhi::IResource::Type resource_type = ConvertDescriptorTypeToResourceType(vk_descriptor_type);\
     const Rhi::ShaderType shader_type = shader.GetType();
-
-    for (const spirv_cross::Resource& resource : spirv_resources)
+    for (const ShaderResourceReflection& resource : resource_reflections)
     {
-        const spirv_cross::SPIRType& spirv_type = spirv_compiler.get_type(resource.type_id);
-        const uint32_t array_size = GetArraySize(spirv_type);
-        const uint32_t buffer_size = spirv_type.basetype == spirv_cross::SPIRType::BaseType::Struct
-                                   ? static_cast<uint32_t>(spirv_compiler.get_declared_struct_size(spirv_type))
-                                   : 0U;
-
-        ProgramBindings::ArgumentBinding::ByteCodeMap byte_code_map{ shader_type };
-        if (vk_descriptor_type != vk::DescriptorType::eInlineUniformBlock)
-        {
-            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationDescriptorSet, byte_code_map.descriptor_set_offset));
-            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationBinding, byte_code_map.binding_offset));
-        }
-
-        const uint32_t descriptor_set_id = spirv_compiler.get_decoration(resource.id, spv::DecorationDescriptorSet);
-        const Rhi::ProgramArgumentAccessType arg_access_type = Rhi::ProgramArgumentAccessor::GetTypeByRegisterSpace(descriptor_set_id);
+        const vk::DescriptorType   vk_descriptor_type = resource.descriptor_type;
+        const Rhi::IResource::Type resource_type      = ConvertDescriptorTypeToResourceType(vk_descriptor_type);
+
+        ProgramBindings::ArgumentBinding::ByteCodeMap byte_code_map{
+            shader_type,
+            resource.descriptor_set_offset,
+            resource.binding_offset
+        };
+
+        const Rhi::ProgramArgumentAccessType arg_access_type = Rhi::ProgramArgumentAccessor::GetTypeByRegisterSpace(resource.descriptor_set_id);
         const Rhi::ProgramArgumentValueType arg_value_type = vk_descriptor_type == vk::DescriptorType::eInlineUniformBlock
                                                            ? Rhi::ProgramArgumentValueType::RootConstantValue
                                                            : Rhi::ProgramArgumentValueType::ResourceView;
 
-        const Rhi::ProgramArgument shader_argument(shader_type, shader.GetCachedArgName(spirv_compiler.get_name(resource.id)));
+        const Rhi::ProgramArgument shader_argument(shader_type, shader.GetCachedArgName(resource.name));
         const Rhi::ProgramArgumentAccessor* argument_accessor_ptr = Rhi::IProgram::FindArgumentAccessor(argument_accessors, shader_argument);
         const Rhi::ProgramArgumentAccessor argument_acc = argument_accessor_ptr
                                                           ? *argument_accessor_ptr
@@ -204,8 +127,8 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
                 {
                     argument_acc,
                     resource_type,
-                    array_size,
-                    buffer_size
+                    resource.array_size,
+                    resource.buffer_size
                 },
                 UpdateDescriptorType(vk_descriptor_type, argument_acc),
                 { std::move(byte_code_map) }
@@ -215,14 +138,15 @@ static void AddSpirvResourcesToArgumentBindings(const spirv_cross::Compiler& spi
         META_LOG("  - '{}' with descriptor type {}, array size {};",
                  shader_argument.GetName(),
                  vk::to_string(vk_descriptor_type),
-                 array_size);
+                 resource.array_size);
     }
 }
 
 Shader::Shader(Rhi::ShaderType shader_type, const Base::Context& context, const Settings& settings)
     : Base::Shader(shader_type, context, settings)
     , m_vk_context(dynamic_cast<const IContext&>(context))
-    , m_byte_code_chunk(settings.data_provider.GetData(fmt::format("{}.spirv", GetCompiledEntryFunctionName(settings))))
+    , m_compiled_shader_ptr(m_vk_context.GetVulkanShaderRegistry().GetCompiledShader(settings.data_provider, GetCompiledEntryFunctionName(settings)))
+    , m_byte_code_chunk(m_compiled_shader_ptr->byte_code.data(), static_cast<Data::Size>(m_compiled_shader_ptr->byte_code.size()))
 { }
 
 Shader::~Shader() = default;
@@ -239,25 +163,7 @@ Ptrs<Base::ProgramArgumentBinding> Shader::GetArgumentBindings(const Rhi::Progra
              Rhi::ShaderMacroDefinition::ToString(shader_settings.compile_definitions));
 
     Ptrs<Base::ProgramArgumentBinding> argument_bindings;
-    const spirv_cross::Compiler& spirv_compiler = GetNativeCompiler();
-    const auto add_spirv_resources_to_argument_bindings = [this, &spirv_compiler, &argument_accessors, &argument_bindings]
-                                                          (const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
-                                                           const vk::DescriptorType vk_descriptor_type)
-    {
-        AddSpirvResourcesToArgumentBindings(spirv_compiler, spirv_resources, vk_descriptor_type, argument_accessors, *this, argument_bindings);
-    };
-
-    // Get only resources that are statically used in SPIRV-code (skip all resources that are never accessed by the shader)
-    const spirv_cross::ShaderResources spirv_resources = spirv_compiler.get_shader_resources(spirv_compiler.get_active_interface_variables());
-
-    add_spirv_resources_to_argument_bindings(spirv_resources.push_constant_buffers, vk::DescriptorType::eInlineUniformBlock);
-    add_spirv_resources_to_argument_bindings(spirv_resources.uniform_buffers,       vk::DescriptorType::eUniformBuffer);
-    add_spirv_resources_to_argument_bindings(spirv_resources.storage_buffers,       vk::DescriptorType::eStorageBuffer);
-    add_spirv_resources_to_argument_bindings(spirv_resources.storage_images,        vk::DescriptorType::eStorageImage);
-    add_spirv_resources_to_argument_bindings(spirv_resources.sampled_images,        vk::DescriptorType::eCombinedImageSampler);
-    add_spirv_resources_to_argument_bindings(spirv_resources.separate_images,       vk::DescriptorType::eSampledImage);
-    add_spirv_resources_to_argument_bindings(spirv_resources.separate_samplers,     vk::DescriptorType::eSampler);
-    // TODO: add support for spirv_resources.atomic_counters, vk::DescriptorType::eMutableVALVE
+    AddResourceReflectionsToArgumentBindings(GetReflection().resources, argument_accessors, *this, argument_bindings);
 
     if (argument_bindings.empty())
     {
@@ -349,8 +255,7 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
         input_buffer_index++;
     }
 
-    const spirv_cross::Compiler& spirv_compiler = GetNativeCompiler();
-    const spirv_cross::ShaderResources shader_resources = spirv_compiler.get_shader_resources();
+    const std::vector<ShaderStageInputReflection>& stage_inputs = GetReflection().stage_inputs;
 
 #ifdef METHANE_LOGGING_ENABLED
     std::stringstream log_ss;
@@ -358,23 +263,18 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
            << " shader '" << shader_settings.entry_function.function_name
            << "' (" << Rhi::ShaderMacroDefinition::ToString(shader_settings.compile_definitions)
            << ") input layout:" << std::endl;
-    if (shader_resources.stage_inputs.empty())
+    if (stage_inputs.empty())
         log_ss << " - No stage inputs." << std::endl;
 #else
     META_UNUSED(shader_settings);
 #endif
 
-    m_vertex_input_attribute_descriptions.reserve(shader_resources.stage_inputs.size());
-    for(const spirv_cross::Resource& input_resource : shader_resources.stage_inputs)
+    m_vertex_input_attribute_descriptions.reserve(stage_inputs.size());
+    for(const ShaderStageInputReflection& stage_input : stage_inputs)
     {
-        const bool has_semantic = spirv_compiler.has_decoration(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
-        const bool has_location = spirv_compiler.has_decoration(input_resource.id, spv::DecorationLocation);
-        META_CHECK_TRUE(has_semantic && has_location);
-
-        const std::string&           semantic_name    = spirv_compiler.get_decoration_string(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
-        const uint32_t               input_location   = spirv_compiler.get_decoration(input_resource.id, spv::DecorationLocation);
-        const spirv_cross::SPIRType& attribute_type   = spirv_compiler.get_type(input_resource.base_type_id);
-        const vk::Format             attribute_format = GetVertexAttributeFormatFromSpirvType(attribute_type);
+        const std::string& semantic_name    = stage_input.semantic_name;
+        const uint32_t     input_location   = stage_input.location;
+        const vk::Format   attribute_format = stage_input.format;
 
         const uint32_t buffer_index = GetProgramInputBufferIndexByArgumentSemantic(program, semantic_name);
         META_CHECK_LESS(buffer_index, m_vertex_input_binding_descriptions.size());
@@ -397,7 +297,7 @@ void Shader::InitializeVertexInputDescriptions(const Program& program)
 #endif
 
         // Tight packing of attributes in vertex buffer is assumed
-        input_binding_desc.stride += attribute_type.vecsize * 4;
+        input_binding_desc.stride += stage_input.vector_size * 4;
     }
 
     META_LOG("{}", log_ss.str());
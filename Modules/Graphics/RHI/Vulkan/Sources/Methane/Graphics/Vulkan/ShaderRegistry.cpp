@@ -0,0 +1,460 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/ShaderRegistry.cpp
+Vulkan registry of compiled shaders shared by all programs of the context
+with cached SPIR-V reflection, which is optionally persisted in file.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/ShaderRegistry.h>
+#include <Methane/Graphics/Vulkan/CacheFile.hpp>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Data/IProvider.h>
+#include <Methane/Data/Chunk.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <spirv_cross.hpp>
+#include <nowide/fstream.hpp>
+#include <fmt/format.h>
+
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+namespace Methane::Graphics::Vulkan
+{
+
+class ReflectionWriter
+{
+public:
+    explicit ReflectionWriter(Data::Bytes& data) : m_data(data) { }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    void Write(const T& value)
+    {
+        const auto* value_bytes_ptr = reinterpret_cast<const std::byte*>(&value); // NOSONAR
+        m_data.insert(m_data.end(), value_bytes_ptr, value_bytes_ptr + sizeof(T));
+    }
+
+    void WriteString(const std::string& str)
+    {
+        Write(static_cast<uint32_t>(str.size()));
+        const auto* str_bytes_ptr = reinterpret_cast<const std::byte*>(str.data()); // NOSONAR
+        m_data.insert(m_data.end(), str_bytes_ptr, str_bytes_ptr + str.size());
+    }
+
+private:
+    Data::Bytes& m_data;
+};
+
+class ReflectionReader
+{
+public:
+    explicit ReflectionReader(const Data::Bytes& data) : m_data(data) { }
+
+    template<typename T> requires std::is_trivially_copyable_v<T>
+    bool Read(T& value)
+    {
+        if (m_offset + sizeof(T) > m_data.size())
+            return false;
+
+        std::memcpy(&value, m_data.data() + m_offset, sizeof(T));
+        m_offset += sizeof(T);
+        return true;
+    }
+
+    bool ReadString(std::string& str)
+    {
+        uint32_t str_size = 0U;
+        if (!Read(str_size) || m_offset + str_size > m_data.size())
+            return false;
+
+        str.assign(reinterpret_cast<const char*>(m_data.data() + m_offset), str_size); // NOSONAR
+        m_offset += str_size;
+        return true;
+    }
+
+    [[nodiscard]] bool IsCompleted() const noexcept { return m_offset == m_data.size(); }
+
+private:
+    const Data::Bytes& m_data;
+    size_t             m_offset = 0U;
+};
+
+static vk::Format GetFloatVectorFormat(uint32_t vector_size)
+{
+    META_FUNCTION_TASK();
+    switch (vector_size)
+    {
+    using enum vk::Format;
+    case 1: return eR32Sfloat;
+    case 2: return eR32G32Sfloat;
+    case 3: return eR32G32B32Sfloat;
+    case 4: return eR32G32B32A32Sfloat;
+    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
+    }
+}
+
+static vk::Format GetSignedIntegerVectorFormat(uint32_t vector_size)
+{
+    META_FUNCTION_TASK();
+    switch (vector_size)
+    {
+    using enum vk::Format;
+    case 1: return eR32Sint;
+    case 2: return eR32G32Sint;
+    case 3: return eR32G32B32Sint;
+    case 4: return eR32G32B32A32Sint;
+    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
+    }
+}
+
+static vk::Format GetUnsignedIntegerVectorFormat(uint32_t vector_size)
+{
+    META_FUNCTION_TASK();
+    switch (vector_size)
+    {
+    using enum vk::Format;
+    case 1: return eR32Uint;
+    case 2: return eR32G32Uint;
+    case 3: return eR32G32B32Uint;
+    case 4: return eR32G32B32A32Uint;
+    default: META_UNEXPECTED_RETURN(vector_size, eUndefined);
+    }
+}
+
+static vk::Format GetVertexAttributeFormatFromSpirvType(const spirv_cross::SPIRType& attribute_type)
+{
+    META_FUNCTION_TASK();
+    switch(attribute_type.basetype)
+    {
+    case spirv_cross::SPIRType::Float: return GetFloatVectorFormat(attribute_type.vecsize);
+    case spirv_cross::SPIRType::UInt:  return GetSignedIntegerVectorFormat(attribute_type.vecsize);
+    case spirv_cross::SPIRType::Int:   return GetUnsignedIntegerVectorFormat(attribute_type.vecsize);
+    default:                           META_UNEXPECTED_RETURN(attribute_type.basetype, vk::Format::eUndefined);
+    }
+}
+
+static uint32_t GetArraySize(const spirv_cross::SPIRType& resource_type) noexcept
+{
+    META_FUNCTION_TASK();
+    if (resource_type.array.empty())
+        return 1;
+
+    return resource_type.array.front()
+           ? resource_type.array.front()
+           : std::numeric_limits<uint32_t>::max();
+}
+
+static void AddSpirvResourceReflections(const spirv_cross::Compiler& spirv_compiler,
+                                        const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
+                                        const vk::DescriptorType vk_descriptor_type,
+                                        std::vector<ShaderResourceReflection>& resource_reflections)
+{
+    META_FUNCTION_TASK();
+    for (const spirv_cross::Resource& resource : spirv_resources)
+    {
+        const spirv_cross::SPIRType& spirv_type = spirv_compiler.get_type(resource.type_id);
+        ShaderResourceReflection resource_reflection{
+            spirv_compiler.get_name(resource.id),
+            vk_descriptor_type,
+            spirv_compiler.get_decoration(resource.id, spv::DecorationDescriptorSet),
+            GetArraySize(spirv_type),
+            spirv_type.basetype == spirv_cross::SPIRType::BaseType::Struct
+                ? static_cast<uint32_t>(spirv_compiler.get_declared_struct_size(spirv_type))
+                : 0U
+        };
+
+        if (vk_descriptor_type != vk::DescriptorType::eInlineUniformBlock)
+        {
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationDescriptorSet, resource_reflection.descriptor_set_offset));
+            META_CHECK_TRUE(spirv_compiler.get_binary_offset_for_decoration(resource.id, spv::DecorationBinding, resource_reflection.binding_offset));
+        }
+
+        resource_reflections.emplace_back(std::move(resource_reflection));
+    }
+}
+
+ShaderRegistry::ShaderRegistry(std::string reflection_cache_file_path)
+    : m_reflection_cache_file_path(std::move(reflection_cache_file_path))
+{
+    META_FUNCTION_TASK();
+    LoadReflectionCache();
+}
+
+ShaderRegistry::~ShaderRegistry()
+{
+    META_FUNCTION_TASK();
+    try
+    {
+        Save();
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Failed to save Vulkan shader reflection cache to file '{}': {}", m_reflection_cache_file_path, e.what());
+    }
+}
+
+Ptr<const CompiledShader> ShaderRegistry::GetCompiledShader(const Data::IProvider& data_provider, const std::string& compiled_entry_name)
+{
+    META_FUNCTION_TASK();
+    ShaderKey shader_key(&data_provider, compiled_entry_name);
+    {
+        std::lock_guard lock(m_mutex);
+        if (const auto compiled_shader_it = m_compiled_shader_by_key.find(shader_key);
+            compiled_shader_it != m_compiled_shader_by_key.end())
+        {
+            m_statistics.byte_code_hits_count++;
+            return compiled_shader_it->second;
+        }
+    }
+
+    // Byte code is loaded and reflected without lock, so that different shaders can be created in parallel
+    const Data::Chunk byte_code_chunk = data_provider.GetData(fmt::format("{}.spirv", compiled_entry_name));
+    META_CHECK_NOT_ZERO_DESCR(byte_code_chunk.GetDataSize(), "shader '{}' byte code is empty", compiled_entry_name);
+
+    auto compiled_shader_ptr = std::make_shared<CompiledShader>();
+    compiled_shader_ptr->byte_code.assign(byte_code_chunk.GetDataPtr(), byte_code_chunk.GetDataEndPtr());
+    compiled_shader_ptr->byte_code_hash = ComputeDataHash(reinterpret_cast<const uint8_t*>(byte_code_chunk.GetDataPtr()), // NOSONAR
+                                                          byte_code_chunk.GetDataSize());
+    compiled_shader_ptr->reflection = GetReflection(byte_code_chunk, compiled_shader_ptr->byte_code_hash);
+
+    std::lock_guard lock(m_mutex);
+    m_statistics.byte_code_loads_count++;
+    const auto [compiled_shader_it, is_emplaced] = m_compiled_shader_by_key.try_emplace(std::move(shader_key), std::move(compiled_shader_ptr));
+    META_UNUSED(is_emplaced);
+    return compiled_shader_it->second;
+}
+
+ShaderReflection ShaderRegistry::ReflectByteCode(const Data::Chunk& spirv_byte_code)
+{
+    META_FUNCTION_TASK();
+    const spirv_cross::Compiler spirv_compiler(spirv_byte_code.GetDataPtr<uint32_t>(), spirv_byte_code.GetDataSize<uint32_t>());
+    ShaderReflection reflection;
+
+    // Get only resources that are statically used in SPIRV-code (skip all resources that are never accessed by the shader)
+    const spirv_cross::ShaderResources spirv_resources = spirv_compiler.get_shader_resources(spirv_compiler.get_active_interface_variables());
+    const auto add_spirv_resource_reflections = [&spirv_compiler, &reflection](const spirv_cross::SmallVector<spirv_cross::Resource>& spirv_resources,
+                                                                               const vk::DescriptorType vk_descriptor_type)
+    {
+        AddSpirvResourceReflections(spirv_compiler, spirv_resources, vk_descriptor_type, reflection.resources);
+    };
+
+    add_spirv_resource_reflections(spirv_resources.push_constant_buffers, vk::DescriptorType::eInlineUniformBlock);
+    add_spirv_resource_reflections(spirv_resources.uniform_buffers,       vk::DescriptorType::eUniformBuffer);
+    add_spirv_resource_reflections(spirv_resources.storage_buffers,       vk::DescriptorType::eStorageBuffer);
+    add_spirv_resource_reflections(spirv_resources.storage_images,        vk::DescriptorType::eStorageImage);
+    add_spirv_resource_reflections(spirv_resources.sampled_images,        vk::DescriptorType::eCombinedImageSampler);
+    add_spirv_resource_reflections(spirv_resources.separate_images,       vk::DescriptorType::eSampledImage);
+    add_spirv_resource_reflections(spirv_resources.separate_samplers,     vk::DescriptorType::eSampler);
+    // TODO: add support for spirv_resources.atomic_counters, vk::DescriptorType::eMutableVALVE
+
+    // Stage inputs of all interface variables are reflected for vertex shader input layout only
+    if (spirv_compiler.get_execution_model() != spv::ExecutionModelVertex)
+        return reflection;
+
+    const spirv_cross::ShaderResources all_spirv_resources = spirv_compiler.get_shader_resources();
+    reflection.stage_inputs.reserve(all_spirv_resources.stage_inputs.size());
+    for(const spirv_cross::Resource& input_resource : all_spirv_resources.stage_inputs)
+    {
+        const bool has_semantic = spirv_compiler.has_decoration(input_resource.id, spv::DecorationHlslSemanticGOOGLE);
+        const bool has_location = spirv_compiler.has_decoration(input_resource.id, spv::DecorationLocation);
+        META_CHECK_TRUE(has_semantic && has_location);
+
+        const spirv_cross::SPIRType& attribute_type = spirv_compiler.get_type(input_resource.base_type_id);
+        reflection.stage_inputs.push_back(ShaderStageInputReflection{
+            spirv_compiler.get_decoration_string(input_resource.id, spv::DecorationHlslSemanticGOOGLE),
+            spirv_compiler.get_decoration(input_resource.id, spv::DecorationLocation),
+            GetVertexAttributeFormatFromSpirvType(attribute_type),
+            attribute_type.vecsize
+        });
+    }
+
+    return reflection;
+}
+
+Data::Bytes ShaderRegistry::SerializeReflections(const std::map<uint64_t, ShaderReflection>& reflection_by_hash)
+{
+    META_FUNCTION_TASK();
+    Data::Bytes data;
+    ReflectionWriter writer(data);
+    writer.Write(static_cast<uint32_t>(reflection_by_hash.size()));
+    for(const auto& [byte_code_hash, reflection] : reflection_by_hash)
+    {
+        writer.Write(byte_code_hash);
+        writer.Write(static_cast<uint32_t>(reflection.resources.size()));
+        for(const ShaderResourceReflection& resource : reflection.resources)
+        {
+            writer.WriteString(resource.name);
+            writer.Write(resource.descriptor_type);
+            writer.Write(resource.descriptor_set_id);
+            writer.Write(resource.array_size);
+            writer.Write(resource.buffer_size);
+            writer.Write(resource.descriptor_set_offset);
+            writer.Write(resource.binding_offset);
+        }
+        writer.Write(static_cast<uint32_t>(reflection.stage_inputs.size()));
+        for(const ShaderStageInputReflection& stage_input : reflection.stage_inputs)
+        {
+            writer.WriteString(stage_input.semantic_name);
+            writer.Write(stage_input.location);
+            writer.Write(stage_input.format);
+            writer.Write(stage_input.vector_size);
+        }
+    }
+    return data;
+}
+
+bool ShaderRegistry::DeserializeReflections(const Data::Bytes& data, std::map<uint64_t, ShaderReflection>& reflection_by_hash)
+{
+    META_FUNCTION_TASK();
+    ReflectionReader reader(data);
+    uint32_t reflections_count = 0U;
+    if (!reader.Read(reflections_count))
+        return false;
+
+    std::map<uint64_t, ShaderReflection> read_reflection_by_hash;
+    for(uint32_t reflection_index = 0U; reflection_index < reflections_count; ++reflection_index)
+    {
+        uint64_t byte_code_hash  = 0U;
+        uint32_t resources_count = 0U;
+        if (!reader.Read(byte_code_hash) || !reader.Read(resources_count))
+            return false;
+
+        ShaderReflection reflection;
+        for(uint32_t resource_index = 0U; resource_index < resources_count; ++resource_index)
+        {
+            ShaderResourceReflection& resource = reflection.resources.emplace_back();
+            if (!reader.ReadString(resource.name) ||
+                !reader.Read(resource.descriptor_type) ||
+                !reader.Read(resource.descriptor_set_id) ||
+                !reader.Read(resource.array_size) ||
+                !reader.Read(resource.buffer_size) ||
+                !reader.Read(resource.descriptor_set_offset) ||
+                !reader.Read(resource.binding_offset))
+                return false;
+        }
+
+        uint32_t stage_inputs_count = 0U;
+        if (!reader.Read(stage_inputs_count))
+            return false;
+
+        for(uint32_t input_index = 0U; input_index < stage_inputs_count; ++input_index)
+        {
+            ShaderStageInputReflection& stage_input = reflection.stage_inputs.emplace_back();
+            if (!reader.ReadString(stage_input.semantic_name) ||
+                !reader.Read(stage_input.location) ||
+                !reader.Read(stage_input.format) ||
+                !reader.Read(stage_input.vector_size))
+                return false;
+        }
+
+        read_reflection_by_hash.try_emplace(byte_code_hash, std::move(reflection));
+    }
+
+    if (!reader.IsCompleted())
+        return false;
+
+    reflection_by_hash.merge(read_reflection_by_hash);
+    return true;
+}
+
+bool ShaderRegistry::Save()
+{
+    META_FUNCTION_TASK();
+    if (m_reflection_cache_file_path.empty())
+        return false;
+
+    std::lock_guard lock(m_mutex);
+    if (!m_reflection_cache_changed)
+        return false;
+
+    const Data::Bytes reflections_data = SerializeReflections(m_reflection_by_hash);
+    nowide::ofstream file_stream(m_reflection_cache_file_path, std::ios::binary | std::ios::trunc);
+    if (!file_stream.is_open())
+    {
+        META_LOG("WARNING: Failed to open Vulkan shader reflection cache file '{}' for writing.", m_reflection_cache_file_path);
+        return false;
+    }
+
+    FileHeader file_header;
+    file_header.data_size = reflections_data.size();
+    file_header.data_hash = ComputeDataHash(reinterpret_cast<const uint8_t*>(reflections_data.data()), reflections_data.size()); // NOSONAR
+
+    file_stream.write(reinterpret_cast<const char*>(&file_header), sizeof(file_header)); // NOSONAR
+    file_stream.write(reinterpret_cast<const char*>(reflections_data.data()), static_cast<std::streamsize>(reflections_data.size())); // NOSONAR
+    if (!file_stream.good())
+        return false;
+
+    m_reflection_cache_changed = false;
+    m_statistics.saved_reflections_count = static_cast<uint32_t>(m_reflection_by_hash.size());
+    return true;
+}
+
+ShaderRegistry::Statistics ShaderRegistry::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    return m_statistics;
+}
+
+void ShaderRegistry::LoadReflectionCache()
+{
+    META_FUNCTION_TASK();
+    const Data::Bytes reflections_data = ReadCacheFileData<FileHeader, std::byte>(m_reflection_cache_file_path, "shader reflection cache");
+    if (reflections_data.empty())
+        return;
+
+    if (!DeserializeReflections(reflections_data, m_reflection_by_hash))
+    {
+        META_LOG("WARNING: Vulkan shader reflection cache file '{}' is corrupted and is ignored.", m_reflection_cache_file_path);
+        m_reflection_by_hash.clear();
+        return;
+    }
+
+    m_statistics.loaded_reflections_count = static_cast<uint32_t>(m_reflection_by_hash.size());
+}
+
+ShaderReflection ShaderRegistry::GetReflection(const Data::Chunk& byte_code, uint64_t byte_code_hash)
+{
+    META_FUNCTION_TASK();
+    {
+        // Reflection is cached by byte code hash, so that changed shaders are reflected again
+        std::lock_guard lock(m_mutex);
+        if (const auto reflection_it = m_reflection_by_hash.find(byte_code_hash);
+            reflection_it != m_reflection_by_hash.end())
+        {
+            m_statistics.reflection_cache_hits_count++;
+            return reflection_it->second;
+        }
+    }
+
+    ShaderReflection reflection = ReflectByteCode(byte_code);
+
+    std::lock_guard lock(m_mutex);
+    m_statistics.reflections_count++;
+    m_reflection_by_hash.try_emplace(byte_code_hash, reflection);
+    m_reflection_cache_changed = true;
+    return reflection;
+}
+
+} // namespace Methane::Graphics::Vulkan
@@ -0,0 +1,195 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/Graphics/Vulkan/StagingRingBuffer.cpp
+Vulkan persistently mapped staging ring buffer shared by all resource uploads
+of the context, ring ranges are retired on upload command list completion.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Vulkan/StagingRingBuffer.h>
+#include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/Utils.hpp>
+
+#include <Methane/Checks.hpp>
+#include <Methane/Instrumentation.h>
+
+#include <algorithm>
+
+namespace Methane::Graphics::Vulkan
+{
+
+// Staging offsets are aligned to satisfy buffer-to-image copy requirements for all texel block sizes
+static constexpr vk::DeviceSize g_min_staging_alignment = 16U;
+
+static constexpr vk::MemoryPropertyFlags g_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible
+                                                                | vk::MemoryPropertyFlagBits::eHostCoherent;
+
+static vk::UniqueBuffer CreateStagingBuffer(const vk::Device& vk_device, vk::DeviceSize size)
+{
+    META_FUNCTION_TASK();
+    return vk_device.createBufferUnique(
+        vk::BufferCreateInfo(vk::BufferCreateFlags{},
+                             size,
+                             vk::BufferUsageFlagBits::eTransferSrc,
+                             vk::SharingMode::eExclusive));
+}
+
+StagingRingBuffer::StagingRingBuffer(const Device& device, const Settings& settings)
+    : m_settings(settings)
+    , m_vk_device(device.GetNativeDevice())
+    , m_memory_allocator(device.GetMemoryAllocator())
+    , m_alignment(std::max(g_min_staging_alignment, device.GetNativePhysicalDevice().getProperties().limits.optimalBufferCopyOffsetAlignment))
+    , m_vk_unique_buffer(CreateStagingBuffer(m_vk_device, settings.GetRingSize()))
+    , m_memory_allocation(m_memory_allocator.Allocate(m_vk_device.getBufferMemoryRequirements(m_vk_unique_buffer.get()),
+                                                      g_staging_memory_flags, MemoryResourceKind::Buffer))
+    , m_ring_allocator(settings.GetRingSize())
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(settings.frames_count, "staging ring buffer requires at least one frame partition");
+    META_CHECK_NOT_NULL_DESCR(m_memory_allocation.GetMappedDataPtr(), "staging ring buffer memory is not mapped");
+    m_vk_device.bindBufferMemory(m_vk_unique_buffer.get(), m_memory_allocation.GetNativeDeviceMemory(), m_memory_allocation.GetOffset());
+    SetVulkanObjectName(m_vk_device, m_vk_unique_buffer.get(), "Staging Ring Buffer");
+    m_statistics.ring_size = settings.GetRingSize();
+}
+
+StagingRegion StagingRingBuffer::Allocate(Rhi::ICommandList& upload_cmd_list, vk::DeviceSize size)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(size, "staging region size can not be zero");
+
+    // Connect to command list events before locking to keep the same lock order with callbacks emitted under emitter lock
+    static_cast<Data::IEmitter<Rhi::ICommandListCallback>&>(upload_cmd_list).Connect(*this);
+
+    std::lock_guard lock(m_mutex);
+    Segment& segment = GetEncodingSegment(upload_cmd_list);
+
+    // Uploads larger than one frame partition would stall streaming of the following frames, so they are staged separately
+    const Opt<vk::DeviceSize> offset_opt = size <= m_settings.frame_size
+                                         ? m_ring_allocator.Allocate(size, m_alignment)
+                                         : Opt<vk::DeviceSize>();
+    if (!offset_opt)
+        return AllocateDedicated(segment, size);
+
+    segment.ring_end_offset_opt = *offset_opt + size;
+    m_statistics.staged_size += size;
+    m_statistics.staged_uploads_count++;
+    return StagingRegion{
+        m_vk_unique_buffer.get(),
+        *offset_opt,
+        size,
+        m_memory_allocation.GetMappedDataPtr() + *offset_opt
+    };
+}
+
+StagingRingBufferStatistics StagingRingBuffer::GetStatistics() const
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    Statistics statistics = m_statistics;
+    statistics.ring_used_size         = m_ring_allocator.GetStatistics().used_size;
+    statistics.ring_wraps_count       = m_ring_allocator.GetWrapsCount();
+    statistics.pending_segments_count = static_cast<uint32_t>(m_segments.size());
+    return statistics;
+}
+
+void StagingRingBuffer::OnCommandListStateChanged(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    const Rhi::CommandListState cmd_list_state = command_list.GetState();
+    if (cmd_list_state != Rhi::CommandListState::Executing &&
+        cmd_list_state != Rhi::CommandListState::Pending)
+        return;
+
+    // Encoding segment of the command list reset to pending state without execution is not used by GPU
+    const SegmentState new_segment_state = cmd_list_state == Rhi::CommandListState::Executing
+                                         ? SegmentState::Executing
+                                         : SegmentState::Completed;
+    std::lock_guard lock(m_mutex);
+    for(Segment& segment : m_segments)
+    {
+        if (segment.cmd_list_ptr == &command_list && segment.state == SegmentState::Encoding)
+            segment.state = new_segment_state;
+    }
+    if (new_segment_state == SegmentState::Completed)
+        RetireCompletedSegments();
+}
+
+void StagingRingBuffer::OnCommandListExecutionCompleted(Rhi::ICommandList& command_list)
+{
+    META_FUNCTION_TASK();
+    std::lock_guard lock(m_mutex);
+    for(Segment& segment : m_segments)
+    {
+        if (segment.cmd_list_ptr == &command_list && segment.state == SegmentState::Executing)
+            segment.state = SegmentState::Completed;
+    }
+    RetireCompletedSegments();
+}
+
+StagingRingBuffer::Segment& StagingRingBuffer::GetEncodingSegment(Rhi::ICommandList& upload_cmd_list)
+{
+    META_FUNCTION_TASK();
+    // New segment is started when allocations switch to another command list to keep segments in ring order
+    if (!m_segments.empty() &&
+        m_segments.back().cmd_list_ptr == &upload_cmd_list &&
+        m_segments.back().state == SegmentState::Encoding)
+        return m_segments.back();
+
+    return m_segments.emplace_back(Segment{ &upload_cmd_list });
+}
+
+StagingRegion StagingRingBuffer::AllocateDedicated(Segment& segment, vk::DeviceSize size)
+{
+    META_FUNCTION_TASK();
+    DedicatedStaging dedicated_staging{ CreateStagingBuffer(m_vk_device, size) };
+    dedicated_staging.memory_allocation = m_memory_allocator.Allocate(m_vk_device.getBufferMemoryRequirements(dedicated_staging.vk_unique_buffer.get()),
+                                                                      g_staging_memory_flags, MemoryResourceKind::Buffer);
+    m_vk_device.bindBufferMemory(dedicated_staging.vk_unique_buffer.get(),
+                                 dedicated_staging.memory_allocation.GetNativeDeviceMemory(),
+                                 dedicated_staging.memory_allocation.GetOffset());
+
+    const StagingRegion staging_region{
+        dedicated_staging.vk_unique_buffer.get(),
+        0U,
+        size,
+        dedicated_staging.memory_allocation.GetMappedDataPtr()
+    };
+    META_CHECK_NOT_NULL_DESCR(staging_region.data_ptr, "dedicated staging buffer memory is not mapped");
+
+    segment.dedicated_stagings.emplace_back(std::move(dedicated_staging));
+    m_statistics.dedicated_staged_size += size;
+    m_statistics.dedicated_uploads_count++;
+    return staging_region;
+}
+
+void StagingRingBuffer::RetireCompletedSegments()
+{
+    META_FUNCTION_TASK();
+    while(!m_segments.empty() && m_segments.front().state == SegmentState::Completed)
+    {
+        if (const Opt<vk::DeviceSize>& ring_end_offset_opt = m_segments.front().ring_end_offset_opt;
+            ring_end_offset_opt)
+        {
+            m_ring_allocator.ReleaseUntil(*ring_end_offset_opt);
+        }
+        m_segments.pop_front();
+    }
+}
+
+} // namespace Methane::Graphics::Vulkan
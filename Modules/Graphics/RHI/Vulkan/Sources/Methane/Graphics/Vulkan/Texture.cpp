@@ -25,6 +25,7 @@ Vulkan implementation of the texture interface.
 #include <Methane/Graphics/Vulkan/RenderContext.h>
 #include <Methane/Graphics/Vulkan/RenderCommandList.h>
 #include <Methane/Graphics/Vulkan/Device.h>
+#include <Methane/Graphics/Vulkan/StagingRingBuffer.h>
 #include <Methane/Graphics/Vulkan/Types.h>
 
 #include <Methane/Data/EnumMaskUtil.hpp>
@@ -281,19 +282,23 @@ void Texture::InitializeAsImage()
     const vk::Device& vk_device = GetNativeDevice();
     const vk::MemoryRequirements vk_image_memory_requirements = vk_device.getImageMemoryRequirements(GetNativeResource());
     AllocateResourceMemory(vk_image_memory_requirements, vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 
-    // Create staging buffer and allocate staging memory
-    m_vk_unique_staging_buffer = vk_device.createBufferUnique(
+    // Image data is uploaded via context staging ring buffer, so only read-back textures need their own host-visible buffer
+    if (!GetUsage().HasAnyBit(Rhi::ResourceUsage::ReadBack))
+        return;
+
+    // Create read-back buffer and allocate its memory
+    m_vk_unique_readback_buffer = vk_device.createBufferUnique(
         vk::BufferCreateInfo(vk::BufferCreateFlags{},
                              vk_image_memory_requirements.size,
-                             vk::BufferUsageFlagBits::eTransferSrc | vk::BufferUsageFlagBits::eTransferDst,
+                             vk::BufferUsageFlagBits::eTransferDst,
                              vk::SharingMode::eExclusive)
     );
 
-    const vk::MemoryPropertyFlags vk_staging_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
-    m_vk_unique_staging_memory = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_staging_buffer.get()), vk_staging_memory_flags);
-    vk_device.bindBufferMemory(m_vk_unique_staging_buffer.get(), m_vk_unique_staging_memory.get(), 0);
+    const vk::MemoryPropertyFlags vk_readback_memory_flags = vk::MemoryPropertyFlagBits::eHostVisible | vk::MemoryPropertyFlagBits::eHostCoherent;
+    m_readback_memory_allocation = AllocateDeviceMemory(vk_device.getBufferMemoryRequirements(m_vk_unique_readback_buffer.get()), vk_readback_memory_flags);
+    vk_device.bindBufferMemory(m_vk_unique_readback_buffer.get(), m_readback_memory_allocation.GetNativeDeviceMemory(), m_readback_memory_allocation.GetOffset());
 }
 
 void Texture::InitializeAsRenderTarget()
@@ -305,7 +310,7 @@ void Texture::InitializeAsRenderTarget()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::InitializeAsDepthStencil()
@@ -322,7 +327,7 @@ void Texture::InitializeAsDepthStencil()
     // Allocate resource primary memory
     const vk::Device& vk_device = GetNativeDevice();
     AllocateResourceMemory(vk_device.getImageMemoryRequirements(GetNativeResource()), vk::MemoryPropertyFlagBits::eDeviceLocal);
-    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), 0);
+    vk_device.bindImageMemory(GetNativeResource(), GetNativeDeviceMemory(), GetMemoryAllocation().GetOffset());
 }
 
 void Texture::ResetNativeFrameImage()
@@ -350,42 +355,42 @@ void Texture::SetData(Rhi::ICommandQueue& target_cmd_queue, const SubResources&
     m_vk_copy_regions.clear();
     m_vk_copy_regions.reserve(sub_resources.size());
 
-    const SubResource::Count& subresource_count = GetSubresourceCount();
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    vk::DeviceSize sub_resource_offset = 0U;
-
+    vk::DeviceSize staging_data_size = 0U;
     for(const SubResource& sub_resource : sub_resources)
     {
         ValidateSubResource(sub_resource);
-        Data::RawPtr sub_resource_data_ptr = nullptr;
-        const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, sub_resource_offset, sub_resource.GetDataSize(), vk::MemoryMapFlags{},
-                                                                     reinterpret_cast<void**>(&sub_resource_data_ptr)); // NOSONAR
+        staging_data_size += sub_resource.GetDataSize();
+    }
 
-        META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-        META_CHECK_NOT_NULL_DESCR(sub_resource_data_ptr, "failed to map buffer subresource");
-        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), sub_resource_data_ptr);
+    // Copy all subresources data to the single context staging ring region retired on upload completion
+    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
+    const StagingRegion    staging_region  = GetVulkanContext().GetVulkanStagingRingBuffer().Allocate(upload_cmd_list, staging_data_size);
+    const SubResource::Count& subresource_count = GetSubresourceCount();
+    vk::DeviceSize sub_resource_offset = 0U;
 
-        GetNativeDevice().unmapMemory(vk_device_memory);
+    for(const SubResource& sub_resource : sub_resources)
+    {
+        std::copy(sub_resource.GetDataPtr(), sub_resource.GetDataEndPtr(), staging_region.data_ptr + sub_resource_offset);
 
+        const FrameRect update_rect = GetSubResourceUpdateRect(sub_resource);
         m_vk_copy_regions.emplace_back(
-            sub_resource_offset, 0, 0,
+            staging_region.offset + sub_resource_offset, 0, 0,
             vk::ImageSubresourceLayers(
                 vk::ImageAspectFlagBits::eColor,
                 sub_resource.GetIndex().GetMipLevel(),
                 sub_resource.GetIndex().GetBaseLayerIndex(subresource_count),
                 1U
             ),
-            vk::Offset3D(),
-            TypeConverter::FrameSizeToExtent3D(GetSettings().dimensions.AsRectSize())
+            vk::Offset3D(update_rect.origin.GetX(), update_rect.origin.GetY(), 0),
+            TypeConverter::FrameSizeToExtent3D(update_rect.size)
         );
 
         sub_resource_offset += sub_resource.GetDataSize();
     }
 
     // Copy buffer data from staging upload resource to the device-local GPU resource
-    TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopyDest);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
-    vk_cmd_buffer.copyBufferToImage(m_vk_unique_staging_buffer.get(), GetNativeResource(),
+    vk_cmd_buffer.copyBufferToImage(staging_region.vk_buffer, GetNativeResource(),
                                     vk::ImageLayout::eTransferDstOptimal, m_vk_copy_regions);
 
     if (GetSettings().mipmapped && sub_resources.size() < GetSubresourceCount().GetRawCount())
@@ -412,7 +417,7 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
     const SubResource::Count& subresource_count = GetSubresourceCount();
     const State           initial_texture_state = GetState();
 
-    // Copy texture data from device-local GPU resource to staging resource for read-back
+    // Copy texture data from device-local GPU resource to read-back buffer
     vk::BufferImageCopy image_to_buffer_copy(
         0U, 0U, 0U,
         vk::ImageSubresourceLayers(
@@ -427,33 +432,26 @@ Rhi::SubResource Texture::GetData(Rhi::ICommandQueue& target_cmd_queue, const Su
     TransferCommandList&   upload_cmd_list = PrepareResourceTransfer(target_cmd_queue, State::CopySource);
     const vk::CommandBuffer& vk_cmd_buffer = upload_cmd_list.GetNativeCommandBufferDefault();
     vk_cmd_buffer.copyImageToBuffer(GetNativeResource(), vk::ImageLayout::eTransferSrcOptimal,
-                                    m_vk_unique_staging_buffer.get(), image_to_buffer_copy);
+                                    m_vk_unique_readback_buffer.get(), image_to_buffer_copy);
 
     CompleteResourceTransfer(upload_cmd_list, initial_texture_state, target_cmd_queue);
 
     // Execute resource transfer commands and wait for completion
     GetBaseContext().UploadResources();
 
-    // Map staging buffer memory and copy texture subresource data
-    const vk::DeviceMemory& vk_device_memory = m_vk_unique_staging_memory.get();
-    Data::Size   staging_data_offset = 0U;
-    Data::Size   staging_data_size   = bytes_per_image;
-    Data::RawPtr staging_data_ptr    = nullptr;
+    // Copy texture subresource data from persistently mapped read-back buffer memory
+    Data::Size staging_data_offset = 0U;
+    Data::Size staging_data_size   = bytes_per_image;
     if (data_range)
     {
         META_CHECK_LESS_DESCR(data_range->GetEnd(), staging_data_size, "provided texture subresource data range is out of bounds");
         staging_data_offset = data_range->GetStart();
         staging_data_size   = data_range->GetLength();
     }
-    const vk::Result vk_map_result = GetNativeDevice().mapMemory(vk_device_memory, staging_data_offset, staging_data_size, vk::MemoryMapFlags{},
-                                                                 reinterpret_cast<void**>(&staging_data_ptr)); // NOSONAR
-
-    META_CHECK_EQUAL_DESCR(vk_map_result, vk::Result::eSuccess, "failed to map staging buffer subresource");
-    META_CHECK_NOT_NULL_DESCR(staging_data_ptr, "failed to map buffer subresource");
-    Rhi::SubResource sub_resource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
-
-    GetNativeDevice().unmapMemory(vk_device_memory);
-    return sub_resource;
+    const Data::RawPtr mapped_data_ptr = m_readback_memory_allocation.GetMappedDataPtr();
+    META_CHECK_NOT_NULL_DESCR(mapped_data_ptr, "failed to map read-back buffer memory");
+    const Data::RawPtr staging_data_ptr = mapped_data_ptr + staging_data_offset;
+    return Rhi::SubResource(Data::Bytes(staging_data_ptr, staging_data_ptr + staging_data_size), sub_resource_index, data_range);
 }
 
 bool Texture::SetName(std::string_view name)
@@ -462,9 +460,9 @@ bool Texture::SetName(std::string_view name)
     if (!Resource::SetName(name))
         return false;
 
-    if (m_vk_unique_staging_buffer)
+    if (m_vk_unique_readback_buffer)
     {
-        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_staging_buffer.get(), fmt::format("{} Staging Buffer", name));
+        SetVulkanObjectName(GetNativeDevice(), m_vk_unique_readback_buffer.get(), fmt::format("{} Read-back Buffer", name));
     }
     return true;
 }
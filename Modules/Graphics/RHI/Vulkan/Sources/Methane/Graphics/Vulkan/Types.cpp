@@ -57,6 +57,24 @@ vk::Format TypeConverter::PixelFormatToVulkan(PixelFormat pixel_format)
     case R8Unorm:          return eR8Unorm;
     case R8Snorm:          return eR8Snorm;
     case A8Unorm:          return eR8Unorm; // TODO: Channels swizzle?
+    case RGBA32Float:      return eR32G32B32A32Sfloat;
+    case RGBA16Float:      return eR16G16B16A16Sfloat;
+    case RG11B10Float:     return eB10G11R11UfloatPack32;
+    case RGB9E5Float:      return eE5B9G9R9UfloatPack32;
+    case BC1Unorm:         return eBc1RgbaUnormBlock;
+    case BC1Unorm_sRGB:    return eBc1RgbaSrgbBlock;
+    case BC2Unorm:         return eBc2UnormBlock;
+    case BC2Unorm_sRGB:    return eBc2SrgbBlock;
+    case BC3Unorm:         return eBc3UnormBlock;
+    case BC3Unorm_sRGB:    return eBc3SrgbBlock;
+    case BC4Unorm:         return eBc4UnormBlock;
+    case BC4Snorm:         return eBc4SnormBlock;
+    case BC5Unorm:         return eBc5UnormBlock;
+    case BC5Snorm:         return eBc5SnormBlock;
+    case BC6HUfloat:       return eBc6HUfloatBlock;
+    case BC6HSfloat:       return eBc6HSfloatBlock;
+    case BC7Unorm:         return eBc7UnormBlock;
+    case BC7Unorm_sRGB:    return eBc7SrgbBlock;
     default:               META_UNEXPECTED_RETURN(pixel_format, vk::Format::eUndefined);
     }
 }
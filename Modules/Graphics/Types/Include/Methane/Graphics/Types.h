@@ -74,7 +74,29 @@ enum class PixelFormat : uint32_t
     R8Unorm,
     R8Snorm,
     A8Unorm,
-    Depth32Float
+    Depth32Float,
+
+    // High-precision formats for HDR images and render targets
+    RGBA32Float,
+    RGBA16Float,
+    RG11B10Float, // packed unsigned floats with 6-bit mantissa in R and G channels and 5-bit mantissa in B channel
+    RGB9E5Float,  // packed unsigned floats with 9-bit mantissa per channel and shared 5-bit exponent
+
+    // Block-compressed formats encode blocks of 4x4 pixels
+    BC1Unorm,
+    BC1Unorm_sRGB,
+    BC2Unorm,
+    BC2Unorm_sRGB,
+    BC3Unorm,
+    BC3Unorm_sRGB,
+    BC4Unorm,
+    BC4Snorm,
+    BC5Unorm,
+    BC5Snorm,
+    BC6HUfloat,
+    BC6HSfloat,
+    BC7Unorm,
+    BC7Unorm_sRGB
 };
 
 using PixelFormats = std::vector<PixelFormat>;
@@ -89,6 +111,13 @@ struct AttachmentFormats
 [[nodiscard]] Data::Size GetPixelSize(PixelFormat pixel_format);
 [[nodiscard]] bool IsSrgbColorSpace(PixelFormat pixel_format) noexcept;
 [[nodiscard]] bool IsDepthFormat(PixelFormat pixel_format) noexcept;
+[[nodiscard]] bool IsCompressedFormat(PixelFormat pixel_format) noexcept;
+
+// Pixel block is a single pixel for uncompressed formats and 4x4 pixels for block-compressed formats
+[[nodiscard]] uint32_t   GetPixelBlockDimension(PixelFormat pixel_format) noexcept;
+[[nodiscard]] Data::Size GetPixelBlockSize(PixelFormat pixel_format);
+[[nodiscard]] Data::Size GetImageRowPitch(PixelFormat pixel_format, uint32_t width);
+[[nodiscard]] Data::Size GetImageSlicePitch(PixelFormat pixel_format, uint32_t width, uint32_t height);
 
 enum class Compare : uint32_t
 {
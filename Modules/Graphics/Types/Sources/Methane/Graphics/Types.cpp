@@ -81,6 +81,12 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     switch(pixel_format)
     {
     using enum PixelFormat;
+    case RGBA32Float:
+        return 16;
+
+    case RGBA16Float:
+        return 8;
+
     case RGBA8:
     case RGBA8Unorm:
     case RGBA8Unorm_sRGB:
@@ -90,6 +96,8 @@ Data::Size GetPixelSize(PixelFormat pixel_format)
     case R32Uint:
     case R32Sint:
     case Depth32Float:
+    case RG11B10Float:
+    case RGB9E5Float:
         return 4;
 
     case R16Float:
@@ -119,6 +127,10 @@ bool IsSrgbColorSpace(PixelFormat pixel_format) noexcept
     using enum PixelFormat;
     case RGBA8Unorm_sRGB:
     case BGRA8Unorm_sRGB:
+    case BC1Unorm_sRGB:
+    case BC2Unorm_sRGB:
+    case BC3Unorm_sRGB:
+    case BC7Unorm_sRGB:
         return true;
 
     default:
@@ -132,4 +144,59 @@ bool IsDepthFormat(PixelFormat pixel_format) noexcept
     return pixel_format == PixelFormat::Depth32Float;
 }
 
+bool IsCompressedFormat(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    return pixel_format >= PixelFormat::BC1Unorm && pixel_format <= PixelFormat::BC7Unorm_sRGB;
+}
+
+uint32_t GetPixelBlockDimension(PixelFormat pixel_format) noexcept
+{
+    META_FUNCTION_TASK();
+    return IsCompressedFormat(pixel_format) ? 4U : 1U;
+}
+
+Data::Size GetPixelBlockSize(PixelFormat pixel_format)
+{
+    META_FUNCTION_TASK();
+    switch(pixel_format)
+    {
+    using enum PixelFormat;
+    case BC1Unorm:
+    case BC1Unorm_sRGB:
+    case BC4Unorm:
+    case BC4Snorm:
+        return 8;
+
+    case BC2Unorm:
+    case BC2Unorm_sRGB:
+    case BC3Unorm:
+    case BC3Unorm_sRGB:
+    case BC5Unorm:
+    case BC5Snorm:
+    case BC6HUfloat:
+    case BC6HSfloat:
+    case BC7Unorm:
+    case BC7Unorm_sRGB:
+        return 16;
+
+    default:
+        return GetPixelSize(pixel_format);
+    }
+}
+
+Data::Size GetImageRowPitch(PixelFormat pixel_format, uint32_t width)
+{
+    META_FUNCTION_TASK();
+    const uint32_t block_dimension = GetPixelBlockDimension(pixel_format);
+    return GetPixelBlockSize(pixel_format) * ((width + block_dimension - 1U) / block_dimension);
+}
+
+Data::Size GetImageSlicePitch(PixelFormat pixel_format, uint32_t width, uint32_t height)
+{
+    META_FUNCTION_TASK();
+    const uint32_t block_dimension = GetPixelBlockDimension(pixel_format);
+    return GetImageRowPitch(pixel_format, width) * ((height + block_dimension - 1U) / block_dimension);
+}
+
 } // namespace Methane::Graphics
@@ -40,10 +40,18 @@ Methane platform utility functions
 #include <string>
 #include <vector>
 #include <limits>
+#include <memory>
+#include <cstddef>
 
 namespace Methane::Platform
 {
 
+struct MappedFile
+{
+    std::shared_ptr<const std::byte> data_ptr; // file is unmapped from memory when the last copy of data pointer is released
+    size_t                           size = 0U;
+};
+
 void PrintToDebugOutput(std::string_view msg);
 std::string GetExecutableDir();
 std::string GetExecutableFileName();
@@ -52,4 +60,7 @@ std::vector<std::string_view> SplitString(const std::string_view str, const char
                                           bool with_empty_parts = false,
                                           size_t max_chunk_size = std::numeric_limits<size_t>::max());
 
+// Maps file to memory for read-only access, so that file pages are loaded on demand by OS without copying
+[[nodiscard]] MappedFile MapFileToMemory(const std::string& file_path);
+
 } // namespace Methane::Platform
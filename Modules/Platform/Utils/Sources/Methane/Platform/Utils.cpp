@@ -24,6 +24,16 @@ Methane platform utility functions
 #include <Methane/Platform/Utils.h>
 #include <Methane/Instrumentation.h>
 
+#ifndef _WIN32
+#include <fmt/format.h>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 namespace Methane::Platform
 {
 
@@ -67,4 +77,42 @@ std::vector<std::string_view> SplitString(const std::string_view str, const char
     return parts;
 }
 
+#ifndef _WIN32
+
+MappedFile MapFileToMemory(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    const int file_descriptor = open(file_path.c_str(), O_RDONLY);
+    if (file_descriptor < 0)
+        throw std::runtime_error(fmt::format("Failed to open file '{}' for memory mapping.", file_path));
+
+    struct stat file_stat{};
+    if (fstat(file_descriptor, &file_stat) != 0)
+    {
+        close(file_descriptor);
+        throw std::runtime_error(fmt::format("Failed to get size of file '{}' for memory mapping.", file_path));
+    }
+
+    const auto file_size = static_cast<size_t>(file_stat.st_size);
+    if (!file_size)
+    {
+        close(file_descriptor);
+        return {};
+    }
+
+    // File descriptor is not needed after mapping is created, mapped pages remain valid until unmapped
+    void* mapped_data_ptr = mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    close(file_descriptor);
+    if (mapped_data_ptr == MAP_FAILED)
+        throw std::runtime_error(fmt::format("Failed to map file '{}' to memory.", file_path));
+
+    return MappedFile{
+        std::shared_ptr<const std::byte>(static_cast<const std::byte*>(mapped_data_ptr),
+                                         [file_size](const std::byte* data_ptr) { munmap(const_cast<std::byte*>(data_ptr), file_size); }), // NOSONAR
+        file_size
+    };
+}
+
+#endif
+
 } // namespace Methane::Platform
@@ -29,8 +29,10 @@ Windows platform utility functions.
 #include <shellapi.h>
 
 #include <nowide/convert.hpp>
+#include <fmt/format.h>
 #include <string_view>
 #include <array>
+#include <stdexcept>
 
 namespace Methane::Platform
 {
@@ -78,6 +80,45 @@ std::string GetResourceDir()
     return GetExecutableDir();
 }
 
+MappedFile MapFileToMemory(const std::string& file_path)
+{
+    META_FUNCTION_TASK();
+    const HANDLE file_handle = CreateFileW(nowide::widen(file_path).c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                           OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file_handle == INVALID_HANDLE_VALUE)
+        throw std::runtime_error(fmt::format("Failed to open file '{}' for memory mapping.", file_path));
+
+    LARGE_INTEGER file_size{};
+    if (!GetFileSizeEx(file_handle, &file_size))
+    {
+        CloseHandle(file_handle);
+        throw std::runtime_error(fmt::format("Failed to get size of file '{}' for memory mapping.", file_path));
+    }
+
+    if (!file_size.QuadPart)
+    {
+        CloseHandle(file_handle);
+        return {};
+    }
+
+    // File and mapping handles are not needed after view is mapped, mapped view remains valid until unmapped
+    const HANDLE mapping_handle = CreateFileMappingW(file_handle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    CloseHandle(file_handle);
+    if (!mapping_handle)
+        throw std::runtime_error(fmt::format("Failed to create memory mapping of file '{}'.", file_path));
+
+    const void* mapped_data_ptr = MapViewOfFile(mapping_handle, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping_handle);
+    if (!mapped_data_ptr)
+        throw std::runtime_error(fmt::format("Failed to map file '{}' to memory.", file_path));
+
+    return MappedFile{
+        std::shared_ptr<const std::byte>(static_cast<const std::byte*>(mapped_data_ptr),
+                                         [](const std::byte* data_ptr) { UnmapViewOfFile(data_ptr); }),
+        static_cast<size_t>(file_size.QuadPart)
+    };
+}
+
 namespace Windows
 {
 
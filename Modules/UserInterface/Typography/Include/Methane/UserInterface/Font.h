@@ -23,6 +23,7 @@ Font atlas texture generation class.
 
 #pragma once
 
+#include <Methane/UserInterface/SignedDistanceField.h>
 #include <Methane/Pimpl.h>
 #include <Methane/Graphics/Rect.hpp>
 #include <Methane/Data/IProvider.h>
@@ -51,11 +52,19 @@ struct FontDescription
     uint32_t    size_pt;
 };
 
+enum class FontGlyphMode : uint32_t
+{
+    Coverage = 0U,  // anti-aliased glyph coverage bitmaps rendered for the font size only
+    DistanceField   // signed distance fields of glyphs rendered with any text size from the single font atlas
+};
+
 struct FontSettings
 {
-    FontDescription description;
-    uint32_t        resolution_dpi;
-    std::u32string  characters;
+    FontDescription       description;
+    uint32_t              resolution_dpi;
+    std::u32string        characters;
+    FontGlyphMode         glyph_mode = FontGlyphMode::Coverage;
+    DistanceFieldSettings distance_field;
 };
 
 class FreeTypeError
@@ -91,6 +100,7 @@ public:
 
     using Description = FontDescription;
     using Settings    = FontSettings;
+    using GlyphMode   = FontGlyphMode;
     using Library     = FontLibrary;
 
     [[nodiscard]] static std::u32string ConvertUtf8To32(std::string_view text);
@@ -119,7 +129,15 @@ public:
     [[nodiscard]] uint32_t GetLineHeight() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] const gfx::FrameSize& GetMaxGlyphSize() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] const gfx::FrameSize& GetAtlasSize() const META_PIMPL_NOEXCEPT;
+
+    // Atlas texture is shared by render contexts of the same device and is uploaded by the context which created it,
+    // other contexts wait on GPU for its upload fence when uploading their resources before using the updated texture
     [[nodiscard]] const rhi::Texture&   GetAtlasTexture(const rhi::RenderContext& context) const;
+    [[nodiscard]] bool                  IsAtlasRepackPending() const META_PIMPL_NOEXCEPT;
+
+    // Atlas is repacked asynchronously when new characters do not fit into atlas textures in use,
+    // repack result is applied with recreation of atlas textures on completion check
+    bool CompleteAtlasRepack(bool wait_for_completion = false) const;
 
     void RemoveAtlasTexture(const rhi::RenderContext& render_context) const;
     void ClearAtlasTextures() const;
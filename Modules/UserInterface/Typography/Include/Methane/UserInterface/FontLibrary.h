@@ -31,9 +31,32 @@ Fonts library to manage created font instances.
 typedef struct FT_LibraryRec_* FT_Library; // NOSONAR
 #endif
 
+namespace tf // NOSONAR
+{
+// TaskFlow Executor class forward declaration from <taskflow/core/executor.hpp>
+class Executor;
+}
+
 namespace Methane::UserInterface
 {
 
+struct FontGlyphCacheStatistics
+{
+    Data::Size cached_glyphs_count      = 0U; // glyphs of all library fonts currently cached in memory
+    Data::Size pinned_glyphs_count      = 0U; // cached glyphs used by text meshes, which can not be evicted
+    Data::Size cached_data_size         = 0U; // size of character metrics and glyph pixels of all cached glyphs
+    Data::Size hits_count               = 0U; // requests of glyphs found in cache
+    Data::Size misses_count             = 0U; // glyphs loaded and rasterized, since they were not found in cache
+    Data::Size evicted_glyphs_count     = 0U; // least recently used glyphs evicted to fit cached data size in budget
+    Data::Size reused_atlas_rects_count = 0U; // glyphs placed to font atlas space released by evicted glyphs without atlas repack
+
+    [[nodiscard]] float GetHitRate() const noexcept
+    {
+        const Data::Size requests_count = hits_count + misses_count;
+        return requests_count ? static_cast<float>(hits_count) / static_cast<float>(requests_count) : 0.F;
+    }
+};
+
 struct IFontLibraryCallback
 {
     virtual void OnFontAdded(Font& font) = 0;
@@ -42,17 +65,23 @@ struct IFontLibraryCallback
     virtual ~IFontLibraryCallback() = default;
 };
 
+class FontGlyphCache;
+
 class FontLibrary
 {
     friend class Font;
+    friend class Font::Impl;
 
 public:
-    FontLibrary();
+    // Glyphs of added characters are rasterized in parallel by fonts of the library, when parallel executor is provided.
+    // Glyphs of all library fonts are cached within the budget size shared by all fonts, where zero budget is unlimited
+    explicit FontLibrary(tf::Executor* parallel_executor_ptr = nullptr, Data::Size glyph_cache_budget_size = 0U);
 
     void Connect(Data::Receiver<IFontLibraryCallback>& receiver) const;
     void Disconnect(Data::Receiver<IFontLibraryCallback>& receiver) const;
 
     [[nodiscard]] FT_Library GetFreeTypeLibrary() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] tf::Executor* GetParallelExecutor() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] std::vector<Font> GetFonts() const;
     [[nodiscard]] bool HasFont(std::string_view font_name) const;
     [[nodiscard]] Font& GetFont(std::string_view font_name) const;
@@ -61,9 +90,17 @@ public:
     void RemoveFont(std::string_view font_name) const;
     void Clear() const;
 
+    // Least recently used glyphs, which are not used by any text, are evicted from fonts when cached glyphs exceed the budget
+    void SetGlyphCacheBudgetSize(Data::Size budget_size) const;
+    [[nodiscard]] Data::Size GetGlyphCacheBudgetSize() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] const FontGlyphCacheStatistics& GetGlyphCacheStatistics() const META_PIMPL_NOEXCEPT;
+    void ResetGlyphCacheStatistics() const;
+
 private:
     class Impl;
 
+    [[nodiscard]] FontGlyphCache& GetGlyphCache() const META_PIMPL_NOEXCEPT;
+
     const Ptr<Impl> m_impl_ptr;
 };
 
@@ -0,0 +1,56 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/SignedDistanceField.h
+Signed distance field generation from supersampled glyph coverage bitmaps.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Graphics/Rect.hpp>
+#include <Methane/Data/Types.h>
+
+#include <cstdint>
+
+namespace Methane::UserInterface
+{
+
+namespace gfx = Methane::Graphics;
+
+struct DistanceFieldSettings
+{
+    uint32_t supersampling = 4U; // resolution multiplier of coverage bitmap relative to distance field
+    uint32_t spread        = 4U; // maximum encoded distance to glyph edge in distance field pixels
+
+    [[nodiscard]] friend bool operator==(const DistanceFieldSettings& left, const DistanceFieldSettings& right) noexcept = default;
+};
+
+// Distance field pixel stores distance from its center to the nearest glyph edge in distance field pixels,
+// which is positive inside glyph, negative outside and linearly encoded to [0, 255] for distances in range [-spread, +spread]
+[[nodiscard]] Data::Byte EncodeSignedDistance(float distance, uint32_t spread) noexcept;
+[[nodiscard]] float      DecodeSignedDistance(Data::Byte encoded_distance, uint32_t spread) noexcept;
+
+// Coverage bitmap is placed with offset in coverage pixels less than supersampling to align it with distance field pixels grid,
+// distance field is extended with spread pixels from each side of the downsampled coverage bitmap
+[[nodiscard]] gfx::FrameSize GetSignedDistanceFieldSize(const gfx::FrameSize& coverage_size, const gfx::FramePoint& coverage_offset,
+                                                        const DistanceFieldSettings& settings);
+[[nodiscard]] Data::Bytes    GenerateSignedDistanceField(const Data::Bytes& coverage_bitmap, const gfx::FrameSize& coverage_size,
+                                                         const gfx::FramePoint& coverage_offset, const DistanceFieldSettings& settings);
+
+} // namespace Methane::UserInterface
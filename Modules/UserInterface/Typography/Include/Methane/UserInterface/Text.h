@@ -91,6 +91,9 @@ struct TextSettings // NOSONAR
     // NOTE: State name should be different in case of render state incompatibility between Text objects
     std::string state_name = "Screen Text Render State";
 
+    // Text size in points can differ from the font size only for distance field fonts, font size is used when zero
+    uint32_t    font_size_pt = 0U;
+
     TextSettings& SetName(std::string_view new_name) noexcept                                         { name = new_name; return *this; }
     TextSettings& SetText(const StringType& new_text) noexcept                                        { text = new_text; return *this; }
     TextSettings& SetRect(const UnitRect& new_rect) noexcept                                          { rect = new_rect; return *this; }
@@ -100,6 +103,7 @@ struct TextSettings // NOSONAR
     TextSettings& SetAdjustVerticalContentOffset(bool new_adjust_offset) noexcept                     { adjust_vertical_content_offset = new_adjust_offset; return *this; }
     TextSettings& SetMeshBuffersReservationMultiplier(Data::Size new_reservation_multiplier) noexcept { mesh_buffers_reservation_multiplier = new_reservation_multiplier; return *this; }
     TextSettings& SetStateName(std::string_view new_state_name) noexcept                              { state_name = new_state_name; return *this; }
+    TextSettings& SetFontSize(uint32_t new_font_size_pt) noexcept                                     { font_size_pt = new_font_size_pt; return *this; }
 };
 
 struct ITextCallback
@@ -117,6 +121,8 @@ namespace rhi = Methane::Graphics::Rhi;
 class Text // NOSONAR - manual copy, move constructors and assignment operators
 {
 public:
+    class Impl;
+
     using Wrap                = TextWrap;
     using HorizontalAlignment = TextHorizontalAlignment;
     using VerticalAlignment   = TextVerticalAlignment;
@@ -139,6 +145,7 @@ public:
     void Connect(Data::Receiver<ITextCallback>& callback) const;
     void Disconnect(Data::Receiver<ITextCallback>& callback) const;
 
+    [[nodiscard]] const Font&           GetFont() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] const UnitRect&       GetFrameRect() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] const SettingsUtf32&  GetSettings() const META_PIMPL_NOEXCEPT;
     [[nodiscard]] const std::u32string& GetTextUtf32() const META_PIMPL_NOEXCEPT;
@@ -154,14 +161,16 @@ public:
     void SetHorizontalAlignment(HorizontalAlignment alignment) const;
     void SetVerticalAlignment(VerticalAlignment alignment) const;
     void SetIncrementalUpdate(bool incremental_update) const META_PIMPL_NOEXCEPT;
+    void SetFontSize(uint32_t font_size_pt) const;
     bool SetFrameRect(const UnitRect& ui_rect) const;
 
     void Update(const gfx::FrameSize& frame_size) const;
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
 
-private:
-    class Impl;
+    Impl& GetImplementation();
+    const Impl& GetImplementation() const;
 
+private:
     Ptr<Impl> m_impl_ptr;
 };
 
@@ -0,0 +1,101 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/TextBatch.h
+Methane text batch rendering many texts of the same font with one draw call.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/Types.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Pimpl.h>
+
+#include <string>
+#include <string_view>
+
+namespace Methane::Graphics::Rhi
+{
+class RenderPattern;
+class RenderCommandList;
+class CommandListDebugGroup;
+}
+
+namespace Methane::UserInterface
+{
+
+namespace rhi = Methane::Graphics::Rhi;
+
+struct TextBatchSettings
+{
+    std::string name;
+    Data::Size  mesh_buffers_reservation_multiplier = 2U;
+    std::string state_name = "Text Batch Pipeline State";
+
+    TextBatchSettings& SetName(std::string_view new_name) noexcept                                   { name = new_name; return *this; }
+    TextBatchSettings& SetMeshBuffersReservationMultiplier(Data::Size new_multiplier) noexcept       { mesh_buffers_reservation_multiplier = new_multiplier; return *this; }
+    TextBatchSettings& SetStateName(std::string_view new_state_name) noexcept                        { state_name = new_state_name; return *this; }
+};
+
+struct TextBatchStatistics
+{
+    Data::Size batched_texts_count      = 0U; // texts with non-empty mesh drawn by the batch
+    Data::Size uploaded_meshes_count    = 0U; // text meshes uploaded to the current frame buffers on last update
+    Data::Size uploaded_instances_count = 0U; // text instances uploaded to the current frame buffer on last update
+    Data::Size uploaded_data_size       = 0U; // size of all data uploaded to the current frame buffers on last update
+};
+
+class Context;
+class Font;
+class Text;
+
+class TextBatch // NOSONAR - manual copy, move constructors and assignment operators
+{
+public:
+    using Settings   = TextBatchSettings;
+    using Statistics = TextBatchStatistics;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE_NO_INLINE(TextBatch);
+
+    TextBatch(Context& ui_context, const rhi::RenderPattern& render_pattern, const Font& font, const Settings& settings);
+    TextBatch(Context& ui_context, const Font& font, const Settings& settings);
+
+    bool IsInitialized() const noexcept { return static_cast<bool>(m_impl_ptr); }
+
+    [[nodiscard]] const Settings&   GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] const Font&       GetFont() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] const Statistics& GetStatistics() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] Data::Size        GetTextsCount() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] bool              HasText(const Text& text) const;
+
+    // Batched texts must use the batch font and are drawn by the batch only,
+    // with texts mesh, frame rect and color changes picked up on every batch update
+    void AddText(const Text& text) const;
+    void RemoveText(const Text& text) const;
+
+    void Update(const gfx::FrameSize& render_attachment_size) const;
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
+
+private:
+    class Impl;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::UserInterface
@@ -35,10 +35,38 @@ struct PSInput
     float2 texcoord         : TEXCOORD;
 };
 
-ConstantBuffer<TextConstants> g_constants : register(b0, META_ARG_MUTABLE);
-ConstantBuffer<TextUniforms>  g_uniforms  : register(b1, META_ARG_MUTABLE);
-Texture2D<float>              g_texture   : register(t0, META_ARG_MUTABLE);
-SamplerState                  g_sampler   : register(s0, META_ARG_CONSTANT);
+struct BatchVSInput
+{
+    float2 position         : POSITION;
+    float2 texcoord         : TEXCOORD;
+    uint   text_index       : TEXT_INDEX;
+};
+
+struct BatchPSInput
+{
+    float4 position         : SV_POSITION;
+    float2 texcoord         : TEXCOORD;
+    float4 color            : COLOR;
+};
+
+ConstantBuffer<TextConstants>  g_constants : register(b0, META_ARG_MUTABLE);
+ConstantBuffer<TextUniforms>   g_uniforms  : register(b1, META_ARG_MUTABLE);
+Texture2D<float>               g_texture   : register(t0, META_ARG_MUTABLE);
+StructuredBuffer<TextInstance> g_instances : register(t1, META_ARG_MUTABLE);
+SamplerState                   g_sampler   : register(s0, META_ARG_CONSTANT);
+
+float GetGlyphAlpha(float2 texcoord)
+{
+#ifdef DISTANCE_FIELD
+    // Signed distance to glyph edge is converted to screen pixels with its screen-space derivative,
+    // so that glyph edge is anti-aliased over one pixel for any text scale
+    const float glyph_distance = g_texture.Sample(g_sampler, texcoord) - 0.5F;
+    const float pixel_distance = max(fwidth(glyph_distance), 0.0001F);
+    return saturate(glyph_distance / pixel_distance + 0.5F);
+#else
+    return g_texture.Sample(g_sampler, texcoord);
+#endif
+}
 
 PSInput TextVS(VSInput input)
 {
@@ -50,6 +78,22 @@ PSInput TextVS(VSInput input)
 
 float4 TextPS(PSInput input) : SV_TARGET
 {
-    const float glyph_alpha = g_texture.Sample(g_sampler, input.texcoord);
-    return float4(g_constants.color.rgb, g_constants.color.a * glyph_alpha);
+    return float4(g_constants.color.rgb, g_constants.color.a * GetGlyphAlpha(input.texcoord));
+}
+
+// Batched texts vertices are indexing per-text transformation and color in the instances buffer
+BatchPSInput TextBatchVS(BatchVSInput input)
+{
+    const TextInstance text_instance = g_instances[input.text_index];
+
+    BatchPSInput output;
+    output.position = float4(mul(text_instance.vp_matrix, float4(input.position, 1.F, 1.F)).xy, 0.F, 1.F);
+    output.texcoord = input.texcoord;
+    output.color    = text_instance.color;
+    return output;
+}
+
+float4 TextBatchPS(BatchPSInput input) : SV_TARGET
+{
+    return float4(input.color.rgb, input.color.a * GetGlyphAlpha(input.texcoord));
 }
@@ -22,4 +22,10 @@ struct TextUniforms
     float4x4 vp_matrix;
 };
 
+struct TextInstance
+{
+    float4x4 vp_matrix;
+    float4   color;
+};
+
 #endif // TEXT_UNIFORMS_H
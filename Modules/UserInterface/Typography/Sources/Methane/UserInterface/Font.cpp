@@ -169,6 +169,16 @@ const rhi::Texture& Font::GetAtlasTexture(const rhi::RenderContext& context) con
     return GetImpl(m_impl_ptr).GetAtlasTexture(context);
 }
 
+bool Font::IsAtlasRepackPending() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).IsAtlasRepackPending();
+}
+
+bool Font::CompleteAtlasRepack(bool wait_for_completion) const
+{
+    return GetImpl(m_impl_ptr).CompleteAtlasRepack(wait_for_completion);
+}
+
 void Font::RemoveAtlasTexture(const rhi::RenderContext& context) const
 {
     GetImpl(m_impl_ptr).RemoveAtlasTexture(context);
@@ -56,10 +56,17 @@ FontChar::Glyph::Glyph(FT_Glyph ft_glyph, uint32_t face_index)
 {
 }
 
+FontChar::Glyph::Glyph(Data::Bytes&& distance_field, uint32_t face_index)
+    : m_distance_field(std::move(distance_field))
+    , m_face_index(face_index)
+{
+}
+
 FontChar::Glyph::~Glyph()
 {
     META_FUNCTION_TASK();
-    FT_Done_Glyph(m_ft_glyph);
+    if (m_ft_glyph)
+        FT_Done_Glyph(m_ft_glyph);
 }
 
 static constexpr FontChar::Code g_line_break_code = static_cast<FontChar::Code>('\n');
@@ -97,6 +104,21 @@ FontChar::FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Poi
     , m_glyph_ptr(std::make_shared<Glyph>(ft_glyph, face_index))
 { }
 
+FontChar::FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Point2I advance,
+                   Data::Bytes&& distance_field, uint32_t face_index)
+    : m_code(code)
+    , m_type_mask(GetTypeMask(code))
+    , m_rect(std::move(rect))
+    , m_offset(std::move(offset))
+    , m_advance(std::move(advance))
+    , m_visual_size(IsWhiteSpace() ? m_advance.GetX() : m_offset.GetX() + m_rect.size.GetWidth(),
+                    IsWhiteSpace() ? m_advance.GetY() : m_offset.GetY() + m_rect.size.GetHeight())
+    , m_glyph_ptr(std::make_shared<Glyph>(std::move(distance_field), face_index))
+{
+    META_CHECK_EQUAL_DESCR(m_glyph_ptr->GetDistanceField().size(), m_rect.size.GetPixelsCount(),
+                           "glyph distance field size does not match character rectangle");
+}
+
 void FontChar::DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const
 {
     META_FUNCTION_TASK();
@@ -110,21 +132,37 @@ void FontChar::DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride)
     META_CHECK_LESS_OR_EQUAL(m_rect.GetRight(), atlas_row_stride);
     META_CHECK_LESS_OR_EQUAL(m_rect.GetBottom(), atlas_bitmap.size() / atlas_row_stride);
 
+    // Distance field glyphs are generated on character loading and copied to atlas as is
+    if (const Data::Bytes& distance_field = m_glyph_ptr->GetDistanceField();
+        !distance_field.empty())
+    {
+        CopyGlyphRowsToAtlas(distance_field.data(), atlas_bitmap, atlas_row_stride);
+        return;
+    }
+
     // Draw glyph to bitmap
     FT_Glyph ft_glyph = m_glyph_ptr->GetFreeTypeGlyph();
     ThrowFreeTypeError(FT_Glyph_To_Bitmap(&ft_glyph, FT_RENDER_MODE_NORMAL, nullptr, false));
 
-    FT_Bitmap& ft_bitmap = reinterpret_cast<FT_BitmapGlyph>(ft_glyph)->bitmap; // NOSONAR
+    const FT_Bitmap& ft_bitmap = reinterpret_cast<FT_BitmapGlyph>(ft_glyph)->bitmap; // NOSONAR
     META_CHECK_EQUAL(ft_bitmap.width, m_rect.size.GetWidth());
     META_CHECK_EQUAL(ft_bitmap.rows, m_rect.size.GetHeight());
 
+    CopyGlyphRowsToAtlas(reinterpret_cast<Data::ConstRawPtr>(ft_bitmap.buffer), atlas_bitmap, atlas_row_stride); // NOSONAR
+}
+
+void FontChar::CopyGlyphRowsToAtlas(Data::ConstRawPtr glyph_bitmap_ptr, Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const
+{
+    META_FUNCTION_TASK();
+    const uint32_t glyph_width = m_rect.size.GetWidth();
+
     // Copy glyph pixels to output bitmap row-by-row
-    for (uint32_t y = 0; y < ft_bitmap.rows; y++)
+    for (uint32_t y = 0; y < m_rect.size.GetHeight(); y++)
     {
         const uint32_t atlas_index = m_rect.origin.GetX() + (m_rect.origin.GetY() + y) * atlas_row_stride;
-        META_CHECK_LESS_DESCR(atlas_index, atlas_bitmap.size() - ft_bitmap.width + 1, "char glyph does not fit into target atlas bitmap");
-        std::copy(reinterpret_cast<Data::RawPtr>(ft_bitmap.buffer + y * ft_bitmap.width), // NOSONAR
-                  reinterpret_cast<Data::RawPtr>(ft_bitmap.buffer + (y + 1) * ft_bitmap.width), // NOSONAR
+        META_CHECK_LESS_DESCR(atlas_index, atlas_bitmap.size() - glyph_width + 1, "char glyph does not fit into target atlas bitmap");
+        std::copy(glyph_bitmap_ptr + y * glyph_width,
+                  glyph_bitmap_ptr + (y + 1) * glyph_width,
                   atlas_bitmap.begin() + atlas_index);
     }
 }
@@ -57,6 +57,7 @@ public:
     {
     public:
         Glyph(FT_Glyph ft_glyph, uint32_t face_index);
+        Glyph(Data::Bytes&& distance_field, uint32_t face_index);
         ~Glyph();
 
         Glyph(const Glyph&) noexcept = delete;
@@ -65,12 +66,14 @@ public:
         Glyph& operator=(const Glyph&) noexcept = delete;
         Glyph& operator=(Glyph&&) noexcept = default;
 
-        [[nodiscard]] FT_Glyph GetFreeTypeGlyph() const { return m_ft_glyph; }
-        [[nodiscard]] uint32_t GetFaceIndex() const     { return m_face_index; }
+        [[nodiscard]] FT_Glyph           GetFreeTypeGlyph() const { return m_ft_glyph; }
+        [[nodiscard]] const Data::Bytes& GetDistanceField() const { return m_distance_field; }
+        [[nodiscard]] uint32_t           GetFaceIndex() const     { return m_face_index; }
 
     private:
-        FT_Glyph m_ft_glyph;
-        uint32_t m_face_index;
+        FT_Glyph    m_ft_glyph = nullptr;
+        Data::Bytes m_distance_field;
+        uint32_t    m_face_index;
     };
 
     class BinPack
@@ -88,6 +91,8 @@ public:
     explicit FontChar(Code code);
     FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Point2I advance,
              FT_Glyph ft_glyph, uint32_t face_index);
+    FontChar(Code code, gfx::FrameRect rect, gfx::Point2I offset, gfx::Point2I advance,
+             Data::Bytes&& distance_field, uint32_t face_index);
 
     [[nodiscard]] Code GetCode() const noexcept
     { return m_code; }
@@ -110,16 +115,25 @@ public:
     [[nodiscard]] const gfx::FrameSize& GetVisualSize() const noexcept
     { return m_visual_size; }
 
+    // Data size of character metrics and its glyph pixels stored with one byte per pixel in atlas
+    [[nodiscard]] Data::Size GetDataSize() const noexcept
+    { return static_cast<Data::Size>(sizeof(FontChar)) + m_rect.size.GetPixelsCount(); }
+
     [[nodiscard]] friend auto operator<=>(const FontChar& left, const FontChar& right) noexcept
     { return left.m_rect.size.GetPixelsCount() <=> right.m_rect.size.GetPixelsCount(); }
 
     [[nodiscard]] explicit operator bool() const noexcept
     { return m_code != 0U; }
 
+    void SetAtlasPosition(const gfx::FramePoint& atlas_position) noexcept
+    { m_rect.origin = atlas_position; }
+
     void DrawToAtlas(Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const;
     uint32_t GetGlyphIndex() const;
 
 private:
+    void CopyGlyphRowsToAtlas(Data::ConstRawPtr glyph_bitmap_ptr, Data::Bytes& atlas_bitmap, uint32_t atlas_row_stride) const;
+
     const Code     m_code = 0U;
     const TypeMask m_type_mask{};
     gfx::FrameRect m_rect;
@@ -0,0 +1,167 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/FontGlyphCache.cpp
+Glyph cache shared by all fonts of the library with least recently used glyphs
+eviction when cached glyphs data size exceeds memory budget.
+
+******************************************************************************/
+
+#include "FontGlyphCache.h"
+#include "FontImpl.hpp"
+
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+namespace Methane::UserInterface
+{
+
+FontGlyphCache::FontGlyphCache(Data::Size budget_size)
+    : m_budget_size(budget_size)
+{ }
+
+void FontGlyphCache::SetBudgetSize(Data::Size budget_size)
+{
+    META_FUNCTION_TASK();
+    m_budget_size = budget_size;
+    EvictGlyphs(0U);
+}
+
+void FontGlyphCache::ResetStatistics() noexcept
+{
+    META_FUNCTION_TASK();
+    m_statistics.hits_count               = 0U;
+    m_statistics.misses_count             = 0U;
+    m_statistics.evicted_glyphs_count     = 0U;
+    m_statistics.reused_atlas_rects_count = 0U;
+}
+
+void FontGlyphCache::AddGlyph(Font::Impl& font, Code code, Data::Size data_size)
+{
+    META_FUNCTION_TASK();
+    const auto [glyph_by_key_it, glyph_added] = m_glyph_by_key.try_emplace(GlyphKey(&font, code), m_unpinned_glyphs.end());
+    META_CHECK_TRUE_DESCR(glyph_added, "font glyph with code {} is already cached", static_cast<uint32_t>(code));
+
+    m_unpinned_glyphs.push_front(Glyph{ &font, code, data_size });
+    glyph_by_key_it->second = m_unpinned_glyphs.begin();
+
+    m_statistics.cached_glyphs_count++;
+    m_statistics.cached_data_size += data_size;
+    m_statistics.misses_count++;
+}
+
+void FontGlyphCache::UseGlyph(const Font::Impl& font, Code code, bool is_hit_counted)
+{
+    META_FUNCTION_TASK();
+    const auto glyph_by_key_it = FindGlyph(font, code);
+    if (glyph_by_key_it == m_glyph_by_key.end())
+        return;
+
+    if (const Glyphs::iterator glyph_it = glyph_by_key_it->second;
+        !glyph_it->pins_count)
+        m_unpinned_glyphs.splice(m_unpinned_glyphs.begin(), m_unpinned_glyphs, glyph_it);
+
+    if (is_hit_counted)
+        m_statistics.hits_count++;
+}
+
+void FontGlyphCache::RemoveFontGlyphs(const Font::Impl& font)
+{
+    META_FUNCTION_TASK();
+    const auto font_glyphs_begin_it = m_glyph_by_key.lower_bound(GlyphKey(&font, Code{}));
+    auto glyph_by_key_it = font_glyphs_begin_it;
+    while (glyph_by_key_it != m_glyph_by_key.end() && glyph_by_key_it->first.first == &font)
+    {
+        RemoveGlyph(glyph_by_key_it++);
+    }
+}
+
+void FontGlyphCache::PinGlyph(const Font::Impl& font, Code code)
+{
+    META_FUNCTION_TASK();
+    const auto glyph_by_key_it = FindGlyph(font, code);
+    if (glyph_by_key_it == m_glyph_by_key.end())
+        return;
+
+    const Glyphs::iterator glyph_it = glyph_by_key_it->second;
+    if (!glyph_it->pins_count++)
+    {
+        m_pinned_glyphs.splice(m_pinned_glyphs.begin(), m_unpinned_glyphs, glyph_it);
+        m_statistics.pinned_glyphs_count++;
+    }
+}
+
+void FontGlyphCache::UnpinGlyph(const Font::Impl& font, Code code)
+{
+    META_FUNCTION_TASK();
+    const auto glyph_by_key_it = FindGlyph(font, code);
+    if (glyph_by_key_it == m_glyph_by_key.end())
+        return;
+
+    const Glyphs::iterator glyph_it = glyph_by_key_it->second;
+    META_CHECK_NOT_ZERO_DESCR(glyph_it->pins_count, "font glyph with code {} is not pinned", static_cast<uint32_t>(code));
+
+    // Unpinned glyph was in use until now, so it becomes the most recently used one
+    if (!--glyph_it->pins_count)
+    {
+        m_unpinned_glyphs.splice(m_unpinned_glyphs.begin(), m_pinned_glyphs, glyph_it);
+        m_statistics.pinned_glyphs_count--;
+    }
+}
+
+void FontGlyphCache::EvictGlyphs(Data::Size reserved_size)
+{
+    META_FUNCTION_TASK();
+    if (!m_budget_size)
+        return;
+
+    while (!m_unpinned_glyphs.empty() && m_statistics.cached_data_size + reserved_size > m_budget_size)
+    {
+        const Glyph evicted_glyph = m_unpinned_glyphs.back();
+        RemoveGlyph(FindGlyph(*evicted_glyph.font_ptr, evicted_glyph.code));
+        m_statistics.evicted_glyphs_count++;
+        evicted_glyph.font_ptr->EvictChar(evicted_glyph.code);
+    }
+}
+
+FontGlyphCache::GlyphByKey::iterator FontGlyphCache::FindGlyph(const Font::Impl& font, Code code)
+{
+    META_FUNCTION_TASK();
+    return m_glyph_by_key.find(GlyphKey(&font, code));
+}
+
+void FontGlyphCache::RemoveGlyph(GlyphByKey::iterator glyph_by_key_it)
+{
+    META_FUNCTION_TASK();
+    const Glyphs::iterator glyph_it = glyph_by_key_it->second;
+    m_statistics.cached_glyphs_count--;
+    m_statistics.cached_data_size -= glyph_it->data_size;
+
+    if (glyph_it->pins_count)
+    {
+        m_statistics.pinned_glyphs_count--;
+        m_pinned_glyphs.erase(glyph_it);
+    }
+    else
+    {
+        m_unpinned_glyphs.erase(glyph_it);
+    }
+    m_glyph_by_key.erase(glyph_by_key_it);
+}
+
+} // namespace Methane::UserInterface
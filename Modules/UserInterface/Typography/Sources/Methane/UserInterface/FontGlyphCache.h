@@ -0,0 +1,99 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/FontGlyphCache.h
+Glyph cache shared by all fonts of the library with least recently used glyphs
+eviction when cached glyphs data size exceeds memory budget.
+
+******************************************************************************/
+
+#pragma once
+
+#include "FontChar.h"
+
+#include <Methane/UserInterface/FontLibrary.h>
+
+#include <list>
+#include <map>
+#include <utility>
+
+namespace Methane::UserInterface
+{
+
+class FontGlyphCache
+{
+public:
+    using Statistics = FontGlyphCacheStatistics;
+    using Code       = FontChar::Code;
+
+    explicit FontGlyphCache(Data::Size budget_size);
+
+    FontGlyphCache(const FontGlyphCache&) = delete;
+    FontGlyphCache(FontGlyphCache&&) = delete;
+
+    FontGlyphCache& operator=(const FontGlyphCache&) = delete;
+    FontGlyphCache& operator=(FontGlyphCache&&) = delete;
+
+    [[nodiscard]] Data::Size        GetBudgetSize() const noexcept { return m_budget_size; }
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept { return m_statistics; }
+
+    // Zero budget size is unlimited, otherwise least recently used glyphs are evicted to fit in the new budget
+    void SetBudgetSize(Data::Size budget_size);
+    void ResetStatistics() noexcept;
+
+    // Glyph added to the font is most recently used and counted as cache miss,
+    // while use of already added glyph moves it to the front of the recently used glyphs and is counted as cache hit,
+    // unless it was counted already by the lookup of the same glyph in the same text update
+    void AddGlyph(Font::Impl& font, Code code, Data::Size data_size);
+    void UseGlyph(const Font::Impl& font, Code code, bool is_hit_counted = true);
+    void RemoveFontGlyphs(const Font::Impl& font);
+
+    // Pinned glyphs are used by the text meshes and can not be evicted until unpinned as many times as pinned
+    void PinGlyph(const Font::Impl& font, Code code);
+    void UnpinGlyph(const Font::Impl& font, Code code);
+
+    // Least recently used glyphs, which are not pinned, are evicted from their fonts until reserved data size
+    // fits in the budget along with cached glyphs, so budget may be exceeded only when all glyphs are pinned
+    void EvictGlyphs(Data::Size reserved_size);
+
+    void AddReusedAtlasRect() noexcept { m_statistics.reused_atlas_rects_count++; }
+
+private:
+    struct Glyph
+    {
+        Font::Impl* font_ptr;
+        Code        code;
+        Data::Size  data_size;
+        uint32_t    pins_count = 0U;
+    };
+
+    using Glyphs      = std::list<Glyph>; // ordered from the most to the least recently used glyph
+    using GlyphKey    = std::pair<const Font::Impl*, Code>;
+    using GlyphByKey  = std::map<GlyphKey, Glyphs::iterator>;
+
+    [[nodiscard]] GlyphByKey::iterator FindGlyph(const Font::Impl& font, Code code);
+    void RemoveGlyph(GlyphByKey::iterator glyph_by_key_it);
+
+    Data::Size m_budget_size;
+    Glyphs     m_unpinned_glyphs;
+    Glyphs     m_pinned_glyphs;
+    GlyphByKey m_glyph_by_key;
+    Statistics m_statistics;
+};
+
+} // namespace Methane::UserInterface
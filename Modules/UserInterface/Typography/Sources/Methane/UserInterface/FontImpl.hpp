@@ -24,20 +24,32 @@ Font implementation.
 #pragma once
 
 #include "FontChar.h"
+#include "FontGlyphCache.h"
 
 #include <Methane/UserInterface/Font.h>
 #include <Methane/UserInterface/FontLibrary.h>
 #include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/Device.h>
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/IFence.h>
 #include <Methane/Graphics/RHI/Texture.h>
 #include <Methane/Graphics/Rect.hpp>
 #include <Methane/Data/IProvider.h>
 #include <Methane/Data/Emitter.hpp>
+#include <Methane/Data/RangeSet.hpp>
+
+#include <taskflow/taskflow.hpp>
 
 #include <map>
+#include <set>
 #include <string>
+#include <optional>
+#include <exception>
 #include <ranges>
+#include <algorithm>
+#include <future>
+#include <chrono>
 #include <cctype>
 #include <cassert>
 
@@ -57,24 +69,56 @@ inline void ThrowFreeTypeError(FT_Error error)
         throw FreeTypeError(error);
 }
 
+// Integer division with rounding to negative infinity for positive denominator
+constexpr int32_t DivideFloor(int32_t numerator, int32_t denominator) noexcept
+{
+    const int32_t quotient = numerator / denominator;
+    return quotient * denominator > numerator ? quotient - 1 : quotient;
+}
+
+// Integer division with rounding to positive infinity for positive denominator
+constexpr int32_t DivideCeil(int32_t numerator, int32_t denominator) noexcept
+{
+    return -DivideFloor(-numerator, denominator);
+}
+
 class Font::Impl // NOSONAR - class destructor is required, class has more than 35 methods
   : public Data::Emitter<IFontCallback>
   , protected Data::Receiver<rhi::IContextCallback> //NOSONAR
 {
-    struct AtlasTexture
-    {
-        rhi::Texture texture;
-        bool is_update_required = true;
-    };
-
     using Description = FontDescription;
     using Settings    = FontSettings;
     using Library     = FontLibrary;
     using Char        = FontChar;
     using CharBinPack = FontChar::BinPack;
     using Chars       = Refs<const Char>;
-    using TextureByContext = std::map<rhi::RenderContext, AtlasTexture>;
-    using CharByCode = std::map<Char::Code, Char>;
+    using CharByCode  = std::map<Char::Code, Char>;
+    using AtlasRows   = Data::RangeSet<uint32_t>;
+
+    using RenderContexts = std::set<rhi::RenderContext>;
+
+    // Atlas texture is shared by all render contexts created on the same device,
+    // while atlas data is uploaded to texture only by the render context which has created it,
+    // so other contexts make their render queues wait for the upload fence of the owner context before using it
+    struct AtlasTexture
+    {
+        rhi::RenderContext owner_context;
+        rhi::Texture       texture;
+        bool               is_update_required = true; // full atlas upload is required
+        AtlasRows          dirty_rows;                // rows of atlas with new glyphs, which were not uploaded yet
+        RenderContexts     unsynced_contexts;         // sharing contexts which did not wait for the last upload yet
+    };
+
+    // Result of asynchronous atlas repack made with copies of font characters
+    struct AtlasRepack
+    {
+        UniquePtr<CharBinPack>                 pack_ptr;
+        Data::Bytes                            bitmap;
+        std::map<Char::Code, gfx::FrameRect>   char_rects;
+    };
+
+    using TextureByDevice = std::map<rhi::Device, AtlasTexture>;
+    using DeviceByContext = std::map<rhi::RenderContext, rhi::Device>;
 
     class Face // NOSONAR - custom destructor is required
     {
@@ -98,11 +142,16 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
         Face& operator=(const Face&) noexcept = delete;
         Face& operator=(Face&&) noexcept = delete;
 
-        void SetSize(uint32_t font_size_pt, uint32_t resolution_dpi)
+        void SetSize(uint32_t font_size_pt, uint32_t resolution_dpi, uint32_t supersampling = 1U)
         {
             META_FUNCTION_TASK();
+            META_CHECK_NOT_ZERO(supersampling);
+
+            // Glyphs are rendered with supersampled size, while all metrics are returned in pixels of the requested size
+            m_dots_in_pixel = s_ft_dots_in_pixel * static_cast<int32_t>(supersampling);
+
             // 0 values mean that vertical value is equal to horizontal value
-            ThrowFreeTypeError(FT_Set_Char_Size(m_ft_face, font_size_pt * s_ft_dots_in_pixel, 0, resolution_dpi, 0));
+            ThrowFreeTypeError(FT_Set_Char_Size(m_ft_face, font_size_pt * m_dots_in_pixel, 0, resolution_dpi, 0));
         }
 
         uint32_t GetCharIndex(Char::Code char_code)
@@ -114,28 +163,58 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
         Char LoadChar(Char::Code char_code)
         {
             META_FUNCTION_TASK();
-
-            uint32_t char_index = GetCharIndex(char_code);
-            META_CHECK_NOT_ZERO_DESCR(char_index, "unicode character U+{} does not exist in font face", static_cast<uint32_t>(char_code));
-
-            ThrowFreeTypeError(FT_Load_Glyph(m_ft_face, char_index, FT_LOAD_RENDER));
-            META_CHECK_NOT_NULL_DESCR(m_ft_face_rec.glyph, "glyph should not be null after loading from font face");
+            const FT_GlyphSlot ft_glyph_slot = LoadGlyph(char_code);
 
             FT_Glyph ft_glyph = nullptr;
-            ThrowFreeTypeError(FT_Get_Glyph(m_ft_face_rec.glyph, &ft_glyph));
+            ThrowFreeTypeError(FT_Get_Glyph(ft_glyph_slot, &ft_glyph));
 
             // All glyph metrics are multiplied by 64, so we reverse them back
             return Char(char_code,
                 {
                     gfx::Point2I(),
-                    gfx::FrameSize(static_cast<uint32_t>(m_ft_face_rec.glyph->metrics.width  / s_ft_dots_in_pixel),
-                                   static_cast<uint32_t>(m_ft_face_rec.glyph->metrics.height / s_ft_dots_in_pixel))
+                    gfx::FrameSize(static_cast<uint32_t>(ft_glyph_slot->metrics.width  / m_dots_in_pixel),
+                                   static_cast<uint32_t>(ft_glyph_slot->metrics.height / m_dots_in_pixel))
                 },
-                gfx::Point2I(static_cast<int32_t>(m_ft_face_rec.glyph->metrics.horiBearingX  / s_ft_dots_in_pixel),
-                             -static_cast<int32_t>(m_ft_face_rec.glyph->metrics.horiBearingY  / s_ft_dots_in_pixel)),
-                gfx::Point2I(static_cast<int32_t>(m_ft_face_rec.glyph->metrics.horiAdvance   / s_ft_dots_in_pixel),
-                             static_cast<int32_t>(m_ft_face_rec.glyph->metrics.vertAdvance   / s_ft_dots_in_pixel)),
-                ft_glyph, char_index
+                gfx::Point2I(static_cast<int32_t>(ft_glyph_slot->metrics.horiBearingX  / m_dots_in_pixel),
+                             -static_cast<int32_t>(ft_glyph_slot->metrics.horiBearingY  / m_dots_in_pixel)),
+                GetGlyphAdvance(*ft_glyph_slot),
+                ft_glyph, ft_glyph_slot->glyph_index
+            );
+        }
+
+        Char LoadDistanceFieldChar(Char::Code char_code, const DistanceFieldSettings& distance_field_settings)
+        {
+            META_FUNCTION_TASK();
+            const FT_GlyphSlot ft_glyph_slot = LoadGlyph(char_code);
+            const FT_Bitmap&   ft_bitmap     = ft_glyph_slot->bitmap;
+
+            // Supersampled coverage bitmap is aligned with distance field pixels grid,
+            // so that glyph offset is integer in pixels of the requested font size
+            const auto    supersampling = static_cast<int32_t>(distance_field_settings.supersampling);
+            const auto    spread        = static_cast<int32_t>(distance_field_settings.spread);
+            const int32_t glyph_left    = DivideFloor(ft_glyph_slot->bitmap_left, supersampling);
+            const int32_t glyph_top     = DivideCeil(ft_glyph_slot->bitmap_top, supersampling);
+            const gfx::FramePoint coverage_offset(ft_glyph_slot->bitmap_left - glyph_left * supersampling,
+                                                  glyph_top * supersampling - ft_glyph_slot->bitmap_top);
+            const gfx::FrameSize  coverage_size(ft_bitmap.width, ft_bitmap.rows);
+
+            Data::Bytes coverage_bitmap(coverage_size.GetPixelsCount());
+            for(uint32_t y = 0; y < ft_bitmap.rows; ++y)
+            {
+                const auto* ft_row_ptr = reinterpret_cast<Data::ConstRawPtr>(ft_bitmap.buffer + static_cast<ptrdiff_t>(y) * std::abs(ft_bitmap.pitch)); // NOSONAR
+                std::copy(ft_row_ptr, ft_row_ptr + ft_bitmap.width, coverage_bitmap.begin() + y * ft_bitmap.width);
+            }
+
+            // Distance field is extended with spread margins from each side of the glyph
+            const gfx::FrameSize distance_field_size = GetSignedDistanceFieldSize(coverage_size, coverage_offset, distance_field_settings);
+            return Char(char_code,
+                { gfx::Point2I(), distance_field_size },
+                distance_field_size
+                    ? gfx::Point2I(glyph_left - spread, -(glyph_top + spread))
+                    : gfx::Point2I(),
+                GetGlyphAdvance(*ft_glyph_slot),
+                GenerateSignedDistanceField(coverage_bitmap, coverage_size, coverage_offset, distance_field_settings),
+                ft_glyph_slot->glyph_index
             );
         }
 
@@ -150,14 +229,14 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
 
             FT_Vector kerning_vec{};
             ThrowFreeTypeError(FT_Get_Kerning(m_ft_face, left_glyph_index, right_glyph_index, FT_KERNING_DEFAULT, &kerning_vec));
-            return gfx::FramePoint(static_cast<int>(kerning_vec.x >> 6), 0);
+            return gfx::FramePoint(static_cast<int>(kerning_vec.x / m_dots_in_pixel), 0);
         }
 
         uint32_t GetLineHeight() const
         {
             META_FUNCTION_TASK();
             META_CHECK_NOT_NULL(m_ft_face_rec.size);
-            return static_cast<uint32_t>(m_ft_face_rec.size->metrics.height / s_ft_dots_in_pixel);
+            return static_cast<uint32_t>(m_ft_face_rec.size->metrics.height / m_dots_in_pixel);
         }
 
         const FT_FaceRec& GetFaceRec() const
@@ -167,7 +246,29 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
             return *m_ft_face;
         }
 
+        const Data::Chunk& GetFontData() const noexcept
+        {
+            return m_font_data;
+        }
+
     private:
+        FT_GlyphSlot LoadGlyph(Char::Code char_code)
+        {
+            META_FUNCTION_TASK();
+            const uint32_t char_index = GetCharIndex(char_code);
+            META_CHECK_NOT_ZERO_DESCR(char_index, "unicode character U+{} does not exist in font face", static_cast<uint32_t>(char_code));
+
+            ThrowFreeTypeError(FT_Load_Glyph(m_ft_face, char_index, FT_LOAD_RENDER));
+            META_CHECK_NOT_NULL_DESCR(m_ft_face_rec.glyph, "glyph should not be null after loading from font face");
+            return m_ft_face_rec.glyph;
+        }
+
+        gfx::Point2I GetGlyphAdvance(const FT_GlyphSlotRec& ft_glyph_slot) const
+        {
+            return gfx::Point2I(static_cast<int32_t>(ft_glyph_slot.metrics.horiAdvance / m_dots_in_pixel),
+                                static_cast<int32_t>(ft_glyph_slot.metrics.vertAdvance / m_dots_in_pixel));
+        }
+
         static FT_Face LoadFace(FT_Library ft_library, const Data::Chunk& font_data)
         {
             META_FUNCTION_TASK();
@@ -185,30 +286,38 @@ class Font::Impl // NOSONAR - class destructor is required, class has more than
         const FT_Face     m_ft_face = nullptr;
         const FT_FaceRec& m_ft_face_rec;
         const bool        m_has_kerning;
+        int32_t           m_dots_in_pixel = s_ft_dots_in_pixel;
     };
 
-    Library                m_font_lib;
-    Font&                  m_font;
-    Settings               m_settings;
-    Face                   m_face;
-    UniquePtr<CharBinPack> m_atlas_pack_ptr;
-    CharByCode             m_char_by_code;
-    Data::Bytes            m_atlas_bitmap;
-    TextureByContext       m_atlas_textures;
-    gfx::FrameSize         m_max_glyph_size;
-
-    static constexpr int32_t s_ft_dots_in_pixel = 64; // Freetype measures all font sizes in 1/64ths of pixels
+    Library                      m_font_lib;
+    FontGlyphCache&              m_glyph_cache; // shared by all fonts of the library, which outlives the font
+    Font&                        m_font;
+    Settings                     m_settings;
+    Face                         m_face;
+    std::vector<UniquePtr<Face>> m_worker_faces; // FreeType faces can not be shared between threads, so each parallel worker has its own face
+    UniquePtr<CharBinPack>       m_atlas_pack_ptr;
+    CharByCode                   m_char_by_code;
+    Data::Bytes                  m_atlas_bitmap;
+    TextureByDevice              m_atlas_textures;
+    DeviceByContext              m_atlas_devices;
+    gfx::FrameSize               m_max_glyph_size;
+    std::future<AtlasRepack>     m_atlas_repack_future;
+    uint32_t                     m_chars_version = 0U; // incremented on characters reset, when references to previous font characters become invalid
+
+    static constexpr int32_t s_ft_dots_in_pixel = 64;        // Freetype measures all font sizes in 1/64ths of pixels
+    static constexpr size_t  s_parallel_chars_min_count = 32; // minimum number of added characters to rasterize their glyphs in parallel
 
 public:
 
     Impl(const Library& font_lib, Font& font, const Data::IProvider& data_provider, const Settings& settings)
         : m_font_lib(font_lib)
+        , m_glyph_cache(font_lib.GetGlyphCache())
         , m_font(font)
         , m_settings(settings)
         , m_face(font_lib, data_provider.GetData(m_settings.description.path))
     {
         META_FUNCTION_TASK();
-        m_face.SetSize(m_settings.description.size_pt, m_settings.resolution_dpi);
+        SetFaceSize(m_face);
         AddChars(m_settings.characters);
     }
 
@@ -217,7 +326,9 @@ public:
         META_FUNCTION_TASK();
         try
         {
+            CancelAtlasRepack();
             ClearAtlasTextures();
+            m_glyph_cache.RemoveFontGlyphs(*this);
         }
         catch(const std::exception& e)
         {
@@ -242,6 +353,16 @@ public:
         return m_max_glyph_size;
     }
 
+    [[nodiscard]] uint32_t GetCharsVersion() const noexcept
+    {
+        return m_chars_version;
+    }
+
+    [[nodiscard]] bool IsDistanceField() const noexcept
+    {
+        return m_settings.glyph_mode == FontGlyphMode::DistanceField;
+    }
+
     void ResetChars(const std::string& utf8_characters)
     {
         META_FUNCTION_TASK();
@@ -251,13 +372,16 @@ public:
     void ResetChars(const std::u32string& utf32_characters)
     {
         META_FUNCTION_TASK();
+        CancelAtlasRepack();
         m_atlas_pack_ptr.reset();
         m_char_by_code.clear();
+        m_glyph_cache.RemoveFontGlyphs(*this);
         m_atlas_bitmap.clear();
+        m_chars_version++;
 
         if (utf32_characters.empty())
         {
-            for(const auto& [context_ptr, atlas_texture] : m_atlas_textures)
+            for(const auto& [device, atlas_texture] : m_atlas_textures)
             {
                 Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, &atlas_texture.texture, nullptr);
             }
@@ -267,7 +391,7 @@ public:
 
         AddChars(utf32_characters);
         PackCharsToAtlas(1.2F);
-        UpdateAtlasBitmap(false);
+        UpdateAtlasBitmap(false, true);
     }
 
     void AddChars(const std::string& utf8_characters)
@@ -279,46 +403,97 @@ public:
     void AddChars(const std::u32string& utf32_characters)
     {
         META_FUNCTION_TASK();
+        std::set<Char::Code> new_char_codes;
+        std::set<Char::Code> used_char_codes;
         for (Char::Code char_code : utf32_characters)
         {
             if (!char_code)
                 break;
 
             if (HasChar(char_code))
-                continue;
+                used_char_codes.insert(char_code);
+            else
+                new_char_codes.insert(char_code);
+        }
+
+        // Every distinct character is looked up in glyph cache once, no matter how many times it is repeated in text
+        for (Char::Code char_code : used_char_codes)
+        {
+            m_glyph_cache.UseGlyph(*this, char_code);
+        }
+        if (new_char_codes.empty())
+            return;
+
+        // Glyphs of all new chars are loaded before adding them to the font,
+        // so that atlas is packed once for all of them instead of repacking it for each char
+        std::vector<Char> new_chars = LoadChars(new_char_codes);
 
-            AddChar(char_code);
+        // Already added chars requested along with the new chars are pinned while evicting glyphs for the new chars,
+        // so that none of the requested chars is evicted even if they do not fit in glyph cache budget all together
+        for (Char::Code char_code : used_char_codes)
+        {
+            m_glyph_cache.PinGlyph(*this, char_code);
         }
+        EvictCharsForNew(new_chars);
+        for (Char::Code char_code : used_char_codes)
+        {
+            m_glyph_cache.UnpinGlyph(*this, char_code);
+        }
+
+        Refs<Char> new_font_chars;
+        new_font_chars.reserve(new_chars.size());
+        for(Char& new_char : new_chars)
+        {
+            new_font_chars.emplace_back(AddLoadedChar(std::move(new_char)));
+        }
+        PlaceCharsToAtlas(new_font_chars);
     }
 
-    const FontChar& AddChar(Char::Code char_code)
+    // Character lookup is not counted as glyph cache hit when it was counted already by adding chars of the whole text
+    const FontChar& AddChar(Char::Code char_code, bool is_cache_hit_counted = true)
     {
         META_FUNCTION_TASK();
         if (const Char& font_char = GetChar(char_code); font_char)
+        {
+            m_glyph_cache.UseGlyph(*this, char_code, is_cache_hit_counted);
             return font_char;
+        }
 
-        // Load char glyph and add it to the font characters map
-        const auto font_char_it = m_char_by_code.try_emplace(char_code, m_face.LoadChar(char_code)).first;
-        META_CHECK_DESCR(static_cast<uint32_t>(char_code), font_char_it != m_char_by_code.end(), "font character was not added to character map");
+        std::vector<Char> new_chars;
+        new_chars.emplace_back(LoadChar(m_face, char_code));
+        EvictCharsForNew(new_chars);
 
-        Char& new_font_char = font_char_it->second;
-        m_max_glyph_size.SetWidth( std::max(m_max_glyph_size.GetWidth(),  new_font_char.GetRect().size.GetWidth()));
-        m_max_glyph_size.SetHeight(std::max(m_max_glyph_size.GetHeight(), new_font_char.GetRect().size.GetHeight()));
+        Char& new_font_char = AddLoadedChar(std::move(new_chars.front()));
+        PlaceCharsToAtlas({ new_font_char });
+        return new_font_char;
+    }
 
-        // Attempt to pack new char into existing atlas
-        if (m_atlas_pack_ptr && m_atlas_pack_ptr->TryPack(new_font_char))
-        {
-            // Draw char to existing atlas bitmap and update textures
-            new_font_char.DrawToAtlas(m_atlas_bitmap, m_atlas_pack_ptr->GetSize().GetWidth());
-            UpdateAtlasTextures(true);
-            return new_font_char;
-        }
+    // Pinned characters are used by text meshes, so they are not evicted from font by glyph cache
+    void PinChar(const Char& font_char)
+    {
+        META_FUNCTION_TASK();
+        m_glyph_cache.PinGlyph(*this, font_char.GetCode());
+    }
 
-        // If new char does not fit into existing atlas, repack all chars into new atlas
-        PackCharsToAtlas(2.F);
-        UpdateAtlasBitmap(true);
+    void UnpinChar(const Char& font_char)
+    {
+        META_FUNCTION_TASK();
+        m_glyph_cache.UnpinGlyph(*this, font_char.GetCode());
+    }
 
-        return new_font_char;
+    // Atlas space of evicted character is released for new characters without atlas repack,
+    // while space of characters evicted during pending repack is released on its completion
+    void EvictChar(Char::Code char_code)
+    {
+        META_FUNCTION_TASK();
+        const auto char_by_code_it = m_char_by_code.find(char_code);
+        if (char_by_code_it == m_char_by_code.end())
+            return;
+
+        if (m_atlas_pack_ptr && !IsAtlasRepackPending())
+            ReleaseAtlasRect(char_by_code_it->second.GetRect());
+
+        m_char_by_code.erase(char_by_code_it);
     }
 
     [[nodiscard]] bool HasChar(Char::Code char_code) const
@@ -396,7 +571,9 @@ public:
         META_FUNCTION_TASK();
         META_CHECK_TRUE(context.IsInitialized());
 
-        if (const auto atlas_texture_it = m_atlas_textures.find(context);
+        // Atlas texture created by another render context on the same device is shared with this context
+        const rhi::Device& device = AddAtlasContext(context);
+        if (const auto atlas_texture_it = m_atlas_textures.find(device);
             atlas_texture_it != m_atlas_textures.end())
         {
             META_CHECK_TRUE(atlas_texture_it->second.texture.IsInitialized());
@@ -411,13 +588,10 @@ public:
         if (!m_atlas_pack_ptr && !PackCharsToAtlas(1.2F))
             return uninitialized_texture;
 
-        // Add font as context callback to remove atlas texture when context is released
-        static_cast<Data::IEmitter<IContextCallback>&>(context.GetInterface()).Connect(*this);
-
         // Create atlas texture and render glyphs to it
-        UpdateAtlasBitmap(true);
+        UpdateAtlasBitmap(true, false);
 
-        const rhi::Texture& atlas_texture = m_atlas_textures.try_emplace(context, CreateAtlasTexture(context, true)).first->second.texture;
+        const rhi::Texture& atlas_texture = m_atlas_textures.try_emplace(device, CreateAtlasTexture(context, true)).first->second.texture;
         Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, nullptr, &atlas_texture);
 
         return atlas_texture;
@@ -426,25 +600,285 @@ public:
     void RemoveAtlasTexture(const rhi::RenderContext& render_context)
     {
         META_FUNCTION_TASK();
-        m_atlas_textures.erase(render_context);
+        const auto atlas_device_it = m_atlas_devices.find(render_context);
+        if (atlas_device_it == m_atlas_devices.end())
+            return;
+
+        const rhi::Device device = atlas_device_it->second;
+        m_atlas_devices.erase(atlas_device_it);
         static_cast<Data::IEmitter<IContextCallback>&>(render_context.GetInterface()).Disconnect(*this);
+
+        const auto atlas_texture_it = m_atlas_textures.find(device);
+        if (atlas_texture_it == m_atlas_textures.end())
+            return;
+
+        atlas_texture_it->second.unsynced_contexts.erase(render_context);
+        if (atlas_texture_it->second.owner_context != render_context)
+            return;
+
+        // Texture of the removed context can not be used anymore,
+        // so it is recreated with another render context sharing it on the same device
+        const auto other_context_it = std::ranges::find_if(m_atlas_devices,
+            [&device](const auto& context_and_device) { return context_and_device.second == device; });
+        if (other_context_it == m_atlas_devices.end())
+        {
+            m_atlas_textures.erase(atlas_texture_it);
+            return;
+        }
+
+        const rhi::Texture old_texture = atlas_texture_it->second.texture;
+        atlas_texture_it->second = CreateAtlasTexture(other_context_it->first, true);
+        Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, &old_texture, &atlas_texture_it->second.texture);
     }
 
-    void ClearAtlasTextures()
+    [[nodiscard]] bool IsAtlasRepackPending() const noexcept
+    {
+        return m_atlas_repack_future.valid();
+    }
+
+    bool CompleteAtlasRepack(bool wait_for_completion)
     {
         META_FUNCTION_TASK();
-        for(const auto& [context, atlas_texture] : m_atlas_textures)
+        if (!IsAtlasRepackPending())
+            return false;
+
+        if (!wait_for_completion &&
+            m_atlas_repack_future.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+            return false;
+
+        AtlasRepack atlas_repack = m_atlas_repack_future.get();
+        m_atlas_pack_ptr = std::move(atlas_repack.pack_ptr);
+        m_atlas_bitmap   = std::move(atlas_repack.bitmap);
+
+        // Space of characters evicted during asynchronous repack is released in the new atlas
+        for(const auto& [char_code, char_rect] : atlas_repack.char_rects)
+        {
+            if (!m_char_by_code.contains(char_code))
+                ReleaseAtlasRect(char_rect);
+        }
+
+        // Characters added during asynchronous repack are packed into reserved space of the new atlas
+        const uint32_t atlas_width = m_atlas_pack_ptr->GetSize().GetWidth();
+        bool are_all_chars_packed = true;
+        for(auto& [char_code, font_char] : m_char_by_code)
         {
-            if (!context.IsInitialized())
+            if (const auto char_rect_it = atlas_repack.char_rects.find(char_code);
+                char_rect_it != atlas_repack.char_rects.end())
+            {
+                font_char.SetAtlasPosition(char_rect_it->second.origin);
                 continue;
+            }
+            if (are_all_chars_packed && m_atlas_pack_ptr->TryPack(font_char))
+                font_char.DrawToAtlas(m_atlas_bitmap, atlas_width);
+            else
+                are_all_chars_packed = false;
+        }
+
+        // Character positions have changed, so atlas textures are recreated even if atlas size is the same
+        ResetAtlasTextures();
+
+        if (!are_all_chars_packed)
+            StartAtlasRepack(2.F);
 
-            static_cast<Data::IEmitter<IContextCallback>&>(context.GetInterface()).Disconnect(*this);
+        return true;
+    }
+
+    void ClearAtlasTextures()
+    {
+        META_FUNCTION_TASK();
+        for(const auto& [context, device] : m_atlas_devices)
+        {
+            if (context.IsInitialized())
+                static_cast<Data::IEmitter<IContextCallback>&>(context.GetInterface()).Disconnect(*this);
+        }
+        for(const auto& [device, atlas_texture] : m_atlas_textures)
+        {
             Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, &atlas_texture.texture, nullptr);
         }
+        m_atlas_devices.clear();
         m_atlas_textures.clear();
     }
 
 private:
+    void SetFaceSize(Face& face) const
+    {
+        META_FUNCTION_TASK();
+        face.SetSize(m_settings.description.size_pt, m_settings.resolution_dpi,
+                     IsDistanceField() ? m_settings.distance_field.supersampling : 1U);
+    }
+
+    Char LoadChar(Face& face, Char::Code char_code) const
+    {
+        META_FUNCTION_TASK();
+        return IsDistanceField()
+             ? face.LoadDistanceFieldChar(char_code, m_settings.distance_field)
+             : face.LoadChar(char_code);
+    }
+
+    std::vector<Char> LoadChars(const std::set<Char::Code>& char_codes)
+    {
+        META_FUNCTION_TASK();
+        std::vector<Char> font_chars;
+        font_chars.reserve(char_codes.size());
+
+        // Glyphs are rasterized on the calling thread when parallel executor is not available,
+        // or when glyphs are loaded from the executor task, which should not wait for other tasks
+        tf::Executor* parallel_executor_ptr = m_font_lib.GetParallelExecutor();
+        if (!parallel_executor_ptr || char_codes.size() < s_parallel_chars_min_count ||
+            parallel_executor_ptr->num_workers() < 2U || parallel_executor_ptr->this_worker_id() >= 0)
+        {
+            for(Char::Code char_code : char_codes)
+            {
+                font_chars.emplace_back(LoadChar(m_face, char_code));
+            }
+            return font_chars;
+        }
+
+        // FreeType library is not thread-safe for faces creation, so worker faces are created on the calling thread
+        const size_t workers_count = parallel_executor_ptr->num_workers();
+        while(m_worker_faces.size() < workers_count)
+        {
+            const Data::Chunk& font_data = m_face.GetFontData();
+            const UniquePtr<Face>& worker_face_ptr = m_worker_faces.emplace_back(
+                std::make_unique<Face>(m_font_lib, Data::Chunk(font_data.GetDataPtr(), font_data.GetDataSize())));
+            SetFaceSize(*worker_face_ptr);
+        }
+
+        const std::vector<Char::Code> char_codes_vector(char_codes.begin(), char_codes.end());
+        std::vector<std::optional<Char>>  loaded_chars(char_codes_vector.size());
+        std::vector<std::exception_ptr>   load_exceptions(char_codes_vector.size());
+
+        tf::Taskflow load_task_flow;
+        load_task_flow.for_each_index(size_t{ 0 }, char_codes_vector.size(), size_t{ 1 },
+            [this, parallel_executor_ptr, &char_codes_vector, &loaded_chars, &load_exceptions](const size_t char_index)
+            {
+                META_FUNCTION_TASK();
+                try
+                {
+                    Face& worker_face = *m_worker_faces[static_cast<size_t>(parallel_executor_ptr->this_worker_id())];
+                    loaded_chars[char_index].emplace(LoadChar(worker_face, char_codes_vector[char_index]));
+                }
+                catch(...)
+                {
+                    load_exceptions[char_index] = std::current_exception();
+                }
+            }
+        );
+        parallel_executor_ptr->run(load_task_flow).get();
+
+        // Exception of the first failed character is re-thrown as if characters were loaded one by one
+        for(size_t char_index = 0; char_index < loaded_chars.size(); ++char_index)
+        {
+            if (load_exceptions[char_index])
+                std::rethrow_exception(load_exceptions[char_index]);
+
+            font_chars.emplace_back(std::move(*loaded_chars[char_index]));
+        }
+        return font_chars;
+    }
+
+    Char& AddLoadedChar(Char&& loaded_char)
+    {
+        META_FUNCTION_TASK();
+        const Char::Code char_code = loaded_char.GetCode();
+        const auto font_char_it = m_char_by_code.try_emplace(char_code, std::move(loaded_char)).first;
+        META_CHECK_DESCR(static_cast<uint32_t>(char_code), font_char_it != m_char_by_code.end(), "font character was not added to character map");
+
+        Char& new_font_char = font_char_it->second;
+        m_max_glyph_size.SetWidth( std::max(m_max_glyph_size.GetWidth(),  new_font_char.GetRect().size.GetWidth()));
+        m_max_glyph_size.SetHeight(std::max(m_max_glyph_size.GetHeight(), new_font_char.GetRect().size.GetHeight()));
+        m_glyph_cache.AddGlyph(*this, char_code, new_font_char.GetDataSize());
+        return new_font_char;
+    }
+
+    // Glyphs of new characters are loaded before eviction of least recently used glyphs to know their data size,
+    // while new characters are not added to the font yet and can not be evicted
+    void EvictCharsForNew(const std::vector<Char>& new_chars)
+    {
+        META_FUNCTION_TASK();
+        Data::Size new_chars_data_size = 0U;
+        for(const Char& new_char : new_chars)
+        {
+            new_chars_data_size += new_char.GetDataSize();
+        }
+        m_glyph_cache.EvictGlyphs(new_chars_data_size);
+    }
+
+    void ReleaseAtlasRect(const gfx::FrameRect& char_rect)
+    {
+        META_FUNCTION_TASK();
+        if (!m_atlas_pack_ptr->Release(char_rect))
+            return;
+
+        // Released glyph pixels are cleared only in atlas bitmap, since they are not used by any text,
+        // and are uploaded to atlas textures along with rows of the new glyph reusing this space
+        const gfx::FrameSize& atlas_size = m_atlas_pack_ptr->GetSize();
+        if (m_atlas_bitmap.size() != atlas_size.GetPixelsCount())
+            return;
+
+        for(auto row = static_cast<uint32_t>(char_rect.GetTop()); row < static_cast<uint32_t>(char_rect.GetBottom()); ++row)
+        {
+            const auto row_begin_it = m_atlas_bitmap.begin() + static_cast<ptrdiff_t>(row * atlas_size.GetWidth() + static_cast<uint32_t>(char_rect.GetLeft()));
+            std::fill_n(row_begin_it, char_rect.size.GetWidth(), Data::Byte{});
+        }
+    }
+
+    void PlaceCharsToAtlas(const Refs<Char>& new_font_chars)
+    {
+        META_FUNCTION_TASK();
+
+        // New chars are placed to the atlas when pending repack is completed
+        if (IsAtlasRepackPending())
+        {
+            CompleteAtlasRepack(false);
+            return;
+        }
+
+        // Attempt to pack new chars into existing atlas
+        bool are_all_chars_packed = !!m_atlas_pack_ptr;
+        for(Char& new_font_char : new_font_chars)
+        {
+            const size_t released_rects_count = m_atlas_pack_ptr ? m_atlas_pack_ptr->GetReleasedRectsCount() : 0U;
+            if (!are_all_chars_packed || !m_atlas_pack_ptr->TryPack(new_font_char))
+            {
+                are_all_chars_packed = false;
+                break;
+            }
+            if (m_atlas_pack_ptr->GetReleasedRectsCount() < released_rects_count)
+                m_glyph_cache.AddReusedAtlasRect();
+
+            // Draw only the new char to reserved space of atlas bitmap and upload only its rows to textures
+            new_font_char.DrawToAtlas(m_atlas_bitmap, m_atlas_pack_ptr->GetSize().GetWidth());
+            AddAtlasDirtyRows(new_font_char.GetRect());
+        }
+        if (are_all_chars_packed)
+            return;
+
+        // If new chars do not fit into existing atlas, repack all chars into new atlas:
+        // asynchronously when atlas textures are in use, otherwise there is nothing to stall
+        if (m_atlas_textures.empty())
+        {
+            PackCharsToAtlas(2.F);
+            UpdateAtlasBitmap(true, true);
+        }
+        else
+        {
+            StartAtlasRepack(2.F);
+        }
+    }
+
+    const rhi::Device& AddAtlasContext(const rhi::RenderContext& context)
+    {
+        META_FUNCTION_TASK();
+        if (const auto atlas_device_it = m_atlas_devices.find(context);
+            atlas_device_it != m_atlas_devices.end())
+            return atlas_device_it->second;
+
+        // Add font as context callback to remove atlas texture when context is released
+        static_cast<Data::IEmitter<IContextCallback>&>(context.GetInterface()).Connect(*this);
+        return m_atlas_devices.try_emplace(context, context.GetDevice()).first->second;
+    }
+
     Refs<FontChar> GetMutableChars()
     {
         META_FUNCTION_TASK();
@@ -465,6 +899,14 @@ private:
         if (font_chars.empty())
             return false;
 
+        m_atlas_pack_ptr = PackChars(font_chars, pixels_reserve_multiplier);
+        return true;
+    }
+
+    static UniquePtr<CharBinPack> PackChars(Refs<Char>& font_chars, float pixels_reserve_multiplier)
+    {
+        META_FUNCTION_TASK();
+
         // Sort chars by decreasing of glyph pixels count from largest to smallest
         std::ranges::sort(font_chars,
             [](Ref<Char> left, Ref<Char> right)
@@ -482,13 +924,64 @@ private:
 
         // Pack all character glyphs intro atlas size with doubling the size until all chars fit in
         gfx::FrameSize atlas_size(square_atlas_dimension, square_atlas_dimension);
-        m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
-        while(!m_atlas_pack_ptr->TryPack(font_chars))
+        auto atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
+        while(!atlas_pack_ptr->TryPack(font_chars))
         {
             atlas_size *= 2;
-            m_atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
+            atlas_pack_ptr = std::make_unique<CharBinPack>(atlas_size);
         }
-        return true;
+        return atlas_pack_ptr;
+    }
+
+    static Data::Bytes DrawCharsToAtlas(const CharByCode& char_by_code, const gfx::FrameSize& atlas_size)
+    {
+        META_FUNCTION_TASK();
+        Data::Bytes atlas_bitmap(atlas_size.GetPixelsCount(), Data::Byte{});
+        for (const auto& [char_code, font_char] : char_by_code)
+        {
+            font_char.DrawToAtlas(atlas_bitmap, atlas_size.GetWidth());
+        }
+        return atlas_bitmap;
+    }
+
+    void StartAtlasRepack(float pixels_reserve_multiplier)
+    {
+        META_FUNCTION_TASK();
+        if (IsAtlasRepackPending())
+            return;
+
+        // Characters are copied to be packed and drawn in parallel thread,
+        // while original characters keep their positions in current atlas until repack is completed.
+        // Glyph bitmaps are shared by character copies and are only read by the repack task.
+        tf::Executor& parallel_executor = m_atlas_textures.begin()->second.owner_context.GetParallelExecutor();
+        m_atlas_repack_future = parallel_executor.async(
+            [char_by_code = m_char_by_code, pixels_reserve_multiplier]() mutable
+            {
+                META_FUNCTION_TASK();
+                Refs<Char> font_chars;
+                for(auto& [char_code, font_char] : char_by_code)
+                {
+                    font_chars.emplace_back(font_char);
+                }
+
+                AtlasRepack atlas_repack{ PackChars(font_chars, pixels_reserve_multiplier), {}, {} };
+                atlas_repack.bitmap = DrawCharsToAtlas(char_by_code, atlas_repack.pack_ptr->GetSize());
+                for(const auto& [char_code, font_char] : char_by_code)
+                {
+                    atlas_repack.char_rects.try_emplace(char_code, font_char.GetRect());
+                }
+                return atlas_repack;
+            });
+    }
+
+    void CancelAtlasRepack()
+    {
+        META_FUNCTION_TASK();
+        if (!IsAtlasRepackPending())
+            return;
+
+        m_atlas_repack_future.wait();
+        m_atlas_repack_future = {};
     }
 
     AtlasTexture CreateAtlasTexture(const rhi::RenderContext& render_context, bool deferred_data_init)
@@ -508,30 +1001,53 @@ private:
             atlas_texture.SetData(render_context.GetRenderCommandKit().GetQueue(),
                 { rhi::IResource::SubResource(reinterpret_cast<Data::ConstRawPtr>(m_atlas_bitmap.data()), static_cast<Data::Size>(m_atlas_bitmap.size())) }); // NOSONAR
         }
-        return { atlas_texture, deferred_data_init };
+        return { render_context, atlas_texture, deferred_data_init, {},
+                 deferred_data_init ? RenderContexts{} : GetAtlasSharingContexts(render_context) };
     }
 
-    bool UpdateAtlasBitmap(bool deferred_textures_update)
+    bool UpdateAtlasBitmap(bool deferred_textures_update, bool chars_repacked)
     {
         META_FUNCTION_TASK();
         META_CHECK_NOT_NULL_DESCR(m_atlas_pack_ptr, "can not update atlas bitmap until atlas is packed");
 
+        // Repacked chars have to be redrawn even if atlas size has not changed
         const gfx::FrameSize& atlas_size = m_atlas_pack_ptr->GetSize();
-        if (m_atlas_bitmap.size() == atlas_size.GetPixelsCount())
+        if (!chars_repacked && m_atlas_bitmap.size() == atlas_size.GetPixelsCount())
             return false;
 
-        // Clear old atlas content
-        std::ranges::fill(m_atlas_bitmap, Data::Byte{});
-        m_atlas_bitmap.resize(atlas_size.GetPixelsCount(), Data::Byte{});
+        // Render glyphs to cleared atlas bitmap
+        m_atlas_bitmap = DrawCharsToAtlas(m_char_by_code, atlas_size);
 
-        // Render glyphs to atlas bitmap
-        for (const auto& [char_code, character] : m_char_by_code)
+        UpdateAtlasTextures(deferred_textures_update);
+        return true;
+    }
+
+    void AddAtlasDirtyRows(const gfx::FrameRect& char_rect)
+    {
+        META_FUNCTION_TASK();
+        if (!char_rect.size || m_atlas_textures.empty())
+            return;
+
+        // Only rows covered by the new char are uploaded to textures on next upload
+        const Data::Range<uint32_t> char_rows(static_cast<uint32_t>(char_rect.GetTop()), static_cast<uint32_t>(char_rect.GetBottom()));
+        for(auto& [device, atlas_texture] : m_atlas_textures)
         {
-            character.DrawToAtlas(m_atlas_bitmap, atlas_size.GetWidth());
+            atlas_texture.dirty_rows.Add(char_rows);
+            atlas_texture.owner_context.RequestDeferredAction(rhi::IContext::DeferredAction::UploadResources);
         }
 
-        UpdateAtlasTextures(deferred_textures_update);
-        return true;
+        Emit(&IFontCallback::OnFontAtlasUpdated, m_font);
+    }
+
+    void ResetAtlasTextures()
+    {
+        META_FUNCTION_TASK();
+        for(auto& [device, atlas_texture] : m_atlas_textures)
+        {
+            const rhi::Texture old_texture = atlas_texture.texture;
+            atlas_texture = CreateAtlasTexture(atlas_texture.owner_context, false);
+            Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, &old_texture, &atlas_texture.texture);
+        }
     }
 
     void UpdateAtlasTextures(bool deferred_textures_update)
@@ -541,29 +1057,30 @@ private:
         if (m_atlas_textures.empty())
             return;
 
-        for(auto& [context, atlas_texture] : m_atlas_textures)
+        for(auto& [device, atlas_texture] : m_atlas_textures)
         {
             if (deferred_textures_update)
             {
                 // Texture will be updated on GPU context completing initialization,
                 // when next GPU Frame rendering is started and just before uploading data on GPU with upload command queue
                 atlas_texture.is_update_required = true;
-                context.RequestDeferredAction(rhi::IContext::DeferredAction::UploadResources);
+                atlas_texture.owner_context.RequestDeferredAction(rhi::IContext::DeferredAction::UploadResources);
             }
             else
             {
-                META_CHECK_TRUE(context.IsInitialized());
-                UpdateAtlasTexture(context, atlas_texture);
+                META_CHECK_TRUE(atlas_texture.owner_context.IsInitialized());
+                UpdateAtlasTexture(atlas_texture);
             }
         }
 
         Emit(&IFontCallback::OnFontAtlasUpdated, m_font);
     }
 
-    void UpdateAtlasTexture(const rhi::RenderContext& render_context, AtlasTexture& atlas_texture)
+    void UpdateAtlasTexture(AtlasTexture& atlas_texture)
     {
         META_FUNCTION_TASK();
         META_CHECK_TRUE_DESCR(atlas_texture.texture.IsInitialized(), "font atlas texture is not initialized");
+        const rhi::RenderContext& render_context = atlas_texture.owner_context;
 
         const gfx::FrameSize atlas_size = m_atlas_pack_ptr->GetSize();
         if (const gfx::Dimensions& texture_dimensions = atlas_texture.texture.GetSettings().dimensions;
@@ -573,13 +1090,70 @@ private:
             atlas_texture.texture = CreateAtlasTexture(render_context, false).texture;
             Emit(&IFontCallback::OnFontAtlasTextureReset, m_font, &old_texture, &atlas_texture.texture);
         }
-        else
+        else if (atlas_texture.is_update_required)
         {
             atlas_texture.texture.SetData(render_context.GetRenderCommandKit().GetQueue(),
                 { rhi::IResource::SubResource(reinterpret_cast<Data::ConstRawPtr>(m_atlas_bitmap.data()), static_cast<Data::Size>(m_atlas_bitmap.size())) }); // NOSONAR
         }
+        else if (!atlas_texture.dirty_rows.IsEmpty())
+        {
+            UpdateAtlasTextureRows(render_context, atlas_texture);
+        }
 
         atlas_texture.is_update_required = false;
+        atlas_texture.dirty_rows.Clear();
+        atlas_texture.unsynced_contexts  = GetAtlasSharingContexts(render_context);
+    }
+
+    RenderContexts GetAtlasSharingContexts(const rhi::RenderContext& owner_context) const
+    {
+        META_FUNCTION_TASK();
+        RenderContexts sharing_contexts;
+        const auto owner_device_it = m_atlas_devices.find(owner_context);
+        if (owner_device_it == m_atlas_devices.end())
+            return sharing_contexts;
+
+        for(const auto& [context, device] : m_atlas_devices)
+        {
+            if (context != owner_context && device == owner_device_it->second)
+                sharing_contexts.insert(context);
+        }
+        return sharing_contexts;
+    }
+
+    void SyncSharedAtlasTexture(const rhi::RenderContext& render_context, AtlasTexture& atlas_texture)
+    {
+        META_FUNCTION_TASK();
+        // Pending atlas updates are uploaded by the owner context before this context renders with shared texture
+        if (atlas_texture.is_update_required || !atlas_texture.dirty_rows.IsEmpty())
+            UpdateAtlasTexture(atlas_texture);
+
+        if (!atlas_texture.unsynced_contexts.erase(render_context))
+            return;
+
+        // Atlas data is uploaded on the command queue of the owner context, so the render queue
+        // of this context waits on GPU for the owner upload fence signalled after the atlas upload
+        const rhi::RenderContext& owner_context = atlas_texture.owner_context;
+        owner_context.UploadResources();
+        owner_context.GetUploadCommandKit().GetFence().FlushOnGpu(render_context.GetRenderCommandKit().GetQueue().GetInterface());
+    }
+
+    void UpdateAtlasTextureRows(const rhi::RenderContext& render_context, const AtlasTexture& atlas_texture) const
+    {
+        META_FUNCTION_TASK();
+        const uint32_t atlas_width = m_atlas_pack_ptr->GetSize().GetWidth();
+
+        // Each band of dirty rows is uploaded with a separate sub-resource addressing its data range in atlas bitmap
+        rhi::SubResources dirty_sub_resources;
+        dirty_sub_resources.reserve(atlas_texture.dirty_rows.Size());
+        for(const Data::Range<uint32_t>& dirty_rows : atlas_texture.dirty_rows)
+        {
+            const rhi::BytesRange dirty_bytes(dirty_rows.GetStart() * atlas_width, dirty_rows.GetEnd() * atlas_width);
+            dirty_sub_resources.emplace_back(
+                m_atlas_bitmap.data() + dirty_bytes.GetStart(), dirty_bytes.GetLength(),
+                rhi::SubResource::Index(), dirty_bytes);
+        }
+        atlas_texture.texture.SetData(render_context.GetRenderCommandKit().GetQueue(), dirty_sub_resources);
     }
 
     void OnContextReleased(rhi::IContext& context) final
@@ -594,10 +1168,21 @@ private:
         META_FUNCTION_TASK();
         META_CHECK_EQUAL(context.GetType(), rhi::IContext::Type::Render);
         const rhi::RenderContext render_context(dynamic_cast<rhi::IRenderContext&>(context));
-        if (const auto atlas_texture_it = m_atlas_textures.find(render_context);
-            atlas_texture_it != m_atlas_textures.end() && atlas_texture_it->second.is_update_required)
+        CompleteAtlasRepack(false);
+
+        // Shared atlas texture is updated only by its owner context
+        for(auto& [device, atlas_texture] : m_atlas_textures)
         {
-            UpdateAtlasTexture(render_context, atlas_texture_it->second);
+            if (atlas_texture.owner_context != render_context)
+            {
+                if (const auto atlas_device_it = m_atlas_devices.find(render_context);
+                    atlas_device_it != m_atlas_devices.end() && atlas_device_it->second == device)
+                    SyncSharedAtlasTexture(render_context, atlas_texture);
+            }
+            else if (atlas_texture.is_update_required || !atlas_texture.dirty_rows.IsEmpty())
+            {
+                UpdateAtlasTexture(atlas_texture);
+            }
         }
     }
 
@@ -21,6 +21,8 @@ Fonts library to manage created font instances.
 
 ******************************************************************************/
 
+#include "FontGlyphCache.h"
+
 #include <Methane/UserInterface/FontLibrary.h>
 #include <Methane/Data/Emitter.hpp>
 #include <Methane/Pimpl.hpp>
@@ -41,8 +43,10 @@ class FontLibrary::Impl // NOSONAR - custom destructor is required
     : public Data::Emitter<IFontLibraryCallback>
 {
 public:
-    explicit Impl(FontLibrary& font_lib)
+    Impl(FontLibrary& font_lib, tf::Executor* parallel_executor_ptr, Data::Size glyph_cache_budget_size)
         : m_font_lib(font_lib)
+        , m_parallel_executor_ptr(parallel_executor_ptr)
+        , m_glyph_cache(glyph_cache_budget_size)
     {
         META_FUNCTION_TASK();
         ThrowFreeTypeError(FT_Init_FreeType(&m_ft_library));
@@ -128,16 +132,28 @@ public:
         return m_ft_library;
     }
 
+    [[nodiscard]] tf::Executor* GetParallelExecutor() const noexcept
+    {
+        return m_parallel_executor_ptr;
+    }
+
+    [[nodiscard]] FontGlyphCache& GetGlyphCache() noexcept
+    {
+        return m_glyph_cache;
+    }
+
 private:
     using FontByName = std::map<std::string, Font, std::less<>>;
 
-    FontLibrary& m_font_lib;
-    FT_Library   m_ft_library;
-    FontByName   m_font_by_name;
+    FontLibrary&   m_font_lib;
+    tf::Executor*  m_parallel_executor_ptr;
+    FT_Library     m_ft_library;
+    FontGlyphCache m_glyph_cache; // declared before fonts, which remove their glyphs from cache on destruction
+    FontByName     m_font_by_name;
 };
 
-FontLibrary::FontLibrary()
-    : m_impl_ptr(std::make_unique<Impl>(*this)) // NOSONAR
+FontLibrary::FontLibrary(tf::Executor* parallel_executor_ptr, Data::Size glyph_cache_budget_size)
+    : m_impl_ptr(std::make_unique<Impl>(*this, parallel_executor_ptr, glyph_cache_budget_size)) // NOSONAR
 { }
 
 void FontLibrary::Connect(Data::Receiver<IFontLibraryCallback>& receiver) const
@@ -155,6 +171,11 @@ FT_Library FontLibrary::GetFreeTypeLibrary() const META_PIMPL_NOEXCEPT
     return GetImpl(m_impl_ptr).GetFreeTypeLibrary();
 }
 
+tf::Executor* FontLibrary::GetParallelExecutor() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetParallelExecutor();
+}
+
 std::vector<Font> FontLibrary::GetFonts() const
 {
     return GetImpl(m_impl_ptr).GetFonts();
@@ -185,6 +206,31 @@ void FontLibrary::RemoveFont(std::string_view font_name) const
     GetImpl(m_impl_ptr).RemoveFont(font_name);
 }
 
+void FontLibrary::SetGlyphCacheBudgetSize(Data::Size budget_size) const
+{
+    GetImpl(m_impl_ptr).GetGlyphCache().SetBudgetSize(budget_size);
+}
+
+Data::Size FontLibrary::GetGlyphCacheBudgetSize() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetGlyphCache().GetBudgetSize();
+}
+
+const FontGlyphCacheStatistics& FontLibrary::GetGlyphCacheStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetGlyphCache().GetStatistics();
+}
+
+void FontLibrary::ResetGlyphCacheStatistics() const
+{
+    GetImpl(m_impl_ptr).GetGlyphCache().ResetStatistics();
+}
+
+FontGlyphCache& FontLibrary::GetGlyphCache() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetGlyphCache();
+}
+
 void FontLibrary::Clear() const
 {
     GetImpl(m_impl_ptr).Clear();
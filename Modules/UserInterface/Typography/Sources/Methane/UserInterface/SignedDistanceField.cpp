@@ -0,0 +1,209 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/SignedDistanceField.cpp
+Signed distance field generation from supersampled glyph coverage bitmaps.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/SignedDistanceField.h>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace Methane::UserInterface
+{
+
+static constexpr float   g_far_squared_distance = 1E20F;
+static constexpr uint8_t g_coverage_threshold   = 128U;
+
+class SquaredDistanceTransform
+{
+public:
+    explicit SquaredDistanceTransform(size_t max_line_length)
+        : m_samples(max_line_length)
+        , m_parabola_vertices(max_line_length)
+        , m_parabola_bounds(max_line_length + 1)
+    { }
+
+    // Exact squared Euclidean distance transform of Felzenszwalb and Huttenlocher applied to the line of grid samples
+    void TransformLine(float* line_ptr, size_t length, size_t stride)
+    {
+        for(size_t i = 0; i < length; ++i)
+        {
+            m_samples[i] = line_ptr[i * stride];
+        }
+
+        // Compute lower envelope of parabolas rooted at each sample
+        size_t k = 0;
+        m_parabola_vertices[0] = 0;
+        m_parabola_bounds[0]   = -g_far_squared_distance;
+        m_parabola_bounds[1]   = g_far_squared_distance;
+        for(size_t q = 1; q < length; ++q)
+        {
+            float intersection = GetParabolasIntersection(q, m_parabola_vertices[k]);
+            while(intersection <= m_parabola_bounds[k])
+            {
+                --k;
+                intersection = GetParabolasIntersection(q, m_parabola_vertices[k]);
+            }
+            ++k;
+            m_parabola_vertices[k]   = q;
+            m_parabola_bounds[k]     = intersection;
+            m_parabola_bounds[k + 1] = g_far_squared_distance;
+        }
+
+        // Sample lower envelope to get squared distances
+        k = 0;
+        for(size_t q = 0; q < length; ++q)
+        {
+            while(m_parabola_bounds[k + 1] < static_cast<float>(q))
+                ++k;
+
+            const auto delta = static_cast<float>(q) - static_cast<float>(m_parabola_vertices[k]);
+            line_ptr[q * stride] = delta * delta + m_samples[m_parabola_vertices[k]];
+        }
+    }
+
+    void Transform(std::vector<float>& grid, size_t width, size_t height)
+    {
+        META_FUNCTION_TASK();
+        for(size_t x = 0; x < width; ++x)
+        {
+            TransformLine(grid.data() + x, height, width);
+        }
+        for(size_t y = 0; y < height; ++y)
+        {
+            TransformLine(grid.data() + y * width, width, 1U);
+        }
+    }
+
+private:
+    [[nodiscard]] float GetParabolasIntersection(size_t q, size_t v) const noexcept
+    {
+        const auto qf = static_cast<float>(q);
+        const auto vf = static_cast<float>(v);
+        return ((m_samples[q] + qf * qf) - (m_samples[v] + vf * vf)) / (2.F * qf - 2.F * vf);
+    }
+
+    std::vector<float>  m_samples;
+    std::vector<size_t> m_parabola_vertices;
+    std::vector<float>  m_parabola_bounds;
+};
+
+Data::Byte EncodeSignedDistance(float distance, uint32_t spread) noexcept
+{
+    const float normalized_distance = std::clamp(0.5F + distance / (2.F * static_cast<float>(spread)), 0.F, 1.F);
+    return static_cast<Data::Byte>(std::lround(normalized_distance * 255.F));
+}
+
+float DecodeSignedDistance(Data::Byte encoded_distance, uint32_t spread) noexcept
+{
+    return (static_cast<float>(std::to_integer<uint8_t>(encoded_distance)) / 255.F - 0.5F) * 2.F * static_cast<float>(spread);
+}
+
+gfx::FrameSize GetSignedDistanceFieldSize(const gfx::FrameSize& coverage_size, const gfx::FramePoint& coverage_offset,
+                                          const DistanceFieldSettings& settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_NOT_ZERO_DESCR(settings.supersampling, "distance field supersampling can not be zero");
+    META_CHECK_RANGE(coverage_offset.GetX(), 0, static_cast<int32_t>(settings.supersampling));
+    META_CHECK_RANGE(coverage_offset.GetY(), 0, static_cast<int32_t>(settings.supersampling));
+    if (!coverage_size)
+        return {};
+
+    const auto get_field_dimension = [&settings](uint32_t coverage_dimension, int32_t offset)
+    {
+        const uint32_t supersampled_dimension = coverage_dimension + static_cast<uint32_t>(offset);
+        return (supersampled_dimension + settings.supersampling - 1U) / settings.supersampling + 2U * settings.spread;
+    };
+    return gfx::FrameSize(get_field_dimension(coverage_size.GetWidth(),  coverage_offset.GetX()),
+                          get_field_dimension(coverage_size.GetHeight(), coverage_offset.GetY()));
+}
+
+Data::Bytes GenerateSignedDistanceField(const Data::Bytes& coverage_bitmap, const gfx::FrameSize& coverage_size,
+                                        const gfx::FramePoint& coverage_offset, const DistanceFieldSettings& settings)
+{
+    META_FUNCTION_TASK();
+    META_CHECK_EQUAL_DESCR(coverage_bitmap.size(), coverage_size.GetPixelsCount(), "coverage bitmap size does not match its dimensions");
+    META_CHECK_NOT_ZERO_DESCR(settings.spread, "distance field spread can not be zero");
+
+    const gfx::FrameSize field_size = GetSignedDistanceFieldSize(coverage_size, coverage_offset, settings);
+    if (!field_size)
+        return {};
+
+    // Supersampled grid is aligned with distance field pixels and contains coverage bitmap with spread margins
+    const uint32_t ss          = settings.supersampling;
+    const size_t   grid_width  = static_cast<size_t>(field_size.GetWidth())  * ss;
+    const size_t   grid_height = static_cast<size_t>(field_size.GetHeight()) * ss;
+    const size_t   grid_left   = static_cast<size_t>(settings.spread) * ss + static_cast<size_t>(coverage_offset.GetX());
+    const size_t   grid_top    = static_cast<size_t>(settings.spread) * ss + static_cast<size_t>(coverage_offset.GetY());
+
+    std::vector<bool> inside_mask(grid_width * grid_height, false);
+    for(uint32_t y = 0; y < coverage_size.GetHeight(); ++y)
+    {
+        for(uint32_t x = 0; x < coverage_size.GetWidth(); ++x)
+        {
+            if (std::to_integer<uint8_t>(coverage_bitmap[y * coverage_size.GetWidth() + x]) >= g_coverage_threshold)
+                inside_mask[(grid_top + y) * grid_width + grid_left + x] = true;
+        }
+    }
+
+    // Squared distances from every sample to the nearest sample on the other side of glyph edge
+    std::vector<float> outside_distances(inside_mask.size());
+    std::vector<float> inside_distances(inside_mask.size());
+    for(size_t i = 0; i < inside_mask.size(); ++i)
+    {
+        outside_distances[i] = inside_mask[i] ? g_far_squared_distance : 0.F;
+        inside_distances[i]  = inside_mask[i] ? 0.F : g_far_squared_distance;
+    }
+
+    SquaredDistanceTransform distance_transform(std::max(grid_width, grid_height));
+    distance_transform.Transform(outside_distances, grid_width, grid_height);
+    distance_transform.Transform(inside_distances, grid_width, grid_height);
+
+    // Edge is located half-way between the samples on its different sides,
+    // distance field pixel value is averaged from its supersampled signed distances
+    const float samples_per_pixel = static_cast<float>(ss * ss);
+    Data::Bytes distance_field(field_size.GetPixelsCount());
+    for(uint32_t field_y = 0; field_y < field_size.GetHeight(); ++field_y)
+    {
+        for(uint32_t field_x = 0; field_x < field_size.GetWidth(); ++field_x)
+        {
+            float distance_sum = 0.F;
+            for(size_t y = field_y * ss; y < (field_y + 1) * ss; ++y)
+            {
+                for(size_t x = field_x * ss; x < (field_x + 1) * ss; ++x)
+                {
+                    const size_t i = y * grid_width + x;
+                    distance_sum += inside_mask[i]
+                                  ? std::sqrt(outside_distances[i]) - 0.5F
+                                  : 0.5F - std::sqrt(inside_distances[i]);
+                }
+            }
+            const float distance = distance_sum / samples_per_pixel / static_cast<float>(ss);
+            distance_field[field_y * field_size.GetWidth() + field_x] = EncodeSignedDistance(distance, settings.spread);
+        }
+    }
+    return distance_field;
+}
+
+} // namespace Methane::UserInterface
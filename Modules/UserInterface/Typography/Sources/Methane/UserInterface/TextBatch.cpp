@@ -0,0 +1,675 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/TextBatch.cpp
+Methane text batch rendering many texts of the same font with one draw call.
+
+******************************************************************************/
+
+#include "TextImpl.hpp"
+
+#include <Methane/UserInterface/TextBatch.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace Methane::UserInterface
+{
+
+class TextBatch::Impl
+{
+public:
+    Impl(Context& ui_context, const rhi::RenderPattern& render_pattern, const Font& font, const Settings& settings)
+        : m_ui_context(ui_context)
+        , m_settings(settings)
+        , m_font(font)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_EMPTY_DESCR(m_settings.state_name, "Text batch state name can not be empty");
+        META_CHECK_NOT_ZERO_DESCR(m_settings.mesh_buffers_reservation_multiplier, "text batch mesh buffers reservation multiplier can not be zero");
+
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
+        META_CHECK_LESS_DESCR(frame_buffers_count, static_cast<uint32_t>(std::numeric_limits<FramesMask>::digits),
+                              "frame buffers count is too large for text batch dirty frames mask");
+        m_all_frames_mask = (FramesMask{ 1U } << frame_buffers_count) - 1U;
+        m_frame_resources.resize(frame_buffers_count);
+
+        // Distance field fonts are rendered with a separate pixel shader, so text batch render state is cached with a different name
+        const bool        is_distance_field = m_font.GetSettings().glyph_mode == FontGlyphMode::DistanceField;
+        const std::string render_state_name = is_distance_field ? m_settings.state_name + " with Distance Field" : m_settings.state_name;
+
+        rhi::ObjectRegistry gfx_objects_registry = render_context.GetObjectRegistry();
+        m_render_state = gfx_objects_registry.GetGraphicsObject<rhi::RenderState>(render_state_name);
+        if (m_render_state.IsInitialized())
+        {
+            META_CHECK_EQUAL_DESCR(m_render_state.GetSettings().render_pattern_ptr->GetSettings(), render_pattern.GetSettings(),
+                                   "Text batch '{}' render state '{}' from cache has incompatible render pattern settings", m_settings.name,
+                                   render_state_name);
+        }
+        else
+        {
+            rhi::IShader::MacroDefinitions pixel_shader_definitions;
+            if (is_distance_field)
+                pixel_shader_definitions.emplace_back("DISTANCE_FIELD", "");
+
+            rhi::RenderState::Settings state_settings
+            {
+                .program = rhi::Program(
+                    render_context,
+                    rhi::Program::Settings
+                    {
+                        .shader_set = rhi::Program::ShaderSet
+                        {
+                            { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "Text", "TextBatchVS" }, {} } },
+                            { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "Text", "TextBatchPS" }, pixel_shader_definitions } },
+                        },
+                        .input_buffer_layouts = rhi::ProgramInputBufferLayouts
+                        {
+                            rhi::Program::InputBufferLayout
+                            {
+                                rhi::Program::InputBufferLayout::ArgumentSemantics{ "POSITION", "TEXCOORD", "TEXT_INDEX" }
+                            }
+                        },
+                        .argument_accessors = rhi::ProgramArgumentAccessors{ },
+                        .attachment_formats = render_pattern.GetAttachmentFormats()
+                    }),
+                .render_pattern = render_pattern,
+                .rasterizer = rhi::RasterizerSettings
+                {
+                    .is_front_counter_clockwise = true
+                },
+                .depth = rhi::DepthSettings
+                {
+                    .enabled       = false,
+                    .write_enabled = false
+                }
+            };
+            state_settings.blending.render_targets[0] = rhi::RenderTargetSettings
+            {
+                .blend_enabled             = true,
+                .source_rgb_blend_factor   = Graphics::Rhi::BlendingFactor::SourceAlpha,
+                .source_alpha_blend_factor = Graphics::Rhi::BlendingFactor::Zero,
+                .dest_rgb_blend_factor     = Graphics::Rhi::BlendingFactor::OneMinusSourceAlpha,
+                .dest_alpha_blend_factor   = Graphics::Rhi::BlendingFactor::Zero
+            };
+            state_settings.program.SetName("Text Batch Shading");
+
+            m_render_state = render_context.CreateRenderState(state_settings);
+            m_render_state.SetName(render_state_name);
+
+            gfx_objects_registry.AddGraphicsObject(m_render_state);
+        }
+
+        static const std::string s_sampler_name = "Font Atlas Sampler";
+        m_atlas_sampler = gfx_objects_registry.GetGraphicsObject<rhi::Sampler>(s_sampler_name);
+        if (!m_atlas_sampler.IsInitialized())
+        {
+            m_atlas_sampler = render_context.CreateSampler(
+                rhi::SamplerSettings
+                {
+                    .filter  = rhi::ISampler::Filter(rhi::ISampler::Filter::MinMag::Linear),
+                    .address = rhi::ISampler::Address(rhi::ISampler::Address::Mode::ClampToZero),
+                });
+            m_atlas_sampler.SetName(s_sampler_name);
+
+            gfx_objects_registry.AddGraphicsObject(m_atlas_sampler);
+        }
+    }
+
+    Impl(Context& ui_context, const Font& font, const Settings& settings)
+        : Impl(ui_context, ui_context.GetRenderPattern(), font, settings)
+    { }
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept
+    { return m_settings; }
+
+    [[nodiscard]] const Font& GetFont() const noexcept
+    { return m_font; }
+
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept
+    { return m_statistics; }
+
+    [[nodiscard]] Data::Size GetTextsCount() const noexcept
+    { return static_cast<Data::Size>(m_text_slots.size()); }
+
+    [[nodiscard]] bool HasText(const Text& text) const
+    {
+        META_FUNCTION_TASK();
+        return FindTextSlot(text) != m_text_slots.end();
+    }
+
+    void AddText(const Text& text)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_TRUE_DESCR(text.IsInitialized(), "can not add uninitialized text to the text batch");
+        META_CHECK_TRUE_DESCR(text.GetImplementation().GetFont() == m_font,
+                              "text '{}' font differs from the font of text batch '{}'", text.GetSettings().name, m_settings.name);
+        META_CHECK_FALSE_DESCR(HasText(text), "text '{}' was already added to the text batch '{}'", text.GetSettings().name, m_settings.name);
+
+        m_text_slots.push_back(TextSlot{ .text = text });
+        m_is_layout_dirty = true;
+    }
+
+    void RemoveText(const Text& text)
+    {
+        META_FUNCTION_TASK();
+        const auto text_slot_it = FindTextSlot(text);
+        META_CHECK_TRUE_DESCR(text_slot_it != m_text_slots.end(), "text '{}' was not found in the text batch '{}'",
+                              text.GetSettings().name, m_settings.name);
+
+        m_text_slots.erase(text_slot_it);
+        m_is_layout_dirty = true;
+    }
+
+    void Update(const gfx::FrameSize& render_attachment_size)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO_DESCR(render_attachment_size, "text batch can not be updated with zero render attachment size");
+        m_statistics = {};
+
+        // Completed font atlas repack resets atlas texture and updates meshes of all texts via font callback
+        m_font.CompleteAtlasRepack();
+
+        if (m_render_attachment_size != render_attachment_size)
+        {
+            UpdateViewState(render_attachment_size);
+        }
+
+        UpdateTextSlots();
+
+        if (m_is_layout_dirty)
+        {
+            LayoutTextSlots();
+        }
+
+        UpdateFrameResources(m_ui_context.GetRenderContext().GetFrameBufferIndex());
+    }
+
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr)
+    {
+        META_FUNCTION_TASK();
+        const FrameResources& frame_resources = GetCurrentFrameResources();
+        if (!frame_resources.indices_count || !frame_resources.program_bindings.IsInitialized())
+            return;
+
+        cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
+        cmd_list.SetViewState(m_view_state);
+        cmd_list.SetProgramBindings(frame_resources.program_bindings);
+        cmd_list.SetVertexBuffers(frame_resources.vertex_buffer_set);
+        cmd_list.SetIndexBuffer(frame_resources.index_buffer);
+        cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle, frame_resources.indices_count);
+    }
+
+private:
+    using FramesMask = uint32_t;
+    using Index      = uint32_t;
+
+    // Text mesh vertex extended with index of the text instance data in the instances buffer
+    struct Vertex
+    {
+        Data::RawVector2F position;
+        Data::RawVector2F texcoord;
+        uint32_t          text_index;
+    };
+
+    using Vertices  = std::vector<Vertex>;
+    using Indices   = std::vector<Index>;
+    using Instances = std::vector<hlslpp::TextInstance>;
+
+    // Each text mesh occupies a range of batch vertices and indices reserved for mesh growth,
+    // unused indices of the range are degenerate and do not produce any triangles
+    struct TextSlot
+    {
+        Text         text;
+        uint32_t     mesh_version          = std::numeric_limits<uint32_t>::max();
+        bool         is_drawable           = false;
+        Data::Index  vertex_offset         = 0U;
+        Data::Size   vertex_capacity       = 0U;
+        Data::Index  index_offset          = 0U;
+        Data::Size   index_capacity        = 0U;
+        bool         is_instance_valid     = false;
+        FrameRect    viewport_rect;
+        gfx::Color4F color;
+        FramesMask   dirty_mesh_frames     = 0U;
+        FramesMask   dirty_instance_frames = 0U;
+    };
+
+    using TextSlots = std::vector<TextSlot>;
+
+    struct FrameResources
+    {
+        rhi::BufferSet       vertex_buffer_set;
+        rhi::Buffer          index_buffer;
+        rhi::Buffer          instances_buffer;
+        rhi::Texture         atlas_texture;
+        rhi::ProgramBindings program_bindings;
+        uint32_t             indices_count = 0U;
+    };
+
+    using PerFrameResources = std::vector<FrameResources>;
+
+    [[nodiscard]] TextSlots::const_iterator FindTextSlot(const Text& text) const
+    {
+        return std::ranges::find_if(m_text_slots, [&text](const TextSlot& text_slot)
+                                    { return std::addressof(text_slot.text.GetImplementation()) == std::addressof(text.GetImplementation()); });
+    }
+
+    [[nodiscard]] static bool IsTextDrawable(const Text::Impl& text_impl)
+    {
+        const TextMesh* text_mesh_ptr = text_impl.GetTextMesh();
+        return text_mesh_ptr && !text_mesh_ptr->GetIndices().empty() &&
+               text_mesh_ptr->GetContentSize() && text_impl.GetFrameRect().size;
+    }
+
+    [[nodiscard]] static bool IsTextMeshFitsSlot(const TextSlot& text_slot)
+    {
+        const TextMesh* text_mesh_ptr = text_slot.text.GetImplementation().GetTextMesh();
+        return !text_slot.is_drawable ||
+               (text_mesh_ptr->GetVertices().size() <= text_slot.vertex_capacity &&
+                text_mesh_ptr->GetIndices().size()  <= text_slot.index_capacity);
+    }
+
+    FrameResources& GetCurrentFrameResources()
+    {
+        META_FUNCTION_TASK();
+        const uint32_t frame_index = m_ui_context.GetRenderContext().GetFrameBufferIndex();
+        META_CHECK_LESS_DESCR(frame_index, m_frame_resources.size(), "no resources available for the current frame buffer index");
+        return m_frame_resources[frame_index];
+    }
+
+    void UpdateViewState(const gfx::FrameSize& render_attachment_size)
+    {
+        META_FUNCTION_TASK();
+        m_render_attachment_size = render_attachment_size;
+
+        // All texts are drawn with one viewport covering render attachment, so that text position is applied with instance transformation
+        if (m_view_state.IsInitialized())
+        {
+            m_view_state.SetViewports({ gfx::GetFrameViewport(m_render_attachment_size) });
+            m_view_state.SetScissorRects({ gfx::GetFrameScissorRect(m_render_attachment_size) });
+        }
+        else
+        {
+            m_view_state = rhi::ViewState({
+                { gfx::GetFrameViewport(m_render_attachment_size) },
+                { gfx::GetFrameScissorRect(m_render_attachment_size) }
+            });
+        }
+
+        for(TextSlot& text_slot : m_text_slots)
+        {
+            text_slot.is_instance_valid = false;
+        }
+    }
+
+    // Picks up changes of texts mesh, frame rect and color since the previous update
+    void UpdateTextSlots()
+    {
+        META_FUNCTION_TASK();
+        m_instances.resize(m_text_slots.size());
+
+        for(Data::Index slot_index = 0U; slot_index < m_text_slots.size(); ++slot_index)
+        {
+            TextSlot&         text_slot = m_text_slots[slot_index];
+            const Text::Impl& text_impl = text_slot.text.GetImplementation();
+            const bool        is_drawable = IsTextDrawable(text_impl);
+
+            if (text_slot.mesh_version != text_impl.GetMeshVersion() || text_slot.is_drawable != is_drawable)
+            {
+                text_slot.mesh_version = text_impl.GetMeshVersion();
+                text_slot.is_drawable  = is_drawable;
+
+                if (!m_is_layout_dirty && IsTextMeshFitsSlot(text_slot))
+                {
+                    FillTextSlotMesh(slot_index);
+                    text_slot.dirty_mesh_frames = m_all_frames_mask;
+                }
+                else
+                {
+                    m_is_layout_dirty = true;
+                }
+            }
+
+            if (!is_drawable)
+                continue;
+
+            m_statistics.batched_texts_count++;
+
+            const FrameRect     viewport_rect = text_impl.GetAlignedViewportRect();
+            const gfx::Color4F& color         = text_impl.GetSettings().color;
+            if (text_slot.is_instance_valid && text_slot.viewport_rect == viewport_rect && text_slot.color == color)
+                continue;
+
+            text_slot.viewport_rect         = viewport_rect;
+            text_slot.color                 = color;
+            text_slot.is_instance_valid     = true;
+            text_slot.dirty_instance_frames = m_all_frames_mask;
+            m_instances[slot_index]         = GetTextInstance(viewport_rect, color);
+        }
+    }
+
+    [[nodiscard]] hlslpp::TextInstance GetTextInstance(const FrameRect& viewport_rect, const gfx::Color4F& color) const
+    {
+        META_FUNCTION_TASK();
+        const auto attachment_width  = static_cast<float>(m_render_attachment_size.GetWidth());
+        const auto attachment_height = static_cast<float>(m_render_attachment_size.GetHeight());
+        const auto viewport_x        = static_cast<float>(viewport_rect.origin.GetX());
+        const auto viewport_y        = static_cast<float>(viewport_rect.origin.GetY());
+
+        // Text mesh is in pixel coordinates relative to the top-left corner of text viewport with Y axis directed up
+        return hlslpp::TextInstance{
+            hlslpp::mul(
+                hlslpp::float4x4::scale(2.F / attachment_width, 2.F / attachment_height, 1.F),
+                hlslpp::float4x4::translation(2.F * viewport_x / attachment_width - 1.F, 1.F - 2.F * viewport_y / attachment_height, 0.F)),
+            color.AsVector()
+        };
+    }
+
+    // Reserves ranges of batch vertices and indices for all text meshes, fills meshes and instances of all texts
+    // and marks all texts dirty in all frames
+    void LayoutTextSlots()
+    {
+        META_FUNCTION_TASK();
+        const Data::Size reservation_multiplier = m_settings.mesh_buffers_reservation_multiplier;
+        Data::Index vertex_offset = 0U;
+        Data::Index index_offset  = 0U;
+
+        for(TextSlot& text_slot : m_text_slots)
+        {
+            const TextMesh* text_mesh_ptr = text_slot.text.GetImplementation().GetTextMesh();
+            text_slot.vertex_offset         = vertex_offset;
+            text_slot.index_offset          = index_offset;
+            text_slot.vertex_capacity       = text_slot.is_drawable ? static_cast<Data::Size>(text_mesh_ptr->GetVertices().size()) * reservation_multiplier : 0U;
+            text_slot.index_capacity        = text_slot.is_drawable ? static_cast<Data::Size>(text_mesh_ptr->GetIndices().size()) * reservation_multiplier : 0U;
+            text_slot.dirty_mesh_frames     = m_all_frames_mask;
+            text_slot.dirty_instance_frames = m_all_frames_mask;
+            vertex_offset += text_slot.vertex_capacity;
+            index_offset  += text_slot.index_capacity;
+        }
+
+        m_vertices.resize(vertex_offset);
+        m_indices.resize(index_offset);
+        m_instances.resize(m_text_slots.size());
+
+        // Slot indices of texts following the removed text are shifted, so their instances are rewritten at the new indices
+        for(Data::Index slot_index = 0U; slot_index < m_text_slots.size(); ++slot_index)
+        {
+            FillTextSlotMesh(slot_index);
+            if (const TextSlot& text_slot = m_text_slots[slot_index];
+                text_slot.is_instance_valid)
+            {
+                m_instances[slot_index] = GetTextInstance(text_slot.viewport_rect, text_slot.color);
+            }
+        }
+        m_is_layout_dirty = false;
+    }
+
+    void FillTextSlotMesh(Data::Index slot_index)
+    {
+        META_FUNCTION_TASK();
+        const TextSlot& text_slot = m_text_slots[slot_index];
+        const auto vertices_begin = m_vertices.begin() + text_slot.vertex_offset;
+        const auto vertices_end   = vertices_begin + text_slot.vertex_capacity;
+        const auto indices_begin  = m_indices.begin() + text_slot.index_offset;
+        const auto indices_end    = indices_begin + text_slot.index_capacity;
+        auto       vertex_it      = vertices_begin;
+        auto       index_it       = indices_begin;
+
+        if (text_slot.is_drawable)
+        {
+            const TextMesh& text_mesh = *text_slot.text.GetImplementation().GetTextMesh();
+            vertex_it = std::ranges::transform(text_mesh.GetVertices(), vertices_begin, [slot_index](const TextMesh::Vertex& vertex)
+                                               { return Vertex{ vertex.position, vertex.texcoord, slot_index }; }).out;
+            index_it  = std::ranges::transform(text_mesh.GetIndices(), indices_begin, [&text_slot](TextMesh::Index index)
+                                               { return static_cast<Index>(text_slot.vertex_offset + index); }).out;
+        }
+
+        std::fill(vertex_it, vertices_end, Vertex{ {}, {}, slot_index });
+        std::fill(index_it, indices_end, static_cast<Index>(text_slot.vertex_offset));
+    }
+
+    void SetAllTextSlotsDirty(FramesMask TextSlot::* dirty_frames_member, FramesMask frame_mask)
+    {
+        META_FUNCTION_TASK();
+        for(TextSlot& text_slot : m_text_slots)
+        {
+            text_slot.*dirty_frames_member |= frame_mask;
+        }
+    }
+
+    void UpdateFrameResources(uint32_t frame_index)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS_DESCR(frame_index, m_frame_resources.size(), "no resources available for the frame buffer index");
+        FrameResources& frame_resources = m_frame_resources[frame_index];
+        frame_resources.indices_count = static_cast<uint32_t>(m_indices.size());
+        if (m_indices.empty())
+            return;
+
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        const FramesMask          frame_mask     = FramesMask{ 1U } << frame_index;
+        const Data::Size          reservation_multiplier = m_settings.mesh_buffers_reservation_multiplier;
+
+        const auto vertices_data_size = static_cast<Data::Size>(m_vertices.size() * sizeof(Vertex));
+        if (!frame_resources.vertex_buffer_set.IsInitialized() || frame_resources.vertex_buffer_set[0].GetDataSize() < vertices_data_size)
+        {
+            rhi::Buffer vertex_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForVertexBuffer(vertices_data_size * reservation_multiplier, static_cast<Data::Size>(sizeof(Vertex))));
+            vertex_buffer.SetName(fmt::format("{} Text Batch Vertex Buffer {}", m_settings.name, frame_index));
+            frame_resources.vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
+            SetAllTextSlotsDirty(&TextSlot::dirty_mesh_frames, frame_mask);
+        }
+
+        const auto indices_data_size = static_cast<Data::Size>(m_indices.size() * sizeof(Index));
+        if (!frame_resources.index_buffer.IsInitialized() || frame_resources.index_buffer.GetDataSize() < indices_data_size)
+        {
+            frame_resources.index_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForIndexBuffer(indices_data_size * reservation_multiplier, gfx::PixelFormat::R32Uint));
+            frame_resources.index_buffer.SetName(fmt::format("{} Text Batch Index Buffer {}", m_settings.name, frame_index));
+            SetAllTextSlotsDirty(&TextSlot::dirty_mesh_frames, frame_mask);
+        }
+
+        const auto instances_data_size = static_cast<Data::Size>(m_instances.size() * sizeof(hlslpp::TextInstance));
+        if (!frame_resources.instances_buffer.IsInitialized() || frame_resources.instances_buffer.GetDataSize() < instances_data_size)
+        {
+            frame_resources.instances_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForStorageBuffer(instances_data_size * reservation_multiplier, static_cast<Data::Size>(sizeof(hlslpp::TextInstance))));
+            frame_resources.instances_buffer.SetName(fmt::format("{} Text Batch Instances Buffer {}", m_settings.name, frame_index));
+            frame_resources.program_bindings = {};
+            SetAllTextSlotsDirty(&TextSlot::dirty_instance_frames, frame_mask);
+        }
+
+        UpdateProgramBindings(frame_resources, frame_index);
+        UploadDirtyMeshes(frame_resources, frame_mask);
+        UploadDirtyInstances(frame_resources, frame_mask);
+    }
+
+    void UpdateProgramBindings(FrameResources& frame_resources, uint32_t frame_index) const
+    {
+        META_FUNCTION_TASK();
+        const rhi::Texture& atlas_texture = m_font.GetAtlasTexture(m_ui_context.GetRenderContext());
+        if (frame_resources.program_bindings.IsInitialized())
+        {
+            if (frame_resources.atlas_texture != atlas_texture)
+            {
+                frame_resources.atlas_texture = atlas_texture;
+                frame_resources.program_bindings.Get({ rhi::ShaderType::Pixel, "g_texture" }).SetResourceView(atlas_texture.GetResourceView());
+            }
+            return;
+        }
+
+        using enum rhi::ShaderType;
+        frame_resources.atlas_texture    = atlas_texture;
+        frame_resources.program_bindings = m_render_state.GetProgram().CreateBindings({
+            { { Vertex, "g_instances" }, frame_resources.instances_buffer.GetResourceView() },
+            { { Pixel,  "g_texture" },   atlas_texture.GetResourceView() },
+            { { Pixel,  "g_sampler" },   m_atlas_sampler.GetResourceView() },
+        });
+        frame_resources.program_bindings.SetName(fmt::format("{} Text Batch Bindings {}", m_settings.name, frame_index));
+    }
+
+    // Uploads vertices and indices of texts changed since the previous update of the frame buffers,
+    // meshes of adjacent changed texts are merged into single range
+    void UploadDirtyMeshes(const FrameResources& frame_resources, FramesMask frame_mask)
+    {
+        META_FUNCTION_TASK();
+        const rhi::CommandQueue& cmd_queue   = m_ui_context.GetRenderContext().GetRenderCommandKit().GetQueue();
+        const auto               slots_count = static_cast<Data::Index>(m_text_slots.size());
+
+        for(Data::Index begin_index = 0U; begin_index < slots_count; ++begin_index)
+        {
+            if (!(m_text_slots[begin_index].dirty_mesh_frames & frame_mask))
+                continue;
+
+            Data::Index end_index = begin_index;
+            while(end_index < slots_count && (m_text_slots[end_index].dirty_mesh_frames & frame_mask))
+            {
+                m_text_slots[end_index].dirty_mesh_frames &= ~frame_mask;
+                ++end_index;
+            }
+
+            const TextSlot& begin_slot = m_text_slots[begin_index];
+            const TextSlot& last_slot  = m_text_slots[end_index - 1];
+            const auto vertices_start  = static_cast<Data::Size>(begin_slot.vertex_offset * sizeof(Vertex));
+            const auto vertices_end    = static_cast<Data::Size>((last_slot.vertex_offset + last_slot.vertex_capacity) * sizeof(Vertex));
+            const auto indices_start   = static_cast<Data::Size>(begin_slot.index_offset * sizeof(Index));
+            const auto indices_end     = static_cast<Data::Size>((last_slot.index_offset + last_slot.index_capacity) * sizeof(Index));
+
+            if (vertices_end > vertices_start)
+            {
+                frame_resources.vertex_buffer_set[0].SetData(cmd_queue, rhi::SubResource(
+                    reinterpret_cast<Data::ConstRawPtr>(&m_vertices[begin_slot.vertex_offset]), // NOSONAR
+                    vertices_end - vertices_start, rhi::SubResource::Index(), rhi::BytesRange(vertices_start, vertices_end)
+                ));
+                frame_resources.index_buffer.SetData(cmd_queue, rhi::SubResource(
+                    reinterpret_cast<Data::ConstRawPtr>(&m_indices[begin_slot.index_offset]), // NOSONAR
+                    indices_end - indices_start, rhi::SubResource::Index(), rhi::BytesRange(indices_start, indices_end)
+                ));
+                m_statistics.uploaded_data_size += vertices_end - vertices_start + indices_end - indices_start;
+            }
+            m_statistics.uploaded_meshes_count += end_index - begin_index;
+            begin_index = end_index;
+        }
+    }
+
+    // Uploads instance data of texts with frame rect or color changed since the previous update of the frame buffer,
+    // adjacent changed instances are merged into single range
+    void UploadDirtyInstances(const FrameResources& frame_resources, FramesMask frame_mask)
+    {
+        META_FUNCTION_TASK();
+        const rhi::CommandQueue& cmd_queue   = m_ui_context.GetRenderContext().GetRenderCommandKit().GetQueue();
+        const auto               slots_count = static_cast<Data::Index>(m_text_slots.size());
+
+        for(Data::Index begin_index = 0U; begin_index < slots_count; ++begin_index)
+        {
+            if (!(m_text_slots[begin_index].dirty_instance_frames & frame_mask))
+                continue;
+
+            Data::Index end_index = begin_index;
+            while(end_index < slots_count && (m_text_slots[end_index].dirty_instance_frames & frame_mask))
+            {
+                m_text_slots[end_index].dirty_instance_frames &= ~frame_mask;
+                ++end_index;
+            }
+
+            const auto range_start = static_cast<Data::Size>(begin_index * sizeof(hlslpp::TextInstance));
+            const auto range_end   = static_cast<Data::Size>(end_index * sizeof(hlslpp::TextInstance));
+            frame_resources.instances_buffer.SetData(cmd_queue, rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(&m_instances[begin_index]), // NOSONAR
+                range_end - range_start, rhi::SubResource::Index(), rhi::BytesRange(range_start, range_end)
+            ));
+            m_statistics.uploaded_instances_count += end_index - begin_index;
+            m_statistics.uploaded_data_size       += range_end - range_start;
+            begin_index = end_index;
+        }
+    }
+
+    Context&          m_ui_context;
+    Settings          m_settings;
+    Font              m_font;
+    rhi::RenderState  m_render_state;
+    rhi::ViewState    m_view_state;
+    rhi::Sampler      m_atlas_sampler;
+    FrameSize         m_render_attachment_size;
+    FramesMask        m_all_frames_mask = 0U;
+    TextSlots         m_text_slots;
+    Vertices          m_vertices;
+    Indices           m_indices;
+    Instances         m_instances;
+    PerFrameResources m_frame_resources;
+    Statistics        m_statistics;
+    bool              m_is_layout_dirty = true;
+};
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(TextBatch);
+
+TextBatch::TextBatch(Context& ui_context, const rhi::RenderPattern& render_pattern, const Font& font, const Settings& settings)
+    : m_impl_ptr(std::make_shared<Impl>(ui_context, render_pattern, font, settings))
+{ }
+
+TextBatch::TextBatch(Context& ui_context, const Font& font, const Settings& settings)
+    : m_impl_ptr(std::make_shared<Impl>(ui_context, font, settings))
+{ }
+
+const TextBatch::Settings& TextBatch::GetSettings() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetSettings();
+}
+
+const Font& TextBatch::GetFont() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetFont();
+}
+
+const TextBatch::Statistics& TextBatch::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
+Data::Size TextBatch::GetTextsCount() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetTextsCount();
+}
+
+bool TextBatch::HasText(const Text& text) const
+{
+    return GetImpl(m_impl_ptr).HasText(text);
+}
+
+void TextBatch::AddText(const Text& text) const
+{
+    GetImpl(m_impl_ptr).AddText(text);
+}
+
+void TextBatch::RemoveText(const Text& text) const
+{
+    GetImpl(m_impl_ptr).RemoveText(text);
+}
+
+void TextBatch::Update(const gfx::FrameSize& render_attachment_size) const
+{
+    GetImpl(m_impl_ptr).Update(render_attachment_size);
+}
+
+void TextBatch::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
+{
+    GetImpl(m_impl_ptr).Draw(cmd_list, debug_group_ptr);
+}
+
+} // namespace Methane::UserInterface
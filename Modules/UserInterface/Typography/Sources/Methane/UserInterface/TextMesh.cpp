@@ -31,6 +31,7 @@ Methane text mesh generation helper.
 
 #include <ranges>
 #include <stdexcept>
+#include <cmath>
 
 namespace Methane::UserInterface
 {
@@ -44,30 +45,56 @@ enum class CharAction
 
 using IndexRange = std::pair<size_t, size_t>;
 
+// Font metrics in pixels of the font size are scaled to pixels of the text size, which may differ for distance field fonts
+[[nodiscard]] static int32_t ScaleFontMetric(int32_t font_metric, float font_scale) noexcept
+{
+    return font_scale == 1.F ? font_metric : static_cast<int32_t>(std::round(static_cast<float>(font_metric) * font_scale));
+}
+
+static void FillGlyphRun(Font::Impl& font, float font_scale, std::u32string_view text, TextMesh::GlyphRun& glyph_run)
+{
+    META_FUNCTION_TASK();
+    glyph_run.chars.reserve(text.length());
+    glyph_run.advances.reserve(text.length());
+    glyph_run.kernings.reserve(text.length());
+    glyph_run.visual_widths.reserve(text.length());
+
+    // Text characters are added to the font and counted in glyph cache statistics before text mesh update,
+    // so glyph run characters lookup is not counted as glyph cache hit one more time
+    for (const char32_t char_code : text)
+    {
+        const FontChar& text_char = font.AddChar(char_code, false);
+        const bool is_kerning_applied = !glyph_run.chars.empty() && !text_char.IsLineBreak() && !glyph_run.chars.back().get().IsLineBreak();
+        glyph_run.kernings.emplace_back(is_kerning_applied ? ScaleFontMetric(font.GetKerning(glyph_run.chars.back().get(), text_char).GetX(), font_scale) : 0);
+        glyph_run.advances.emplace_back(ScaleFontMetric(text_char.GetAdvance().GetX(), font_scale));
+        glyph_run.visual_widths.emplace_back(static_cast<uint32_t>(ScaleFontMetric(static_cast<int32_t>(text_char.GetVisualSize().GetWidth()), font_scale)));
+
+        // Glyph run characters are pinned in font glyph cache to prevent their eviction while glyph run is cached
+        font.PinChar(text_char);
+        glyph_run.chars.emplace_back(text_char);
+    }
+}
+
 template<typename FuncType> // function CharAction(const FontChar& text_char, const TextMesh::CharPosition& char_pos, size_t char_index)
-void ForEachTextCharacterInRange(const Font::Impl& font, const FontChars& text_chars, const IndexRange& index_range,
-                                 TextMesh::CharPositions& char_positions, uint32_t frame_width, Text::Wrap wrap,
-                                 FuncType process_char_at_position)
+void ForEachGlyphInRange(const TextMesh::GlyphRun& glyph_run, const IndexRange& index_range, TextMesh::CharPositions& char_positions,
+                         int32_t line_height, uint32_t frame_width, Text::Wrap wrap, FuncType process_char_at_position)
 {
     META_FUNCTION_TASK();
     META_CHECK_NOT_EMPTY(char_positions);
-    const FontChar* prev_text_char_ptr = nullptr;
-
     for (size_t char_index = index_range.first; char_index < index_range.second; ++char_index)
     {
-        const FontChar& text_char = text_chars[char_index].get();
+        const FontChar& text_char = glyph_run.chars[char_index].get();
         META_CHECK_NOT_ZERO(text_char);
 
         TextMesh::CharPosition& char_pos = char_positions.back();
         char_pos.is_whitespace = text_char.IsWhiteSpace();
         char_pos.is_line_break = text_char.IsLineBreak();
-        char_pos.visual_width  = text_char.GetVisualSize().GetWidth();
+        char_pos.visual_width  = glyph_run.visual_widths[char_index];
 
         // Wrap to next line and skip visualization of "line break" character
         if (text_char.IsLineBreak())
         {
-            char_positions.emplace_back(0, char_pos.GetY() + font.GetLineHeight(), true);
-            prev_text_char_ptr = nullptr;
+            char_positions.emplace_back(0, char_pos.GetY() + line_height, true);
             continue;
         }
 
@@ -76,28 +103,21 @@ void ForEachTextCharacterInRange(const Font::Impl& font, const FontChars& text_c
             wrap == Text::Wrap::Anywhere && frame_width && char_right_pos > frame_width)
         {
             char_pos.SetX(0);
-            char_pos.SetY(char_pos.GetY() + font.GetLineHeight());
+            char_pos.SetY(char_pos.GetY() + line_height);
             char_pos.is_line_start = true;
-            prev_text_char_ptr = nullptr;
         }
 
-        if (!prev_text_char_ptr && char_index && !text_chars[char_index - 1].get().IsLineBreak())
-            prev_text_char_ptr = &(text_chars[char_index - 1].get());
-
-        if(prev_text_char_ptr)
-            char_pos += font.GetKerning(*prev_text_char_ptr, text_char);
+        char_pos.SetX(char_pos.GetX() + glyph_run.kernings[char_index]);
 
         switch (const CharAction action = process_char_at_position(text_char, char_pos, char_index); action)
         {
         using enum CharAction;
         case Continue:
-            char_positions.emplace_back(char_pos.GetX() + text_char.GetAdvance().GetX(), char_pos.GetY());
-            prev_text_char_ptr = &text_char;
+            char_positions.emplace_back(char_pos.GetX() + glyph_run.advances[char_index], char_pos.GetY());
             break;
 
         case Wrap:
-            char_positions.emplace_back(0, char_pos.GetY() + font.GetLineHeight(), true);
-            prev_text_char_ptr = nullptr;
+            char_positions.emplace_back(0, char_pos.GetY() + line_height, true);
             break;
 
         case Stop:
@@ -110,16 +130,15 @@ void ForEachTextCharacterInRange(const Font::Impl& font, const FontChars& text_c
 }
 
 template<typename FuncType> // function CharAction(const FontChar& text_char, const TextMesh::CharPosition& char_pos, size_t char_index)
-static void ForEachTextCharacter(const std::u32string& text, Font::Impl& font, TextMesh::CharPositions& char_positions,
-                                 uint32_t frame_width, Text::Wrap wrap, FuncType process_char_at_position)
+static void ForEachGlyph(const TextMesh::GlyphRun& glyph_run, TextMesh::CharPositions& char_positions,
+                         int32_t line_height, uint32_t frame_width, Text::Wrap wrap, FuncType process_char_at_position)
 {
     META_FUNCTION_TASK();
-    const FontChars text_chars = font.GetTextChars(text);
-    const IndexRange  text_range { 0, text_chars.size() };
+    const IndexRange glyph_range { 0, glyph_run.chars.size() };
     if (wrap == Text::Wrap::Word && frame_width)
     {
-        ForEachTextCharacterInRange(font, text_chars, text_range, char_positions, frame_width, wrap,
-            [&font, &text_chars, &char_positions, &frame_width, &process_char_at_position] // NOSONAR - lambda function lines count is greater than 20
+        ForEachGlyphInRange(glyph_run, glyph_range, char_positions, line_height, frame_width, wrap,
+            [&glyph_run, &char_positions, line_height, frame_width, &process_char_at_position] // NOSONAR - lambda function lines count is greater than 20
             (const FontChar& text_char, const TextMesh::CharPosition& cur_char_pos, size_t char_index)
             {
                 if (text_char.IsWhiteSpace())
@@ -127,15 +146,15 @@ static void ForEachTextCharacter(const std::u32string& text, Font::Impl& font, T
                     // Word wrap prediction: check if next word fits in given frame width
                     bool word_wrap_required = false;
                     const size_t start_chars_count = char_positions.size();
-                    char_positions.emplace_back(cur_char_pos.GetX() + text_char.GetAdvance().GetX(), cur_char_pos.GetY());
-                    ForEachTextCharacterInRange(font, text_chars, { char_index + 1, text_chars.size() }, char_positions, frame_width, Text::Wrap::Anywhere,
-                        [&word_wrap_required, &cur_char_pos, &text_chars]
+                    char_positions.emplace_back(cur_char_pos.GetX() + glyph_run.advances[char_index], cur_char_pos.GetY());
+                    ForEachGlyphInRange(glyph_run, { char_index + 1, glyph_run.chars.size() }, char_positions, line_height, frame_width, Text::Wrap::Anywhere,
+                        [&word_wrap_required, &cur_char_pos, &glyph_run]
                         (const FontChar& inner_text_char, const gfx::FramePoint& char_pos, size_t inner_char_index)
                         {
                             using enum CharAction;
 
                             // Word has ended if whitespace character is received or line break character was passed
-                            if (inner_text_char.IsWhiteSpace() || (inner_char_index && text_chars[inner_char_index - 1].get().IsLineBreak()))
+                            if (inner_text_char.IsWhiteSpace() || (inner_char_index && glyph_run.chars[inner_char_index - 1].get().IsLineBreak()))
                                 return Stop;
 
                             word_wrap_required = char_pos.GetY() > cur_char_pos.GetY();
@@ -152,7 +171,7 @@ static void ForEachTextCharacter(const std::u32string& text, Font::Impl& font, T
     }
     else
     {
-        ForEachTextCharacterInRange(font, text_chars, text_range, char_positions, frame_width, wrap, process_char_at_position);
+        ForEachGlyphInRange(glyph_run, glyph_range, char_positions, line_height, frame_width, wrap, process_char_at_position);
     }
 }
 
@@ -162,48 +181,88 @@ TextMesh::CharPosition::CharPosition(CoordinateType x, CoordinateType y, bool is
 {
 }
 
-TextMesh::TextMesh(const std::u32string& text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size)
+TextMesh::TextMesh(const std::u32string& text, const Text::Layout& layout, Font& font, gfx::FrameSize& frame_size, float font_scale)
     : m_font(font)
+    , m_font_scale(font_scale)
     , m_layout(layout)
     , m_frame_size(frame_size)
+    , m_chars_version(font.GetImplementation().GetCharsVersion())
 {
     META_FUNCTION_TASK();
-    m_content_size.SetWidth(frame_size.GetWidth());
-
-    Update(text, frame_size);
+    Update(text, layout, frame_size);
 }
 
-bool TextMesh::IsUpdatable(const std::u32string& text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept
+TextMesh::~TextMesh()
 {
     META_FUNCTION_TASK();
-    // Text mesh can be updated when all text visualization parameters are equal to the initial
-    // and new text start with the previously used text (typing continued),
-    // or previous text starts with the new one (deleting with backspace)
-    return m_frame_size == frame_size &&
-           m_layout.wrap == layout.wrap &&
-           m_layout.horizontal_alignment == layout.horizontal_alignment && // vertical_alignment is not handled in TextMesh
-           std::addressof(m_font) == std::addressof(font) &&
-           (IsNewTextStartsWithOldOne(text) || IsOldTextStartsWithNewOne(text));
+    try
+    {
+        // Characters of cached paragraphs were removed from glyph cache on font characters reset
+        if (m_chars_version != m_font.GetImplementation().GetCharsVersion())
+            return;
+
+        for(const auto& [paragraph_text, paragraph] : m_paragraph_by_text)
+        {
+            UnpinParagraphChars(paragraph);
+        }
+    }
+    catch(const std::exception& e)
+    {
+        META_UNUSED(e);
+        META_LOG("WARNING: Unexpected error during TextMesh destruction: {}", e.what());
+        assert(false);
+    }
 }
 
-void TextMesh::Update(const std::u32string& text, gfx::FrameSize& frame_size)
+bool TextMesh::IsUpdatable(const Font& font, float font_scale) const noexcept
 {
     META_FUNCTION_TASK();
-    const bool new_text_starts_with_old_one = IsNewTextStartsWithOldOne(text);
-    const bool old_text_starts_with_new_one = IsOldTextStartsWithNewOne(text);
-
-    META_CHECK_EQUAL_DESCR(frame_size, m_frame_size, "text mesh can be incrementally updated only when frame size does not change");
-    META_CHECK_NAME_DESCR("text", new_text_starts_with_old_one || old_text_starts_with_new_one, "text mesh can be incrementally updated only when text is appended or backspaced");
+    // Text mesh can be updated with any text, layout and frame size, when the font is the same as initial,
+    // because the text paragraphs glyph runs and layouts are cached for the font characters scaled to text size
+    return std::addressof(m_font) == std::addressof(font) &&
+           m_font_scale == font_scale;
+}
 
-    if (new_text_starts_with_old_one)
+void TextMesh::Update(const std::u32string& text, const Text::Layout& layout, gfx::FrameSize& frame_size)
+{
+    META_FUNCTION_TASK();
+    if (const uint32_t chars_version = m_font.GetImplementation().GetCharsVersion();
+        m_chars_version != chars_version)
     {
-        AppendChars(text.substr(m_text.length()));
+        // Cached glyph runs reference font characters, which were released on font characters reset
+        m_paragraph_by_text.clear();
+        m_chars_version = chars_version;
     }
-    else if (old_text_starts_with_new_one)
+
+    m_text       = text;
+    m_layout     = layout;
+    m_frame_size = frame_size;
+    m_update_statistics = {};
+    m_update_index++;
+    m_paragraphs.clear();
+
+    // Font characters are taken from the text until the first null character
+    const std::u32string_view text_view = std::u32string_view(m_text).substr(0, m_text.find(U'\0'));
+    for(size_t paragraph_begin = 0; paragraph_begin < text_view.length();)
     {
-        EraseTrailingChars(m_text.length() - text.length(), true, true);
+        const size_t line_break_pos = text_view.find(U'\n', paragraph_begin);
+        const size_t paragraph_end  = line_break_pos == std::u32string_view::npos ? text_view.length() : line_break_pos + 1;
+        m_paragraphs.emplace_back(GetLaidOutParagraph(text_view.substr(paragraph_begin, paragraph_end - paragraph_begin)));
+        paragraph_begin = paragraph_end;
     }
 
+    // Release cached paragraphs which are not used in the current text and unpin their characters
+    std::erase_if(m_paragraph_by_text, [this](const auto& paragraph_by_text)
+        {
+            if (paragraph_by_text.second.update_index == m_update_index)
+                return false;
+
+            UnpinParagraphChars(paragraph_by_text.second);
+            return true;
+        });
+
+    ComposeParagraphs();
+
     if (frame_size)
         return;
 
@@ -216,171 +275,128 @@ void TextMesh::Update(const std::u32string& text, gfx::FrameSize& frame_size)
     {
         frame_size.SetHeight(m_content_size.GetHeight() - GetContentTopOffset());
     }
-
-    return;
 }
 
-void TextMesh::EraseTrailingChars(size_t erase_chars_count, bool fixup_whitespace, bool update_alignment_and_content_size)
+TextMesh::Paragraph& TextMesh::GetLaidOutParagraph(std::u32string_view paragraph_text)
 {
     META_FUNCTION_TASK();
-    if (!erase_chars_count)
-        return;
-
-    META_CHECK_LESS_DESCR(erase_chars_count, m_text.length() + 1, "unable to erase mote characters than text contains");
-    const size_t erase_chars_from_index = m_text.length() - erase_chars_count;
-    const size_t empty_symbols_count    = std::count_if(m_text.begin() + erase_chars_from_index, m_text.end(),
-                                            [](char32_t char_code) { return char_code < 255 && (char_code == '\n' || std::isspace(static_cast<int>(char_code))); });
-
-    META_CHECK_LESS(empty_symbols_count, erase_chars_count + 1);
-    const size_t erase_symbols_count = erase_chars_count - empty_symbols_count;
-
-    META_CHECK_LESS(erase_chars_count, m_char_positions.size() + 1);
-    META_CHECK_LESS(erase_symbols_count, m_vertices.size() / 4 + 1);
-    META_CHECK_LESS(erase_symbols_count, m_indices.size()  / 6 + 1);
-
-    m_char_positions.erase(m_char_positions.begin() + m_char_positions.size() - erase_chars_count, m_char_positions.end());
-    m_vertices.erase(m_vertices.begin() + m_vertices.size() - erase_symbols_count * 4, m_vertices.end());
-    m_indices.erase( m_indices.begin()  + m_indices.size()  - erase_symbols_count * 6, m_indices.end());
-    m_text.erase(m_text.begin() + erase_chars_from_index, m_text.end());
-
-    if (fixup_whitespace && m_last_whitespace_index >= m_text.length())
+    auto paragraph_it = m_paragraph_by_text.find(paragraph_text);
+    if (paragraph_it == m_paragraph_by_text.end())
     {
-        if (const auto whitespace_it = std::ranges::find_if(std::ranges::reverse_view(m_text),
-                [](char32_t char_code) { return char_code <= 255 && std::isspace(static_cast<int>(char_code)); });
-            whitespace_it != m_text.rend())
-        {
-            m_last_whitespace_index = std::distance(m_text.begin(), whitespace_it.base()) - 1;
-            META_CHECK(m_last_whitespace_index, m_char_positions[m_last_whitespace_index].IsWhiteSpaceOrLineBreak());
-        }
-        else
-        {
-            m_last_whitespace_index = std::string::npos;
-        }
+        paragraph_it = m_paragraph_by_text.try_emplace(std::u32string(paragraph_text)).first;
+        FillGlyphRun(m_font.GetImplementation(), m_font_scale, paragraph_text, paragraph_it->second.glyph_run);
+        m_update_statistics.shaped_paragraphs_count++;
     }
 
-    if (m_last_line_start_index >= m_text.length())
-    {
-        if (const auto line_start_it = std::ranges::find_if(std::ranges::reverse_view(m_char_positions),
-                [](const CharPosition& char_pos) { return char_pos.is_line_start; });
-            line_start_it != m_char_positions.rend())
-        {
-            m_last_line_start_index = std::distance(m_char_positions.begin(), line_start_it.base()) - 1;
-            META_CHECK(m_last_line_start_index, m_char_positions[m_last_line_start_index].is_line_start);
-        }
-        else
-        {
-            m_last_line_start_index = std::string::npos;
-        }
-    }
+    Paragraph& paragraph = paragraph_it->second;
+    paragraph.update_index = m_update_index;
 
-    if (update_alignment_and_content_size)
+    // Layout does not depend on frame width when text is not wrapped
+    const bool       is_wrapped  = m_layout.wrap != Text::Wrap::None && m_frame_size.GetWidth();
+    const Text::Wrap wrap        = is_wrapped ? m_layout.wrap : Text::Wrap::None;
+    const uint32_t   frame_width = is_wrapped ? m_frame_size.GetWidth() : 0U;
+    if (!paragraph.is_laid_out || paragraph.layout_wrap != wrap || paragraph.layout_frame_width != frame_width)
     {
-        UpdateContentSize();
-        ApplyAlignmentOffset(m_text.length(), m_last_line_start_index);
+        paragraph.layout_wrap        = wrap;
+        paragraph.layout_frame_width = frame_width;
+        LayoutParagraph(paragraph);
+        m_update_statistics.laid_out_paragraphs_count++;
     }
+    return paragraph;
 }
 
-void TextMesh::AppendChars(std::u32string added_text)
+void TextMesh::UnpinParagraphChars(const Paragraph& paragraph) const
 {
     META_FUNCTION_TASK();
-    if (added_text.empty())
-        return;
-
-    // Start adding new text characters from the previous text word (so that it can be properly wrapped) or from the last line start
-    if (m_layout.wrap == Text::Wrap::Word && !m_text.empty() &&
-         (m_last_whitespace_index != std::string::npos ||
-          m_last_line_start_index != std::string::npos))
+    Font::Impl& font = m_font.GetImplementation();
+    for(const FontChar& paragraph_char : paragraph.glyph_run.chars)
     {
-        // Remove characters starting with last whitespace and other non-whitespace symbols
-        size_t update_from_index = m_last_line_start_index;
-        if (m_last_whitespace_index != std::string::npos)
-        {
-            update_from_index = m_last_line_start_index != std::string::npos
-                              ? std::max(m_last_whitespace_index, m_last_line_start_index)
-                              : m_last_whitespace_index;
-        }
-        if (update_from_index < m_text.length())
-        {
-            added_text = m_text.substr(update_from_index) + added_text;
-            EraseTrailingChars(m_text.length() - update_from_index, false, false);
-        }
-        m_last_whitespace_index = std::string::npos;
+        font.UnpinChar(paragraph_char);
     }
+}
 
-    const size_t init_text_length  = m_text.length();
-    const size_t added_text_length = added_text.length();
-    const size_t init_line_start_index = m_last_line_start_index;
-
-    m_text.insert(m_text.end(), added_text.begin(), added_text.end());
+void TextMesh::LayoutParagraph(Paragraph& paragraph) const
+{
+    META_FUNCTION_TASK();
+    const int32_t line_height = ScaleFontMetric(static_cast<int32_t>(m_font.GetLineHeight()), m_font_scale);
 
-    const gfx::FrameSize& atlas_size = m_font.GetAtlasSize();
-    m_vertices.reserve(m_vertices.size() + added_text_length * 4);
-    m_indices.reserve(m_indices.size() + added_text_length * 6);
+    paragraph.char_positions.clear();
+    paragraph.char_positions.reserve(paragraph.glyph_run.chars.size() + 1);
+    paragraph.char_positions.emplace_back(0, 0, true);
 
-    if (m_char_positions.empty())
-    {
-        m_char_positions.emplace_back(0, static_cast<int32_t>(m_font.GetLineHeight()), true);
-    }
-    m_char_positions.reserve(m_char_positions.size() + added_text.length());
+    ForEachGlyph(paragraph.glyph_run, paragraph.char_positions, line_height, paragraph.layout_frame_width, paragraph.layout_wrap,
+        [](const FontChar&, const TextMesh::CharPosition&, size_t) { return CharAction::Continue; });
 
-    ForEachTextCharacter(added_text, m_font.GetImplementation(), m_char_positions, m_frame_size.GetWidth(), m_layout.wrap,
-        [this, init_text_length, &atlas_size](const FontChar& font_char, const TextMesh::CharPosition& char_pos, size_t char_index)
-        {
-            if (font_char.IsWhiteSpace())
-                m_last_whitespace_index = init_text_length + char_index;
+    paragraph.is_laid_out = true;
+}
 
-            if (font_char.IsWhiteSpace() || font_char.IsLineBreak())
-            {
-                META_CHECK(char_index, m_char_positions[init_text_length + char_index].IsWhiteSpaceOrLineBreak());
-                return CharAction::Continue;
-            }
+void TextMesh::ComposeParagraphs()
+{
+    META_FUNCTION_TASK();
+    m_char_positions.clear();
+    m_vertices.clear();
+    m_indices.clear();
+    m_content_size = { m_frame_size.GetWidth(), 0U };
+    m_content_top_offset = std::numeric_limits<uint32_t>::max();
 
-            if (char_pos.is_line_start)
-            {
-                m_last_line_start_index = init_text_length + char_index;
-                META_CHECK(m_last_line_start_index, m_char_positions[m_last_line_start_index].is_line_start);
-            }
+    if (m_paragraphs.empty())
+        return;
 
-            m_char_positions.back().start_vertex_index = m_vertices.size();
+    const gfx::FrameSize& atlas_size = m_font.GetAtlasSize();
+    m_char_positions.reserve(m_text.length() + 1);
+    m_vertices.reserve(m_text.length() * 4);
+    m_indices.reserve(m_text.length() * 6);
+
+    // Paragraph char positions are offset vertically by the height of previous paragraphs,
+    // character quads are generated for the current font atlas, so that atlas update does not invalidate cached layouts
+    auto paragraph_top = static_cast<gfx::FramePoint::CoordinateType>(ScaleFontMetric(static_cast<int32_t>(m_font.GetLineHeight()), m_font_scale));
+    for(const Paragraph& paragraph : m_paragraphs)
+    {
+        const CharPositions& paragraph_char_positions = paragraph.char_positions;
+        for(size_t char_index = 0; char_index < paragraph_char_positions.size() - 1; ++char_index)
+        {
+            CharPosition& char_pos = m_char_positions.emplace_back(paragraph_char_positions[char_index]);
+            char_pos.SetY(char_pos.GetY() + paragraph_top);
+            if (char_pos.IsWhiteSpaceOrLineBreak())
+                continue;
 
+            const FontChar& font_char = paragraph.glyph_run.chars[char_index].get();
+            char_pos.start_vertex_index = m_vertices.size();
             AddCharQuad(font_char, char_pos, atlas_size);
             UpdateContentSizeWithChar(font_char, char_pos);
-            return CharAction::Continue;
         }
-    );
+        paragraph_top += paragraph_char_positions.back().GetY();
+    }
 
-    if (m_char_positions.back().is_line_start)
-        m_last_line_start_index = m_char_positions.size() - 1;
+    // Position of the next character after the end of text
+    m_char_positions.emplace_back(m_paragraphs.back().get().char_positions.back()).SetY(paragraph_top);
 
-    ApplyAlignmentOffset(init_text_length, init_line_start_index);
+    ApplyAlignmentOffset();
 }
 
-void TextMesh::ApplyAlignmentOffset(const size_t aligned_text_length, const size_t line_start_index)
+void TextMesh::ApplyAlignmentOffset()
 {
     META_FUNCTION_TASK();
     if (m_layout.horizontal_alignment == Text::HorizontalAlignment::Left)
         return;
 
-    META_CHECK(line_start_index, m_char_positions[line_start_index].is_line_start);
+    META_CHECK_TRUE(m_char_positions.front().is_line_start);
     const size_t  end_char_index              = m_char_positions.size() - 1;
     int32_t       horizontal_alignment_offset = 0;
-    int32_t       line_start_offset           = 0;
     float         justified_whitespace_width  = 0.F;
     size_t        line_whitespace_index       = 0;
     const bool    justify_alignment_enabled   = m_layout.horizontal_alignment == Text::HorizontalAlignment::Justify &&
                                                 (m_layout.wrap == Text::Wrap::None || m_layout.wrap == Text::Wrap::Word);
 
-    // Apply horizontal alignment offset to newly added and existing character quads at last line
-    for(size_t char_index = line_start_index; char_index < end_char_index; ++char_index)
+    // Apply horizontal alignment offset to character quads of every line
+    for(size_t char_index = 0; char_index < end_char_index; ++char_index)
     {
         const CharPosition& char_position = m_char_positions[char_index];
         if (char_position.is_line_start &&
             !char_position.is_whitespace &&
             char_index <= end_char_index - 1)
         {
-            META_CHECK_LESS_DESCR(char_position.start_vertex_index, m_vertices.size(), "character start vertex index is invalid");
             line_whitespace_index = 0;
-            line_start_offset = static_cast<int32_t>(m_vertices[char_position.start_vertex_index].position[0]);
             horizontal_alignment_offset = GetHorizontalLineAlignmentOffset(char_index);
             if (justify_alignment_enabled)
             {
@@ -400,11 +416,7 @@ void TextMesh::ApplyAlignmentOffset(const size_t aligned_text_length, const size
 
         // Apply line alignment offset to the character quad vertices
         META_CHECK_LESS(char_position.start_vertex_index, m_vertices.size());
-        const int32_t alignment_offset = char_index < aligned_text_length
-                                       ? horizontal_alignment_offset - line_start_offset
-                                       : horizontal_alignment_offset;
-
-        const auto real_alignment_offset = static_cast<float>(alignment_offset);
+        const auto real_alignment_offset = static_cast<float>(horizontal_alignment_offset);
         for (size_t vertex_id = 0; vertex_id < 4; ++vertex_id)
         {
             m_vertices[char_position.start_vertex_index + vertex_id].position[0] += real_alignment_offset;
@@ -475,12 +487,12 @@ void TextMesh::AddCharQuad(const FontChar& font_char, const gfx::FramePoint& cha
     // Char quad rectangle in text model coordinates [0, 0] x [width, height]
     const gfx::Rect<float, float> ver_rect {
         {
-            static_cast<float>(char_pos.GetX() + font_char.GetOffset().GetX()),
-            static_cast<float>(char_pos.GetY() + font_char.GetOffset().GetY() + static_cast<int32_t>(font_char.GetRect().size.GetHeight())) * -1.F,
+            static_cast<float>(char_pos.GetX()) + static_cast<float>(font_char.GetOffset().GetX()) * m_font_scale,
+            (static_cast<float>(char_pos.GetY()) + static_cast<float>(font_char.GetOffset().GetY() + static_cast<int32_t>(font_char.GetRect().size.GetHeight())) * m_font_scale) * -1.F,
         },
         {
-            static_cast<float>(font_char.GetRect().size.GetWidth()),
-            static_cast<float>(font_char.GetRect().size.GetHeight()),
+            static_cast<float>(font_char.GetRect().size.GetWidth())  * m_font_scale,
+            static_cast<float>(font_char.GetRect().size.GetHeight()) * m_font_scale,
         }
     };
 
@@ -524,28 +536,14 @@ void TextMesh::AddCharQuad(const FontChar& font_char, const gfx::FramePoint& cha
     m_indices.push_back(start_index);
 }
 
-void TextMesh::UpdateContentSize()
-{
-    META_FUNCTION_TASK();
-    m_content_size = { 0U, 0U };
-    m_content_top_offset = std::numeric_limits<uint32_t>::max();
-    for(uint32_t vertex_index = 0; vertex_index < m_vertices.size(); vertex_index += 4)
-    {
-        m_content_top_offset  = std::min(m_content_top_offset,  static_cast<uint32_t>(-m_vertices[vertex_index].position[1]));
-        m_content_size.SetWidth( std::max(m_content_size.GetWidth(),  static_cast<uint32_t>( m_vertices[vertex_index + 2].position[0])));
-        m_content_size.SetHeight(std::max(m_content_size.GetHeight(), static_cast<uint32_t>(-m_vertices[vertex_index + 2].position[1])));
-    }
-
-    if (m_frame_size.GetWidth())
-        m_content_size.SetWidth(m_frame_size.GetWidth());
-}
-
 void TextMesh::UpdateContentSizeWithChar(const FontChar& font_char, const gfx::FramePoint& char_pos)
 {
     META_FUNCTION_TASK();
-    m_content_top_offset  = std::min(m_content_top_offset,  static_cast<uint32_t>(char_pos.GetY() + font_char.GetOffset().GetY()));
-    m_content_size.SetWidth( std::max(m_content_size.GetWidth(),  char_pos.GetX() + font_char.GetVisualSize().GetWidth()));
-    m_content_size.SetHeight(std::max(m_content_size.GetHeight(), char_pos.GetY() + font_char.GetVisualSize().GetHeight()));
+    const gfx::Point2I& char_offset = font_char.GetOffset();
+    const gfx::FrameSize& char_visual_size = font_char.GetVisualSize();
+    m_content_top_offset  = std::min(m_content_top_offset,  static_cast<uint32_t>(char_pos.GetY() + ScaleFontMetric(char_offset.GetY(), m_font_scale)));
+    m_content_size.SetWidth( std::max(m_content_size.GetWidth(),  char_pos.GetX() + static_cast<uint32_t>(ScaleFontMetric(static_cast<int32_t>(char_visual_size.GetWidth()), m_font_scale))));
+    m_content_size.SetHeight(std::max(m_content_size.GetHeight(), char_pos.GetY() + static_cast<uint32_t>(ScaleFontMetric(static_cast<int32_t>(char_visual_size.GetHeight()), m_font_scale))));
 }
 
 } // namespace Methane::Graphics
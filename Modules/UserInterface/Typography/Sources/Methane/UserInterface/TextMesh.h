@@ -23,10 +23,14 @@ Methane text mesh generation helper.
 
 #pragma once
 
+#include "FontChar.h"
+
 #include <Methane/UserInterface/Text.h>
 #include <Methane/Graphics/Types.h>
 
 #include <vector>
+#include <string_view>
+#include <unordered_map>
 
 namespace Methane::UserInterface
 {
@@ -34,8 +38,6 @@ namespace Methane::UserInterface
 namespace gfx = Methane::Graphics;
 namespace rhi = Methane::Graphics::Rhi;
 
-class FontChar;
-
 class TextMesh
 {
 public:
@@ -64,17 +66,45 @@ public:
 
     using CharPositions = std::vector<CharPosition>;
 
-    TextMesh(const std::u32string& text, Text::Layout layout, Font& font, gfx::FrameSize& frame_size);
+    // Glyph run of text characters with flat arrays of glyph metrics scaled to text size and indexed by character
+    struct GlyphRun
+    {
+        FontChars             chars;
+        std::vector<int32_t>  advances;
+        std::vector<int32_t>  kernings;      // kerning with previous character or zero for the first character
+        std::vector<uint32_t> visual_widths;
+    };
+
+    // Number of text paragraphs (lines ending with line break) which glyph runs and layouts were rebuilt by last update,
+    // while other paragraphs reused their cached glyph runs and layouts
+    struct UpdateStatistics
+    {
+        uint32_t shaped_paragraphs_count    = 0U;
+        uint32_t laid_out_paragraphs_count  = 0U;
+    };
+
+    // Font scale is a ratio of text size to font size, which is used to render text of any size with distance field font
+    TextMesh(const std::u32string& text, const Text::Layout& layout, Font& font, gfx::FrameSize& frame_size, float font_scale = 1.F);
+    ~TextMesh();
+
+    TextMesh(const TextMesh&) = delete;
+    TextMesh(TextMesh&&) = delete;
+
+    TextMesh& operator=(const TextMesh&) = delete;
+    TextMesh& operator=(TextMesh&&) = delete;
 
-    [[nodiscard]] bool IsUpdatable(const std::u32string& text, const Text::Layout& layout, Font& font, const gfx::FrameSize& frame_size) const noexcept;
-    void Update(const std::u32string& text, gfx::FrameSize& frame_size);
+    [[nodiscard]] bool IsUpdatable(const Font& font, float font_scale = 1.F) const noexcept;
+    void Update(const std::u32string& text, const Text::Layout& layout, gfx::FrameSize& frame_size);
 
-    [[nodiscard]] const std::u32string& GetText() const noexcept              { return m_text; }
-    [[nodiscard]] Font&                 GetFont() noexcept                    { return m_font; }
-    [[nodiscard]] Text::Layout          GetLayout() const noexcept            { return m_layout; }
-    [[nodiscard]] const gfx::FrameSize& GetFrameSize() const noexcept         { return m_frame_size; }
-    [[nodiscard]] const gfx::FrameSize& GetContentSize() const noexcept       { return m_content_size; }
-    [[nodiscard]] uint32_t              GetContentTopOffset() const noexcept  { return m_content_top_offset == std::numeric_limits<uint32_t>::max() ? 0U : m_content_top_offset; }
+    [[nodiscard]] const std::u32string&   GetText() const noexcept              { return m_text; }
+    [[nodiscard]] Font&                   GetFont() noexcept                    { return m_font; }
+    [[nodiscard]] float                   GetFontScale() const noexcept         { return m_font_scale; }
+    [[nodiscard]] Text::Layout            GetLayout() const noexcept            { return m_layout; }
+    [[nodiscard]] const gfx::FrameSize&   GetFrameSize() const noexcept         { return m_frame_size; }
+    [[nodiscard]] const gfx::FrameSize&   GetContentSize() const noexcept       { return m_content_size; }
+    [[nodiscard]] uint32_t                GetContentTopOffset() const noexcept  { return m_content_top_offset == std::numeric_limits<uint32_t>::max() ? 0U : m_content_top_offset; }
+    [[nodiscard]] const CharPositions&    GetCharPositions() const noexcept     { return m_char_positions; }
+    [[nodiscard]] const UpdateStatistics& GetUpdateStatistics() const noexcept  { return m_update_statistics; }
 
     [[nodiscard]] const Vertices& GetVertices() const noexcept                { return m_vertices; }
     [[nodiscard]] const Indices&  GetIndices() const noexcept                 { return m_indices; }
@@ -86,31 +116,50 @@ public:
     [[nodiscard]] Data::Size      GetIndicesDataSize() const noexcept         { return static_cast<Data::Size>(m_indices.size() * sizeof(Index)); }
 
 private:
-    void EraseTrailingChars(size_t erase_chars_count, bool fixup_whitespace, bool update_alignment_and_content_size);
-    void AppendChars(std::u32string added_text);
+    // Paragraph is a part of text ending with line break or with the text end, which is laid out independently of other paragraphs
+    // in its own coordinates starting from zero vertical offset, so that it is cached and reused while the paragraph text does not change
+    struct Paragraph
+    {
+        GlyphRun      glyph_run;
+        CharPositions char_positions; // positions of paragraph characters followed by the position of the next character
+        bool          is_laid_out        = false;
+        Text::Wrap    layout_wrap        = Text::Wrap::None;
+        uint32_t      layout_frame_width = 0U;
+        uint32_t      update_index       = 0U;
+    };
+
+    struct ParagraphTextHash
+    {
+        using is_transparent = void;
+        size_t operator()(std::u32string_view text) const noexcept { return std::hash<std::u32string_view>{}(text); }
+    };
+
+    using ParagraphByText = std::unordered_map<std::u32string, Paragraph, ParagraphTextHash, std::equal_to<>>;
+
+    Paragraph& GetLaidOutParagraph(std::u32string_view paragraph_text);
+    void UnpinParagraphChars(const Paragraph& paragraph) const;
+    void LayoutParagraph(Paragraph& paragraph) const;
+    void ComposeParagraphs();
     void AddCharQuad(const FontChar& font_char, const gfx::FramePoint& char_pos, const gfx::FrameSize& atlas_size);
-    void ApplyAlignmentOffset(const size_t aligned_text_length, const size_t line_start_index);
+    void ApplyAlignmentOffset();
     int32_t GetLineWidth(size_t line_start_index) const;
     int32_t GetHorizontalLineAlignmentOffset(size_t line_start_index) const;
     float GetJustifiedWhitespaceWidth(size_t line_start_index) const;
-    void UpdateContentSize();
     void UpdateContentSizeWithChar(const FontChar& font_char, const gfx::FramePoint& char_pos);
 
-    [[nodiscard]] bool IsNewTextStartsWithOldOne(std::u32string_view text) const noexcept
-    { return m_text.empty() || (m_text.length() < text.length()   && text.find(m_text) == 0); }
-
-    [[nodiscard]] bool IsOldTextStartsWithNewOne(std::u32string_view text) const noexcept
-    { return !text.empty()  &&  text.length()   < m_text.length() && m_text.find(text) == 0; }
-
     std::u32string       m_text;
     Font&                m_font;
-    const Text::Layout   m_layout;
-    const gfx::FrameSize m_frame_size;
+    const float          m_font_scale;
+    Text::Layout         m_layout;
+    gfx::FrameSize       m_frame_size;
     gfx::FrameSize       m_content_size;
     uint32_t             m_content_top_offset = std::numeric_limits<uint32_t>::max(); // minimum distance from frame top border to character quads in first text line
+    ParagraphByText      m_paragraph_by_text; // cache of glyph runs and layouts of text paragraphs used by the last update, which pin their font characters
+    Refs<Paragraph>      m_paragraphs;
+    uint32_t             m_update_index  = 0U;
+    uint32_t             m_chars_version = 0U;
+    UpdateStatistics     m_update_statistics;
     CharPositions        m_char_positions; // char positions without any hor/ver alignment
-    size_t               m_last_whitespace_index = std::string::npos;
-    size_t               m_last_line_start_index = 0U;
     Vertices             m_vertices;
     Indices              m_indices;
 };
@@ -72,10 +72,13 @@ public:
     HeadsUpDisplay(Context& ui_context, const FontContext& font_context, const Settings& settings);
 
     const Settings& GetHudSettings() const { return m_settings; }
+    Data::Size      GetLayoutsCount() const { return m_layouts_count; }
 
     void SetTextColor(const Color4F& text_color);
     void SetUpdateInterval(double update_interval_sec);
 
+    // Updates displayed values only without text blocks GPU resources, which are not used when HUD is drawn by widgets batch
+    void UpdateValues();
     void Update(const FrameSize& render_attachment_size);
     void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const override;
 
@@ -95,7 +98,9 @@ private:
 
     using TextItemPtrs = std::array<Ptr<TextItem>, static_cast<size_t>(TextBlock::Count)>;
     TextItem& GetTextBlock(TextBlock block) const;
+    bool SetTextBlockText(TextBlock block, std::string_view text) const;
 
+    void UpdateTextBlocks();
     void LayoutTextBlocks();
     void UpdateAllTextBlocks(const FrameSize& render_attachment_size) const;
 
@@ -104,6 +109,8 @@ private:
     const Font         m_minor_font;
     const TextItemPtrs m_text_blocks;
     Timer              m_update_timer;
+    bool               m_is_layout_dirty = true;
+    Data::Size         m_layouts_count = 0U;
 };
 
 } // namespace Methane::UserInterface
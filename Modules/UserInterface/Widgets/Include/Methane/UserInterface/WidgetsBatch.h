@@ -0,0 +1,105 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/WidgetsBatch.h
+Methane retained widgets batch rendering quads and texts of items tree
+with a few draw calls from one dynamic vertex stream per frame.
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/UserInterface/Types.hpp>
+#include <Methane/Data/Types.h>
+#include <Methane/Pimpl.h>
+
+#include <string>
+#include <string_view>
+
+namespace Methane::Graphics::Rhi
+{
+class RenderPattern;
+class RenderCommandList;
+class CommandListDebugGroup;
+}
+
+namespace Methane::UserInterface
+{
+
+namespace rhi = Methane::Graphics::Rhi;
+
+struct WidgetsBatchSettings
+{
+    std::string name;
+    Data::Size  buffers_reservation_multiplier = 2U;
+    std::string state_name = "Widgets Batch Pipeline State";
+
+    WidgetsBatchSettings& SetName(std::string_view new_name) noexcept                              { name = new_name; return *this; }
+    WidgetsBatchSettings& SetBuffersReservationMultiplier(Data::Size new_multiplier) noexcept      { buffers_reservation_multiplier = new_multiplier; return *this; }
+    WidgetsBatchSettings& SetStateName(std::string_view new_state_name) noexcept                   { state_name = new_state_name; return *this; }
+};
+
+struct WidgetsBatchStatistics
+{
+    Data::Size rebuilt_subtrees_count  = 0U; // root item subtrees collected again on last update due to children changes
+    Data::Size rebuilt_quads_count     = 0U; // quads with vertices regenerated on last update due to layout or content changes
+    Data::Size batched_quads_count     = 0U; // quads of screen-quad items drawn by the batch
+    Data::Size batched_texts_count     = 0U; // texts of text items drawn by the batch
+    Data::Size quad_draw_batches_count = 0U; // quad draw calls issued by the batch, one per texture change
+    Data::Size uploaded_data_size      = 0U; // size of quad vertices uploaded to the current frame buffer on last update
+};
+
+class Context;
+class Item;
+
+class WidgetsBatch // NOSONAR - manual copy, move constructors and assignment operators
+{
+public:
+    using Settings   = WidgetsBatchSettings;
+    using Statistics = WidgetsBatchStatistics;
+
+    META_PIMPL_DEFAULT_CONSTRUCT_METHODS_DECLARE_NO_INLINE(WidgetsBatch);
+
+    WidgetsBatch(Context& ui_context, const rhi::RenderPattern& render_pattern, const Settings& settings);
+    WidgetsBatch(Context& ui_context, const Settings& settings);
+
+    bool IsInitialized() const noexcept { return static_cast<bool>(m_impl_ptr); }
+
+    [[nodiscard]] const Settings&   GetSettings() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] const Statistics& GetStatistics() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] Data::Size        GetItemsCount() const META_PIMPL_NOEXCEPT;
+    [[nodiscard]] bool              HasItem(const Item& item) const;
+
+    // Root items are drawn by the batch only along with all their children: screen-quad items (panels, badges)
+    // are drawn as quads in tree order level by level, then text items are drawn over quads with text batch per font.
+    // NOTE: texts are drawn after all quads of the batch, so text of one item is drawn over quads of the items
+    //       following it in the tree, e.g. over panel overlapping it; overlapping widgets with texts shall be drawn
+    //       with separate widgets batches in the required order.
+    void AddItem(Item& item) const;
+    void RemoveItem(const Item& item) const;
+
+    void Update(const gfx::FrameSize& render_attachment_size) const;
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr = nullptr) const;
+
+private:
+    class Impl;
+
+    Ptr<Impl> m_impl_ptr;
+};
+
+} // namespace Methane::UserInterface
@@ -0,0 +1,68 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: MethaneKit/Modules/UserInterface/Widgets/Shaders/WidgetsBatch.hlsl
+Shaders for batched rendering of widget quads with per-vertex color and texture mode
+
+******************************************************************************/
+
+// Texture modes match values of Methane::Graphics::ScreenQuad::TextureMode enum
+#define TEXTURE_MODE_DISABLED          0
+#define TEXTURE_MODE_RGBA_FLOAT        1
+#define TEXTURE_MODE_R_FLOAT_TO_ALPHA  2
+
+struct VSInput
+{
+    float2 position                     : POSITION;
+    float2 texcoord                     : TEXCOORD;
+    float4 color                        : COLOR;
+    uint   texture_mode                 : TEXTURE_MODE;
+};
+
+struct PSInput
+{
+    float4 position                     : SV_POSITION;
+    float2 texcoord                     : TEXCOORD;
+    float4 color                        : COLOR;
+    nointerpolation uint texture_mode   : TEXTURE_MODE;
+};
+
+Texture2D<float4> g_texture : register(t0, META_ARG_MUTABLE);
+SamplerState      g_sampler : register(s0, META_ARG_CONSTANT);
+
+PSInput WidgetsBatchVS(VSInput input)
+{
+    PSInput output;
+    output.position     = float4(input.position, 0.F, 1.F);
+    output.texcoord     = input.texcoord;
+    output.color        = input.color;
+    output.texture_mode = input.texture_mode;
+    return output;
+}
+
+float4 WidgetsBatchPS(PSInput input) : SV_TARGET
+{
+    if (input.texture_mode == TEXTURE_MODE_DISABLED)
+        return input.color;
+
+    const float4 texel = g_texture.Sample(g_sampler, input.texcoord);
+    if (input.texture_mode == TEXTURE_MODE_R_FLOAT_TO_ALPHA)
+        return float4(1.F, 1.F, 1.F, texel.r) * input.color;
+
+    return texel * input.color;
+}
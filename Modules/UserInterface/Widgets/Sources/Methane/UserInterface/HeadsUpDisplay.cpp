@@ -267,32 +267,19 @@ void HeadsUpDisplay::SetUpdateInterval(double update_interval_sec)
 }
 
 void HeadsUpDisplay::Update(const FrameSize& render_attachment_size)
+{
+    META_FUNCTION_TASK();
+    UpdateValues();
+    UpdateAllTextBlocks(render_attachment_size);
+}
+
+void HeadsUpDisplay::UpdateValues()
 {
     META_FUNCTION_TASK();
     if (m_update_timer.GetElapsedSecondsD() < m_settings.update_interval_sec)
-    {
-        UpdateAllTextBlocks(render_attachment_size);
         return;
-    }
-
-    const Data::IFpsCounter&          fps_counter      = GetUIContext().GetRenderContext().GetFpsCounter();
-    const rhi::RenderContextSettings& context_settings = GetUIContext().GetRenderContext().GetSettings();
-
-    using enum TextBlock;
-    GetTextBlock(Fps).SetText(fmt::format("{:d} FPS", fps_counter.GetFramesPerSecond()));
-    GetTextBlock(FrameTime).SetText(fmt::format("{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
-    GetTextBlock(CpuTime).SetText(fmt::format("{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
-    GetTextBlock(GpuName).SetText(GetUIContext().GetRenderContext().GetDevice().GetAdapterName());
-    GetTextBlock(FrameBuffersAndApi).SetText(fmt::format("{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
-                                                         context_settings.frame_size.GetWidth(),
-                                                         context_settings.frame_size.GetHeight(),
-                                                         context_settings.frame_buffers_count,
-                                                         magic_enum::enum_name(rhi::ISystem::GetNativeApi())));
-    GetTextBlock(VSync).SetText(context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
-    GetTextBlock(VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
 
-    LayoutTextBlocks();
-    UpdateAllTextBlocks(render_attachment_size);
+    UpdateTextBlocks();
     m_update_timer.Reset();
 }
 
@@ -315,6 +302,45 @@ TextItem& HeadsUpDisplay::GetTextBlock(TextBlock block) const
     return *text_item_ptr;
 }
 
+bool HeadsUpDisplay::SetTextBlockText(TextBlock block, std::string_view text) const
+{
+    META_FUNCTION_TASK();
+    TextItem&       text_block      = GetTextBlock(block);
+    const FrameSize text_block_size = text_block.GetRectInPixels().size;
+    text_block.SetText(text);
+    return text_block.GetRectInPixels().size != text_block_size;
+}
+
+void HeadsUpDisplay::UpdateTextBlocks()
+{
+    META_FUNCTION_TASK();
+    const Data::IFpsCounter&          fps_counter      = GetUIContext().GetRenderContext().GetFpsCounter();
+    const rhi::RenderContextSettings& context_settings = GetUIContext().GetRenderContext().GetSettings();
+
+    // Text blocks are laid out again only when size of any text block has changed,
+    // so that HUD values with unchanged text do not rebuild text meshes and panel layout
+    using enum TextBlock;
+    bool is_layout_dirty = m_is_layout_dirty;
+    is_layout_dirty |= SetTextBlockText(Fps, fmt::format("{:d} FPS", fps_counter.GetFramesPerSecond()));
+    is_layout_dirty |= SetTextBlockText(FrameTime, fmt::format("{:.2f} ms", fps_counter.GetAverageFrameTiming().GetTotalTimeMSec()));
+    is_layout_dirty |= SetTextBlockText(CpuTime, fmt::format("{:.2f}% cpu", fps_counter.GetAverageFrameTiming().GetCpuTimePercent()));
+    is_layout_dirty |= SetTextBlockText(GpuName, GetUIContext().GetRenderContext().GetDevice().GetAdapterName());
+    is_layout_dirty |= SetTextBlockText(FrameBuffersAndApi, fmt::format("{:d} x {:d}  {:d} FB  {:s}", // NOSONAR - string contains invisible NBSP symbols
+                                                                        context_settings.frame_size.GetWidth(),
+                                                                        context_settings.frame_size.GetHeight(),
+                                                                        context_settings.frame_buffers_count,
+                                                                        magic_enum::enum_name(rhi::ISystem::GetNativeApi())));
+    is_layout_dirty |= SetTextBlockText(VSync, context_settings.vsync_enabled ? "VSync ON" : "VSync OFF");
+    GetTextBlock(VSync).SetColor(context_settings.vsync_enabled ? m_settings.on_color : m_settings.off_color);
+
+    if (!is_layout_dirty)
+        return;
+
+    LayoutTextBlocks();
+    m_is_layout_dirty = false;
+    m_layouts_count++;
+}
+
 void HeadsUpDisplay::LayoutTextBlocks()
 {
     META_FUNCTION_TASK();
@@ -0,0 +1,843 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Methane/UserInterface/WidgetsBatch.cpp
+Methane retained widgets batch rendering quads and texts of items tree
+with a few draw calls from one dynamic vertex stream per frame.
+
+******************************************************************************/
+
+#include <Methane/UserInterface/WidgetsBatch.h>
+#include <Methane/UserInterface/Container.h>
+#include <Methane/UserInterface/Context.h>
+#include <Methane/UserInterface/TextBatch.h>
+#include <Methane/UserInterface/Text.h>
+#include <Methane/UserInterface/Font.h>
+#include <Methane/Graphics/ScreenQuad.h>
+
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandListDebugGroup.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/BufferSet.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/Sampler.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Data/AppResourceProviders.h>
+#include <Methane/Data/Receiver.hpp>
+#include <Methane/Data/Vector.hpp>
+#include <Methane/Instrumentation.h>
+#include <Methane/Checks.hpp>
+#include <Methane/Pimpl.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <tuple>
+#include <unordered_map>
+
+namespace Methane::UserInterface
+{
+
+class WidgetsBatch::Impl final
+    : private Data::Receiver<IContainerCallback> //NOSONAR
+{
+public:
+    Impl(Context& ui_context, const rhi::RenderPattern& render_pattern, const Settings& settings)
+        : m_ui_context(ui_context)
+        , m_render_pattern(render_pattern)
+        , m_settings(settings)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_EMPTY_DESCR(m_settings.state_name, "widgets batch state name can not be empty");
+        META_CHECK_NOT_ZERO_DESCR(m_settings.buffers_reservation_multiplier, "widgets batch buffers reservation multiplier can not be zero");
+
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        const uint32_t frame_buffers_count = render_context.GetSettings().frame_buffers_count;
+        META_CHECK_LESS_DESCR(frame_buffers_count, static_cast<uint32_t>(std::numeric_limits<FramesMask>::digits),
+                              "frame buffers count is too large for widgets batch dirty frames mask");
+        m_all_frames_mask = (FramesMask{ 1U } << frame_buffers_count) - 1U;
+        m_frame_resources.resize(frame_buffers_count);
+
+        rhi::ObjectRegistry gfx_objects_registry = render_context.GetObjectRegistry();
+        m_render_state = gfx_objects_registry.GetGraphicsObject<rhi::RenderState>(m_settings.state_name);
+        if (m_render_state.IsInitialized())
+        {
+            META_CHECK_EQUAL_DESCR(m_render_state.GetSettings().render_pattern_ptr->GetSettings(), render_pattern.GetSettings(),
+                                   "Widgets batch '{}' render state '{}' from cache has incompatible render pattern settings",
+                                   m_settings.name, m_settings.state_name);
+        }
+        else
+        {
+            // Solid and textured quads of all widgets are drawn with the same alpha-blended pipeline state,
+            // while texture mode of the quad is selected in pixel shader by vertex attribute
+            rhi::RenderState::Settings state_settings
+            {
+                .program = rhi::Program(
+                    render_context,
+                    rhi::Program::Settings
+                    {
+                        .shader_set = rhi::Program::ShaderSet
+                        {
+                            { rhi::ShaderType::Vertex, { Data::ShaderProvider::Get(), { "WidgetsBatch", "WidgetsBatchVS" }, {} } },
+                            { rhi::ShaderType::Pixel,  { Data::ShaderProvider::Get(), { "WidgetsBatch", "WidgetsBatchPS" }, {} } },
+                        },
+                        .input_buffer_layouts = rhi::ProgramInputBufferLayouts
+                        {
+                            rhi::Program::InputBufferLayout
+                            {
+                                rhi::Program::InputBufferLayout::ArgumentSemantics{ "POSITION", "TEXCOORD", "COLOR", "TEXTURE_MODE" }
+                            }
+                        },
+                        .argument_accessors = rhi::ProgramArgumentAccessors{ },
+                        .attachment_formats = render_pattern.GetAttachmentFormats()
+                    }),
+                .render_pattern = render_pattern,
+                .rasterizer = rhi::RasterizerSettings
+                {
+                    .is_front_counter_clockwise = true
+                },
+                .depth = rhi::DepthSettings
+                {
+                    .enabled       = false,
+                    .write_enabled = false
+                }
+            };
+            state_settings.blending.render_targets[0] = rhi::RenderTargetSettings
+            {
+                .blend_enabled             = true,
+                .source_rgb_blend_factor   = rhi::BlendingFactor::SourceAlpha,
+                .source_alpha_blend_factor = rhi::BlendingFactor::Zero,
+                .dest_rgb_blend_factor     = rhi::BlendingFactor::OneMinusSourceAlpha,
+                .dest_alpha_blend_factor   = rhi::BlendingFactor::Zero
+            };
+            state_settings.program.SetName("Widgets Batch Shading");
+
+            m_render_state = render_context.CreateRenderState(state_settings);
+            m_render_state.SetName(m_settings.state_name);
+
+            gfx_objects_registry.AddGraphicsObject(m_render_state);
+        }
+
+        // Sampler is shared with screen-quads having the same sampling settings
+        static const std::string s_sampler_name = "Screen-Quad Sampler";
+        m_texture_sampler = gfx_objects_registry.GetGraphicsObject<rhi::Sampler>(s_sampler_name);
+        if (!m_texture_sampler.IsInitialized())
+        {
+            m_texture_sampler = render_context.CreateSampler(
+                rhi::SamplerSettings
+                {
+                    .filter  = rhi::ISampler::Filter(rhi::ISampler::Filter::MinMag::Linear),
+                    .address = rhi::ISampler::Address(rhi::ISampler::Address::Mode::ClampToZero),
+                });
+            m_texture_sampler.SetName(s_sampler_name);
+            gfx_objects_registry.AddGraphicsObject(m_texture_sampler);
+        }
+
+        // Blank texture is bound to draw batches of solid quads only, which do not sample texture in pixel shader
+        static const std::string s_blank_texture_name = "Widgets Batch Blank Texture";
+        m_blank_texture = gfx_objects_registry.GetGraphicsObject<rhi::Texture>(s_blank_texture_name);
+        if (!m_blank_texture.IsInitialized())
+        {
+            static constexpr uint32_t s_white_pixel = 0xFFFFFFFFU;
+            m_blank_texture = render_context.CreateTexture(
+                rhi::TextureSettings::ForImage(gfx::Dimensions(1U, 1U), std::nullopt, gfx::PixelFormat::RGBA8Unorm, false));
+            m_blank_texture.SetName(s_blank_texture_name);
+            m_blank_texture.SetData(m_ui_context.GetRenderCommandQueue(),
+                { rhi::SubResource(reinterpret_cast<Data::ConstRawPtr>(&s_white_pixel), static_cast<Data::Size>(sizeof(s_white_pixel))) }); // NOSONAR
+            gfx_objects_registry.AddGraphicsObject(m_blank_texture);
+        }
+    }
+
+    Impl(Context& ui_context, const Settings& settings)
+        : Impl(ui_context, ui_context.GetRenderPattern(), settings)
+    { }
+
+    [[nodiscard]] const Settings& GetSettings() const noexcept
+    { return m_settings; }
+
+    [[nodiscard]] const Statistics& GetStatistics() const noexcept
+    { return m_statistics; }
+
+    [[nodiscard]] Data::Size GetItemsCount() const noexcept
+    { return static_cast<Data::Size>(m_root_items.size()); }
+
+    [[nodiscard]] bool HasItem(const Item& item) const
+    {
+        META_FUNCTION_TASK();
+        return FindRootItem(item) != m_root_items.end();
+    }
+
+    void AddItem(Item& item)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_FALSE_DESCR(HasItem(item), "item was already added to the widgets batch '{}'", m_settings.name);
+
+        // Root item is retained by the batch, while its children are retained by parent containers
+        m_root_items.push_back(RootItem{ .item_ptr = item.GetPtr() });
+        m_is_layout_dirty = true;
+    }
+
+    void RemoveItem(const Item& item)
+    {
+        META_FUNCTION_TASK();
+        const auto root_item_it = FindRootItem(item);
+        META_CHECK_TRUE_DESCR(root_item_it != m_root_items.end(), "item was not found in the widgets batch '{}'", m_settings.name);
+
+        for(const Text& text : root_item_it->texts)
+        {
+            GetTextBatch(text.GetFont()).RemoveText(text);
+        }
+
+        m_root_items.erase(root_item_it);
+        m_is_layout_dirty = true;
+    }
+
+    void Update(const gfx::FrameSize& render_attachment_size)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_NOT_ZERO_DESCR(render_attachment_size, "widgets batch can not be updated with zero render attachment size");
+        m_statistics = {};
+
+        if (m_render_attachment_size != render_attachment_size)
+        {
+            UpdateViewState(render_attachment_size);
+        }
+
+        for(RootItem& root_item : m_root_items)
+        {
+            if (!root_item.is_dirty)
+                continue;
+
+            CollectRootItem(root_item);
+            m_statistics.rebuilt_subtrees_count++;
+        }
+
+        if (m_is_layout_dirty)
+        {
+            LayoutQuadSlots();
+        }
+
+        UpdateQuadSlots();
+
+        if (m_is_draw_batches_dirty)
+        {
+            BuildDrawBatches();
+        }
+
+        UpdateFrameResources(m_ui_context.GetRenderContext().GetFrameBufferIndex());
+
+        for(const TextBatch& text_batch : m_text_batches)
+        {
+            text_batch.Update(render_attachment_size);
+            m_statistics.batched_texts_count += text_batch.GetStatistics().batched_texts_count;
+        }
+
+        m_statistics.batched_quads_count     = static_cast<Data::Size>(m_quad_slot_ptrs.size());
+        m_statistics.quad_draw_batches_count = static_cast<Data::Size>(m_draw_batches.size());
+    }
+
+    void Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr)
+    {
+        META_FUNCTION_TASK();
+        if (const FrameResources& frame_resources = GetCurrentFrameResources();
+            frame_resources.quads_count && !m_draw_batches.empty())
+        {
+            cmd_list.ResetWithStateOnce(m_render_state, debug_group_ptr);
+            cmd_list.SetViewState(m_view_state);
+            cmd_list.SetVertexBuffers(frame_resources.vertex_buffer_set);
+            cmd_list.SetIndexBuffer(frame_resources.index_buffer);
+
+            for(const DrawBatch& draw_batch : m_draw_batches)
+            {
+                cmd_list.SetProgramBindings(m_texture_bindings[draw_batch.texture_bindings_index].program_bindings);
+                cmd_list.DrawIndexed(rhi::RenderPrimitive::Triangle,
+                                     draw_batch.quads_count * g_quad_indices_count,
+                                     draw_batch.first_quad_index * g_quad_indices_count);
+            }
+        }
+
+        for(const TextBatch& text_batch : m_text_batches)
+        {
+            text_batch.Draw(cmd_list, debug_group_ptr);
+        }
+    }
+
+private:
+    using FramesMask  = uint32_t;
+    using Index       = uint32_t;
+    using TextureMode = gfx::ScreenQuad::TextureMode;
+
+    static constexpr uint32_t g_quad_vertices_count = 4U;
+    static constexpr uint32_t g_quad_indices_count  = 6U;
+
+    struct Vertex
+    {
+        Data::RawVector2F position;
+        Data::RawVector2F texcoord;
+        Data::RawVector4F color;
+        uint32_t          texture_mode;
+    };
+
+    using QuadVertices = std::array<Vertex, g_quad_vertices_count>;
+    using Vertices     = std::vector<Vertex>;
+    using Indices      = std::vector<Index>;
+
+    // Quad of the screen-quad item with cached vertices, which are regenerated only on quad layout or content change
+    struct QuadSlot
+    {
+        Item*                  item_ptr          = nullptr;
+        const gfx::ScreenQuad* screen_quad_ptr   = nullptr;
+        Data::Index            depth             = 0U;
+        Data::Index            texture_order     = 0U;
+        Data::Index            quad_index        = std::numeric_limits<Data::Index>::max();
+        bool                   is_valid          = false;
+        FrameRect              screen_rect;
+        gfx::Color4F           color;
+        TextureMode            texture_mode      = TextureMode::Disabled;
+        rhi::Texture           texture;
+        QuadVertices           vertices{};
+        FramesMask             dirty_frames      = 0U;
+    };
+
+    using QuadSlots    = std::vector<QuadSlot>;
+    using QuadSlotPtrs = std::vector<QuadSlot*>;
+
+    // Root item subtree is collected again only when children of any container in this subtree have changed
+    struct RootItem
+    {
+        Ptr<Item>               item_ptr;
+        bool                    is_dirty = true;
+        std::vector<Container*> containers;
+        QuadSlots               quad_slots;
+        std::vector<Text>       texts;
+    };
+
+    using RootItems = std::vector<RootItem>;
+
+    struct DrawBatch
+    {
+        Data::Index texture_bindings_index = 0U;
+        uint32_t    first_quad_index       = 0U;
+        uint32_t    quads_count            = 0U;
+    };
+
+    using DrawBatches = std::vector<DrawBatch>;
+
+    struct TextureBindings
+    {
+        rhi::Texture         texture;
+        rhi::ProgramBindings program_bindings;
+    };
+
+    struct FrameResources
+    {
+        rhi::BufferSet vertex_buffer_set;
+        rhi::Buffer    index_buffer;
+        uint32_t       quads_count = 0U;
+    };
+
+    using PerFrameResources = std::vector<FrameResources>;
+
+    [[nodiscard]] RootItems::const_iterator FindRootItem(const Item& item) const
+    {
+        return std::ranges::find_if(m_root_items, [&item](const RootItem& root_item)
+                                    { return root_item.item_ptr.get() == std::addressof(item); });
+    }
+
+    [[nodiscard]] static bool IsSameText(const Text& left, const Text& right)
+    {
+        return std::addressof(left.GetImplementation()) == std::addressof(right.GetImplementation());
+    }
+
+    [[nodiscard]] TextBatch& GetTextBatch(const Font& font)
+    {
+        META_FUNCTION_TASK();
+        if (const auto text_batch_it = std::ranges::find_if(m_text_batches, [&font](const TextBatch& text_batch)
+                                                             { return text_batch.GetFont() == font; });
+            text_batch_it != m_text_batches.end())
+            return *text_batch_it;
+
+        return m_text_batches.emplace_back(m_ui_context, m_render_pattern, font,
+                                           TextBatch::Settings{ .name = fmt::format("{} {}", m_settings.name, font.GetSettings().description.name) });
+    }
+
+    FrameResources& GetCurrentFrameResources()
+    {
+        META_FUNCTION_TASK();
+        const uint32_t frame_index = m_ui_context.GetRenderContext().GetFrameBufferIndex();
+        META_CHECK_LESS_DESCR(frame_index, m_frame_resources.size(), "no resources available for the current frame buffer index");
+        return m_frame_resources[frame_index];
+    }
+
+    void UpdateViewState(const gfx::FrameSize& render_attachment_size)
+    {
+        META_FUNCTION_TASK();
+        m_render_attachment_size = render_attachment_size;
+
+        // All quads are drawn with one viewport covering render attachment, so that quad vertices are in normalized device coordinates
+        if (m_view_state.IsInitialized())
+        {
+            m_view_state.SetViewports({ gfx::GetFrameViewport(m_render_attachment_size) });
+            m_view_state.SetScissorRects({ gfx::GetFrameScissorRect(m_render_attachment_size) });
+        }
+        else
+        {
+            m_view_state = rhi::ViewState({
+                { gfx::GetFrameViewport(m_render_attachment_size) },
+                { gfx::GetFrameScissorRect(m_render_attachment_size) }
+            });
+        }
+
+        for(RootItem& root_item : m_root_items)
+        {
+            for(QuadSlot& quad_slot : root_item.quad_slots)
+            {
+                quad_slot.is_valid = false;
+            }
+        }
+    }
+
+    // Collects quads and texts of the root item subtree, while quads of items collected before keep their cached vertices
+    void CollectRootItem(RootItem& root_item)
+    {
+        META_FUNCTION_TASK();
+        std::unordered_map<const Item*, QuadSlot> prev_quad_slots;
+        for(QuadSlot& quad_slot : root_item.quad_slots)
+        {
+            prev_quad_slots.try_emplace(quad_slot.item_ptr, std::move(quad_slot));
+        }
+
+        std::vector<Text>         prev_texts = std::move(root_item.texts);
+        std::vector<rhi::Texture> textures;
+        root_item.containers.clear();
+        root_item.quad_slots.clear();
+        root_item.texts.clear();
+
+        CollectItem(root_item, *root_item.item_ptr, 0U, textures);
+
+        for(QuadSlot& quad_slot : root_item.quad_slots)
+        {
+            const auto prev_quad_slot_it = prev_quad_slots.find(quad_slot.item_ptr);
+            if (prev_quad_slot_it == prev_quad_slots.end())
+                continue;
+
+            const QuadSlot& prev_quad_slot = prev_quad_slot_it->second;
+            quad_slot.quad_index   = prev_quad_slot.quad_index;
+            quad_slot.is_valid     = prev_quad_slot.is_valid;
+            quad_slot.screen_rect  = prev_quad_slot.screen_rect;
+            quad_slot.color        = prev_quad_slot.color;
+            quad_slot.texture_mode = prev_quad_slot.texture_mode;
+            quad_slot.texture      = prev_quad_slot.texture;
+            quad_slot.vertices     = prev_quad_slot.vertices;
+            quad_slot.dirty_frames = prev_quad_slot.dirty_frames;
+        }
+
+        // Quads are drawn level by level from root to leaves, while quads of one level are grouped by texture,
+        // so that items of the same level are expected not to overlap each other
+        std::ranges::stable_sort(root_item.quad_slots, [](const QuadSlot& left, const QuadSlot& right)
+                                 { return std::tie(left.depth, left.texture_order) < std::tie(right.depth, right.texture_order); });
+
+        for(const Text& prev_text : prev_texts)
+        {
+            if (std::ranges::none_of(root_item.texts, [&prev_text](const Text& text) { return IsSameText(text, prev_text); }))
+                GetTextBatch(prev_text.GetFont()).RemoveText(prev_text);
+        }
+        for(const Text& text : root_item.texts)
+        {
+            if (TextBatch& text_batch = GetTextBatch(text.GetFont());
+                !text_batch.HasText(text))
+                text_batch.AddText(text);
+        }
+
+        root_item.is_dirty = false;
+        m_is_layout_dirty  = true;
+    }
+
+    void CollectItem(RootItem& root_item, Item& item, Data::Index depth, std::vector<rhi::Texture>& textures)
+    {
+        META_FUNCTION_TASK();
+        if (const auto* screen_quad_ptr = dynamic_cast<const gfx::ScreenQuad*>(&item);
+            screen_quad_ptr && screen_quad_ptr->IsInitialized())
+        {
+            root_item.quad_slots.push_back(QuadSlot{
+                .item_ptr        = &item,
+                .screen_quad_ptr = screen_quad_ptr,
+                .depth           = depth,
+                .texture_order   = GetTextureOrder(*screen_quad_ptr, textures)
+            });
+        }
+
+        if (const auto* text_ptr = dynamic_cast<const Text*>(&item);
+            text_ptr && text_ptr->IsInitialized())
+        {
+            root_item.texts.push_back(*text_ptr);
+        }
+
+        auto* container_ptr = dynamic_cast<Container*>(&item);
+        if (!container_ptr)
+            return;
+
+        // Container remains connected after removal from the batch, while its changes are ignored by the batch
+        container_ptr->Data::Emitter<IContainerCallback>::Connect(*this);
+        root_item.containers.push_back(container_ptr);
+
+        for(const Ptr<Item>& child_ptr : container_ptr->GetChildren())
+        {
+            if (child_ptr)
+                CollectItem(root_item, *child_ptr, depth + 1U, textures);
+        }
+    }
+
+    [[nodiscard]] static Data::Index GetTextureOrder(const gfx::ScreenQuad& screen_quad, std::vector<rhi::Texture>& textures)
+    {
+        META_FUNCTION_TASK();
+        if (screen_quad.GetQuadSettings().texture_mode == TextureMode::Disabled)
+            return 0U;
+
+        const rhi::Texture& texture = screen_quad.GetTexture();
+        auto texture_it = std::ranges::find(textures, texture);
+        if (texture_it == textures.end())
+            texture_it = textures.insert(textures.end(), texture);
+
+        return static_cast<Data::Index>(std::distance(textures.begin(), texture_it)) + 1U;
+    }
+
+    // Assigns positions of all quads in the batch vertex stream, quads moved to other position are uploaded again
+    void LayoutQuadSlots()
+    {
+        META_FUNCTION_TASK();
+        m_quad_slot_ptrs.clear();
+        for(RootItem& root_item : m_root_items)
+        {
+            for(QuadSlot& quad_slot : root_item.quad_slots)
+            {
+                const auto quad_index = static_cast<Data::Index>(m_quad_slot_ptrs.size());
+                if (quad_slot.quad_index != quad_index)
+                {
+                    quad_slot.quad_index   = quad_index;
+                    quad_slot.dirty_frames = m_all_frames_mask;
+                }
+                m_quad_slot_ptrs.push_back(&quad_slot);
+            }
+        }
+
+        m_vertices.resize(m_quad_slot_ptrs.size() * g_quad_vertices_count);
+        for(const QuadSlot* quad_slot_ptr : m_quad_slot_ptrs)
+        {
+            std::ranges::copy(quad_slot_ptr->vertices, m_vertices.begin() + quad_slot_ptr->quad_index * g_quad_vertices_count);
+        }
+
+        m_is_layout_dirty       = false;
+        m_is_draw_batches_dirty = true;
+    }
+
+    // Picks up changes of screen rect, color and texture of all quads since the previous update
+    void UpdateQuadSlots()
+    {
+        META_FUNCTION_TASK();
+        for(QuadSlot* quad_slot_ptr : m_quad_slot_ptrs)
+        {
+            QuadSlot&                        quad_slot     = *quad_slot_ptr;
+            const gfx::ScreenQuad::Settings& quad_settings = quad_slot.screen_quad_ptr->GetQuadSettings();
+            const rhi::Texture&              texture       = quad_slot.screen_quad_ptr->GetTexture();
+            if (quad_slot.is_valid &&
+                quad_slot.screen_rect  == quad_settings.screen_rect &&
+                quad_slot.color        == quad_settings.blend_color &&
+                quad_slot.texture_mode == quad_settings.texture_mode &&
+                quad_slot.texture      == texture)
+                continue;
+
+            if (quad_slot.texture_mode != quad_settings.texture_mode || quad_slot.texture != texture)
+                m_is_draw_batches_dirty = true;
+
+            quad_slot.screen_rect  = quad_settings.screen_rect;
+            quad_slot.color        = quad_settings.blend_color;
+            quad_slot.texture_mode = quad_settings.texture_mode;
+            quad_slot.texture      = texture;
+            quad_slot.vertices     = GetQuadVertices(quad_slot.screen_rect, quad_slot.color, quad_slot.texture_mode);
+            quad_slot.is_valid     = true;
+            quad_slot.dirty_frames = m_all_frames_mask;
+            std::ranges::copy(quad_slot.vertices, m_vertices.begin() + quad_slot.quad_index * g_quad_vertices_count);
+            m_statistics.rebuilt_quads_count++;
+        }
+    }
+
+    [[nodiscard]] QuadVertices GetQuadVertices(const FrameRect& screen_rect, const gfx::Color4F& color, TextureMode texture_mode) const
+    {
+        META_FUNCTION_TASK();
+        const auto attachment_width  = static_cast<float>(m_render_attachment_size.GetWidth());
+        const auto attachment_height = static_cast<float>(m_render_attachment_size.GetHeight());
+        const float left   = 2.F * static_cast<float>(screen_rect.GetLeft())   / attachment_width - 1.F;
+        const float right  = 2.F * static_cast<float>(screen_rect.GetRight())  / attachment_width - 1.F;
+        const float top    = 1.F - 2.F * static_cast<float>(screen_rect.GetTop())    / attachment_height;
+        const float bottom = 1.F - 2.F * static_cast<float>(screen_rect.GetBottom()) / attachment_height;
+        const Data::RawVector4F vertex_color(color.AsVector());
+        const auto              vertex_texture_mode = static_cast<uint32_t>(texture_mode);
+
+        // Quad vertices are listed counter-clockwise starting from the top-left corner
+        return QuadVertices{
+            Vertex{ { left,  top    }, { 0.F, 0.F }, vertex_color, vertex_texture_mode },
+            Vertex{ { left,  bottom }, { 0.F, 1.F }, vertex_color, vertex_texture_mode },
+            Vertex{ { right, bottom }, { 1.F, 1.F }, vertex_color, vertex_texture_mode },
+            Vertex{ { right, top    }, { 1.F, 0.F }, vertex_color, vertex_texture_mode },
+        };
+    }
+
+    // Merges adjacent quads into one draw batch while they use the same texture,
+    // solid quads do not sample texture and are merged with draw batch of any texture
+    void BuildDrawBatches()
+    {
+        META_FUNCTION_TASK();
+        m_draw_batches.clear();
+
+        std::vector<const rhi::Texture*> draw_batch_textures;
+        for(const QuadSlot* quad_slot_ptr : m_quad_slot_ptrs)
+        {
+            const rhi::Texture* texture_ptr = quad_slot_ptr->texture_mode == TextureMode::Disabled ? nullptr : &quad_slot_ptr->texture;
+            if (m_draw_batches.empty() ||
+                (texture_ptr && draw_batch_textures.back() && *draw_batch_textures.back() != *texture_ptr))
+            {
+                m_draw_batches.push_back(DrawBatch{ .first_quad_index = quad_slot_ptr->quad_index });
+                draw_batch_textures.push_back(texture_ptr);
+            }
+            else if (texture_ptr && !draw_batch_textures.back())
+            {
+                draw_batch_textures.back() = texture_ptr;
+            }
+            m_draw_batches.back().quads_count++;
+        }
+
+        // Program bindings of textures not used anymore are released, since command lists retain bindings in use
+        std::vector<TextureBindings> prev_texture_bindings = std::move(m_texture_bindings);
+        m_texture_bindings.clear();
+        for(size_t batch_index = 0U; batch_index < m_draw_batches.size(); ++batch_index)
+        {
+            const rhi::Texture& texture = draw_batch_textures[batch_index] ? *draw_batch_textures[batch_index] : m_blank_texture;
+            m_draw_batches[batch_index].texture_bindings_index = GetTextureBindingsIndex(texture, prev_texture_bindings);
+        }
+
+        m_is_draw_batches_dirty = false;
+    }
+
+    [[nodiscard]] Data::Index GetTextureBindingsIndex(const rhi::Texture& texture, std::vector<TextureBindings>& prev_texture_bindings)
+    {
+        META_FUNCTION_TASK();
+        if (const auto texture_bindings_it = std::ranges::find(m_texture_bindings, texture, &TextureBindings::texture);
+            texture_bindings_it != m_texture_bindings.end())
+            return static_cast<Data::Index>(std::distance(m_texture_bindings.begin(), texture_bindings_it));
+
+        if (const auto prev_texture_bindings_it = std::ranges::find(prev_texture_bindings, texture, &TextureBindings::texture);
+            prev_texture_bindings_it != prev_texture_bindings.end())
+        {
+            m_texture_bindings.push_back(std::move(*prev_texture_bindings_it));
+        }
+        else
+        {
+            using enum rhi::ShaderType;
+            rhi::ProgramBindings program_bindings = m_render_state.GetProgram().CreateBindings({
+                { { Pixel, "g_texture" }, texture.GetResourceView() },
+                { { Pixel, "g_sampler" }, m_texture_sampler.GetResourceView() },
+            });
+            program_bindings.SetName(fmt::format("{} Widgets Batch Bindings {}", m_settings.name, m_texture_bindings.size()));
+            m_texture_bindings.push_back(TextureBindings{ texture, program_bindings });
+        }
+        return static_cast<Data::Index>(m_texture_bindings.size() - 1U);
+    }
+
+    void UpdateFrameResources(uint32_t frame_index)
+    {
+        META_FUNCTION_TASK();
+        META_CHECK_LESS_DESCR(frame_index, m_frame_resources.size(), "no resources available for the frame buffer index");
+        FrameResources& frame_resources = m_frame_resources[frame_index];
+        frame_resources.quads_count = static_cast<uint32_t>(m_quad_slot_ptrs.size());
+        if (m_quad_slot_ptrs.empty())
+            return;
+
+        const rhi::RenderContext& render_context = m_ui_context.GetRenderContext();
+        const rhi::CommandQueue&  cmd_queue      = m_ui_context.GetRenderCommandQueue();
+        const FramesMask          frame_mask     = FramesMask{ 1U } << frame_index;
+        const Data::Size          reservation_multiplier = m_settings.buffers_reservation_multiplier;
+
+        const auto vertices_data_size = static_cast<Data::Size>(m_vertices.size() * sizeof(Vertex));
+        if (!frame_resources.vertex_buffer_set.IsInitialized() || frame_resources.vertex_buffer_set[0].GetDataSize() < vertices_data_size)
+        {
+            rhi::Buffer vertex_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForVertexBuffer(vertices_data_size * reservation_multiplier, static_cast<Data::Size>(sizeof(Vertex))));
+            vertex_buffer.SetName(fmt::format("{} Widgets Batch Vertex Buffer {}", m_settings.name, frame_index));
+            frame_resources.vertex_buffer_set = rhi::BufferSet(rhi::BufferType::Vertex, { vertex_buffer });
+
+            for(QuadSlot* quad_slot_ptr : m_quad_slot_ptrs)
+            {
+                quad_slot_ptr->dirty_frames |= frame_mask;
+            }
+        }
+
+        // Index buffer contains the same indices pattern for every quad, so it is uploaded only once on creation
+        const auto indices_data_size = static_cast<Data::Size>(m_quad_slot_ptrs.size() * g_quad_indices_count * sizeof(Index));
+        if (!frame_resources.index_buffer.IsInitialized() || frame_resources.index_buffer.GetDataSize() < indices_data_size)
+        {
+            const Indices quad_indices = GetQuadIndices(static_cast<Data::Size>(m_quad_slot_ptrs.size()) * reservation_multiplier);
+            const auto    quad_indices_data_size = static_cast<Data::Size>(quad_indices.size() * sizeof(Index));
+            frame_resources.index_buffer = render_context.CreateBuffer(
+                rhi::BufferSettings::ForIndexBuffer(quad_indices_data_size, gfx::PixelFormat::R32Uint));
+            frame_resources.index_buffer.SetName(fmt::format("{} Widgets Batch Index Buffer {}", m_settings.name, frame_index));
+            frame_resources.index_buffer.SetData(cmd_queue, rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(quad_indices.data()), quad_indices_data_size // NOSONAR
+            ));
+        }
+
+        UploadDirtyQuads(frame_resources, frame_mask);
+    }
+
+    [[nodiscard]] static Indices GetQuadIndices(Data::Size quads_count)
+    {
+        META_FUNCTION_TASK();
+        Indices indices;
+        indices.reserve(quads_count * g_quad_indices_count);
+        for(Index quad_index = 0U; quad_index < quads_count; ++quad_index)
+        {
+            const Index base_vertex = quad_index * g_quad_vertices_count;
+            indices.insert(indices.end(), { base_vertex, base_vertex + 1U, base_vertex + 2U, base_vertex, base_vertex + 2U, base_vertex + 3U });
+        }
+        return indices;
+    }
+
+    // Uploads vertices of quads changed or moved since the previous update of the frame buffer,
+    // vertices of adjacent changed quads are merged into single range
+    void UploadDirtyQuads(const FrameResources& frame_resources, FramesMask frame_mask)
+    {
+        META_FUNCTION_TASK();
+        const rhi::CommandQueue& cmd_queue   = m_ui_context.GetRenderCommandQueue();
+        const auto               quads_count = static_cast<Data::Index>(m_quad_slot_ptrs.size());
+
+        for(Data::Index begin_index = 0U; begin_index < quads_count; ++begin_index)
+        {
+            if (!(m_quad_slot_ptrs[begin_index]->dirty_frames & frame_mask))
+                continue;
+
+            Data::Index end_index = begin_index;
+            while(end_index < quads_count && (m_quad_slot_ptrs[end_index]->dirty_frames & frame_mask))
+            {
+                m_quad_slot_ptrs[end_index]->dirty_frames &= ~frame_mask;
+                ++end_index;
+            }
+
+            const auto range_start = static_cast<Data::Size>(begin_index * g_quad_vertices_count * sizeof(Vertex));
+            const auto range_end   = static_cast<Data::Size>(end_index * g_quad_vertices_count * sizeof(Vertex));
+            frame_resources.vertex_buffer_set[0].SetData(cmd_queue, rhi::SubResource(
+                reinterpret_cast<Data::ConstRawPtr>(&m_vertices[begin_index * g_quad_vertices_count]), // NOSONAR
+                range_end - range_start, rhi::SubResource::Index(), rhi::BytesRange(range_start, range_end)
+            ));
+            m_statistics.uploaded_data_size += range_end - range_start;
+            begin_index = end_index;
+        }
+    }
+
+    // IContainerCallback overrides
+    void ChildrenChanged(Container& container) override
+    {
+        META_FUNCTION_TASK();
+        for(RootItem& root_item : m_root_items)
+        {
+            if (std::ranges::find(root_item.containers, &container) != root_item.containers.end())
+                root_item.is_dirty = true;
+        }
+    }
+
+    Context&                     m_ui_context;
+    const rhi::RenderPattern     m_render_pattern;
+    Settings                     m_settings;
+    rhi::RenderState             m_render_state;
+    rhi::ViewState               m_view_state;
+    rhi::Sampler                 m_texture_sampler;
+    rhi::Texture                 m_blank_texture;
+    FrameSize                    m_render_attachment_size;
+    FramesMask                   m_all_frames_mask = 0U;
+    RootItems                    m_root_items;
+    QuadSlotPtrs                 m_quad_slot_ptrs;
+    Vertices                     m_vertices;
+    DrawBatches                  m_draw_batches;
+    std::vector<TextureBindings> m_texture_bindings;
+    std::vector<TextBatch>       m_text_batches;
+    PerFrameResources            m_frame_resources;
+    Statistics                   m_statistics;
+    bool                         m_is_layout_dirty       = true;
+    bool                         m_is_draw_batches_dirty = true;
+};
+
+META_PIMPL_DEFAULT_CONSTRUCT_METHODS_IMPLEMENT(WidgetsBatch);
+
+WidgetsBatch::WidgetsBatch(Context& ui_context, const rhi::RenderPattern& render_pattern, const Settings& settings)
+    : m_impl_ptr(std::make_shared<Impl>(ui_context, render_pattern, settings))
+{ }
+
+WidgetsBatch::WidgetsBatch(Context& ui_context, const Settings& settings)
+    : m_impl_ptr(std::make_shared<Impl>(ui_context, settings))
+{ }
+
+const WidgetsBatch::Settings& WidgetsBatch::GetSettings() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetSettings();
+}
+
+const WidgetsBatch::Statistics& WidgetsBatch::GetStatistics() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetStatistics();
+}
+
+Data::Size WidgetsBatch::GetItemsCount() const META_PIMPL_NOEXCEPT
+{
+    return GetImpl(m_impl_ptr).GetItemsCount();
+}
+
+bool WidgetsBatch::HasItem(const Item& item) const
+{
+    return GetImpl(m_impl_ptr).HasItem(item);
+}
+
+void WidgetsBatch::AddItem(Item& item) const
+{
+    GetImpl(m_impl_ptr).AddItem(item);
+}
+
+void WidgetsBatch::RemoveItem(const Item& item) const
+{
+    GetImpl(m_impl_ptr).RemoveItem(item);
+}
+
+void WidgetsBatch::Update(const gfx::FrameSize& render_attachment_size) const
+{
+    GetImpl(m_impl_ptr).Update(render_attachment_size);
+}
+
+void WidgetsBatch::Draw(const rhi::RenderCommandList& cmd_list, const rhi::CommandListDebugGroup* debug_group_ptr) const
+{
+    GetImpl(m_impl_ptr).Draw(cmd_list, debug_group_ptr);
+}
+
+} // namespace Methane::UserInterface
@@ -0,0 +1,295 @@
+/******************************************************************************
+
+Copyright 2024 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/BlockAllocatorTest.cpp
+Unit tests of the memory block allocation policies
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/BlockAllocator.hpp>
+
+#include <random>
+#include <deque>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+TEST_CASE("Linear block allocator", "[allocator][linear]")
+{
+    SECTION("Allocations are appended with alignment")
+    {
+        LinearBlockAllocator<uint64_t> allocator(1024U);
+        CHECK(allocator.Allocate(10U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(16U, 16U) == Opt<uint64_t>(16U));
+        CHECK(allocator.Allocate(100U, 256U) == Opt<uint64_t>(256U));
+
+        const LinearBlockAllocator<uint64_t>::Statistics stats = allocator.GetStatistics();
+        CHECK(stats.used_size == 356U);
+        CHECK(stats.requested_size == 126U);
+        CHECK(stats.allocations_count == 3U);
+        CHECK(stats.largest_free_size == 1024U - 356U);
+    }
+
+    SECTION("Allocation out of block size fails")
+    {
+        LinearBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(200U).has_value());
+        CHECK_FALSE(allocator.Allocate(100U).has_value());
+        CHECK_FALSE(allocator.Allocate(8U, 256U).has_value());
+    }
+
+    SECTION("Freed tail is reused")
+    {
+        LinearBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(64U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(64U) == Opt<uint64_t>(64U));
+        allocator.Free(64U);
+        CHECK(allocator.Allocate(128U) == Opt<uint64_t>(64U));
+    }
+
+    SECTION("Block is reset when all allocations are freed")
+    {
+        LinearBlockAllocator<uint64_t> allocator(256U);
+        const Opt<uint64_t> offset_a = allocator.Allocate(100U);
+        const Opt<uint64_t> offset_b = allocator.Allocate(100U);
+        REQUIRE(offset_a);
+        REQUIRE(offset_b);
+        allocator.Free(*offset_a);
+        CHECK_FALSE(allocator.IsEmpty());
+        CHECK(allocator.GetStatistics().used_size == 200U);
+        allocator.Free(*offset_b);
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetStatistics().used_size == 0U);
+        CHECK(allocator.Allocate(256U) == Opt<uint64_t>(0U));
+    }
+
+    SECTION("Free of unknown offset throws")
+    {
+        LinearBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(16U).has_value());
+        CHECK_THROWS(allocator.Free(8U));
+    }
+}
+
+TEST_CASE("Buddy block allocator", "[allocator][buddy]")
+{
+    SECTION("Invalid block sizes throw")
+    {
+        CHECK_THROWS(BuddyBlockAllocator<uint64_t>(1000U, 16U));
+        CHECK_THROWS(BuddyBlockAllocator<uint64_t>(1024U, 24U));
+        CHECK_THROWS(BuddyBlockAllocator<uint64_t>(1024U, 2048U));
+    }
+
+    SECTION("Allocations are rounded to power of two and aligned by size")
+    {
+        BuddyBlockAllocator<uint64_t> allocator(1024U, 16U);
+        CHECK(allocator.Allocate(100U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(10U) == Opt<uint64_t>(128U));
+        CHECK(allocator.Allocate(10U, 64U) == Opt<uint64_t>(192U));
+
+        const BuddyBlockAllocator<uint64_t>::Statistics stats = allocator.GetStatistics();
+        CHECK(stats.used_size == 128U + 16U + 64U);
+        CHECK(stats.requested_size == 120U);
+        CHECK(stats.allocations_count == 3U);
+        CHECK(stats.largest_free_size == 512U);
+    }
+
+    SECTION("Whole block allocation")
+    {
+        BuddyBlockAllocator<uint64_t> allocator(1024U, 16U);
+        CHECK(allocator.Allocate(1024U) == Opt<uint64_t>(0U));
+        CHECK_FALSE(allocator.Allocate(16U).has_value());
+        CHECK_FALSE(BuddyBlockAllocator<uint64_t>(1024U, 16U).Allocate(1025U).has_value());
+    }
+
+    SECTION("Freed buddies are merged back")
+    {
+        BuddyBlockAllocator<uint64_t> allocator(1024U, 16U);
+        std::vector<uint64_t> offsets;
+        for(uint32_t i = 0; i < 64U; ++i)
+        {
+            const Opt<uint64_t> offset_opt = allocator.Allocate(16U);
+            REQUIRE(offset_opt);
+            offsets.push_back(*offset_opt);
+        }
+        CHECK_FALSE(allocator.Allocate(16U).has_value());
+        CHECK(allocator.GetStatistics().largest_free_size == 0U);
+
+        for(uint64_t offset : offsets)
+            allocator.Free(offset);
+
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetStatistics().largest_free_size == 1024U);
+        CHECK(allocator.Allocate(1024U) == Opt<uint64_t>(0U));
+    }
+
+    SECTION("Fragmentation statistics")
+    {
+        BuddyBlockAllocator<uint64_t> allocator(1024U, 256U);
+        const Opt<uint64_t> offset_a = allocator.Allocate(256U);
+        const Opt<uint64_t> offset_b = allocator.Allocate(256U);
+        const Opt<uint64_t> offset_c = allocator.Allocate(256U);
+        REQUIRE(offset_a);
+        REQUIRE(offset_b);
+        REQUIRE(offset_c);
+        allocator.Free(*offset_a);
+
+        // Two free 256 bytes ranges are not buddies, so only one of them can be used for the largest allocation
+        const BuddyBlockAllocator<uint64_t>::Statistics stats = allocator.GetStatistics();
+        CHECK(stats.GetFreeSize() == 512U);
+        CHECK(stats.largest_free_size == 256U);
+        CHECK(stats.GetFragmentation() == 0.5F);
+        CHECK_FALSE(allocator.Allocate(512U).has_value());
+    }
+
+    SECTION("Random allocations do not overlap")
+    {
+        BuddyBlockAllocator<uint64_t> allocator(1U << 20U, 64U);
+        std::mt19937 random_engine(1234U);
+        std::uniform_int_distribution<uint64_t> size_distribution(1U, 8192U);
+        std::map<uint64_t, uint64_t> allocated_ranges;
+
+        for(uint32_t i = 0; i < 1000U; ++i)
+        {
+            if (!allocated_ranges.empty() && random_engine() % 3U == 0U)
+            {
+                allocator.Free(allocated_ranges.begin()->first);
+                allocated_ranges.erase(allocated_ranges.begin());
+                continue;
+            }
+
+            const uint64_t size = size_distribution(random_engine);
+            const Opt<uint64_t> offset_opt = allocator.Allocate(size);
+            if (!offset_opt)
+                continue;
+
+            const auto next_it = allocated_ranges.upper_bound(*offset_opt);
+            if (next_it != allocated_ranges.end())
+                CHECK(*offset_opt + size <= next_it->first);
+            if (next_it != allocated_ranges.begin())
+                CHECK(std::prev(next_it)->first + std::prev(next_it)->second <= *offset_opt);
+            allocated_ranges.emplace(*offset_opt, size);
+        }
+
+        CHECK(allocator.GetStatistics().allocations_count == allocated_ranges.size());
+    }
+}
+
+TEST_CASE("Ring block allocator", "[allocator][ring]")
+{
+    SECTION("Allocations are appended with alignment")
+    {
+        RingBlockAllocator<uint64_t> allocator(1024U);
+        CHECK(allocator.Allocate(10U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(16U, 16U) == Opt<uint64_t>(16U));
+        CHECK(allocator.GetHeadOffset() == 32U);
+
+        const RingBlockAllocator<uint64_t>::Statistics stats = allocator.GetStatistics();
+        CHECK(stats.used_size == 32U);
+        CHECK(stats.requested_size == 26U);
+        CHECK(stats.allocations_count == 2U);
+        CHECK(stats.largest_free_size == 1024U - 32U);
+    }
+
+    SECTION("Allocation wraps around after release of the oldest ranges")
+    {
+        RingBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(100U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(100U) == Opt<uint64_t>(100U));
+        CHECK_FALSE(allocator.Allocate(100U).has_value());
+
+        allocator.ReleaseUntil(100U);
+        CHECK(allocator.Allocate(100U) == Opt<uint64_t>(0U));
+        CHECK(allocator.GetWrapsCount() == 1U);
+
+        // Head is behind the tail after wrap-around, so only the range between them is free
+        const RingBlockAllocator<uint64_t>::Statistics stats = allocator.GetStatistics();
+        CHECK(stats.used_size == 256U);
+        CHECK(stats.largest_free_size == 0U);
+        CHECK_FALSE(allocator.Allocate(1U).has_value());
+    }
+
+    SECTION("Wrapped ring is filled up to the tail")
+    {
+        RingBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(64U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(128U) == Opt<uint64_t>(64U));
+        CHECK(allocator.Allocate(32U) == Opt<uint64_t>(192U));
+        allocator.ReleaseUntil(192U);
+        CHECK(allocator.Allocate(64U) == Opt<uint64_t>(0U));
+        CHECK(allocator.Allocate(128U) == Opt<uint64_t>(64U));
+        CHECK_FALSE(allocator.Allocate(1U).has_value());
+        CHECK(allocator.GetStatistics().largest_free_size == 0U);
+    }
+
+    SECTION("Ring is restarted when all allocations are released")
+    {
+        RingBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(200U) == Opt<uint64_t>(0U));
+        allocator.ReleaseUntil(200U);
+        CHECK(allocator.IsEmpty());
+        CHECK(allocator.GetStatistics().used_size == 0U);
+        CHECK(allocator.Allocate(256U) == Opt<uint64_t>(0U));
+        CHECK(allocator.GetWrapsCount() == 0U);
+    }
+
+    SECTION("Oversized allocation fails")
+    {
+        RingBlockAllocator<uint64_t> allocator(256U);
+        CHECK_FALSE(allocator.Allocate(257U).has_value());
+    }
+
+    SECTION("Release of unknown end offset throws")
+    {
+        RingBlockAllocator<uint64_t> allocator(256U);
+        CHECK(allocator.Allocate(16U).has_value());
+        CHECK_THROWS(allocator.ReleaseUntil(8U));
+    }
+
+    SECTION("Streaming allocations do not overlap with live ranges")
+    {
+        RingBlockAllocator<uint64_t> allocator(4096U);
+        std::mt19937 random_engine(4321U);
+        std::uniform_int_distribution<uint64_t> size_distribution(1U, 700U);
+        std::deque<std::pair<uint64_t, uint64_t>> live_ranges;
+
+        for(uint32_t i = 0; i < 2000U; ++i)
+        {
+            const uint64_t size = size_distribution(random_engine);
+            Opt<uint64_t> offset_opt = allocator.Allocate(size, 4U);
+            while (!offset_opt && !live_ranges.empty())
+            {
+                allocator.ReleaseUntil(live_ranges.front().first + live_ranges.front().second);
+                live_ranges.pop_front();
+                offset_opt = allocator.Allocate(size, 4U);
+            }
+            REQUIRE(offset_opt);
+            CHECK(*offset_opt + size <= 4096U);
+            for(const auto& [live_offset, live_size] : live_ranges)
+            {
+                CHECK((*offset_opt + size <= live_offset || live_offset + live_size <= *offset_opt));
+            }
+            live_ranges.emplace_back(*offset_opt, size);
+        }
+
+        CHECK(allocator.GetWrapsCount() > 0U);
+        CHECK(allocator.GetStatistics().allocations_count == live_ranges.size());
+    }
+}
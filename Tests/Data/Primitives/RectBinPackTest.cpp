@@ -0,0 +1,112 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/Data/Primitives/RectBinPackTest.cpp
+Unit tests of the rectangle bin packing with released space reuse
+
+******************************************************************************/
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <Methane/Data/RectBinPack.hpp>
+
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Data;
+
+using FrameRect    = Rect<int32_t, uint32_t>;
+using FrameBinPack = RectBinPack<FrameRect>;
+
+[[nodiscard]]
+static bool AreRectsOverlapping(const FrameRect& left, const FrameRect& right) noexcept
+{
+    return left.GetLeft() < right.GetRight() && right.GetLeft() < left.GetRight() &&
+           left.GetTop() < right.GetBottom() && right.GetTop() < left.GetBottom();
+}
+
+TEST_CASE("Rectangle bin packing", "[rect][bin-pack]")
+{
+    SECTION("Packed rectangles do not overlap and fit in bin")
+    {
+        FrameBinPack bin_pack(FrameRect::Size(64U, 64U));
+        std::vector<FrameRect> rects;
+        for (uint32_t index = 0U; index < 16U; ++index)
+        {
+            FrameRect rect(FrameRect::Size(8U + index % 5U, 10U + index % 3U));
+            REQUIRE(bin_pack.TryPack(rect));
+            for (const FrameRect& packed_rect : rects)
+            {
+                CHECK_FALSE(AreRectsOverlapping(rect, packed_rect));
+            }
+            rects.push_back(rect);
+        }
+    }
+
+    SECTION("Rectangle not fitting in free space is not packed")
+    {
+        FrameBinPack bin_pack(FrameRect::Size(16U, 16U));
+        FrameRect large_rect(FrameRect::Size(16U, 12U));
+        FrameRect small_rect(FrameRect::Size(8U, 8U));
+        CHECK(bin_pack.TryPack(large_rect));
+        CHECK_FALSE(bin_pack.TryPack(small_rect));
+    }
+
+    SECTION("Released rectangle space is reused by fitting rectangle")
+    {
+        FrameBinPack bin_pack(FrameRect::Size(16U, 16U));
+        FrameRect large_rect(FrameRect::Size(16U, 12U));
+        REQUIRE(bin_pack.TryPack(large_rect));
+
+        CHECK(bin_pack.Release(large_rect));
+        CHECK(bin_pack.GetReleasedRectsCount() == 1U);
+
+        FrameRect small_rect(FrameRect::Size(8U, 8U));
+        CHECK(bin_pack.TryPack(small_rect));
+        CHECK(small_rect.origin == large_rect.origin);
+        CHECK(bin_pack.GetReleasedRectsCount() == 0U);
+    }
+
+    SECTION("Released rectangle space is not reused by larger rectangle")
+    {
+        FrameBinPack bin_pack(FrameRect::Size(32U, 32U));
+        FrameRect small_rect(FrameRect::Size(8U, 8U));
+        REQUIRE(bin_pack.TryPack(small_rect));
+        REQUIRE(bin_pack.Release(small_rect));
+
+        FrameRect large_rect(FrameRect::Size(10U, 10U));
+        CHECK(bin_pack.TryPack(large_rect));
+        CHECK_FALSE(AreRectsOverlapping(large_rect, small_rect));
+        CHECK(bin_pack.GetReleasedRectsCount() == 1U);
+    }
+
+    SECTION("Rectangle can not be released twice or without being packed")
+    {
+        FrameBinPack bin_pack(FrameRect::Size(32U, 32U));
+        FrameRect first_rect(FrameRect::Size(8U, 8U));
+        FrameRect second_rect(FrameRect::Size(8U, 8U));
+        REQUIRE(bin_pack.TryPack(first_rect));
+        REQUIRE(bin_pack.TryPack(second_rect));
+
+        CHECK(bin_pack.Release(second_rect));
+        CHECK_FALSE(bin_pack.Release(second_rect));
+        CHECK_FALSE(bin_pack.Release(FrameRect(4, 4, 8U, 8U)));
+        CHECK_FALSE(bin_pack.Release(FrameRect(FrameRect::Size())));
+        CHECK(bin_pack.GetReleasedRectsCount() == 1U);
+    }
+}
@@ -0,0 +1,114 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FrustumCullingBenchmark.cpp
+Batch frustum culling benchmarks
+
+******************************************************************************/
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/FrustumCulling.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <fmt/format.h>
+#include <random>
+#include <type_traits>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+using namespace Methane;
+
+static CullingFrustum CreateBenchmarkFrustum()
+{
+    Camera camera;
+    camera.Resize({ 1920.F, 1080.F });
+    camera.SetParameters({ 0.1F, 500.F, 90.F });
+    camera.ResetOrientation({ { 0.F, 0.F, -10.F }, { 0.F, 0.F, 0.F }, { 0.F, 1.F, 0.F } });
+    return camera.GetCullingFrustum();
+}
+
+template<typename BoundsType>
+static BoundsType GenerateBenchmarkBounds(Size objects_count)
+{
+    std::mt19937 random_engine(objects_count);
+    std::uniform_real_distribution<float> position_distribution(-500.F, 500.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 5.F);
+
+    BoundsType bounds;
+    for(Size index = 0U; index < objects_count; ++index)
+    {
+        const hlslpp::float3 position(position_distribution(random_engine), position_distribution(random_engine), position_distribution(random_engine));
+        if constexpr (std::is_same_v<BoundsType, BoundingSpheres>)
+            bounds.Add(position, extent_distribution(random_engine));
+        else
+            bounds.Add(position, position + hlslpp::float3(extent_distribution(random_engine)));
+    }
+    return bounds;
+}
+
+TEST_CASE("Bounding Spheres Frustum Culling Benchmark", "[camera][culling][benchmark]")
+{
+    const CullingFrustum frustum = CreateBenchmarkFrustum();
+    tf::Executor         parallel_executor;
+
+    for(const Size spheres_count : { 10'000U, 100'000U, 1'000'000U })
+    {
+        const BoundingSpheres spheres = GenerateBenchmarkBounds<BoundingSpheres>(spheres_count);
+        VisibleIndices visible_indices;
+        visible_indices.reserve(spheres_count);
+
+        BENCHMARK(fmt::format("Serial culling of {} spheres", spheres_count))
+        {
+            frustum.CullSpheres(spheres, visible_indices);
+            return visible_indices.size();
+        };
+
+        BENCHMARK(fmt::format("Parallel culling of {} spheres", spheres_count))
+        {
+            frustum.CullSpheres(spheres, visible_indices, &parallel_executor);
+            return visible_indices.size();
+        };
+    }
+}
+
+TEST_CASE("Bounding Boxes Frustum Culling Benchmark", "[camera][culling][benchmark]")
+{
+    const CullingFrustum frustum = CreateBenchmarkFrustum();
+    tf::Executor         parallel_executor;
+
+    for(const Size boxes_count : { 10'000U, 100'000U, 1'000'000U })
+    {
+        const BoundingBoxes boxes = GenerateBenchmarkBounds<BoundingBoxes>(boxes_count);
+        VisibleIndices visible_indices;
+        visible_indices.reserve(boxes_count);
+
+        BENCHMARK(fmt::format("Serial culling of {} boxes", boxes_count))
+        {
+            frustum.CullBoxes(boxes, visible_indices);
+            return visible_indices.size();
+        };
+
+        BENCHMARK(fmt::format("Parallel culling of {} boxes", boxes_count))
+        {
+            frustum.CullBoxes(boxes, visible_indices, &parallel_executor);
+            return visible_indices.size();
+        };
+    }
+}
@@ -0,0 +1,215 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/FrustumCullingTest.cpp
+Batch frustum culling unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/Camera.h>
+#include <Methane/Graphics/FrustumCulling.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <taskflow/taskflow.hpp>
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <random>
+
+using namespace Methane::Graphics;
+using namespace Methane::Data;
+using namespace Methane;
+
+static const FloatSize           g_test_screen_size { 640.f, 480.f };
+static const Camera::Orientation g_test_orientation { { 0.f, 0.f, -10.f }, { 0.f, 0.f, 0.f }, { 0.f, 1.f, 0.f } };
+static const Camera::Parameters  g_test_parameters  { 0.1F, 100.F, 90.F };
+
+// Objects closer to frustum planes than this margin are not checked against scalar reference,
+// because SIMD and scalar distance calculations may round differently
+static constexpr float g_boundary_margin = 1E-3F;
+
+static CullingFrustum CreateTestFrustum()
+{
+    Camera camera;
+    camera.Resize(g_test_screen_size);
+    camera.SetParameters(g_test_parameters);
+    camera.ResetOrientation(g_test_orientation);
+    return camera.GetCullingFrustum();
+}
+
+static float GetMinPlaneDistance(const CullingFrustum& frustum, const hlslpp::float3& point)
+{
+    float min_distance = std::numeric_limits<float>::max();
+    for(const hlslpp::float4& plane : frustum.GetPlanes())
+    {
+        min_distance = std::min(min_distance, static_cast<float>(hlslpp::dot(plane.xyz, point) + plane.w));
+    }
+    return min_distance;
+}
+
+static BoundingSpheres GenerateRandomSpheres(Size spheres_count)
+{
+    std::mt19937 random_engine(1234U);
+    std::uniform_real_distribution<float> position_distribution(-150.F, 150.F);
+    std::uniform_real_distribution<float> radius_distribution(0.1F, 5.F);
+
+    BoundingSpheres spheres;
+    for(Size index = 0U; index < spheres_count; ++index)
+    {
+        const hlslpp::float3 center(position_distribution(random_engine), position_distribution(random_engine), position_distribution(random_engine));
+        spheres.Add(center, radius_distribution(random_engine));
+    }
+    return spheres;
+}
+
+static BoundingBoxes GenerateRandomBoxes(Size boxes_count)
+{
+    std::mt19937 random_engine(4321U);
+    std::uniform_real_distribution<float> position_distribution(-150.F, 150.F);
+    std::uniform_real_distribution<float> extent_distribution(0.1F, 5.F);
+
+    BoundingBoxes boxes;
+    for(Size index = 0U; index < boxes_count; ++index)
+    {
+        const hlslpp::float3 min(position_distribution(random_engine), position_distribution(random_engine), position_distribution(random_engine));
+        const hlslpp::float3 extent(extent_distribution(random_engine), extent_distribution(random_engine), extent_distribution(random_engine));
+        boxes.Add(min, min + extent);
+    }
+    return boxes;
+}
+
+static void CheckVisibleIndicesSorted(const VisibleIndices& visible_indices, Size objects_count)
+{
+    CHECK(std::ranges::adjacent_find(visible_indices, std::greater_equal<Index>()) == visible_indices.end());
+    if (!visible_indices.empty())
+    {
+        CHECK(visible_indices.back() < objects_count);
+    }
+}
+
+TEST_CASE("Culling frustum of camera", "[camera][culling]")
+{
+    const CullingFrustum frustum = CreateTestFrustum();
+
+    SECTION("Frustum planes are normalized and directed inside")
+    {
+        for(const hlslpp::float4& plane : frustum.GetPlanes())
+        {
+            CHECK(std::abs(static_cast<float>(hlslpp::length(plane.xyz)) - 1.F) < 1E-5F);
+        }
+        CHECK(GetMinPlaneDistance(frustum, g_test_orientation.aim) > 0.F);
+    }
+
+    SECTION("Sphere visibility")
+    {
+        CHECK(frustum.IsSphereVisible({ 0.f, 0.f, 0.f }, 1.F));
+        CHECK(frustum.IsSphereVisible({ 0.f, 0.f, -10.f }, 1.F));  // intersects near plane
+        CHECK(frustum.IsSphereVisible({ 0.f, 0.f, 88.f }, 1.F));   // in front of far plane
+        CHECK(frustum.IsSphereVisible({ 0.f, 0.f, 90.5f }, 1.F));  // intersects far plane
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.f, 0.f, -20.f }, 1.F));  // behind camera
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.f, 0.f, 200.f }, 1.F));  // behind far plane
+        CHECK_FALSE(frustum.IsSphereVisible({ 100.f, 0.f, 0.f }, 1.F));  // aside
+        CHECK_FALSE(frustum.IsSphereVisible({ 0.f, -100.f, 0.f }, 1.F)); // below
+    }
+
+    SECTION("Box visibility")
+    {
+        CHECK(frustum.IsBoxVisible({ -1.f, -1.f, -1.f }, { 1.f, 1.f, 1.f }));
+        CHECK(frustum.IsBoxVisible({ -1.f, -1.f, -11.f }, { 1.f, 1.f, -9.f }));    // intersects near plane
+        CHECK(frustum.IsBoxVisible({ -1000.f, -1.f, -1.f }, { 1000.f, 1.f, 1.f })); // crosses frustum without corners inside
+        CHECK_FALSE(frustum.IsBoxVisible({ -1.f, -1.f, -21.f }, { 1.f, 1.f, -19.f }));
+        CHECK_FALSE(frustum.IsBoxVisible({ -1.f, -1.f, 199.f }, { 1.f, 1.f, 201.f }));
+        CHECK_FALSE(frustum.IsBoxVisible({ 99.f, -1.f, -1.f }, { 101.f, 1.f, 1.f }));
+    }
+}
+
+TEST_CASE("Batch culling of bounding spheres", "[camera][culling]")
+{
+    const CullingFrustum  frustum = CreateTestFrustum();
+    constexpr Size        spheres_count = 100003U; // not a multiple of SIMD width
+    const BoundingSpheres spheres = GenerateRandomSpheres(spheres_count);
+
+    VisibleIndices visible_indices;
+    frustum.CullSpheres(spheres, visible_indices);
+    REQUIRE(!visible_indices.empty());
+    REQUIRE(visible_indices.size() < spheres_count);
+    CheckVisibleIndicesSorted(visible_indices, spheres_count);
+
+    SECTION("SIMD culling matches scalar sphere test")
+    {
+        std::vector<bool> is_visible(spheres_count, false);
+        for(const Index index : visible_indices)
+        {
+            is_visible[index] = true;
+        }
+
+        size_t mismatches_count = 0U;
+        for(Index index = 0U; index < spheres_count; ++index)
+        {
+            const hlslpp::float3 center(spheres.centers_x[index], spheres.centers_y[index], spheres.centers_z[index]);
+            if (std::abs(GetMinPlaneDistance(frustum, center) + spheres.radii[index]) < g_boundary_margin)
+                continue;
+
+            if (is_visible[index] != frustum.IsSphereVisible(center, spheres.radii[index]))
+                ++mismatches_count;
+        }
+        CHECK(mismatches_count == 0U);
+    }
+
+    SECTION("Parallel culling matches serial culling")
+    {
+        tf::Executor parallel_executor;
+        VisibleIndices parallel_visible_indices;
+        frustum.CullSpheres(spheres, parallel_visible_indices, &parallel_executor);
+        CHECK(parallel_visible_indices == visible_indices);
+    }
+}
+
+TEST_CASE("Batch culling of bounding boxes", "[camera][culling]")
+{
+    const CullingFrustum frustum = CreateTestFrustum();
+    constexpr Size       boxes_count = 100003U; // not a multiple of SIMD width
+    const BoundingBoxes  boxes = GenerateRandomBoxes(boxes_count);
+
+    VisibleIndices visible_indices;
+    frustum.CullBoxes(boxes, visible_indices);
+    REQUIRE(!visible_indices.empty());
+    REQUIRE(visible_indices.size() < boxes_count);
+    CheckVisibleIndicesSorted(visible_indices, boxes_count);
+
+    SECTION("Visible boxes are not fully outside of any frustum plane")
+    {
+        for(const Index index : visible_indices)
+        {
+            const hlslpp::float3 min(boxes.mins_x[index], boxes.mins_y[index], boxes.mins_z[index]);
+            const hlslpp::float3 max(boxes.maxs_x[index], boxes.maxs_y[index], boxes.maxs_z[index]);
+            const hlslpp::float3 center = (min + max) / 2.F;
+            const float half_diagonal = hlslpp::length(max - min) / 2.F;
+            CHECK(GetMinPlaneDistance(frustum, center) >= -half_diagonal - g_boundary_margin);
+        }
+    }
+
+    SECTION("Parallel culling matches serial culling")
+    {
+        tf::Executor parallel_executor;
+        VisibleIndices parallel_visible_indices;
+        frustum.CullBoxes(boxes, parallel_visible_indices, &parallel_executor);
+        CHECK(parallel_visible_indices == visible_indices);
+    }
+}
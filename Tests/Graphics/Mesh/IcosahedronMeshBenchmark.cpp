@@ -0,0 +1,64 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/IcosahedronMeshBenchmark.cpp
+Benchmark CPU cost of icosahedron mesh generation with serial and parallel subdivision.
+
+******************************************************************************/
+
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators_range.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <taskflow/taskflow.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static Data::Size MeasureIcosahedronGeneration(uint32_t subdivisions_count, tf::Executor* parallel_executor_ptr, Catch::Benchmark::Chronometer meter)
+{
+    Data::Size vertices_count = 0U;
+    meter.measure([&]()
+    {
+        const IcosahedronMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, subdivisions_count, true, parallel_executor_ptr);
+        vertices_count += mesh.GetVertexCount();
+    });
+    return vertices_count;
+}
+
+TEST_CASE("Benchmark icosahedron mesh generation", "[mesh][benchmark]")
+{
+    tf::Executor parallel_executor;
+    const uint32_t subdivisions_count = GENERATE(range(1U, 8U));
+
+    BENCHMARK_ADVANCED(fmt::format("Serial generation of icosahedron with {} subdivisions", subdivisions_count))(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureIcosahedronGeneration(subdivisions_count, nullptr, meter);
+    };
+    BENCHMARK_ADVANCED(fmt::format("Parallel generation of icosahedron with {} subdivisions", subdivisions_count))(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureIcosahedronGeneration(subdivisions_count, &parallel_executor, meter);
+    };
+}
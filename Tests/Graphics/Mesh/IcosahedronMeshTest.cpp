@@ -31,6 +31,7 @@ Icosahedron mesh generator unit tests
 
 #include <catch2/catch_test_macros.hpp>
 #include <catch2/catch_approx.hpp>
+#include <taskflow/taskflow.hpp>
 #include <fmt/format.h>
 #include <string>
 
@@ -168,3 +169,25 @@ TEST_CASE("Icosahedron Mesh Generator", "[mesh]")
         }
     }
 }
+
+TEST_CASE("Icosahedron Mesh Parallel Generator", "[mesh][parallel]")
+{
+    tf::Executor parallel_executor;
+
+    SECTION("Parallel Subdivision Equals Serial Subdivision")
+    {
+        const IcosahedronMesh<MeshVertex> serial_mesh(MeshVertex::layout, 2.F, 5U, false);
+        const IcosahedronMesh<MeshVertex> parallel_mesh(MeshVertex::layout, 2.F, 5U, false, &parallel_executor);
+        CHECK(parallel_mesh.GetVertexCount() == 10U * 1024U + 2U); // 10 * 4^N + 2 vertices after N subdivisions
+        CHECK(parallel_mesh.GetIndices() == serial_mesh.GetIndices());
+        CHECK(parallel_mesh.GetVertices() == serial_mesh.GetVertices());
+    }
+
+    SECTION("Parallel Spherify Equals Serial Spherify")
+    {
+        const IcosahedronMesh<MeshVertex> serial_mesh(MeshVertex::layout, 2.F, 5U, true);
+        const IcosahedronMesh<MeshVertex> parallel_mesh(MeshVertex::layout, 2.F, 5U, true, &parallel_executor);
+        CHECK(parallel_mesh.GetIndices() == serial_mesh.GetIndices());
+        CHECK(parallel_mesh.GetVertices() == serial_mesh.GetVertices());
+    }
+}
@@ -0,0 +1,96 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshFileBenchmark.cpp
+Benchmark CPU time of mesh loading from binary mesh file compared with mesh generation.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshFile.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+template<typename MeshType>
+static Data::Size MeasureMeshFileLoading(const MeshType& mesh, Catch::Benchmark::Chronometer meter)
+{
+    // Mesh file data is referenced by non-owning chunk, like data of memory mapped file
+    const Data::Bytes mesh_file_data = MeshFile::Write(mesh);
+    Data::Size vertex_count = 0U;
+    meter.measure([&]()
+    {
+        const MeshFile mesh_file{ Data::Chunk(mesh_file_data.data(), static_cast<Data::Size>(mesh_file_data.size())) };
+        vertex_count += mesh_file.GetVertexCount();
+    });
+
+    // Prevent code removal by optimizer and check that all vertices are loaded
+    CHECK(vertex_count % mesh.GetVertexCount() == 0U);
+    return vertex_count;
+}
+
+TEST_CASE("Benchmark mesh file loading", "[mesh][file][benchmark]")
+{
+    const SphereMesh<MeshVertex>      sphere_256_mesh(MeshVertex::layout, 1.F, 256U, 256U);
+    const IcosahedronMesh<MeshVertex> icosahedron_6_mesh(MeshVertex::layout, 1.F, 6U, true);
+
+    SECTION("Mesh generation")
+    {
+        BENCHMARK("Generate sphere 256x256")
+        {
+            return SphereMesh<MeshVertex>(MeshVertex::layout, 1.F, 256U, 256U).GetVertexCount();
+        };
+        BENCHMARK("Generate icosahedron with 6 subdivisions")
+        {
+            return IcosahedronMesh<MeshVertex>(MeshVertex::layout, 1.F, 6U, true).GetVertexCount();
+        };
+    }
+
+    SECTION("Mesh file writing")
+    {
+        BENCHMARK("Write mesh file of sphere 256x256")
+        {
+            return MeshFile::Write(sphere_256_mesh).size();
+        };
+        BENCHMARK("Write mesh file of icosahedron with 6 subdivisions")
+        {
+            return MeshFile::Write(icosahedron_6_mesh).size();
+        };
+    }
+
+    SECTION("Mesh file loading")
+    {
+        BENCHMARK_ADVANCED("Load mesh file of sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshFileLoading(sphere_256_mesh, meter);
+        };
+        BENCHMARK_ADVANCED("Load mesh file of icosahedron with 6 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshFileLoading(icosahedron_6_mesh, meter);
+        };
+    }
+}
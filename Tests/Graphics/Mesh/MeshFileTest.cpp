@@ -0,0 +1,149 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshFileTest.cpp
+Binary mesh file writing and loading unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshFile.h>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/TypeFormatters.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <cstring>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static void CheckSubsetsEqual(const Mesh::Subsets& loaded_subsets, const Mesh::Subsets& mesh_subsets)
+{
+    REQUIRE(loaded_subsets.size() == mesh_subsets.size());
+    for(size_t subset_index = 0; subset_index < mesh_subsets.size(); ++subset_index)
+    {
+        const Mesh::Subset& loaded_subset = loaded_subsets[subset_index];
+        const Mesh::Subset& mesh_subset   = mesh_subsets[subset_index];
+        CHECK(loaded_subset.mesh_type == mesh_subset.mesh_type);
+        CHECK(loaded_subset.vertices.offset == mesh_subset.vertices.offset);
+        CHECK(loaded_subset.vertices.count == mesh_subset.vertices.count);
+        CHECK(loaded_subset.indices.offset == mesh_subset.indices.offset);
+        CHECK(loaded_subset.indices.count == mesh_subset.indices.count);
+        CHECK(loaded_subset.indices_adjusted == mesh_subset.indices_adjusted);
+    }
+}
+
+static void CheckMeshFileEqualsMesh(const MeshFile& mesh_file, const Mesh& mesh)
+{
+    CHECK(mesh_file.GetType() == mesh.GetType());
+    CHECK(mesh_file.GetVertexLayout() == mesh.GetVertexLayout());
+    CHECK(mesh_file.GetVertexSize() == mesh.GetVertexSize());
+    REQUIRE(mesh_file.GetVertexCount() == mesh.GetVertexCount());
+    REQUIRE(mesh_file.GetVertexDataSize() == mesh.GetVertexDataSize());
+    CHECK(std::memcmp(mesh_file.GetVertexData(), mesh.GetVertexData(), mesh.GetVertexDataSize()) == 0);
+
+    CHECK(mesh_file.GetIndexFormat() == mesh.GetIndexFormat());
+    REQUIRE(mesh_file.GetIndexCount() == mesh.GetIndexCount());
+    CHECK(mesh_file.GetIndexDataSize() == mesh.GetIndexDataSize());
+    const Data::Bytes index_data = mesh.GetIndexData();
+    CHECK(std::memcmp(mesh_file.GetIndexData(), index_data.data(), index_data.size()) == 0);
+    for(Data::Index index = 0; index < mesh.GetIndexCount(); ++index)
+    {
+        CHECK(mesh_file.GetIndex(index) == mesh.GetIndex(index));
+    }
+}
+
+TEST_CASE("Mesh File Round Trip", "[mesh][file]")
+{
+    SECTION("Icosahedron Mesh with 16-bit Indices")
+    {
+        const IcosahedronMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 3U, true);
+        const MeshFile mesh_file{ Data::Chunk(MeshFile::Write(mesh)) };
+        CheckMeshFileEqualsMesh(mesh_file, mesh);
+        CHECK(mesh_file.GetIndexFormat() == PixelFormat::R16Uint);
+        CHECK(mesh_file.GetSubsets().empty());
+    }
+
+    SECTION("Sphere Mesh with 32-bit Indices")
+    {
+        const SphereMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 300U, 300U);
+        const MeshFile mesh_file{ Data::Chunk(MeshFile::Write(mesh)) };
+        CheckMeshFileEqualsMesh(mesh_file, mesh);
+        CHECK(mesh_file.GetIndexFormat() == PixelFormat::R32Uint);
+    }
+
+    SECTION("Uber Mesh with Subsets")
+    {
+        UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+        uber_mesh.AddSubMesh(CubeMesh<MeshVertex>(MeshVertex::layout), true);
+        uber_mesh.AddSubMesh(SphereMesh<MeshVertex>(MeshVertex::layout, 1.F, 16U, 16U), false);
+
+        const MeshFile mesh_file{ Data::Chunk(MeshFile::Write(uber_mesh, uber_mesh.GetSubsets())) };
+        CheckMeshFileEqualsMesh(mesh_file, uber_mesh);
+        CheckSubsetsEqual(mesh_file.GetSubsets(), uber_mesh.GetSubsets());
+    }
+
+    SECTION("Mesh File Loaded from Non-Owning Chunk References Its Data")
+    {
+        const CubeMesh<MeshVertex> mesh(MeshVertex::layout);
+        const Data::Bytes mesh_file_data = MeshFile::Write(mesh);
+        const MeshFile mesh_file{ Data::Chunk(mesh_file_data.data(), static_cast<Data::Size>(mesh_file_data.size())) };
+        CheckMeshFileEqualsMesh(mesh_file, mesh);
+        CHECK(mesh_file.GetVertexData() > mesh_file_data.data());
+        CHECK(mesh_file.GetIndexData() + mesh_file.GetIndexDataSize() <= mesh_file_data.data() + mesh_file_data.size());
+    }
+}
+
+TEST_CASE("Mesh File Validation", "[mesh][file]")
+{
+    const CubeMesh<MeshVertex> mesh(MeshVertex::layout);
+    const Data::Bytes mesh_file_data = MeshFile::Write(mesh);
+
+    SECTION("Empty Data")
+    {
+        CHECK_THROWS_AS(MeshFile(Data::Chunk()), Methane::ArgumentException);
+    }
+
+    SECTION("Invalid Format Magic")
+    {
+        Data::Bytes invalid_data = mesh_file_data;
+        invalid_data[0] = std::byte{ 0 };
+        CHECK_THROWS_AS(MeshFile(Data::Chunk(std::move(invalid_data))), Methane::ArgumentException);
+    }
+
+    SECTION("Unsupported Format Version")
+    {
+        Data::Bytes invalid_data = mesh_file_data;
+        const uint32_t version = MeshFile::s_format_version + 1U;
+        std::memcpy(invalid_data.data() + sizeof(uint32_t), &version, sizeof(version));
+        CHECK_THROWS_AS(MeshFile(Data::Chunk(std::move(invalid_data))), Methane::ArgumentException);
+    }
+
+    SECTION("Truncated Data")
+    {
+        Data::Bytes truncated_data(mesh_file_data.begin(), mesh_file_data.end() - 1);
+        CHECK_THROWS_AS(MeshFile(Data::Chunk(std::move(truncated_data))), Methane::ArgumentException);
+    }
+}
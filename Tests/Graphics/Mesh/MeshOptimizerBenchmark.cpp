@@ -0,0 +1,130 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshOptimizerBenchmark.cpp
+Benchmark CPU cost of mesh vertex cache, overdraw and vertex fetch optimization on large meshes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static constexpr Mesh::OptimizationSettings g_vertex_cache_settings{
+    .reorder_triangles = true,
+    .reorder_clusters  = false,
+    .remap_vertices    = false
+};
+
+static constexpr Mesh::OptimizationSettings g_all_passes_settings{
+    .reorder_triangles  = true,
+    .reorder_clusters   = true,
+    .overdraw_threshold = 1.05F,
+    .remap_vertices     = true
+};
+
+template<typename MeshType>
+static Data::Size MeasureMeshOptimization(const MeshType& mesh, const Mesh::OptimizationSettings& settings, Catch::Benchmark::Chronometer meter)
+{
+    Data::Size optimized_indices_count = 0U;
+    meter.measure([&]()
+    {
+        // Mesh copy is included in measurement, but it takes a small fraction of optimization time
+        MeshType optimized_mesh(mesh);
+        optimized_mesh.Optimize(settings);
+        optimized_indices_count += optimized_mesh.GetIndexCount();
+    });
+
+    // Prevent code removal by optimizer and check that optimization was actually done
+    MeshType optimized_mesh(mesh);
+    optimized_mesh.Optimize(settings);
+    CHECK(optimized_mesh.GetVertexCacheStatistics().acmr < mesh.GetVertexCacheStatistics().acmr);
+    return optimized_indices_count;
+}
+
+static uint32_t MeasureVertexCacheAnalysis(const Mesh& mesh, Catch::Benchmark::Chronometer meter)
+{
+    uint32_t transformed_vertices_count = 0U;
+    meter.measure([&]()
+    {
+        transformed_vertices_count += mesh.GetVertexCacheStatistics().transformed_vertices_count;
+    });
+    return transformed_vertices_count;
+}
+
+TEST_CASE("Benchmark mesh optimization", "[mesh][optimizer][benchmark]")
+{
+    const SphereMesh<MeshVertex>      sphere_128_mesh(MeshVertex::layout, 1.F, 128U, 128U);
+    const SphereMesh<MeshVertex>      sphere_256_mesh(MeshVertex::layout, 1.F, 256U, 256U);
+    const IcosahedronMesh<MeshVertex> icosahedron_5_mesh(MeshVertex::layout, 1.F, 5U, true);
+
+    SECTION("Vertex cache analysis")
+    {
+        BENCHMARK_ADVANCED("Analyze vertex cache of sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureVertexCacheAnalysis(sphere_256_mesh, meter);
+        };
+        BENCHMARK_ADVANCED("Analyze vertex cache of icosahedron with 5 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureVertexCacheAnalysis(icosahedron_5_mesh, meter);
+        };
+    }
+
+    SECTION("Vertex cache optimization")
+    {
+        BENCHMARK_ADVANCED("Optimize vertex cache of sphere 128x128")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(sphere_128_mesh, g_vertex_cache_settings, meter);
+        };
+        BENCHMARK_ADVANCED("Optimize vertex cache of sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(sphere_256_mesh, g_vertex_cache_settings, meter);
+        };
+        BENCHMARK_ADVANCED("Optimize vertex cache of icosahedron with 5 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(icosahedron_5_mesh, g_vertex_cache_settings, meter);
+        };
+    }
+
+    SECTION("Vertex cache, overdraw and vertex fetch optimization")
+    {
+        BENCHMARK_ADVANCED("Optimize all passes of sphere 128x128")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(sphere_128_mesh, g_all_passes_settings, meter);
+        };
+        BENCHMARK_ADVANCED("Optimize all passes of sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(sphere_256_mesh, g_all_passes_settings, meter);
+        };
+        BENCHMARK_ADVANCED("Optimize all passes of icosahedron with 5 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshOptimization(icosahedron_5_mesh, g_all_passes_settings, meter);
+        };
+    }
+}
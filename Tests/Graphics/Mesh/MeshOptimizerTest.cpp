@@ -0,0 +1,233 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshOptimizerTest.cpp
+Mesh vertex cache, overdraw and vertex fetch optimization unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshOptimizer.h>
+#include <Methane/Graphics/QuadMesh.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/TypeFormatters.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Triangle  = std::array<Mesh::Index, 3>;
+using Triangles = std::multiset<Triangle>;
+
+static Triangles GetTriangles(std::span<const Mesh::Index> indices)
+{
+    Triangles triangles;
+    for(size_t index = 0; index < indices.size(); index += 3)
+    {
+        // Triangle is rotated to start from the smallest index, so that winding order is preserved
+        Triangle triangle{ indices[index], indices[index + 1], indices[index + 2] };
+        std::ranges::rotate(triangle, std::ranges::min_element(triangle));
+        triangles.insert(triangle);
+    }
+    return triangles;
+}
+
+template<typename MeshType>
+static void CheckVertexCacheOptimization(const MeshType& mesh, bool is_acmr_improvement_expected)
+{
+    MeshType optimized_mesh(mesh);
+    optimized_mesh.Optimize({ .reorder_triangles = true, .remap_vertices = false });
+
+    const Mesh::VertexCacheStatistics original_statistics  = mesh.GetVertexCacheStatistics();
+    const Mesh::VertexCacheStatistics optimized_statistics = optimized_mesh.GetVertexCacheStatistics();
+
+    CHECK(optimized_mesh.GetVertices() == mesh.GetVertices());
+    CHECK(GetTriangles(optimized_mesh.GetIndices()) == GetTriangles(mesh.GetIndices()));
+    CHECK(optimized_statistics.atvr <= original_statistics.atvr);
+    if (is_acmr_improvement_expected)
+    {
+        CHECK(optimized_statistics.acmr < original_statistics.acmr);
+    }
+    else
+    {
+        CHECK(optimized_statistics.acmr <= original_statistics.acmr);
+    }
+}
+
+TEST_CASE("Mesh Vertex Cache Analysis", "[mesh][optimizer]")
+{
+    SECTION("Triangle Strip Indices")
+    {
+        const Mesh::Indices indices{ 0, 1, 2, 2, 1, 3, 2, 3, 4, 4, 3, 5 };
+        const Mesh::VertexCacheStatistics statistics = AnalyzeVertexCache(indices, 6U);
+        CHECK(statistics.transformed_vertices_count == 6U);
+        CHECK(statistics.acmr == 1.5F);
+        CHECK(statistics.atvr == 1.F);
+    }
+
+    SECTION("Vertex Cache Thrashing")
+    {
+        const Mesh::Indices indices{ 0, 1, 2, 3, 4, 5, 0, 1, 2 };
+        const Mesh::VertexCacheStatistics statistics = AnalyzeVertexCache(indices, 6U, 3U);
+        CHECK(statistics.transformed_vertices_count == 9U);
+        CHECK(statistics.acmr == 3.F);
+        CHECK(statistics.atvr == 1.5F);
+    }
+
+    SECTION("Out of Bounds Indices")
+    {
+        const Mesh::Indices indices{ 0, 1, 2, 2, 1, 6 };
+        CHECK_THROWS_AS(AnalyzeVertexCache(indices, 6U), Methane::ArgumentException);
+    }
+}
+
+TEST_CASE("Mesh Vertex Cache Optimization", "[mesh][optimizer]")
+{
+    SECTION("Quad Mesh")
+    {
+        CheckVertexCacheOptimization(QuadMesh<MeshVertex>(MeshVertex::layout), false);
+    }
+
+    SECTION("Cube Mesh")
+    {
+        CheckVertexCacheOptimization(CubeMesh<MeshVertex>(MeshVertex::layout), false);
+    }
+
+    SECTION("Sphere Mesh")
+    {
+        CheckVertexCacheOptimization(SphereMesh<MeshVertex>(MeshVertex::layout, 1.F, 32U, 32U), true);
+    }
+
+    SECTION("Icosahedron Mesh")
+    {
+        CheckVertexCacheOptimization(IcosahedronMesh<MeshVertex>(MeshVertex::layout, 1.F, 3U, true), true);
+    }
+}
+
+TEST_CASE("Mesh Overdraw Optimization", "[mesh][optimizer]")
+{
+    const SphereMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 32U, 32U);
+    SphereMesh<MeshVertex> cache_optimized_mesh(mesh);
+    cache_optimized_mesh.Optimize({ .reorder_triangles = true, .remap_vertices = false });
+
+    SphereMesh<MeshVertex> overdraw_optimized_mesh(mesh);
+    overdraw_optimized_mesh.Optimize({
+        .reorder_triangles  = true,
+        .reorder_clusters   = true,
+        .overdraw_threshold = 1.05F,
+        .remap_vertices     = false
+    });
+
+    SECTION("Triangles are Preserved")
+    {
+        CHECK(GetTriangles(overdraw_optimized_mesh.GetIndices()) == GetTriangles(mesh.GetIndices()));
+    }
+
+    SECTION("Triangle Clusters are Reordered")
+    {
+        CHECK(overdraw_optimized_mesh.GetIndices() != cache_optimized_mesh.GetIndices());
+        CHECK(overdraw_optimized_mesh.GetVertexCacheStatistics().acmr < mesh.GetVertexCacheStatistics().acmr);
+    }
+
+    SECTION("Threshold Less Than One is Rejected")
+    {
+        SphereMesh<MeshVertex> invalid_mesh(mesh);
+        CHECK_THROWS_AS(invalid_mesh.Optimize({ .reorder_clusters = true, .overdraw_threshold = 0.5F }), Methane::ArgumentException);
+    }
+}
+
+TEST_CASE("Mesh Vertex Fetch Optimization", "[mesh][optimizer]")
+{
+    const IcosahedronMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 2U, true);
+    IcosahedronMesh<MeshVertex> cache_optimized_mesh(mesh);
+    cache_optimized_mesh.Optimize({ .reorder_triangles = true, .remap_vertices = false });
+
+    IcosahedronMesh<MeshVertex> fetch_optimized_mesh(mesh);
+    fetch_optimized_mesh.Optimize({ .reorder_triangles = true, .remap_vertices = true });
+
+    SECTION("Indices Reference Vertices in Order of First Use")
+    {
+        Mesh::Index next_vertex_index = 0U;
+        for(Mesh::Index vertex_index : fetch_optimized_mesh.GetIndices())
+        {
+            REQUIRE(vertex_index <= next_vertex_index);
+            if (vertex_index == next_vertex_index)
+                next_vertex_index++;
+        }
+        CHECK(next_vertex_index == mesh.GetVertexCount());
+    }
+
+    SECTION("Rendered Vertices are Preserved")
+    {
+        REQUIRE(fetch_optimized_mesh.GetIndexCount() == cache_optimized_mesh.GetIndexCount());
+        REQUIRE(fetch_optimized_mesh.GetVertexCount() == cache_optimized_mesh.GetVertexCount());
+        for(Data::Index index = 0; index < fetch_optimized_mesh.GetIndexCount(); ++index)
+        {
+            REQUIRE(fetch_optimized_mesh.GetVertices()[fetch_optimized_mesh.GetIndex(index)] ==
+                    cache_optimized_mesh.GetVertices()[cache_optimized_mesh.GetIndex(index)]);
+        }
+    }
+
+    SECTION("Unreferenced Vertices are Moved to the End")
+    {
+        Mesh::Indices indices{ 3, 1, 4 };
+        const Mesh::Indices vertex_remap = OptimizeVertexFetch(indices, 6U);
+        CHECK(indices == Mesh::Indices{ 0, 1, 2 });
+        CHECK(vertex_remap == Mesh::Indices{ 3, 1, 4, 0, 2, 5 });
+    }
+}
+
+TEST_CASE("Uber Mesh Optimization", "[mesh][optimizer]")
+{
+    const SphereMesh<MeshVertex>      sphere_mesh(MeshVertex::layout, 1.F, 16U, 16U);
+    const IcosahedronMesh<MeshVertex> icosahedron_mesh(MeshVertex::layout, 1.F, 2U, true);
+
+    UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+    uber_mesh.AddSubMesh(sphere_mesh, true);
+    uber_mesh.AddSubMesh(icosahedron_mesh, false);
+
+    UberMesh<MeshVertex> optimized_uber_mesh(uber_mesh);
+    optimized_uber_mesh.Optimize();
+
+    CHECK(optimized_uber_mesh.GetVertexCount() == uber_mesh.GetVertexCount());
+    CHECK(optimized_uber_mesh.GetIndexCount() == uber_mesh.GetIndexCount());
+    CHECK(optimized_uber_mesh.GetVertexCacheStatistics().acmr < uber_mesh.GetVertexCacheStatistics().acmr);
+
+    for(size_t subset_index = 0; subset_index < uber_mesh.GetSubsetCount(); ++subset_index)
+    {
+        const Mesh::Subset& subset = optimized_uber_mesh.GetSubset(subset_index);
+        const auto [subset_indices_ptr, subset_indices_count] = optimized_uber_mesh.GetSubsetIndices(subset_index);
+        const Mesh::Index min_index = subset.indices_adjusted ? subset.vertices.offset : 0U;
+        for(size_t index = 0; index < subset_indices_count; ++index)
+        {
+            REQUIRE(subset_indices_ptr[index] >= min_index);
+            REQUIRE(subset_indices_ptr[index] < min_index + subset.vertices.count);
+        }
+    }
+}
@@ -0,0 +1,71 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshSimplifierBenchmark.cpp
+Benchmark CPU throughput of mesh levels of detail generation on high-subdivision meshes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshSimplifier.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+template<typename MeshType>
+static size_t MeasureLodsGeneration(const MeshType& mesh, Catch::Benchmark::Chronometer meter)
+{
+    size_t lods_count = 0U;
+    meter.measure([&]()
+    {
+        lods_count += mesh.BuildLods().size();
+    });
+
+    // Prevent code removal by optimizer and check that mesh was simplified
+    CHECK(!mesh.BuildLods().empty());
+    return lods_count;
+}
+
+TEST_CASE("Benchmark mesh levels of detail generation", "[mesh][lod][benchmark]")
+{
+    const SphereMesh<MeshVertex>      sphere_128_mesh(MeshVertex::layout, 1.F, 128U, 128U);
+    const IcosahedronMesh<MeshVertex> icosahedron_4_mesh(MeshVertex::layout, 1.F, 4U, true);
+    const IcosahedronMesh<MeshVertex> icosahedron_5_mesh(MeshVertex::layout, 1.F, 5U, true);
+
+    BENCHMARK_ADVANCED("Build levels of detail of sphere 128x128")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLodsGeneration(sphere_128_mesh, meter);
+    };
+    BENCHMARK_ADVANCED("Build levels of detail of icosahedron with 4 subdivisions")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLodsGeneration(icosahedron_4_mesh, meter);
+    };
+    BENCHMARK_ADVANCED("Build levels of detail of icosahedron with 5 subdivisions")(Catch::Benchmark::Chronometer meter)
+    {
+        return MeasureLodsGeneration(icosahedron_5_mesh, meter);
+    };
+}
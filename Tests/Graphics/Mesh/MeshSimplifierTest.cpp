@@ -0,0 +1,187 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshSimplifierTest.cpp
+Mesh levels of detail generation unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/MeshSimplifier.h>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/TypeFormatters.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <cmath>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static void CheckLodTriangles(const Mesh::Lod& lod, const Mesh::Subset::Slice& vertex_slice)
+{
+    REQUIRE(lod.indices.size() % 3 == 0U);
+    for(size_t index = 0; index < lod.indices.size(); index += 3)
+    {
+        const Mesh::Index i1 = lod.indices[index];
+        const Mesh::Index i2 = lod.indices[index + 1];
+        const Mesh::Index i3 = lod.indices[index + 2];
+        CHECK((i1 != i2 && i2 != i3 && i1 != i3));
+        for(const Mesh::Index vertex_index : { i1, i2, i3 })
+        {
+            CHECK(vertex_index >= vertex_slice.offset);
+            CHECK(vertex_index < vertex_slice.offset + vertex_slice.count);
+        }
+    }
+}
+
+// Measures max distance of simplified triangle centroids from the unit sphere surface,
+// which estimates geometric deviation of simplified sphere from the original one
+static float GetMaxSphereDeviation(const std::vector<Mesh::Position>& positions, const Mesh::Lod& lod)
+{
+    float max_deviation = 0.F;
+    for(size_t index = 0; index < lod.indices.size(); index += 3)
+    {
+        const hlslpp::float3 centroid = (positions[lod.indices[index]].AsHlsl() +
+                                         positions[lod.indices[index + 1]].AsHlsl() +
+                                         positions[lod.indices[index + 2]].AsHlsl()) / 3.F;
+        max_deviation = std::max(max_deviation, std::abs(1.F - static_cast<float>(hlslpp::length(centroid))));
+    }
+    return max_deviation;
+}
+
+TEST_CASE("Sphere Levels of Detail Generation", "[mesh][lod]")
+{
+    const IcosahedronMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 4U, true);
+    constexpr Mesh::LodSettings lod_settings{ .max_lods_count = 4U, .index_count_ratio = 0.5F, .max_relative_error = 0.05F };
+    const Mesh::Lods lods = mesh.BuildLods(lod_settings);
+
+    SECTION("Index Count is Reduced by Ratio")
+    {
+        REQUIRE(lods.size() == lod_settings.max_lods_count);
+        size_t prev_index_count = mesh.GetIndexCount();
+        for(const Mesh::Lod& lod : lods)
+        {
+            CHECK(!lod.indices.empty());
+            CHECK(static_cast<float>(lod.indices.size()) <= static_cast<float>(prev_index_count) * lod_settings.index_count_ratio);
+            prev_index_count = lod.indices.size();
+        }
+    }
+
+    SECTION("Levels of Detail Reference Mesh Vertices")
+    {
+        for(const Mesh::Lod& lod : lods)
+        {
+            CheckLodTriangles(lod, Mesh::Subset::Slice(0U, mesh.GetVertexCount()));
+        }
+    }
+
+    SECTION("Errors Grow Within Bounds")
+    {
+        // Sphere of unit radius has extent 2, so relative error 0.05 results in absolute error 0.1
+        constexpr float max_error = 2.F * lod_settings.max_relative_error;
+        const std::vector<Mesh::Position> positions = mesh.GetPositions(Mesh::Subset::Slice(0U, mesh.GetVertexCount()));
+        float prev_error = 0.F;
+        for(const Mesh::Lod& lod : lods)
+        {
+            CHECK(lod.error > 0.F);
+            CHECK(lod.error >= prev_error);
+            CHECK(lod.error <= max_error);
+            CHECK(GetMaxSphereDeviation(positions, lod) <= 2.F * lod.error);
+            prev_error = lod.error;
+        }
+    }
+
+    SECTION("Simplification Stops at Max Error")
+    {
+        CHECK(mesh.BuildLods({ .max_relative_error = 1E-5F }).empty());
+    }
+}
+
+TEST_CASE("Sphere Levels of Detail Preserve Texture Seams", "[mesh][lod]")
+{
+    constexpr Mesh::Index lines_count = 32U;
+    const SphereMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, lines_count, lines_count);
+    const Mesh::Lods lods = mesh.BuildLods();
+    REQUIRE(!lods.empty());
+
+    // Texture seam is formed by the first and the last longitude line vertices with equal positions,
+    // which should be never collapsed to keep texture coordinates continuous across the seam
+    constexpr Mesh::Index row_vertex_count = lines_count + 1U;
+    for(const Mesh::Lod& lod : lods)
+    {
+        CheckLodTriangles(lod, Mesh::Subset::Slice(0U, mesh.GetVertexCount()));
+        const std::set<Mesh::Index> lod_vertices(lod.indices.begin(), lod.indices.end());
+        for(Mesh::Index lat_line_index = 1U; lat_line_index < lines_count - 1U; ++lat_line_index)
+        {
+            CHECK(lod_vertices.contains(lat_line_index * row_vertex_count));
+            CHECK(lod_vertices.contains(lat_line_index * row_vertex_count + lines_count));
+        }
+    }
+}
+
+TEST_CASE("Cube Levels of Detail Generation", "[mesh][lod]")
+{
+    const CubeMesh<MeshVertex> mesh(MeshVertex::layout);
+
+    SECTION("Cube Can Not be Simplified")
+    {
+        // All cube vertices are on seams between faces with different normals
+        CHECK(mesh.BuildLods().empty());
+    }
+
+    SECTION("Invalid Levels of Detail Settings")
+    {
+        CHECK_THROWS_AS(mesh.BuildLods({ .index_count_ratio = 1.F }), Methane::ArgumentException);
+        CHECK_THROWS_AS(mesh.BuildLods({ .index_count_ratio = -0.5F }), Methane::ArgumentException);
+        CHECK_THROWS_AS(mesh.BuildLods({ .max_relative_error = -1.F }), Methane::ArgumentException);
+    }
+}
+
+TEST_CASE("Uber Mesh Levels of Detail Generation", "[mesh][lod]")
+{
+    const IcosahedronMesh<MeshVertex> icosahedron_3_mesh(MeshVertex::layout, 1.F, 3U, true);
+    const IcosahedronMesh<MeshVertex> icosahedron_4_mesh(MeshVertex::layout, 1.F, 4U, true);
+
+    UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+    uber_mesh.AddSubMesh(icosahedron_3_mesh, true);
+    uber_mesh.AddSubMesh(icosahedron_4_mesh, false);
+
+    for(uint32_t subset_index = 0; subset_index < uber_mesh.GetSubsetCount(); ++subset_index)
+    {
+        const Mesh::Subset& subset = uber_mesh.GetSubset(subset_index);
+        const Mesh::Lods    lods   = uber_mesh.BuildSubsetLods(subset_index);
+        REQUIRE(!lods.empty());
+
+        // Indices of adjusted subset are offset to subset vertices, while not adjusted are relative to subset vertices
+        const Mesh::Subset::Slice vertex_slice(subset.indices_adjusted ? subset.vertices.offset : 0U, subset.vertices.count);
+        for(const Mesh::Lod& lod : lods)
+        {
+            CHECK(lod.indices.size() < subset.indices.count);
+            CheckLodTriangles(lod, vertex_slice);
+        }
+    }
+}
@@ -0,0 +1,97 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshletsBenchmark.cpp
+Benchmark CPU throughput of meshlets generation on high-subdivision meshes.
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+template<typename MeshType>
+static size_t MeasureMeshletsGeneration(const MeshType& mesh, Catch::Benchmark::Chronometer meter)
+{
+    size_t meshlets_count = 0U;
+    meter.measure([&]()
+    {
+        meshlets_count += mesh.BuildMeshlets().GetCount();
+    });
+
+    // Prevent code removal by optimizer and check that all triangles were split into meshlets
+    CHECK(mesh.BuildMeshlets().local_indices.size() == mesh.GetIndexCount());
+    return meshlets_count;
+}
+
+template<typename MeshType>
+static MeshType GetOptimizedMesh(const MeshType& mesh)
+{
+    MeshType optimized_mesh(mesh);
+    optimized_mesh.Optimize();
+    return optimized_mesh;
+}
+
+TEST_CASE("Benchmark meshlets generation", "[mesh][meshlets][benchmark]")
+{
+    const SphereMesh<MeshVertex>      sphere_256_mesh(MeshVertex::layout, 1.F, 256U, 256U);
+    const IcosahedronMesh<MeshVertex> icosahedron_5_mesh(MeshVertex::layout, 1.F, 5U, true);
+    const IcosahedronMesh<MeshVertex> icosahedron_6_mesh(MeshVertex::layout, 1.F, 6U, true);
+
+    SECTION("Meshlets generation of original meshes")
+    {
+        BENCHMARK_ADVANCED("Build meshlets of sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshletsGeneration(sphere_256_mesh, meter);
+        };
+        BENCHMARK_ADVANCED("Build meshlets of icosahedron with 5 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshletsGeneration(icosahedron_5_mesh, meter);
+        };
+        BENCHMARK_ADVANCED("Build meshlets of icosahedron with 6 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshletsGeneration(icosahedron_6_mesh, meter);
+        };
+    }
+
+    SECTION("Meshlets generation of optimized meshes")
+    {
+        const SphereMesh<MeshVertex>      sphere_256_optimized_mesh    = GetOptimizedMesh(sphere_256_mesh);
+        const IcosahedronMesh<MeshVertex> icosahedron_6_optimized_mesh = GetOptimizedMesh(icosahedron_6_mesh);
+
+        BENCHMARK_ADVANCED("Build meshlets of optimized sphere 256x256")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshletsGeneration(sphere_256_optimized_mesh, meter);
+        };
+        BENCHMARK_ADVANCED("Build meshlets of optimized icosahedron with 6 subdivisions")(Catch::Benchmark::Chronometer meter)
+        {
+            return MeasureMeshletsGeneration(icosahedron_6_optimized_mesh, meter);
+        };
+    }
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshletsTest.cpp
+Meshlets generation unit tests
+
+******************************************************************************/
+
+#include <Methane/Graphics/Meshlets.h>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/TypeFormatters.hpp>
+
+#define MESH_VERTEX_POSITION
+#define MESH_VERTEX_NORMAL
+#define MESH_VERTEX_TEXCOORD
+#include "MeshTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <set>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Triangle  = std::array<Mesh::Index, 3>;
+using Triangles = std::multiset<Triangle>;
+
+static constexpr float g_bounds_epsilon = 1E-4F;
+
+static Triangles GetMeshTriangles(const Mesh& mesh)
+{
+    Triangles triangles;
+    for(Data::Index index = 0; index < mesh.GetIndexCount(); index += 3)
+    {
+        triangles.insert({ mesh.GetIndex(index), mesh.GetIndex(index + 1), mesh.GetIndex(index + 2) });
+    }
+    return triangles;
+}
+
+static Triangle GetMeshletTriangle(const Meshlets& meshlets, const Meshlet& meshlet, uint32_t triangle_index)
+{
+    Triangle triangle{};
+    for(uint32_t i = 0; i < 3; ++i)
+    {
+        const uint8_t local_index = meshlets.local_indices[meshlet.local_index_offset + triangle_index * 3 + i];
+        REQUIRE(local_index < meshlet.vertices_count);
+        triangle[i] = meshlets.vertex_indices[meshlet.vertex_offset + local_index];
+    }
+    return triangle;
+}
+
+static Triangles GetMeshletsTriangles(const Meshlets& meshlets)
+{
+    Triangles triangles;
+    for(const Meshlet& meshlet : meshlets.meshlets)
+    {
+        for(uint32_t triangle_index = 0; triangle_index < meshlet.triangles_count; ++triangle_index)
+        {
+            triangles.insert(GetMeshletTriangle(meshlets, meshlet, triangle_index));
+        }
+    }
+    return triangles;
+}
+
+template<typename MeshType>
+static void CheckMeshletBounds(const MeshType& mesh, const Meshlets& meshlets)
+{
+    const std::vector<Mesh::Position> positions = mesh.GetPositions(Mesh::Subset::Slice(0U, mesh.GetVertexCount()));
+    REQUIRE(meshlets.bounds.size() == meshlets.meshlets.size());
+
+    for(size_t meshlet_index = 0; meshlet_index < meshlets.GetCount(); ++meshlet_index)
+    {
+        const Meshlet&       meshlet = meshlets.meshlets[meshlet_index];
+        const MeshletBounds& bounds  = meshlets.bounds[meshlet_index];
+
+        for(uint32_t vertex_index = 0; vertex_index < meshlet.vertices_count; ++vertex_index)
+        {
+            const Mesh::Position& position = positions[meshlets.vertex_indices[meshlet.vertex_offset + vertex_index]];
+            CHECK(static_cast<float>(hlslpp::length(position.AsHlsl() - bounds.center.AsHlsl())) <= bounds.radius + g_bounds_epsilon);
+        }
+
+        if (bounds.cone_cutoff >= 1.F)
+            continue;
+
+        // All triangle normals should be inside normal cone
+        const float min_axis_dot = std::sqrt(1.F - bounds.cone_cutoff * bounds.cone_cutoff);
+        for(uint32_t triangle_index = 0; triangle_index < meshlet.triangles_count; ++triangle_index)
+        {
+            const Triangle       triangle = GetMeshletTriangle(meshlets, meshlet, triangle_index);
+            const hlslpp::float3 p1 = positions[triangle[0]].AsHlsl();
+            const hlslpp::float3 p2 = positions[triangle[1]].AsHlsl();
+            const hlslpp::float3 p3 = positions[triangle[2]].AsHlsl();
+            const hlslpp::float3 normal = hlslpp::normalize(hlslpp::cross(p2 - p1, p3 - p1));
+            CHECK(static_cast<float>(hlslpp::dot(normal, bounds.cone_axis.AsHlsl())) >= min_axis_dot - g_bounds_epsilon);
+        }
+    }
+}
+
+TEST_CASE("Sphere Meshlets Generation", "[mesh][meshlets]")
+{
+    const IcosahedronMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, 4U, true);
+    constexpr MeshletSettings meshlet_settings{ .max_vertices_count = 64U, .max_triangles_count = 124U };
+    const Meshlets meshlets = mesh.BuildMeshlets(meshlet_settings);
+
+    SECTION("Meshlets Cover All Triangles")
+    {
+        REQUIRE(meshlets.GetCount() > 1U);
+        CHECK(GetMeshletsTriangles(meshlets) == GetMeshTriangles(mesh));
+        CHECK(meshlets.local_indices.size() == mesh.GetIndexCount());
+    }
+
+    SECTION("Meshlets Fit Limits")
+    {
+        for(const Meshlet& meshlet : meshlets.meshlets)
+        {
+            CHECK(meshlet.subset_index == 0U);
+            CHECK(meshlet.vertices_count > 0U);
+            CHECK(meshlet.vertices_count <= meshlet_settings.max_vertices_count);
+            CHECK(meshlet.triangles_count > 0U);
+            CHECK(meshlet.triangles_count <= meshlet_settings.max_triangles_count);
+        }
+    }
+
+    SECTION("Meshlet Vertices are Unique")
+    {
+        for(const Meshlet& meshlet : meshlets.meshlets)
+        {
+            const auto vertices_begin_it = meshlets.vertex_indices.begin() + meshlet.vertex_offset;
+            const std::set<Mesh::Index> unique_vertices(vertices_begin_it, vertices_begin_it + meshlet.vertices_count);
+            CHECK(unique_vertices.size() == meshlet.vertices_count);
+        }
+    }
+
+    SECTION("Meshlet Bounds Contain Meshlet Geometry")
+    {
+        CheckMeshletBounds(mesh, meshlets);
+    }
+
+    SECTION("Sphere Meshlets Have Normal Cones")
+    {
+        // Meshlets of highly tessellated sphere are nearly flat, so most of them can be culled by normal cone
+        const auto cone_meshlets_count = std::ranges::count_if(meshlets.bounds,
+            [](const MeshletBounds& bounds) { return bounds.cone_cutoff < 1.F; });
+        CHECK(static_cast<size_t>(cone_meshlets_count) * 2U > meshlets.GetCount());
+    }
+}
+
+TEST_CASE("Cube Meshlets Generation", "[mesh][meshlets]")
+{
+    const CubeMesh<MeshVertex> mesh(MeshVertex::layout);
+    const Meshlets meshlets = mesh.BuildMeshlets({ .max_vertices_count = 8U, .max_triangles_count = 4U });
+
+    // Cube faces do not share vertices, so each meshlet is filled with two faces
+    CHECK(meshlets.GetCount() == 3U);
+    CHECK(GetMeshletsTriangles(meshlets) == GetMeshTriangles(mesh));
+    CheckMeshletBounds(mesh, meshlets);
+
+    SECTION("Invalid Meshlet Settings")
+    {
+        CHECK_THROWS_AS(mesh.BuildMeshlets({ .max_vertices_count = 2U }), Methane::ArgumentException);
+        CHECK_THROWS_AS(mesh.BuildMeshlets({ .max_vertices_count = 257U }), Methane::ArgumentException);
+        CHECK_THROWS_AS(mesh.BuildMeshlets({ .max_triangles_count = 0U }), Methane::ArgumentException);
+    }
+}
+
+TEST_CASE("Uber Mesh Meshlets Generation", "[mesh][meshlets]")
+{
+    const SphereMesh<MeshVertex>      sphere_mesh(MeshVertex::layout, 1.F, 16U, 16U);
+    const IcosahedronMesh<MeshVertex> icosahedron_mesh(MeshVertex::layout, 1.F, 2U, true);
+
+    UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+    uber_mesh.AddSubMesh(sphere_mesh, true);
+    uber_mesh.AddSubMesh(icosahedron_mesh, false);
+
+    const Meshlets meshlets = uber_mesh.BuildMeshlets();
+    CheckMeshletBounds(uber_mesh, meshlets);
+
+    for(uint32_t subset_index = 0; subset_index < uber_mesh.GetSubsetCount(); ++subset_index)
+    {
+        const Mesh::Subset& subset = uber_mesh.GetSubset(subset_index);
+        const Mesh::Index   base_vertex_index = subset.indices_adjusted ? 0U : subset.vertices.offset;
+
+        Triangles subset_triangles;
+        for(Data::Index index = 0; index < subset.indices.count; index += 3)
+        {
+            const Data::Index offset = subset.indices.offset + index;
+            subset_triangles.insert({
+                uber_mesh.GetIndex(offset)     + base_vertex_index,
+                uber_mesh.GetIndex(offset + 1) + base_vertex_index,
+                uber_mesh.GetIndex(offset + 2) + base_vertex_index
+            });
+        }
+
+        Triangles meshlet_triangles;
+        for(const Meshlet& meshlet : meshlets.meshlets)
+        {
+            if (meshlet.subset_index != subset_index)
+                continue;
+
+            for(uint32_t triangle_index = 0; triangle_index < meshlet.triangles_count; ++triangle_index)
+            {
+                const Triangle triangle = GetMeshletTriangle(meshlets, meshlet, triangle_index);
+                for(Mesh::Index vertex_index : triangle)
+                {
+                    CHECK(vertex_index >= subset.vertices.offset);
+                    CHECK(vertex_index < subset.vertices.offset + subset.vertices.count);
+                }
+                meshlet_triangles.insert(triangle);
+            }
+        }
+        CHECK(meshlet_triangles == subset_triangles);
+    }
+}
@@ -32,6 +32,7 @@ Sphere mesh generator unit tests
 #include <catch2/catch_test_macros.hpp>
 #include <fmt/format.h>
 #include <string>
+#include <cstring>
 
 using namespace Methane;
 using namespace Methane::Graphics;
@@ -142,3 +143,27 @@ TEST_CASE("Sphere Mesh Generator", "[mesh]")
         CHECK(mesh.GetIndices() == mesh_indices);
     }
 }
+
+TEST_CASE("Large Sphere Mesh Generator with 32-bit Indices", "[mesh]")
+{
+    constexpr uint32_t lines_count        = 300U;
+    constexpr uint32_t large_vertex_count = lines_count * (lines_count + 1U);
+    const SphereMesh<MeshVertex> mesh(MeshVertex::layout, 1.F, lines_count, lines_count);
+
+    SECTION("Mesh Index Format")
+    {
+        REQUIRE(mesh.GetVertexCount() == large_vertex_count);
+        CHECK(mesh.GetMaxIndex() == large_vertex_count - 1U);
+        CHECK(mesh.GetIndexFormat() == PixelFormat::R32Uint);
+        CHECK(mesh.GetIndexSize() == 4U);
+        CHECK(mesh.GetIndexDataSize() == mesh.GetIndexCount() * 4U);
+    }
+
+    SECTION("Mesh Index Data")
+    {
+        const Data::Bytes index_data = mesh.GetIndexData();
+        REQUIRE(index_data.size() == mesh.GetIndexDataSize());
+        CHECK(std::memcmp(index_data.data(), mesh.GetIndices().data(), index_data.size()) == 0);
+        CHECK_THROWS_AS(mesh.GetIndexData(PixelFormat::R16Uint), Methane::ArgumentException);
+    }
+}
@@ -0,0 +1,209 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/HdrPixelConverterTest.cpp
+HDR pixel formats conversion unit tests and HDR image loading to textures with Null RHI backend
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "ImageTestHelpers.hpp"
+
+#include <Methane/Graphics/HdrPixelConverter.h>
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/ImageLoader.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/Null/Texture.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <cstring>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Rgbe = std::array<uint8_t, 4>;
+
+// Uncompressed Radiance HDR image filled with single RGBE color, which is decoded to mantissa * 2^(exponent - 136)
+[[nodiscard]]
+static Data::Bytes CreateHdrImage(uint32_t width, uint32_t height, const Rgbe& rgbe)
+{
+    const std::string header = "#?RADIANCE\nFORMAT=32-bit_rle_rgbe\n\n-Y " + std::to_string(height) + " +X " + std::to_string(width) + "\n";
+    Data::Bytes image_data(header.size() + static_cast<size_t>(width) * height * 4U);
+    std::memcpy(image_data.data(), header.data(), header.size());
+    for(size_t pixel_offset = header.size(); pixel_offset < image_data.size(); pixel_offset += 4U)
+    {
+        for(size_t channel = 0U; channel < 4U; ++channel)
+        {
+            image_data[pixel_offset + channel] = std::byte(rgbe[channel]);
+        }
+    }
+    return image_data;
+}
+
+template<typename T>
+[[nodiscard]]
+static bool IsDataFilledWithValue(const Data::Bytes& data, const T& value)
+{
+    if (data.empty() || data.size() % sizeof(T))
+        return false;
+
+    for(size_t offset = 0U; offset < data.size(); offset += sizeof(T))
+    {
+        if (std::memcmp(data.data() + offset, &value, sizeof(T)) != 0)
+            return false;
+    }
+    return true;
+}
+
+TEST_CASE("HDR Pixel Formats", "[texture][hdr]")
+{
+    SECTION("HDR pixel formats have compact pixel sizes")
+    {
+        CHECK(IsHdrPixelFormat(PixelFormat::RGBA16Float));
+        CHECK_FALSE(IsHdrPixelFormat(PixelFormat::RGBA8Unorm));
+        CHECK(GetPixelSize(PixelFormat::RGBA32Float) == 16U);
+        CHECK(GetPixelSize(PixelFormat::RGBA16Float) == 8U);
+        CHECK(GetPixelSize(PixelFormat::RG11B10Float) == 4U);
+        CHECK(GetPixelSize(PixelFormat::RGB9E5Float) == 4U);
+        CHECK(GetImageSlicePitch(PixelFormat::RGBA16Float, 10U, 4U) == 320U);
+        CHECK_FALSE(IsCompressedFormat(PixelFormat::RGB9E5Float));
+    }
+
+    SECTION("Half-float conversion rounds to nearest and handles special values")
+    {
+        CHECK(ConvertFloatToHalf(0.F) == 0x0000U);
+        CHECK(ConvertFloatToHalf(1.F) == 0x3C00U);
+        CHECK(ConvertFloatToHalf(-2.F) == 0xC000U);
+        CHECK(ConvertFloatToHalf(0.1F) == 0x2E66U);
+        CHECK(ConvertFloatToHalf(65504.F) == 0x7BFFU);
+        CHECK(ConvertFloatToHalf(1E6F) == 0x7C00U);
+        CHECK(ConvertFloatToHalf(5.9604645E-8F) == 0x0001U);
+        CHECK(ConvertHalfToFloat(0x3C00U) == 1.F);
+        CHECK(ConvertHalfToFloat(0xC000U) == -2.F);
+        CHECK(ConvertHalfToFloat(0x0001U) == 5.9604645E-8F);
+        CHECK(ConvertHalfToFloat(0x7BFFU) == 65504.F);
+        for(const float value : { 0.5F, 0.25F, 3.75F, 1024.F, -0.125F })
+        {
+            CHECK(ConvertHalfToFloat(ConvertFloatToHalf(value)) == value);
+        }
+    }
+
+    SECTION("R11G11B10 packed floats are unsigned and clamped to maximum")
+    {
+        const uint32_t packed_one = 0x3C0U | (0x3C0U << 11U) | (0x1E0U << 22U);
+        CHECK(PackRG11B10Float({ 1.F, 1.F, 1.F }) == packed_one);
+        CHECK(UnpackRG11B10Float(packed_one) == HdrColor{ 1.F, 1.F, 1.F });
+        CHECK(UnpackRG11B10Float(PackRG11B10Float({ 0.5F, 2.F, 4.F })) == HdrColor{ 0.5F, 2.F, 4.F });
+        CHECK(UnpackRG11B10Float(PackRG11B10Float({ -1.F, 0.F, 1E9F })) == HdrColor{ 0.F, 0.F, 64512.F });
+    }
+
+    SECTION("RGB9E5 packed floats share exponent of the largest component")
+    {
+        const uint32_t packed_color = (16U << 27U) | (128U << 9U) | 256U;
+        CHECK(PackRGB9E5Float({ 1.F, 0.5F, 0.F }) == packed_color);
+        CHECK(UnpackRGB9E5Float(packed_color) == HdrColor{ 1.F, 0.5F, 0.F });
+        CHECK(PackRGB9E5Float({ 0.F, -1.F, 0.F }) == 0U);
+        CHECK(UnpackRGB9E5Float(PackRGB9E5Float({ 1E9F, 0.F, 0.F }))[0] == 65408.F);
+    }
+
+    SECTION("Float pixels are converted to compact HDR formats")
+    {
+        const std::array<float, 8> rgba_pixels{ 1.F, 0.5F, 0.F, 1.F, 2.F, 4.F, 8.F, 0.F };
+        const Data::Bytes half_pixels = ConvertHdrPixels(rgba_pixels.data(), 2U, PixelFormat::RGBA16Float);
+        REQUIRE(half_pixels.size() == 16U);
+        std::array<uint16_t, 8> half_values{};
+        std::memcpy(half_values.data(), half_pixels.data(), half_pixels.size());
+        CHECK(half_values == std::array<uint16_t, 8>{ 0x3C00U, 0x3800U, 0x0000U, 0x3C00U, 0x4000U, 0x4400U, 0x4800U, 0x0000U });
+
+        const Data::Bytes packed_pixels = ConvertHdrPixels(rgba_pixels.data(), 2U, PixelFormat::RGB9E5Float);
+        REQUIRE(packed_pixels.size() == 8U);
+        uint32_t second_packed_color = 0U;
+        std::memcpy(&second_packed_color, packed_pixels.data() + 4U, sizeof(uint32_t));
+        CHECK(UnpackRGB9E5Float(second_packed_color) == HdrColor{ 2.F, 4.F, 8.F });
+
+        CHECK(ConvertHdrPixels(rgba_pixels.data(), 2U, PixelFormat::RGBA32Float).size() == sizeof(rgba_pixels));
+        CHECK_THROWS_AS(ConvertHdrPixels(rgba_pixels.data(), 2U, PixelFormat::RGBA8Unorm), ArgumentException);
+    }
+
+    SECTION("Half-float mip levels are averaged without quantization")
+    {
+        const std::array<float, 16> rgba_pixels{ 1.F, 1.F, 1.F, 1.F, 2.F, 2.F, 2.F, 2.F, 3.F, 3.F, 3.F, 3.F, 4.F, 4.F, 4.F, 4.F };
+        const Data::Bytes half_pixels = ConvertHdrPixels(rgba_pixels.data(), 4U, PixelFormat::RGBA16Float);
+        const MipChain    mip_chain   = MipChainGenerator().Generate(Data::Chunk(half_pixels.data(), static_cast<Data::Size>(half_pixels.size())),
+                                                                     Dimensions(2U, 2U), PixelFormat::RGBA16Float);
+        const Data::Chunk mip_pixels = mip_chain.GetMipLevelPixels(1U);
+        REQUIRE(mip_pixels.GetDataSize() == 8U);
+        uint16_t mip_value = 0U;
+        std::memcpy(&mip_value, mip_pixels.GetDataPtr(), sizeof(uint16_t));
+        CHECK(ConvertHalfToFloat(mip_value) == 2.5F);
+    }
+}
+
+TEST_CASE("HDR Image Loading", "[texture][hdr]")
+{
+    tf::Executor              executor;
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), executor, {});
+    const Rhi::CommandQueue   cmd_queue       = compute_context.GetComputeCommandKit().GetQueue();
+
+    Test::MemoryProvider memory_provider;
+    memory_provider.AddData("Sky.hdr", CreateHdrImage(4U, 4U, Rgbe{ 128U, 128U, 128U, 129U }));
+    memory_provider.AddData("Sun.HDR", CreateHdrImage(4U, 2U, Rgbe{ 128U, 128U, 128U, 130U }));
+
+    SECTION("HDR image paths are recognized by extension")
+    {
+        CHECK(ImageLoader::IsHdrImagePath("Sky.hdr"));
+        CHECK(ImageLoader::IsHdrImagePath("Textures/Sky.EXR"));
+        CHECK_FALSE(ImageLoader::IsHdrImagePath("Sky.png"));
+        CHECK_THROWS_AS(ImageLoader(memory_provider, PixelFormat::RGBA8Unorm), ArgumentException);
+    }
+
+    SECTION("HDR image is loaded to half-float texture by default")
+    {
+        const ImageLoader image_loader(memory_provider);
+        CHECK(image_loader.GetHdrPixelFormat() == PixelFormat::RGBA16Float);
+
+        const Rhi::Texture texture = image_loader.LoadImageToTexture2D(cmd_queue, "Sun.HDR", { ImageOption::SrgbColorSpace }, "Sun");
+        CHECK(texture.GetSettings().pixel_format == PixelFormat::RGBA16Float);
+        CHECK(texture.GetSettings().dimensions == Dimensions(4U, 2U));
+
+        const auto& null_texture = dynamic_cast<const Null::Texture&>(texture.GetInterface());
+        const Data::Bytes& pixels = null_texture.GetStoredData(Rhi::SubResourceIndex());
+        CHECK(pixels.size() == 4U * 2U * 8U);
+        CHECK(IsDataFilledWithValue(pixels, std::array<uint16_t, 4>{ 0x4000U, 0x4000U, 0x4000U, 0x3C00U }));
+    }
+
+    SECTION("HDR image is loaded to packed float texture with CPU mip levels")
+    {
+        const ImageLoader image_loader(memory_provider, PixelFormat::RG11B10Float);
+        const Rhi::Texture texture = image_loader.LoadImageToTexture2D(cmd_queue, "Sky.hdr", { ImageOption::CpuMipmapped });
+        CHECK(texture.GetSettings().pixel_format == PixelFormat::RG11B10Float);
+        REQUIRE(texture.GetSubresourceCount().GetMipLevelsCount() == 3U);
+
+        const auto& null_texture = dynamic_cast<const Null::Texture&>(texture.GetInterface());
+        const uint32_t packed_one = PackRG11B10Float({ 1.F, 1.F, 1.F });
+        for(uint32_t mip_level = 0U; mip_level < 3U; ++mip_level)
+        {
+            CHECK(IsDataFilledWithValue(null_texture.GetStoredData(Rhi::SubResourceIndex(0U, 0U, mip_level)), packed_one));
+        }
+    }
+}
@@ -0,0 +1,233 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/ImageContainerTest.cpp
+KTX2 and DDS image containers parsing and texture upload unit tests with Null RHI backend
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/ImageContainer.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <string>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+static tf::Executor g_parallel_executor;
+
+[[nodiscard]]
+static ImageContainer LoadTestImageContainer(const std::string& file_name)
+{
+    return ImageContainer(Data::FileProvider::Get().GetData(std::string(TEST_TEXTURES_DIR) + "/" + file_name));
+}
+
+static void CheckSubResourcesData(const ImageContainer& image_container)
+{
+    // Test images are filled with bytes equal to 16 * image_index + mip_level
+    const uint32_t images_count = image_container.GetDimensions().GetDepth() * image_container.GetArrayLength();
+    for(const Rhi::SubResource& sub_resource : image_container.GetSubResources())
+    {
+        const Rhi::SubResourceIndex& index = sub_resource.GetIndex();
+        const uint32_t image_index = index.GetArrayIndex() * image_container.GetDimensions().GetDepth() + index.GetDepthSlice();
+        REQUIRE(image_index < images_count);
+        CHECK(sub_resource.GetDataPtr()[0] == std::byte(image_index * 16U + index.GetMipLevel()));
+        CHECK(sub_resource.GetDataEndPtr()[-1] == std::byte(image_index * 16U + index.GetMipLevel()));
+    }
+}
+
+TEST_CASE("Image Container Pixel Formats", "[image][container]")
+{
+    SECTION("Block-Compressed Format Sizes")
+    {
+        CHECK(IsCompressedFormat(PixelFormat::BC1Unorm));
+        CHECK(IsCompressedFormat(PixelFormat::BC7Unorm_sRGB));
+        CHECK_FALSE(IsCompressedFormat(PixelFormat::RGBA8Unorm));
+        CHECK(GetPixelBlockDimension(PixelFormat::BC3Unorm) == 4U);
+        CHECK(GetPixelBlockDimension(PixelFormat::R8Unorm) == 1U);
+        CHECK(GetPixelBlockSize(PixelFormat::BC1Unorm) == 8U);
+        CHECK(GetPixelBlockSize(PixelFormat::BC5Snorm) == 16U);
+        CHECK(GetPixelBlockSize(PixelFormat::RGBA8Unorm) == 4U);
+    }
+
+    SECTION("Image Pitches are Rounded to Pixel Blocks")
+    {
+        CHECK(GetImageRowPitch(PixelFormat::BC1Unorm, 16U) == 32U);
+        CHECK(GetImageRowPitch(PixelFormat::BC1Unorm, 1U) == 8U);
+        CHECK(GetImageSlicePitch(PixelFormat::BC7Unorm, 10U, 6U) == 96U);
+        CHECK(GetImageSlicePitch(PixelFormat::RGBA8Unorm, 10U, 6U) == 240U);
+    }
+
+    SECTION("sRGB Color Space of Compressed Formats")
+    {
+        CHECK(IsSrgbColorSpace(PixelFormat::BC1Unorm_sRGB));
+        CHECK(IsSrgbColorSpace(PixelFormat::BC7Unorm_sRGB));
+        CHECK_FALSE(IsSrgbColorSpace(PixelFormat::BC6HUfloat));
+    }
+}
+
+TEST_CASE("KTX2 Image Container Parsing", "[image][container][ktx2]")
+{
+    SECTION("BC1 Image with Full Mip Chain")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("CheckerBC1Mips.ktx2");
+        CHECK(image_container.GetFormat() == ImageContainerFormat::KTX2);
+        CHECK(image_container.GetPixelFormat() == PixelFormat::BC1Unorm);
+        CHECK(image_container.GetDimensions() == Dimensions(16U, 16U));
+        CHECK(image_container.GetArrayLength() == 1U);
+        CHECK(image_container.GetMipLevelsCount() == 5U);
+        CHECK_FALSE(image_container.IsCube());
+        CHECK_FALSE(image_container.IsArray());
+
+        const Rhi::SubResources sub_resources = image_container.GetSubResources();
+        REQUIRE(sub_resources.size() == 5U);
+        CHECK(sub_resources[0].GetDataSize() == 128U);
+        CHECK(sub_resources[1].GetDataSize() == 32U);
+        CHECK(sub_resources[4].GetDataSize() == 8U);
+        CHECK(image_container.GetPixelsDataSize() == 184U);
+        CheckSubResourcesData(image_container);
+    }
+
+    SECTION("BC4 Image Array")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("LayersBC4.ktx2");
+        CHECK(image_container.GetPixelFormat() == PixelFormat::BC4Unorm);
+        CHECK(image_container.GetDimensions() == Dimensions(8U, 8U));
+        CHECK(image_container.GetArrayLength() == 2U);
+        CHECK(image_container.GetMipLevelsCount() == 1U);
+        CHECK(image_container.IsArray());
+        CHECK(image_container.GetPixelsDataSize() == 64U);
+        CheckSubResourcesData(image_container);
+    }
+}
+
+TEST_CASE("DDS Image Container Parsing", "[image][container][dds]")
+{
+    SECTION("BC7 Cube Image with DX10 Header and Full Mip Chain")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("CubeBC7Mips.dds");
+        CHECK(image_container.GetFormat() == ImageContainerFormat::DDS);
+        CHECK(image_container.GetPixelFormat() == PixelFormat::BC7Unorm);
+        CHECK(image_container.GetDimensions() == Dimensions(8U, 8U, 6U));
+        CHECK(image_container.GetMipLevelsCount() == 4U);
+        CHECK(image_container.IsCube());
+        CHECK(image_container.GetSubResources().size() == 24U);
+        CHECK(image_container.GetPixelsDataSize() == 672U);
+        CheckSubResourcesData(image_container);
+    }
+
+    SECTION("DXT5 Image with Legacy Header")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("SpriteDXT5.dds");
+        CHECK(image_container.GetPixelFormat() == PixelFormat::BC3Unorm);
+        CHECK(image_container.GetDimensions() == Dimensions(8U, 4U));
+        CHECK(image_container.GetMipLevelsCount() == 1U);
+        CHECK(image_container.GetPixelsDataSize() == 32U);
+        CheckSubResourcesData(image_container);
+    }
+}
+
+TEST_CASE("Invalid Image Container Data", "[image][container]")
+{
+    SECTION("Unknown Container Format")
+    {
+        Data::Bytes image_data(128U, std::byte(0));
+        CHECK_FALSE(ImageContainer::DetectFormat(Data::Chunk(image_data.data(), static_cast<Data::Size>(image_data.size()))).has_value());
+        CHECK_THROWS_AS(ImageContainer(Data::Chunk(std::move(image_data))), ArgumentException);
+    }
+
+    SECTION("Truncated Pixels Data")
+    {
+        Data::Chunk image_data = Data::FileProvider::Get().GetData(std::string(TEST_TEXTURES_DIR) + "/CheckerBC1Mips.ktx2");
+        Data::Bytes truncated_data(image_data.GetDataPtr(), image_data.GetDataEndPtr() - 16);
+        CHECK_THROWS_AS(ImageContainer(Data::Chunk(std::move(truncated_data))), ArgumentException);
+    }
+
+    SECTION("KTX2 Level Offset beyond 32-bit Range")
+    {
+        // Base mip level byte offset in the level index following 80 bytes of KTX2 header gets its high 32 bits set,
+        // so that the offset would point to valid data after narrowing to 32-bit without validation
+        Data::Chunk image_data = Data::FileProvider::Get().GetData(std::string(TEST_TEXTURES_DIR) + "/CheckerBC1Mips.ktx2");
+        Data::Bytes corrupted_data(image_data.GetDataPtr(), image_data.GetDataEndPtr());
+        corrupted_data[80U + 4U] = std::byte(1);
+        CHECK_THROWS_AS(ImageContainer(Data::Chunk(std::move(corrupted_data))), ArgumentException);
+    }
+
+    SECTION("DDS Mip Levels Count beyond Dimensions")
+    {
+        // DDS header following 4 bytes of magic gets mip map count flag set in flags at offset 4
+        // and mip map count at offset 24 exceeding the full mip chain of 8x4 image, which is 4 levels
+        Data::Chunk image_data = Data::FileProvider::Get().GetData(std::string(TEST_TEXTURES_DIR) + "/SpriteDXT5.dds");
+        Data::Bytes corrupted_data(image_data.GetDataPtr(), image_data.GetDataEndPtr());
+        corrupted_data[4U + 4U + 2U] |= std::byte(0x02);
+        corrupted_data[4U + 24U] = std::byte(40);
+        CHECK_THROWS_AS(ImageContainer(Data::Chunk(std::move(corrupted_data))), ArgumentException);
+    }
+}
+
+TEST_CASE("Image Container Texture Upload", "[image][container][texture]")
+{
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), g_parallel_executor, {});
+    const Rhi::CommandQueue   cmd_queue       = compute_context.GetComputeCommandKit().GetQueue();
+
+    SECTION("Mip Chain is Uploaded without Generation")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("CheckerBC1Mips.ktx2");
+        const Rhi::Texture texture = image_container.CreateTexture(cmd_queue, false, "BC1 Texture");
+        const Rhi::TextureSettings& settings = texture.GetSettings();
+        CHECK(settings.pixel_format == PixelFormat::BC1Unorm);
+        CHECK(settings.dimension_type == Rhi::TextureDimensionType::Tex2D);
+        CHECK(settings.mipmapped);
+        CHECK(texture.GetSubresourceCount().GetMipLevelsCount() == 5U);
+        CHECK(texture.GetDataSize(Data::MemoryState::Reserved) == 184U);
+        CHECK(texture.GetDataSize(Data::MemoryState::Initialized) == image_container.GetPixelsDataSize());
+    }
+
+    SECTION("Cube Texture is Uploaded in sRGB Color Space")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("CubeBC7Mips.dds");
+        const Rhi::Texture texture = image_container.CreateTexture(cmd_queue, true, "BC7 Cube Texture");
+        const Rhi::TextureSettings& settings = texture.GetSettings();
+        CHECK(settings.pixel_format == PixelFormat::BC7Unorm_sRGB);
+        CHECK(settings.dimension_type == Rhi::TextureDimensionType::Cube);
+        CHECK(texture.GetDataSize(Data::MemoryState::Initialized) == 672U);
+    }
+
+    SECTION("Texture Array is Uploaded")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("LayersBC4.ktx2");
+        const Rhi::Texture texture = image_container.CreateTexture(cmd_queue);
+        CHECK(texture.GetSettings().dimension_type == Rhi::TextureDimensionType::Tex2DArray);
+        CHECK(texture.GetSettings().array_length == 2U);
+        CHECK(texture.GetDataSize(Data::MemoryState::Initialized) == 64U);
+    }
+
+    SECTION("Compressed Mip Levels can not be Generated")
+    {
+        const ImageContainer image_container = LoadTestImageContainer("CheckerBC1Mips.ktx2");
+        const Rhi::Texture texture(compute_context, image_container.GetTextureSettings());
+        CHECK_THROWS_AS(texture.SetData(cmd_queue, { image_container.GetSubResources().front() }), ArgumentException);
+    }
+}
@@ -0,0 +1,73 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/ImageTestHelpers.hpp
+Image loading test helpers with synthetic images served from memory
+
+******************************************************************************/
+
+#pragma once
+
+#include <Methane/Data/IProvider.h>
+#include <Methane/Data/Chunk.hpp>
+
+#include <map>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace Methane::Graphics::Test
+{
+
+class MemoryProvider final
+    : public Data::IProvider
+{
+public:
+    void AddData(const std::string& path, Data::Bytes&& data) { m_data_by_path.try_emplace(path, std::move(data)); }
+
+    [[nodiscard]] std::vector<std::string> GetRequestedPaths() const
+    {
+        std::scoped_lock lock(m_mutex);
+        return m_requested_paths;
+    }
+
+    // IProvider overrides
+    bool HasData(const std::string& path) const noexcept override { return m_data_by_path.contains(path); }
+    std::vector<std::string> GetFiles(const std::string&) const override { return {}; }
+
+    Data::Chunk GetData(const std::string& path) const override
+    {
+        {
+            std::scoped_lock lock(m_mutex);
+            m_requested_paths.push_back(path);
+        }
+        const auto data_it = m_data_by_path.find(path);
+        if (data_it == m_data_by_path.end())
+            throw std::invalid_argument("No data in memory for path: " + path);
+
+        return Data::Chunk(data_it->second.data(), static_cast<Data::Size>(data_it->second.size()));
+    }
+
+private:
+    std::map<std::string, Data::Bytes, std::less<>> m_data_by_path;
+    mutable std::vector<std::string>                m_requested_paths;
+    mutable std::mutex                              m_mutex;
+};
+
+} // namespace Methane::Graphics::Test
@@ -0,0 +1,123 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshBuffersBenchmark.cpp
+Mesh buffers draw commands recording benchmarks with Null RHI backend
+
+******************************************************************************/
+
+#include "MeshBuffersTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+TEST_CASE("Mesh Buffers Drawing Benchmark", "[mesh][buffers][instancing][benchmark]")
+{
+    const Test::MeshBuffersTestContext test_context;
+    const UberMesh<Test::MeshVertex>   uber_mesh = Test::GetUberMesh();
+    const Rhi::RenderCommandList       cmd_list  = test_context.render_cmd_queue.CreateRenderCommandList(test_context.render_pass);
+
+    for(const Data::Size instance_count : { 1'000U, 10'000U })
+    {
+        const Test::PerInstanceMeshBuffers per_instance_mesh_buffers(test_context.render_cmd_queue, uber_mesh, instance_count);
+        const MeshBuffersBase::InstancedProgramBindings instance_program_bindings = test_context.CreateInstanceProgramBindings(instance_count);
+
+        BENCHMARK(fmt::format("Record per-instance draw calls of {} instances", instance_count))
+        {
+            test_context.ResetCommandList(cmd_list);
+            per_instance_mesh_buffers.Draw(cmd_list, instance_program_bindings);
+        };
+
+        InstancedMeshBuffers<Test::InstanceData> instanced_mesh_buffers(test_context.render_cmd_queue, uber_mesh, "Instanced Mesh");
+        const Data::Size subset_instance_count = instance_count / instanced_mesh_buffers.GetSubsetsCount();
+        instanced_mesh_buffers.SetSubsetInstanceCounts(std::vector<uint32_t>(instanced_mesh_buffers.GetSubsetsCount(), subset_instance_count));
+
+        const Rhi::Buffer instances_buffer = test_context.CreateInstancesBuffer(instanced_mesh_buffers);
+        const MeshBuffersBase::InstancedProgramBindings subset_program_bindings = test_context.CreateSubsetProgramBindings(instanced_mesh_buffers, instances_buffer);
+
+        BENCHMARK(fmt::format("Record instanced draw calls of {} instances", instance_count))
+        {
+            test_context.ResetCommandList(cmd_list);
+            instanced_mesh_buffers.Draw(cmd_list, subset_program_bindings);
+        };
+    }
+}
+
+TEST_CASE("Mesh Buffers Large Mesh Drawing Benchmark", "[mesh][buffers][indices][benchmark]")
+{
+    const Test::MeshBuffersTestContext test_context;
+    const Rhi::RenderCommandList cmd_list = test_context.render_cmd_queue.CreateRenderCommandList(test_context.render_pass);
+    const auto& null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface());
+    const MeshBuffersBase::InstancedProgramBindings program_bindings = test_context.CreateInstanceProgramBindings(1U);
+
+    // Sphere with 300 latitude and longitude lines has more than 65536 vertices and is drawn with 32-bit indices
+    for(const uint32_t lines_count : { 100U, 300U })
+    {
+        const SphereMesh<Test::MeshVertex> sphere_mesh(Test::MeshVertex::layout, 1.F, lines_count, lines_count);
+        const MeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, sphere_mesh, "Sphere Mesh");
+
+        BENCHMARK(fmt::format("Get index data size of sphere mesh with {} vertices", sphere_mesh.GetVertexCount()))
+        {
+            return sphere_mesh.GetIndexDataSize();
+        };
+
+        BENCHMARK(fmt::format("Record draw calls of sphere mesh with {} vertices", sphere_mesh.GetVertexCount()))
+        {
+            test_context.ResetCommandList(cmd_list);
+            mesh_buffers.Draw(cmd_list, program_bindings);
+            return null_cmd_list.GetDrawCalls().size();
+        };
+        CHECK(null_cmd_list.GetDrawCalls().size() == 1U);
+    }
+}
+
+TEST_CASE("Mesh Buffers Uniforms Update Benchmark", "[mesh][buffers][uniforms][benchmark]")
+{
+    constexpr Data::Size frames_count = 3U;
+    const Test::MeshBuffersTestContext test_context;
+    const UberMesh<Test::MeshVertex>   uber_mesh = Test::GetUberMesh();
+
+    for(const Data::Size instance_count : { 1'000U, 10'000U })
+    {
+        Test::PerInstanceMeshBuffers mesh_buffers(test_context.render_cmd_queue, uber_mesh, instance_count);
+        mesh_buffers.SetFramesInFlightCount(frames_count);
+        const Rhi::Buffer uniforms_buffer = test_context.CreateUniformsBuffer(mesh_buffers);
+
+        BENCHMARK(fmt::format("Upload all uniforms of {} instances", instance_count))
+        {
+            uniforms_buffer.SetData(test_context.render_cmd_queue, mesh_buffers.GetFinalPassUniformsSubresource());
+        };
+
+        // Every 100-th instance is changed each frame, so only 1% of uniforms data is uploaded
+        Data::Index frame_index = 0U;
+        BENCHMARK(fmt::format("Upload changed 1% uniforms of {} instances", instance_count))
+        {
+            for(Data::Index instance_index = frame_index % 100U; instance_index < instance_count; instance_index += 100U)
+            {
+                mesh_buffers.SetFinalPassUniforms(Test::InstanceData{}, instance_index);
+            }
+            const Data::Size uploaded_size = mesh_buffers.UpdateFinalPassUniformsBuffer(uniforms_buffer, test_context.render_cmd_queue, frame_index % frames_count);
+            ++frame_index;
+            return uploaded_size;
+        };
+    }
+}
@@ -0,0 +1,260 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshBuffersTest.cpp
+Mesh buffers drawing unit tests with Null RHI backend
+
+******************************************************************************/
+
+#include "MeshBuffersTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+TEST_CASE("Instanced Mesh Buffers Layout", "[mesh][buffers][instancing]")
+{
+    const Test::MeshBuffersTestContext test_context;
+    InstancedMeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, Test::GetUberMesh(), "Instanced Mesh");
+
+    SECTION("One Instance per Subset by Default")
+    {
+        CHECK(mesh_buffers.GetInstanceCount() == mesh_buffers.GetSubsetsCount());
+        for(Data::Index subset_index = 0U; subset_index < mesh_buffers.GetSubsetsCount(); ++subset_index)
+        {
+            CHECK(mesh_buffers.GetSubsetInstanceCount(subset_index) == 1U);
+        }
+    }
+
+    SECTION("Subset Instances are Tightly Packed in Aligned Ranges")
+    {
+        mesh_buffers.SetSubsetInstanceCounts({ 10U, 0U, 33U });
+        CHECK(mesh_buffers.GetInstanceCount() == 43U);
+
+        Data::Size prev_subset_end = 0U;
+        for(Data::Index subset_index = 0U; subset_index < mesh_buffers.GetSubsetsCount(); ++subset_index)
+        {
+            const Data::Size subset_offset = mesh_buffers.GetSubsetInstancesBufferOffset(subset_index);
+            const Data::Size subset_size   = mesh_buffers.GetSubsetInstancesBufferSize(subset_index);
+            CHECK(subset_offset % g_uniform_alignment == 0U);
+            CHECK(subset_offset >= prev_subset_end);
+            CHECK(subset_size == mesh_buffers.GetSubsetInstanceCount(subset_index) * sizeof(Test::InstanceData));
+            prev_subset_end = subset_offset + subset_size;
+        }
+        CHECK(mesh_buffers.GetInstancesBufferSize() >= prev_subset_end);
+        CHECK(mesh_buffers.GetInstancesSubresource().GetDataSize() == mesh_buffers.GetInstancesBufferSize());
+    }
+
+    SECTION("Set and Get Instance Data")
+    {
+        mesh_buffers.SetSubsetInstanceCounts({ 2U, 3U, 4U });
+        mesh_buffers.SetInstance(Test::InstanceData{ .color = { 1.F, 2.F, 3.F, 4.F } }, 1U, 2U);
+        CHECK(mesh_buffers.GetInstance(1U, 2U).color == std::array{ 1.F, 2.F, 3.F, 4.F });
+
+        const Data::Size instance_offset = mesh_buffers.GetSubsetInstancesBufferOffset(1U) + 2U * sizeof(Test::InstanceData);
+        const auto& packed_instance = *reinterpret_cast<const Test::InstanceData*>( // NOSONAR
+            mesh_buffers.GetInstancesSubresource().GetDataPtr() + instance_offset);
+        CHECK(packed_instance.color == std::array{ 1.F, 2.F, 3.F, 4.F });
+    }
+
+    SECTION("Invalid Instance Access")
+    {
+        CHECK_THROWS_AS(mesh_buffers.SetSubsetInstanceCounts({ 1U, 2U }), ArgumentException);
+        CHECK_THROWS_AS(mesh_buffers.GetInstance(3U, 0U), ArgumentException);
+        CHECK_THROWS_AS(mesh_buffers.GetInstance(0U, 1U), ArgumentException);
+    }
+}
+
+TEST_CASE("Instanced Mesh Buffers Drawing", "[mesh][buffers][instancing]")
+{
+    const Test::MeshBuffersTestContext test_context;
+    const UberMesh<Test::MeshVertex>   uber_mesh = Test::GetUberMesh();
+
+    const Rhi::RenderCommandList cmd_list = test_context.render_cmd_queue.CreateRenderCommandList(test_context.render_pass);
+    const auto& null_cmd_list = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface());
+
+    SECTION("Instances of Each Subset are Drawn with Single Draw Call")
+    {
+        InstancedMeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, uber_mesh, "Instanced Mesh");
+        mesh_buffers.SetSubsetInstanceCounts({ 10U, 0U, 33U });
+
+        const Rhi::Buffer instances_buffer = test_context.CreateInstancesBuffer(mesh_buffers);
+        const MeshBuffersBase::InstancedProgramBindings subset_program_bindings = test_context.CreateSubsetProgramBindings(mesh_buffers, instances_buffer);
+        REQUIRE(subset_program_bindings.size() == mesh_buffers.GetSubsetsCount());
+
+        test_context.ResetCommandList(cmd_list);
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, subset_program_bindings));
+
+        // Subset without instances is not drawn
+        const Null::RenderCommandList::DrawCalls& draw_calls = null_cmd_list.GetDrawCalls();
+        REQUIRE(draw_calls.size() == 2U);
+        CHECK(draw_calls[0].is_indexed);
+        CHECK(draw_calls[0].count == uber_mesh.GetSubset(0U).indices.count);
+        CHECK(draw_calls[0].start_index == uber_mesh.GetSubset(0U).indices.offset);
+        CHECK(draw_calls[0].instance_count == 10U);
+        CHECK(draw_calls[0].start_instance == 0U);
+        CHECK(draw_calls[1].count == uber_mesh.GetSubset(2U).indices.count);
+        CHECK(draw_calls[1].start_index == uber_mesh.GetSubset(2U).indices.offset);
+        CHECK(draw_calls[1].instance_count == 33U);
+        CHECK(draw_calls[1].start_instance == 0U);
+    }
+
+    SECTION("Instanced Drawing Requires Program Bindings for Each Subset")
+    {
+        const InstancedMeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, uber_mesh, "Instanced Mesh");
+        const Rhi::Buffer instances_buffer = test_context.CreateInstancesBuffer(mesh_buffers);
+        MeshBuffersBase::InstancedProgramBindings subset_program_bindings = test_context.CreateSubsetProgramBindings(mesh_buffers, instances_buffer);
+        subset_program_bindings.pop_back();
+
+        test_context.ResetCommandList(cmd_list);
+        CHECK_THROWS_AS(mesh_buffers.Draw(cmd_list, subset_program_bindings), ArgumentException);
+    }
+
+    SECTION("Per-Instance Drawing Issues Draw Call for Each Instance")
+    {
+        const Test::PerInstanceMeshBuffers mesh_buffers(test_context.render_cmd_queue, uber_mesh, 43U);
+        const MeshBuffersBase::InstancedProgramBindings instance_program_bindings = test_context.CreateInstanceProgramBindings(43U);
+
+        test_context.ResetCommandList(cmd_list);
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, instance_program_bindings));
+
+        const Null::RenderCommandList::DrawCalls& draw_calls = null_cmd_list.GetDrawCalls();
+        REQUIRE(draw_calls.size() == 43U);
+        CHECK(std::ranges::all_of(draw_calls, [](const Null::RenderCommandList::DrawCall& draw_call)
+                                  { return draw_call.instance_count == 1U; }));
+    }
+}
+
+TEST_CASE("Mesh Buffers Index Format", "[mesh][buffers][indices]")
+{
+    const Test::MeshBuffersTestContext test_context;
+
+    SECTION("Small Mesh Index Buffer has 16-bit Indices")
+    {
+        const SphereMesh<Test::MeshVertex> sphere_mesh(Test::MeshVertex::layout, 1.F, 16U, 16U);
+        const MeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, sphere_mesh, "Small Sphere Mesh");
+        CHECK(mesh_buffers.GetIndexBuffer().GetSettings().data_format == PixelFormat::R16Uint);
+        CHECK(mesh_buffers.GetIndexBuffer().GetDataSize() == sphere_mesh.GetIndexCount() * sizeof(uint16_t));
+    }
+
+    SECTION("Large Mesh with 32-bit Indices is Drawn with Single Draw Call")
+    {
+        const SphereMesh<Test::MeshVertex> sphere_mesh(Test::MeshVertex::layout, 1.F, 300U, 300U);
+        const MeshBuffers<Test::InstanceData> mesh_buffers(test_context.render_cmd_queue, sphere_mesh, "Large Sphere Mesh");
+        CHECK(mesh_buffers.GetIndexBuffer().GetSettings().data_format == PixelFormat::R32Uint);
+        CHECK(mesh_buffers.GetIndexBuffer().GetDataSize() == sphere_mesh.GetIndexCount() * sizeof(uint32_t));
+
+        const Rhi::RenderCommandList cmd_list = test_context.render_cmd_queue.CreateRenderCommandList(test_context.render_pass);
+        test_context.ResetCommandList(cmd_list);
+        REQUIRE_NOTHROW(mesh_buffers.Draw(cmd_list, test_context.CreateInstanceProgramBindings(1U)));
+
+        const Null::RenderCommandList::DrawCalls& draw_calls = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface()).GetDrawCalls();
+        REQUIRE(draw_calls.size() == 1U);
+        CHECK(draw_calls[0].is_indexed);
+        CHECK(draw_calls[0].count == sphere_mesh.GetIndexCount());
+    }
+}
+
+TEST_CASE("Mesh Buffers Uniforms Update per Frame", "[mesh][buffers][uniforms]")
+{
+    constexpr Data::Size frames_count   = 3U;
+    constexpr Data::Size instance_count = 16U;
+
+    const Test::MeshBuffersTestContext test_context;
+    Test::PerInstanceMeshBuffers mesh_buffers(test_context.render_cmd_queue, Test::GetUberMesh(), instance_count);
+    mesh_buffers.SetFramesInFlightCount(frames_count);
+    REQUIRE(mesh_buffers.GetFramesInFlightCount() == frames_count);
+
+    std::vector<Rhi::Buffer> uniforms_buffers;
+    for(Data::Index frame_index = 0U; frame_index < frames_count; ++frame_index)
+    {
+        uniforms_buffers.push_back(test_context.CreateUniformsBuffer(mesh_buffers));
+    }
+
+    const auto get_uploaded_data_size = [&uniforms_buffers](Data::Index frame_index)
+    {
+        return dynamic_cast<const Null::Buffer&>(uniforms_buffers[frame_index].GetInterface()).GetUploadedDataSize();
+    };
+
+    const auto get_stored_instance = [&uniforms_buffers, &mesh_buffers](Data::Index frame_index, Data::Index instance_index)
+    {
+        const Data::Bytes& stored_data = dynamic_cast<const Null::Buffer&>(uniforms_buffers[frame_index].GetInterface()).GetStoredData();
+        return *reinterpret_cast<const Test::InstanceData*>(stored_data.data() + mesh_buffers.GetUniformsBufferOffset(instance_index)); // NOSONAR
+    };
+
+    const auto update_uniforms_buffer = [&](Data::Index frame_index)
+    {
+        return mesh_buffers.UpdateFinalPassUniformsBuffer(uniforms_buffers[frame_index], test_context.render_cmd_queue, frame_index);
+    };
+
+    SECTION("All Uniforms are Uploaded Once to Each Frame Buffer")
+    {
+        for(Data::Index frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            CHECK(mesh_buffers.IsFinalPassUniformsDirty(frame_index, instance_count - 1U));
+            CHECK(update_uniforms_buffer(frame_index) == mesh_buffers.GetUniformsBufferSize());
+            CHECK(update_uniforms_buffer(frame_index) == 0U);
+            CHECK(get_uploaded_data_size(frame_index) == mesh_buffers.GetUniformsBufferSize());
+            CHECK_FALSE(mesh_buffers.IsFinalPassUniformsDirty(frame_index, instance_count - 1U));
+        }
+    }
+
+    SECTION("Only Changed Uniform Ranges are Uploaded")
+    {
+        for(Data::Index frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            update_uniforms_buffer(frame_index);
+        }
+
+        // Contiguous instances 2 and 3 are merged into single range, last instance range ends at buffer end
+        for(const Data::Index instance_index : { 2U, 3U, 9U, 15U })
+        {
+            mesh_buffers.SetFinalPassUniforms(Test::InstanceData{ .color = { static_cast<float>(instance_index), 0.F, 0.F, 1.F } }, instance_index);
+        }
+
+        const Data::Size uniform_stride = mesh_buffers.GetUniformsBufferOffset(1U);
+        for(Data::Index frame_index = 0U; frame_index < frames_count; ++frame_index)
+        {
+            CHECK(update_uniforms_buffer(frame_index) == 4U * uniform_stride);
+            CHECK(update_uniforms_buffer(frame_index) == 0U);
+            CHECK(get_uploaded_data_size(frame_index) == mesh_buffers.GetUniformsBufferSize() + 4U * uniform_stride);
+
+            for(const Data::Index instance_index : { 2U, 3U, 9U, 15U })
+            {
+                CHECK(get_stored_instance(frame_index, instance_index).color == mesh_buffers.GetFinalPassUniforms(instance_index).color);
+            }
+            CHECK(get_stored_instance(frame_index, 4U).color == std::array{ 0.F, 0.F, 0.F, 0.F });
+        }
+    }
+
+    SECTION("Frames in Flight Count Change Marks All Uniforms Dirty")
+    {
+        update_uniforms_buffer(0U);
+        mesh_buffers.SetFramesInFlightCount(2U);
+        CHECK(mesh_buffers.GetFramesInFlightCount() == 2U);
+        CHECK(update_uniforms_buffer(0U) == mesh_buffers.GetUniformsBufferSize());
+    }
+
+    SECTION("Invalid Frames Update")
+    {
+        CHECK_THROWS_AS(mesh_buffers.SetFramesInFlightCount(0U), ArgumentException);
+        CHECK_THROWS_AS(mesh_buffers.SetFramesInFlightCount(33U), ArgumentException);
+        CHECK_THROWS_AS(mesh_buffers.UpdateFinalPassUniformsBuffer(uniforms_buffers[0], test_context.render_cmd_queue, frames_count), ArgumentException);
+    }
+}
@@ -0,0 +1,221 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MeshBuffersTestHelpers.hpp
+Mesh buffers test helpers with Null RHI backend
+
+******************************************************************************/
+
+#pragma once
+
+#include "RhiSettings.hpp"
+
+#include <Methane/Graphics/MeshBuffers.hpp>
+#include <Methane/Graphics/CubeMesh.hpp>
+#include <Methane/Graphics/SphereMesh.hpp>
+#include <Methane/Graphics/IcosahedronMesh.hpp>
+#include <Methane/Graphics/UberMesh.hpp>
+#include <Methane/Data/AppShadersProvider.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/ViewState.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ProgramBindings.h>
+#include <Methane/Graphics/RHI/Buffer.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/Buffer.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+
+#include <taskflow/taskflow.hpp>
+#include <array>
+#include <stdexcept>
+
+namespace Methane::Graphics::Test
+{
+
+struct MeshVertex
+{
+    Mesh::Position position;
+    Mesh::Normal   normal;
+
+    inline static const Mesh::VertexLayout layout{
+        Mesh::VertexField::Position,
+        Mesh::VertexField::Normal
+    };
+};
+
+struct InstanceData
+{
+    std::array<float, 16> model_matrix{};
+    std::array<float, 4>  color{};
+};
+
+inline UberMesh<MeshVertex> GetUberMesh()
+{
+    UberMesh<MeshVertex> uber_mesh(MeshVertex::layout);
+    uber_mesh.AddSubMesh(CubeMesh<MeshVertex>(MeshVertex::layout), true);
+    uber_mesh.AddSubMesh(SphereMesh<MeshVertex>(MeshVertex::layout, 1.F, 16U, 16U), false);
+    uber_mesh.AddSubMesh(IcosahedronMesh<MeshVertex>(MeshVertex::layout, 1.F, 2U, true), false);
+    return uber_mesh;
+}
+
+// Mesh buffers drawn with program bindings per instance, instances are mapped to mesh subsets cyclically
+class PerInstanceMeshBuffers final
+    : public MeshBuffers<InstanceData>
+{
+public:
+    PerInstanceMeshBuffers(const Rhi::CommandQueue& render_cmd_queue, const UberMesh<MeshVertex>& uber_mesh, Data::Size instance_count)
+        : MeshBuffers<InstanceData>(render_cmd_queue, uber_mesh, "Per-Instance Mesh")
+    {
+        SetInstanceCount(instance_count);
+    }
+
+protected:
+    [[nodiscard]]
+    Data::Index GetSubsetByInstanceIndex(Data::Index instance_index) const override
+    {
+        return instance_index % GetSubsetsCount();
+    }
+};
+
+class MeshBuffersTestContext
+{
+public:
+    MeshBuffersTestContext()
+        : render_context(m_app_env, GetTestDevice(), m_parallel_executor, GetRenderContextSettings())
+        , render_cmd_queue(render_context.CreateCommandQueue(Rhi::CommandListType::Render))
+        , render_pattern(render_context.CreateRenderPattern(GetRenderPatternSettings()))
+        , render_pass_resources(GetRenderPassResources(render_pattern))
+        , render_pass(render_pattern.CreateRenderPass(render_pass_resources.settings))
+        , program(CreateProgram())
+        , render_state(render_context.CreateRenderState(GetRenderStateSettings(render_context, render_pattern, program)))
+        , view_state(GetViewStateSettings())
+    { }
+
+    [[nodiscard]]
+    Rhi::Buffer CreateInstancesBuffer(const InstancedMeshBuffers<InstanceData>& mesh_buffers) const
+    {
+        const Rhi::Buffer instances_buffer = render_context.CreateBuffer(
+            Rhi::BufferSettings::ForStorageBuffer(mesh_buffers.GetInstancesBufferSize(), mesh_buffers.GetInstanceSize(), true, true));
+        instances_buffer.SetData(render_cmd_queue, mesh_buffers.GetInstancesSubresource());
+        return instances_buffer;
+    }
+
+    [[nodiscard]]
+    Rhi::Buffer CreateUniformsBuffer(const MeshBuffers<InstanceData>& mesh_buffers) const
+    {
+        return render_context.CreateBuffer(Rhi::BufferSettings::ForConstantBuffer(mesh_buffers.GetUniformsBufferSize(), true, true));
+    }
+
+    [[nodiscard]]
+    MeshBuffersBase::InstancedProgramBindings CreateSubsetProgramBindings(const InstancedMeshBuffers<InstanceData>& mesh_buffers,
+                                                                          const Rhi::Buffer& instances_buffer) const
+    {
+        MeshBuffersBase::InstancedProgramBindings subset_program_bindings;
+        for(Data::Index subset_index = 0U; subset_index < mesh_buffers.GetSubsetsCount(); ++subset_index)
+        {
+            subset_program_bindings.push_back(program.CreateBindings({
+                { { Rhi::ShaderType::Vertex, "g_instances" },
+                  instances_buffer.GetBufferView(mesh_buffers.GetSubsetInstancesBufferOffset(subset_index),
+                                                 mesh_buffers.GetSubsetInstancesBufferSize(subset_index)) }
+            }));
+        }
+        return subset_program_bindings;
+    }
+
+    [[nodiscard]]
+    MeshBuffersBase::InstancedProgramBindings CreateInstanceProgramBindings(Data::Size instance_count) const
+    {
+        const Data::Size  uniforms_size   = static_cast<Data::Size>(Data::AlignUp(sizeof(InstanceData), g_uniform_alignment));
+        const Rhi::Buffer uniforms_buffer = render_context.CreateBuffer(
+            Rhi::BufferSettings::ForConstantBuffer(uniforms_size * instance_count, true, true));
+
+        MeshBuffersBase::InstancedProgramBindings instance_program_bindings;
+        for(Data::Index instance_index = 0U; instance_index < instance_count; ++instance_index)
+        {
+            instance_program_bindings.push_back(program.CreateBindings({
+                { { Rhi::ShaderType::Vertex, "g_instances" }, uniforms_buffer.GetBufferView(instance_index * uniforms_size, uniforms_size) }
+            }));
+        }
+        return instance_program_bindings;
+    }
+
+    void ResetCommandList(const Rhi::RenderCommandList& cmd_list) const
+    {
+        cmd_list.ResetWithState(render_state);
+        cmd_list.SetViewState(view_state);
+    }
+
+private:
+    [[nodiscard]]
+    static Rhi::Device GetTestDevice()
+    {
+        static const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+        if (devices.empty())
+            throw std::logic_error("No RHI devices available");
+
+        return devices[0];
+    }
+
+    [[nodiscard]]
+    Rhi::Program CreateProgram() const
+    {
+        using enum Rhi::ShaderType;
+        const Rhi::ProgramArgumentAccessor instances_accessor{ Vertex, "g_instances", Rhi::ProgramArgumentAccessType::Mutable };
+        Rhi::Program mesh_program = render_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                .shader_set = Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Vertex, { Data::ShaderProvider::Get(), { "Mesh", "MeshVS" } } },
+                    { Pixel,  { Data::ShaderProvider::Get(), { "Mesh", "MeshPS" } } }
+                },
+                .input_buffer_layouts = Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout
+                    {
+                        .argument_semantics = Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION" , "NORMAL" }
+                    }
+                },
+                .argument_accessors = Rhi::ProgramArgumentAccessors{ instances_accessor },
+                .attachment_formats = render_pattern.GetAttachmentFormats()
+            });
+        dynamic_cast<Null::Program&>(mesh_program.GetInterface()).SetArgumentBindings({
+            { instances_accessor, { Rhi::ResourceType::Buffer, 1U } }
+        });
+        return mesh_program;
+    }
+
+    tf::Executor                   m_parallel_executor;
+    const Platform::AppEnvironment m_app_env{ nullptr };
+
+public:
+    const Rhi::RenderContext  render_context;
+    const Rhi::CommandQueue   render_cmd_queue;
+    const Rhi::RenderPattern  render_pattern;
+    const RenderPassResources render_pass_resources;
+    const Rhi::RenderPass     render_pass;
+    const Rhi::Program        program;
+    const Rhi::RenderState    render_state;
+    const Rhi::ViewState      view_state;
+};
+
+} // namespace Methane::Graphics::Test
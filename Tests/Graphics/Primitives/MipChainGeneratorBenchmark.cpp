@@ -0,0 +1,66 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MipChainGeneratorBenchmark.cpp
+CPU mip chain generation throughput benchmarks for 4K images
+
+******************************************************************************/
+
+#include <Methane/Graphics/MipChainGenerator.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <magic_enum/magic_enum.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+TEST_CASE("Mip Chain Generation Benchmark", "[texture][mipmaps][benchmark]")
+{
+    const Dimensions dimensions(4096U, 4096U);
+    Data::Bytes pixels(static_cast<size_t>(dimensions.GetWidth()) * dimensions.GetHeight() * 4U);
+    uint32_t seed = 12345U;
+    for(Data::Byte& pixel_byte : pixels)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        pixel_byte = std::byte(seed >> 24U);
+    }
+    const Data::Chunk pixels_chunk(pixels.data(), static_cast<Data::Size>(pixels.size()));
+
+    tf::Executor parallel_executor;
+    for(const MipFilter filter : { MipFilter::Box, MipFilter::Kaiser })
+    {
+        for(const PixelFormat pixel_format : { PixelFormat::RGBA8Unorm, PixelFormat::RGBA8Unorm_sRGB })
+        {
+            const MipChainGenerator serial_generator({ filter });
+            const MipChainGenerator parallel_generator({ filter }, &parallel_executor);
+
+            BENCHMARK(fmt::format("Serial {} mip chain generation of 4K {} image", magic_enum::enum_name(filter), magic_enum::enum_name(pixel_format)))
+            {
+                return serial_generator.Generate(pixels_chunk, dimensions, pixel_format).GetDataSize();
+            };
+
+            BENCHMARK(fmt::format("Parallel {} mip chain generation of 4K {} image", magic_enum::enum_name(filter), magic_enum::enum_name(pixel_format)))
+            {
+                return parallel_generator.Generate(pixels_chunk, dimensions, pixel_format).GetDataSize();
+            };
+        }
+    }
+}
@@ -0,0 +1,229 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/MipChainGeneratorTest.cpp
+CPU mip chain generator unit tests with box and Kaiser filters
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+
+#include <Methane/Graphics/MipChainGenerator.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/Texture.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <array>
+#include <cstring>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Color = std::array<uint8_t, 4>;
+
+[[nodiscard]]
+static Data::Bytes CreateImagePixels(const Dimensions& dimensions, const Color& color)
+{
+    Data::Bytes pixels(static_cast<size_t>(dimensions.GetWidth()) * dimensions.GetHeight() * 4U);
+    for(size_t pixel_offset = 0U; pixel_offset < pixels.size(); pixel_offset += 4U)
+    {
+        for(size_t channel = 0U; channel < 4U; ++channel)
+        {
+            pixels[pixel_offset + channel] = std::byte(color[channel]);
+        }
+    }
+    return pixels;
+}
+
+// Deterministic pseudo-random pixels to compare results of serial and parallel generation
+[[nodiscard]]
+static Data::Bytes CreateNoisePixels(const Dimensions& dimensions)
+{
+    Data::Bytes pixels(static_cast<size_t>(dimensions.GetWidth()) * dimensions.GetHeight() * 4U);
+    uint32_t seed = 12345U;
+    for(Data::Byte& pixel_byte : pixels)
+    {
+        seed = seed * 1664525U + 1013904223U;
+        pixel_byte = std::byte(seed >> 24U);
+    }
+    return pixels;
+}
+
+[[nodiscard]]
+static bool IsChunkFilledWithColor(const Data::Chunk& pixels, const Color& color)
+{
+    for(Data::Size pixel_offset = 0U; pixel_offset < pixels.GetDataSize(); pixel_offset += 4U)
+    {
+        for(Data::Size channel = 0U; channel < 4U; ++channel)
+        {
+            if (pixels.GetDataPtr()[pixel_offset + channel] != std::byte(color[channel]))
+                return false;
+        }
+    }
+    return true;
+}
+
+[[nodiscard]]
+static bool IsEqualMipChains(const MipChain& left_mip_chain, const MipChain& right_mip_chain)
+{
+    if (left_mip_chain.GetMipLevelsCount() != right_mip_chain.GetMipLevelsCount())
+        return false;
+
+    for(uint32_t mip_level = 0U; mip_level < left_mip_chain.GetMipLevelsCount(); ++mip_level)
+    {
+        const Data::Chunk left_pixels  = left_mip_chain.GetMipLevelPixels(mip_level);
+        const Data::Chunk right_pixels = right_mip_chain.GetMipLevelPixels(mip_level);
+        if (left_pixels.GetDataSize() != right_pixels.GetDataSize() ||
+            std::memcmp(left_pixels.GetDataPtr(), right_pixels.GetDataPtr(), left_pixels.GetDataSize()) != 0)
+            return false;
+    }
+    return true;
+}
+
+static const Color g_orange_color{ 255U, 128U, 0U, 200U };
+
+TEST_CASE("Mip Chain Generator Dimensions", "[texture][mipmaps]")
+{
+    SECTION("Mip levels count matches texture mip levels count")
+    {
+        CHECK(MipChainGenerator::GetMipLevelsCount(Dimensions(256U, 128U)) == 9U);
+        CHECK(MipChainGenerator::GetMipLevelsCount(Dimensions(100U, 60U)) == 7U);
+        CHECK(MipChainGenerator::GetMipLevelsCount(Dimensions(1U, 1U)) == 1U);
+    }
+
+    SECTION("Mip levels have halved dimensions clamped to one pixel")
+    {
+        const Dimensions     dimensions(100U, 60U);
+        const Data::Bytes    pixels = CreateImagePixels(dimensions, g_orange_color);
+        const MipChain       mip_chain = MipChainGenerator().Generate(Data::Chunk(pixels.data(), static_cast<Data::Size>(pixels.size())),
+                                                                      dimensions, PixelFormat::RGBA8Unorm);
+        REQUIRE(mip_chain.GetMipLevelsCount() == 7U);
+        CHECK(mip_chain.GetMipLevelDimensions(1U) == Dimensions(50U, 30U));
+        CHECK(mip_chain.GetMipLevelDimensions(2U) == Dimensions(25U, 15U));
+        CHECK(mip_chain.GetMipLevelDimensions(6U) == Dimensions(1U, 1U));
+        CHECK(mip_chain.GetMipLevelPixels(2U).GetDataSize() == 25U * 15U * 4U);
+        CHECK(mip_chain.GetMipLevelPixels(0U).GetDataPtr() == pixels.data());
+        CHECK_THROWS_AS(mip_chain.GetMipLevelPixels(7U), ArgumentException);
+    }
+
+    SECTION("Unsupported pixel formats and mismatching data sizes are rejected")
+    {
+        const Data::Bytes pixels = CreateImagePixels(Dimensions(4U, 4U), g_orange_color);
+        const Data::Chunk pixels_chunk(pixels.data(), static_cast<Data::Size>(pixels.size()));
+        CHECK_FALSE(MipChainGenerator::IsPixelFormatSupported(PixelFormat::BC1Unorm));
+        CHECK_THROWS_AS(MipChainGenerator().Generate(pixels_chunk, Dimensions(4U, 4U), PixelFormat::BC1Unorm), ArgumentException);
+        CHECK_THROWS_AS(MipChainGenerator().Generate(pixels_chunk, Dimensions(8U, 4U), PixelFormat::RGBA8Unorm), ArgumentException);
+    }
+}
+
+TEST_CASE("Mip Chain Generator Filtering", "[texture][mipmaps]")
+{
+    SECTION("Uniform color is preserved in all mip levels")
+    {
+        const MipFilter   filter = GENERATE(MipFilter::Box, MipFilter::Kaiser);
+        const Dimensions  dimensions(64U, 48U);
+        const Data::Bytes pixels = CreateImagePixels(dimensions, g_orange_color);
+        const MipChain    mip_chain = MipChainGenerator({ filter }).Generate(Data::Chunk(pixels.data(), static_cast<Data::Size>(pixels.size())),
+                                                                             dimensions, PixelFormat::RGBA8Unorm);
+        for(uint32_t mip_level = 1U; mip_level < mip_chain.GetMipLevelsCount(); ++mip_level)
+        {
+            CHECK(IsChunkFilledWithColor(mip_chain.GetMipLevelPixels(mip_level), g_orange_color));
+        }
+    }
+
+    SECTION("Box filter averages 2x2 pixels")
+    {
+        const Data::Bytes pixels{
+            std::byte(0U),   std::byte(10U),  std::byte(20U),  std::byte(255U),
+            std::byte(100U), std::byte(30U),  std::byte(40U),  std::byte(255U),
+            std::byte(200U), std::byte(50U),  std::byte(60U),  std::byte(255U),
+            std::byte(100U), std::byte(70U),  std::byte(80U),  std::byte(251U),
+        };
+        const MipChain mip_chain = MipChainGenerator().Generate(Data::Chunk(pixels.data(), static_cast<Data::Size>(pixels.size())),
+                                                                Dimensions(2U, 2U), PixelFormat::RGBA8Unorm);
+        REQUIRE(mip_chain.GetMipLevelsCount() == 2U);
+        CHECK(IsChunkFilledWithColor(mip_chain.GetMipLevelPixels(1U), Color{ 100U, 40U, 50U, 254U }));
+    }
+
+    SECTION("sRGB colors are averaged in linear space")
+    {
+        const Data::Bytes pixels{
+            std::byte(0U),   std::byte(0U),   std::byte(0U),   std::byte(255U),
+            std::byte(255U), std::byte(255U), std::byte(255U), std::byte(255U),
+            std::byte(0U),   std::byte(0U),   std::byte(0U),   std::byte(255U),
+            std::byte(255U), std::byte(255U), std::byte(255U), std::byte(255U),
+        };
+        const MipChain mip_chain = MipChainGenerator().Generate(Data::Chunk(pixels.data(), static_cast<Data::Size>(pixels.size())),
+                                                                Dimensions(2U, 2U), PixelFormat::RGBA8Unorm_sRGB);
+        CHECK(IsChunkFilledWithColor(mip_chain.GetMipLevelPixels(1U), Color{ 188U, 188U, 188U, 255U }));
+    }
+
+    SECTION("Float pixels are averaged without quantization")
+    {
+        const std::array<float, 4> values{ 1.F, 2.F, 3.F, 4.F };
+        const Data::Chunk values_chunk(reinterpret_cast<Data::ConstRawPtr>(values.data()), static_cast<Data::Size>(sizeof(values))); // NOSONAR
+        const MipChain mip_chain = MipChainGenerator().Generate(values_chunk, Dimensions(2U, 2U), PixelFormat::R32Float);
+        float mip_value = 0.F;
+        REQUIRE(mip_chain.GetMipLevelPixels(1U).GetDataSize() == sizeof(float));
+        std::memcpy(&mip_value, mip_chain.GetMipLevelPixels(1U).GetDataPtr(), sizeof(float));
+        CHECK(mip_value == 2.5F);
+    }
+
+    SECTION("Parallel generation is equal to serial generation")
+    {
+        const MipFilter   filter = GENERATE(MipFilter::Box, MipFilter::Kaiser);
+        const Dimensions  dimensions(512U, 384U);
+        const Data::Bytes pixels = CreateNoisePixels(dimensions);
+        const Data::Chunk pixels_chunk(pixels.data(), static_cast<Data::Size>(pixels.size()));
+        tf::Executor      executor(4U);
+        const MipChain    serial_mip_chain   = MipChainGenerator({ filter }).Generate(pixels_chunk, dimensions, PixelFormat::RGBA8Unorm_sRGB);
+        const MipChain    parallel_mip_chain = MipChainGenerator({ filter }, &executor).Generate(pixels_chunk, dimensions, PixelFormat::RGBA8Unorm_sRGB);
+        CHECK(IsEqualMipChains(serial_mip_chain, parallel_mip_chain));
+    }
+}
+
+TEST_CASE("Mip Chain Upload to Texture", "[texture][mipmaps]")
+{
+    tf::Executor              executor;
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), executor, {});
+    const Rhi::CommandQueue   cmd_queue       = compute_context.GetComputeCommandKit().GetQueue();
+
+    const Dimensions  dimensions(64U, 32U);
+    const Data::Bytes pixels    = CreateImagePixels(dimensions, g_orange_color);
+    const MipChain    mip_chain = MipChainGenerator({}, &executor).Generate(Data::Chunk(pixels.data(), static_cast<Data::Size>(pixels.size())),
+                                                                            dimensions, PixelFormat::RGBA8Unorm);
+
+    const Rhi::Texture texture(compute_context, Rhi::TextureSettings::ForImage(dimensions, std::nullopt, PixelFormat::RGBA8Unorm, true));
+    REQUIRE(texture.GetSubresourceCount().GetMipLevelsCount() == mip_chain.GetMipLevelsCount());
+    REQUIRE_NOTHROW(texture.SetData(cmd_queue, mip_chain.GetSubResources()));
+
+    const auto& null_texture = dynamic_cast<const Null::Texture&>(texture.GetInterface());
+    CHECK(null_texture.GetUploadedDataSize() == mip_chain.GetDataSize());
+    for(uint32_t mip_level = 0U; mip_level < mip_chain.GetMipLevelsCount(); ++mip_level)
+    {
+        const Data::Bytes& mip_pixels = null_texture.GetStoredData(Rhi::SubResourceIndex(0U, 0U, mip_level));
+        CHECK(mip_pixels.size() == mip_chain.GetMipLevelPixels(mip_level).GetDataSize());
+        CHECK(IsChunkFilledWithColor(Data::Chunk(mip_pixels.data(), static_cast<Data::Size>(mip_pixels.size())), g_orange_color));
+    }
+}
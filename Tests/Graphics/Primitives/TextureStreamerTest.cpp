@@ -0,0 +1,244 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Test/TextureStreamerTest.cpp
+Asynchronous texture streaming unit tests with Null RHI backend and synthetic images in memory
+
+******************************************************************************/
+
+#include "RhiTestHelpers.hpp"
+#include "ImageTestHelpers.hpp"
+
+#include <Methane/Graphics/TextureStreamer.h>
+#include <Methane/Graphics/RHI/ComputeContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/Null/Texture.h>
+#include <Methane/Data/FileProvider.hpp>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <array>
+#include <future>
+#include <mutex>
+#include <string>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+
+using Color = std::array<uint8_t, 4>;
+
+// Uncompressed 32-bit TGA image with top-left origin filled with single color
+[[nodiscard]]
+static Data::Bytes CreateTgaImage(uint32_t width, uint32_t height, const Color& color)
+{
+    constexpr size_t header_size = 18U;
+    Data::Bytes image_data(header_size + width * height * 4U);
+    image_data[2]  = std::byte(2U);
+    image_data[12] = std::byte(width & 0xFFU);
+    image_data[13] = std::byte(width >> 8U);
+    image_data[14] = std::byte(height & 0xFFU);
+    image_data[15] = std::byte(height >> 8U);
+    image_data[16] = std::byte(32U);
+    image_data[17] = std::byte(0x28U);
+    for(size_t pixel_offset = header_size; pixel_offset < image_data.size(); pixel_offset += 4U)
+    {
+        image_data[pixel_offset + 0U] = std::byte(color[2]);
+        image_data[pixel_offset + 1U] = std::byte(color[1]);
+        image_data[pixel_offset + 2U] = std::byte(color[0]);
+        image_data[pixel_offset + 3U] = std::byte(color[3]);
+    }
+    return image_data;
+}
+
+[[nodiscard]]
+static bool IsTextureFilledWithColor(const Rhi::Texture& texture, const Color& color)
+{
+    const auto& null_texture = dynamic_cast<const Null::Texture&>(texture.GetInterface());
+    const Data::Bytes& pixels = null_texture.GetStoredData(Rhi::SubResourceIndex());
+    if (pixels.empty())
+        return false;
+
+    for(size_t pixel_offset = 0U; pixel_offset < pixels.size(); pixel_offset += 4U)
+    {
+        for(size_t channel = 0U; channel < 4U; ++channel)
+        {
+            if (pixels[pixel_offset + channel] != std::byte(color[channel]))
+                return false;
+        }
+    }
+    return true;
+}
+
+// Blocks the only executor thread to let test enqueue several images before decoding starts
+class ExecutorBlocker
+{
+public:
+    explicit ExecutorBlocker(tf::Executor& executor)
+    {
+        executor.silent_async([this] { m_release_future.wait(); });
+    }
+
+    ~ExecutorBlocker() { Release(); }
+
+    void Release()
+    {
+        if (!m_is_released)
+            m_release_promise.set_value();
+        m_is_released = true;
+    }
+
+private:
+    std::promise<void>       m_release_promise;
+    std::shared_future<void> m_release_future{ m_release_promise.get_future().share() };
+    bool                     m_is_released = false;
+};
+
+static const Color g_red_color   { 255U, 0U,   0U,   255U };
+static const Color g_green_color { 0U,   255U, 0U,   255U };
+static const Color g_blue_color  { 0U,   0U,   255U, 128U };
+
+TEST_CASE("Texture Streamer Loading", "[texture][streaming]")
+{
+    tf::Executor single_thread_executor(1U);
+    const Rhi::ComputeContext compute_context = Rhi::ComputeContext(GetTestDevice(), single_thread_executor, {});
+    const Rhi::CommandQueue   cmd_queue       = compute_context.GetComputeCommandKit().GetQueue();
+
+    Test::MemoryProvider memory_provider;
+    memory_provider.AddData("Red.tga",   CreateTgaImage(128U, 128U, g_red_color));
+    memory_provider.AddData("Green.tga", CreateTgaImage(64U,  32U,  g_green_color));
+    memory_provider.AddData("Blue.tga",  CreateTgaImage(100U, 60U,  g_blue_color));
+    const ImageLoader image_loader(memory_provider);
+
+    SECTION("Images are Decoded and Uploaded Asynchronously")
+    {
+        TextureStreamer texture_streamer(image_loader, cmd_queue);
+        const StreamedTexture red_texture   = texture_streamer.LoadImageToTexture2DAsync("Red.tga", {}, "Red Texture");
+        const StreamedTexture green_texture = texture_streamer.LoadImageToTexture2DAsync("Green.tga", { ImageOption::SrgbColorSpace });
+        CHECK_FALSE(red_texture.HasTexture());
+        CHECK_THROWS_AS(red_texture.GetTexture(), ArgumentException);
+
+        texture_streamer.WaitForDecoding();
+        CHECK(red_texture.GetState() == TextureStreamingState::Decoded);
+        CHECK(green_texture.GetState() == TextureStreamingState::Decoded);
+        CHECK(texture_streamer.GetPendingCount() == 2U);
+
+        CHECK(texture_streamer.Update() == (128U * 128U + 64U * 32U) * 4U);
+        CHECK(texture_streamer.GetPendingCount() == 0U);
+        REQUIRE(red_texture.IsComplete());
+        REQUIRE(green_texture.IsComplete());
+        CHECK(red_texture.GetStreamedMipLevel() == 0U);
+        CHECK(red_texture.GetTexture().GetName() == "Red Texture");
+        CHECK(red_texture.GetTexture().GetSettings().dimensions == Dimensions(128U, 128U));
+        CHECK(green_texture.GetTexture().GetSettings().pixel_format == PixelFormat::RGBA8Unorm_sRGB);
+        CHECK(IsTextureFilledWithColor(red_texture.GetTexture(), g_red_color));
+        CHECK(IsTextureFilledWithColor(green_texture.GetTexture(), g_green_color));
+        CHECK(texture_streamer.Update() == 0U);
+    }
+
+    SECTION("Images are Decoded in Priority Order")
+    {
+        TextureStreamer texture_streamer(image_loader, cmd_queue);
+        ExecutorBlocker executor_blocker(single_thread_executor);
+        const StreamedTexture red_texture   = texture_streamer.LoadImageToTexture2DAsync("Red.tga", {}, "", 0);
+        const StreamedTexture green_texture = texture_streamer.LoadImageToTexture2DAsync("Green.tga", {}, "", 2);
+        const StreamedTexture blue_texture  = texture_streamer.LoadImageToTexture2DAsync("Blue.tga", {}, "", 1);
+        red_texture.SetPriority(3);
+        CHECK(red_texture.GetPriority() == 3);
+        executor_blocker.Release();
+
+        texture_streamer.WaitForDecoding();
+        CHECK(memory_provider.GetRequestedPaths() == std::vector<std::string>{ "Red.tga", "Green.tga", "Blue.tga" });
+    }
+
+    SECTION("Cancelled Images are not Decoded")
+    {
+        TextureStreamer texture_streamer(image_loader, cmd_queue);
+        ExecutorBlocker executor_blocker(single_thread_executor);
+        const StreamedTexture red_texture   = texture_streamer.LoadImageToTexture2DAsync("Red.tga");
+        const StreamedTexture green_texture = texture_streamer.LoadImageToTexture2DAsync("Green.tga");
+        red_texture.Cancel();
+        executor_blocker.Release();
+
+        texture_streamer.WaitForDecoding();
+        CHECK(memory_provider.GetRequestedPaths() == std::vector<std::string>{ "Green.tga" });
+        CHECK(red_texture.GetState() == TextureStreamingState::Cancelled);
+        CHECK(texture_streamer.Update() == 64U * 32U * 4U);
+        CHECK(green_texture.IsComplete());
+        CHECK_FALSE(red_texture.HasTexture());
+    }
+
+    SECTION("Failed Image Loading Reports Error")
+    {
+        TextureStreamer texture_streamer(image_loader, cmd_queue);
+        const StreamedTexture missing_texture = texture_streamer.LoadImageToTexture2DAsync("Missing.tga");
+        texture_streamer.WaitForDecoding();
+        CHECK(missing_texture.GetState() == TextureStreamingState::Failed);
+        CHECK_FALSE(missing_texture.GetErrorMessage().empty());
+        CHECK(texture_streamer.Update() == 0U);
+        CHECK(texture_streamer.GetPendingCount() == 0U);
+    }
+
+    SECTION("Upload Budget Defers Full Textures with Previews")
+    {
+        TextureStreamer texture_streamer(image_loader, cmd_queue, TextureStreamerSettings{ 16U, 1U });
+        const StreamedTexture red_texture  = texture_streamer.LoadImageToTexture2DAsync("Red.tga", {}, "", 1);
+        const StreamedTexture blue_texture = texture_streamer.LoadImageToTexture2DAsync("Blue.tga", {}, "", 0);
+        texture_streamer.WaitForDecoding();
+
+        // First texture is uploaded regardless of budget, second one gets preview texture 100x60 -> 50x30 -> 25x15 -> 12x7
+        CHECK(texture_streamer.Update() == 128U * 128U * 4U + 12U * 7U * 4U);
+        REQUIRE(red_texture.IsComplete());
+        REQUIRE(blue_texture.GetState() == TextureStreamingState::Preview);
+        CHECK(blue_texture.GetStreamedMipLevel() == 3U);
+        CHECK(blue_texture.GetTexture().GetSettings().dimensions == Dimensions(12U, 7U));
+        CHECK(IsTextureFilledWithColor(blue_texture.GetTexture(), g_blue_color));
+
+        CHECK(texture_streamer.Update() == 100U * 60U * 4U);
+        REQUIRE(blue_texture.IsComplete());
+        CHECK(blue_texture.GetStreamedMipLevel() == 0U);
+        CHECK(blue_texture.GetTexture().GetSettings().dimensions == Dimensions(100U, 60U));
+    }
+
+    SECTION("Image Container Preview is Created from Mip Chain Tail")
+    {
+        Data::Chunk container_data = Data::FileProvider::Get().GetData(std::string(TEST_TEXTURES_DIR) + "/CheckerBC1Mips.ktx2");
+        memory_provider.AddData("Checker.ktx2", Data::Bytes(container_data.GetDataPtr(), container_data.GetDataEndPtr()));
+
+        TextureStreamer texture_streamer(image_loader, cmd_queue, TextureStreamerSettings{ 4U, 1U });
+        const StreamedTexture red_texture     = texture_streamer.LoadImageToTexture2DAsync("Red.tga", {}, "", 1);
+        const StreamedTexture checker_texture = texture_streamer.LoadImageToTexture2DAsync("Checker.ktx2", {}, "", 0);
+        texture_streamer.WaitForDecoding();
+
+        // Preview texture 4x4 is created from mip levels 2, 3 and 4 of 16x16 image
+        CHECK(texture_streamer.Update() == 128U * 128U * 4U + 3U * 8U);
+        REQUIRE(checker_texture.GetState() == TextureStreamingState::Preview);
+        CHECK(checker_texture.GetStreamedMipLevel() == 2U);
+        const Rhi::Texture& preview_texture = checker_texture.GetTexture();
+        CHECK(preview_texture.GetSettings().pixel_format == PixelFormat::BC1Unorm);
+        CHECK(preview_texture.GetSettings().dimensions == Dimensions(4U, 4U));
+        CHECK(preview_texture.GetSubresourceCount().GetMipLevelsCount() == 3U);
+        const auto& null_preview_texture = dynamic_cast<const Null::Texture&>(preview_texture.GetInterface());
+        CHECK(null_preview_texture.GetStoredData(Rhi::SubResourceIndex(0U, 0U, 0U)).front() == std::byte(2U));
+
+        CHECK(texture_streamer.Update() == 184U);
+        REQUIRE(checker_texture.IsComplete());
+        CHECK(checker_texture.GetTexture().GetSettings().dimensions == Dimensions(16U, 16U));
+    }
+}
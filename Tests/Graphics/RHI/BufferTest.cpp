@@ -29,6 +29,7 @@ Unit-tests of the RHI Buffer
 #include <Methane/Graphics/RHI/CommandKit.h>
 #include <Methane/Graphics/RHI/CommandQueue.h>
 #include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/Base/Buffer.h>
 
 #include <memory>
 #include <taskflow/taskflow.hpp>
@@ -56,6 +57,30 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
         CHECK(std::addressof(buffer.GetContext()) == compute_context.GetInterfacePtr().get());
     }
 
+    SECTION("Storage Buffer Construction")
+    {
+        const Rhi::BufferSettings storage_buffer_settings = Rhi::BufferSettings::ForStorageBuffer(48 * 1000, 48, true, true);
+        Rhi::Buffer buffer;
+        REQUIRE_NOTHROW(buffer = compute_context.CreateBuffer(storage_buffer_settings));
+        REQUIRE(buffer.IsInitialized());
+        CHECK(buffer.GetSettings().type == Rhi::BufferType::Storage);
+        CHECK(buffer.GetSettings().item_stride_size == 48U);
+        CHECK(buffer.GetUsage().HasBit(Rhi::ResourceUsage::ShaderRead));
+        CHECK(buffer.GetUsage().HasBit(Rhi::ResourceUsage::Addressable));
+    }
+
+    SECTION("Storage Buffer View Items Range")
+    {
+        const Rhi::Buffer buffer = compute_context.CreateBuffer(Rhi::BufferSettings::ForStorageBuffer(48 * 1000, 48, false, true));
+        const auto& base_buffer = dynamic_cast<const Base::Buffer&>(buffer.GetInterface());
+        CHECK(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{}) == Data::Range<Data::Index>(0U, 1000U));
+        CHECK(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{ .offset = 48 * 10, .size = 48 * 20 }) == Data::Range<Data::Index>(10U, 30U));
+        CHECK(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{ .offset = 48 * 990 }) == Data::Range<Data::Index>(990U, 1000U));
+        CHECK_THROWS_AS(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{ .offset = 40 }), ArgumentException);
+        CHECK_THROWS_AS(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{ .offset = 48, .size = 50 }), ArgumentException);
+        CHECK_THROWS_AS(base_buffer.GetViewItemsRange(Rhi::ResourceView::Settings{ .offset = 48 * 990, .size = 48 * 20 }), ArgumentException);
+    }
+
     SECTION("Object Destroyed Callback")
     {
         auto buffer_ptr = std::make_unique<Rhi::Buffer>(compute_context, constant_buffer_settings);
@@ -174,6 +199,34 @@ TEST_CASE("RHI Buffer Functions", "[rhi][buffer][resource]")
         CHECK(vertex_buffer.GetFormattedItemsCount() == 256);
     }
 
+    SECTION("Set Data Range")
+    {
+        const Rhi::CommandQueue upload_cmd_queue = compute_context.GetUploadCommandKit().GetQueue();
+        const std::vector<std::byte> full_data(1024, std::byte(1));
+        const std::vector<std::byte> range_data(128, std::byte(2));
+        REQUIRE_NOTHROW(buffer.SetData(upload_cmd_queue, {
+            full_data.data(), static_cast<Data::Size>(full_data.size())
+        }));
+        REQUIRE_NOTHROW(buffer.SetData(upload_cmd_queue, {
+            range_data.data(), static_cast<Data::Size>(range_data.size()), Rhi::SubResourceIndex(), Rhi::BytesRange(512U, 640U)
+        }));
+        CHECK(buffer.GetDataSize(Data::MemoryState::Initialized) == 1024U);
+
+        const Rhi::SubResource data = buffer.GetData(upload_cmd_queue, Rhi::BytesRange(500U, 650U));
+        REQUIRE(data.GetDataSize() == 150U);
+        CHECK(data.GetDataPtr()[11]  == std::byte(1));
+        CHECK(data.GetDataPtr()[12]  == std::byte(2));
+        CHECK(data.GetDataPtr()[139] == std::byte(2));
+        CHECK(data.GetDataPtr()[140] == std::byte(1));
+
+        CHECK_THROWS_AS(buffer.SetData(upload_cmd_queue, {
+            range_data.data(), static_cast<Data::Size>(range_data.size()), Rhi::SubResourceIndex(), Rhi::BytesRange(0U, 64U)
+        }), ArgumentException);
+        CHECK_THROWS_AS(buffer.SetData(upload_cmd_queue, {
+            range_data.data(), static_cast<Data::Size>(range_data.size()), Rhi::SubResourceIndex(), Rhi::BytesRange(49872U, 50000U)
+        }), ArgumentException);
+    }
+
     SECTION("Get Data")
     {
         CHECK_NOTHROW(buffer.GetData(compute_context.GetUploadCommandKit().GetQueue()));
@@ -38,7 +38,9 @@ TEST_CASE("RHI Device Functions", "[device][rhi]")
     const Rhi::DeviceCaps device_caps = Rhi::DeviceCaps()
                                       .SetFeatures(Rhi::DeviceFeatureMask(Rhi::DeviceFeature::PresentToWindow))
                                       .SetRenderQueuesCount(2)
-                                      .SetComputeQueuesCount(0);
+                                      .SetComputeQueuesCount(0)
+                                      .SetPipelineCacheFilePath("PipelineCache.bin")
+                                      .SetShaderReflectionCacheFilePath("ShaderReflectionCache.bin");
     
     SECTION("Device Initialization")
     {
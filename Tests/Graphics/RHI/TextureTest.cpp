@@ -180,6 +180,25 @@ TEST_CASE("RHI Texture Functions", "[rhi][texture][resource]")
         CHECK(texture.GetDataSize(Data::MemoryState::Initialized) == 256U);
     }
 
+    SECTION("Set Data Rows")
+    {
+        const Rhi::CommandQueue& cmd_queue = compute_context.GetComputeCommandKit().GetQueue();
+        const Data::Bytes full_data(1228800U, std::byte(1));
+        REQUIRE_NOTHROW(texture.SetData(cmd_queue, { Rhi::SubResource(full_data) }));
+
+        const Data::Size  row_pitch = 640U * 4U;
+        const Data::Bytes rows_data(row_pitch * 2U, std::byte(2));
+        const Rhi::BytesRange rows_range(row_pitch * 10U, row_pitch * 12U);
+        REQUIRE_NOTHROW(texture.SetData(cmd_queue, { Rhi::SubResource(rows_data, Rhi::SubResourceIndex(), rows_range) }));
+        CHECK(texture.GetDataSize(Data::MemoryState::Initialized) == 1228800U);
+        CHECK(texture.GetData(cmd_queue, Rhi::SubResourceIndex(), rows_range).GetDataSize() == rows_data.size());
+        CHECK(texture.GetData(cmd_queue, Rhi::SubResourceIndex(), rows_range).GetDataPtr()[0] == std::byte(2));
+        CHECK(texture.GetData(cmd_queue, Rhi::SubResourceIndex(), Rhi::BytesRange(0U, row_pitch)).GetDataPtr()[0] == std::byte(1));
+
+        const Rhi::BytesRange unaligned_range(row_pitch * 10U + 4U, row_pitch * 12U + 4U);
+        CHECK_THROWS_AS(texture.SetData(cmd_queue, { Rhi::SubResource(rows_data, Rhi::SubResourceIndex(), unaligned_range) }), ArgumentException);
+    }
+
     SECTION("Get Data")
     {
         CHECK_NOTHROW(texture.GetData(compute_context.GetComputeCommandKit().GetQueue(),
@@ -0,0 +1,257 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontAtlasTest.cpp
+Unit-tests of the Font atlas incremental updates and sharing between render contexts verified by Null RHI textures
+
+******************************************************************************/
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/CommandKit.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/Texture.h>
+#include <Methane/Graphics/Null/Fence.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+static FontSettings GetFontSettings(const std::u32string& characters)
+{
+    return FontSettings{ FontDescription{ "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, characters };
+}
+
+static Null::Texture& GetNullTexture(const Rhi::Texture& texture)
+{
+    return dynamic_cast<Null::Texture&>(texture.GetInterface());
+}
+
+static void CompleteAtlasRepack(const Font& font)
+{
+    while(font.IsAtlasRepackPending())
+    {
+        font.CompleteAtlasRepack(true);
+    }
+}
+
+TEST_CASE("Font Atlas Incremental Updates", "[ui][font][atlas]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor,
+                                            Rhi::RenderContextSettings{ FrameSize(640U, 480U) });
+    const FontLibrary font_lib;
+    const Font font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings(Font::GetAlphabetDefault()));
+
+    const Rhi::Texture initial_atlas_texture = font.GetAtlasTexture(render_context);
+    REQUIRE(initial_atlas_texture.IsInitialized());
+    Null::Texture& initial_null_texture = GetNullTexture(initial_atlas_texture);
+
+    const FrameSize initial_atlas_size = font.GetAtlasSize();
+    const Data::Size atlas_row_size  = initial_atlas_size.GetWidth();
+    const Data::Size glyph_rows_size = font.GetMaxGlyphSize().GetHeight() * atlas_row_size;
+
+    SECTION("Initial atlas texture is fully uploaded")
+    {
+        render_context.CompleteInitialization();
+        CHECK(initial_null_texture.GetUploadedDataSize() == initial_atlas_size.GetPixelsCount());
+        CHECK(initial_atlas_texture.GetSettings().dimensions == Dimensions(initial_atlas_size));
+    }
+
+    SECTION("Atlas texture is not uploaded again without new characters")
+    {
+        render_context.CompleteInitialization();
+        initial_null_texture.ResetUploadedDataSize();
+
+        font.AddChars(U"ABC");
+        render_context.CompleteInitialization();
+        CHECK(initial_null_texture.GetUploadedDataSize() == 0U);
+    }
+
+    SECTION("Added character uploads only atlas rows of its glyph")
+    {
+        render_context.CompleteInitialization();
+        initial_null_texture.ResetUploadedDataSize();
+
+        font.AddChar(U'·'); // small middle dot glyph fits into reserved atlas space
+        REQUIRE_FALSE(font.IsAtlasRepackPending());
+        REQUIRE(font.GetAtlasSize() == initial_atlas_size);
+        REQUIRE(font.GetAtlasTexture(render_context) == initial_atlas_texture);
+
+        render_context.CompleteInitialization();
+        const Data::Size uploaded_data_size = initial_null_texture.GetUploadedDataSize();
+        CHECK(uploaded_data_size > 0U);
+        CHECK(uploaded_data_size % atlas_row_size == 0U);
+        CHECK(uploaded_data_size <= glyph_rows_size);
+        CHECK(uploaded_data_size < initial_atlas_size.GetPixelsCount());
+    }
+
+    SECTION("Uploaded atlas rows contain glyphs of added characters")
+    {
+        render_context.CompleteInitialization();
+        const Data::Bytes atlas_data_before = initial_null_texture.GetStoredData(Rhi::SubResourceIndex());
+        initial_null_texture.ResetUploadedDataSize();
+
+        font.AddChars(U"°·");
+        REQUIRE_FALSE(font.IsAtlasRepackPending());
+        REQUIRE(font.GetAtlasSize() == initial_atlas_size);
+
+        render_context.CompleteInitialization();
+        CHECK(initial_null_texture.GetUploadedDataSize() <= 2U * glyph_rows_size);
+        CHECK(initial_null_texture.GetStoredData(Rhi::SubResourceIndex()).size() == atlas_data_before.size());
+        CHECK(initial_null_texture.GetStoredData(Rhi::SubResourceIndex()) != atlas_data_before);
+    }
+
+    SECTION("Atlas overflow is repacked asynchronously to the new atlas texture")
+    {
+        render_context.CompleteInitialization();
+        initial_null_texture.ResetUploadedDataSize();
+
+        font.AddChars(Font::GetAlphabetInRange(U'А', U'я')); // Cyrillic alphabet does not fit into reserved atlas space
+        CompleteAtlasRepack(font);
+        render_context.CompleteInitialization();
+
+        const FrameSize     repacked_atlas_size    = font.GetAtlasSize();
+        const Rhi::Texture& repacked_atlas_texture = font.GetAtlasTexture(render_context);
+        CHECK(repacked_atlas_texture != initial_atlas_texture);
+        CHECK(repacked_atlas_texture.GetSettings().dimensions == Dimensions(repacked_atlas_size));
+        CHECK(repacked_atlas_size.GetPixelsCount() > initial_atlas_size.GetPixelsCount());
+        CHECK(GetNullTexture(repacked_atlas_texture).GetStoredData(Rhi::SubResourceIndex()).size() == repacked_atlas_size.GetPixelsCount());
+        CHECK(GetNullTexture(repacked_atlas_texture).GetUploadedDataSize() >= repacked_atlas_size.GetPixelsCount());
+        CHECK(initial_null_texture.GetUploadedDataSize() == 0U);
+    }
+
+    SECTION("Characters added after repack are uploaded by rows to the new atlas texture")
+    {
+        font.AddChars(Font::GetAlphabetInRange(U'А', U'я'));
+        CompleteAtlasRepack(font);
+        render_context.CompleteInitialization();
+
+        const Rhi::Texture& repacked_atlas_texture = font.GetAtlasTexture(render_context);
+        Null::Texture& repacked_null_texture = GetNullTexture(repacked_atlas_texture);
+        repacked_null_texture.ResetUploadedDataSize();
+
+        font.AddChar(U'·');
+        REQUIRE_FALSE(font.IsAtlasRepackPending());
+
+        render_context.CompleteInitialization();
+        const Data::Size uploaded_data_size = repacked_null_texture.GetUploadedDataSize();
+        CHECK(uploaded_data_size > 0U);
+        CHECK(uploaded_data_size % font.GetAtlasSize().GetWidth() == 0U);
+        CHECK(uploaded_data_size < font.GetAtlasSize().GetPixelsCount());
+    }
+}
+
+TEST_CASE("Font Atlas Sharing Between Render Contexts", "[ui][font][atlas]")
+{
+    const Rhi::Device        device = GetTestDevice();
+    const Rhi::RenderContext first_render_context(Platform::AppEnvironment{}, device, g_parallel_executor,
+                                                  Rhi::RenderContextSettings{ FrameSize(640U, 480U) });
+    const Rhi::RenderContext second_render_context(Platform::AppEnvironment{}, device, g_parallel_executor,
+                                                   Rhi::RenderContextSettings{ FrameSize(320U, 240U) });
+    const FontLibrary font_lib;
+    const Font font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings(Font::GetAlphabetDefault()));
+
+    const Rhi::Texture shared_atlas_texture = font.GetAtlasTexture(first_render_context);
+    REQUIRE(shared_atlas_texture.IsInitialized());
+    Null::Texture& shared_null_texture = GetNullTexture(shared_atlas_texture);
+
+    SECTION("Render contexts on the same device share single atlas texture")
+    {
+        CHECK(font.GetAtlasTexture(second_render_context) == shared_atlas_texture);
+        CHECK(std::addressof(shared_atlas_texture.GetContext()) == std::addressof(first_render_context.GetInterface()));
+    }
+
+    SECTION("Shared atlas texture is uploaded only once by its owner context")
+    {
+        REQUIRE(font.GetAtlasTexture(second_render_context) == shared_atlas_texture);
+        second_render_context.CompleteInitialization();
+        first_render_context.CompleteInitialization();
+        CHECK(shared_null_texture.GetUploadedDataSize() == font.GetAtlasSize().GetPixelsCount());
+
+        shared_null_texture.ResetUploadedDataSize();
+        font.AddChar(U'·');
+        REQUIRE_FALSE(font.IsAtlasRepackPending());
+        second_render_context.CompleteInitialization();
+        const Data::Size uploaded_data_size = shared_null_texture.GetUploadedDataSize();
+        CHECK(uploaded_data_size > 0U);
+        CHECK(uploaded_data_size < font.GetAtlasSize().GetPixelsCount());
+        CHECK(std::addressof(shared_atlas_texture.GetContext()) == std::addressof(first_render_context.GetInterface()));
+
+        first_render_context.CompleteInitialization();
+        CHECK(shared_null_texture.GetUploadedDataSize() == uploaded_data_size);
+    }
+
+    SECTION("Sharing context waits for the upload fence of the owner context after atlas update")
+    {
+        REQUIRE(font.GetAtlasTexture(second_render_context) == shared_atlas_texture);
+        first_render_context.CompleteInitialization();
+
+        const auto& owner_upload_fence = dynamic_cast<const Null::Fence&>(first_render_context.GetUploadCommandKit().GetFence());
+        const uint64_t owner_upload_fence_value = owner_upload_fence.GetValue();
+        second_render_context.CompleteInitialization();
+        CHECK(owner_upload_fence.GetValue() > owner_upload_fence_value);
+
+        const uint64_t synced_upload_fence_value = owner_upload_fence.GetValue();
+        second_render_context.CompleteInitialization();
+        CHECK(owner_upload_fence.GetValue() == synced_upload_fence_value);
+    }
+
+    SECTION("Shared atlas texture is recreated by remaining context when owner context is removed")
+    {
+        REQUIRE(font.GetAtlasTexture(second_render_context) == shared_atlas_texture);
+        first_render_context.CompleteInitialization();
+
+        font.RemoveAtlasTexture(first_render_context);
+        const Rhi::Texture& recreated_atlas_texture = font.GetAtlasTexture(second_render_context);
+        CHECK(recreated_atlas_texture != shared_atlas_texture);
+        CHECK(std::addressof(recreated_atlas_texture.GetContext()) == std::addressof(second_render_context.GetInterface()));
+
+        second_render_context.CompleteInitialization();
+        CHECK(GetNullTexture(recreated_atlas_texture).GetStoredData(Rhi::SubResourceIndex()) ==
+              shared_null_texture.GetStoredData(Rhi::SubResourceIndex()));
+        CHECK(font.GetAtlasTexture(first_render_context) == recreated_atlas_texture);
+    }
+
+    SECTION("Atlas texture is released with the last context using it")
+    {
+        REQUIRE(font.GetAtlasTexture(second_render_context) == shared_atlas_texture);
+        font.RemoveAtlasTexture(second_render_context);
+        CHECK(font.GetAtlasTexture(first_render_context) == shared_atlas_texture);
+
+        font.RemoveAtlasTexture(first_render_context);
+        const Rhi::Texture& new_atlas_texture = font.GetAtlasTexture(first_render_context);
+        CHECK(new_atlas_texture.IsInitialized());
+        CHECK(new_atlas_texture != shared_atlas_texture);
+    }
+}
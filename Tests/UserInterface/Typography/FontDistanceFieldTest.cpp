@@ -0,0 +1,273 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontDistanceFieldTest.cpp
+Unit-tests of the signed distance field generation, distance field font atlas and scaled text meshes
+
+******************************************************************************/
+
+#include "../Types/FakePlatformApp.hpp"
+
+#include <Methane/UserInterface/SignedDistanceField.h>
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/UserInterface/Text.h>
+#include <Methane/UserInterface/Context.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/Texture.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/catch_approx.hpp>
+#include <algorithm>
+#include <cmath>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static const Platform::FakeApp     g_fake_app(1.F, 96U);
+static const DistanceFieldSettings g_distance_field_settings{ 4U, 4U };
+static tf::Executor                g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+static FontSettings GetFontSettings(const std::string& name, FontGlyphMode glyph_mode)
+{
+    return FontSettings{
+        FontDescription{ name, "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, Font::GetAlphabetDefault(),
+        glyph_mode, g_distance_field_settings
+    };
+}
+
+// Coverage bitmap of the disk with given center and radius in distance field pixels rendered with supersampling
+static Data::Bytes CreateDiskCoverage(uint32_t bitmap_dimension, float radius, uint32_t supersampling)
+{
+    const float center = static_cast<float>(bitmap_dimension) / 2.F;
+    const float supersampled_radius = radius * static_cast<float>(supersampling);
+    Data::Bytes coverage_bitmap(static_cast<size_t>(bitmap_dimension) * bitmap_dimension);
+    for(uint32_t y = 0; y < bitmap_dimension; ++y)
+    {
+        for(uint32_t x = 0; x < bitmap_dimension; ++x)
+        {
+            const float dx = static_cast<float>(x) + 0.5F - center;
+            const float dy = static_cast<float>(y) + 0.5F - center;
+            coverage_bitmap[y * bitmap_dimension + x] = std::sqrt(dx * dx + dy * dy) <= supersampled_radius ? Data::Byte{ 255 } : Data::Byte{ 0 };
+        }
+    }
+    return coverage_bitmap;
+}
+
+static size_t GetNonZeroPixelsCount(const Data::Bytes& bitmap)
+{
+    return static_cast<size_t>(std::ranges::count_if(bitmap, [](Data::Byte value) { return value != Data::Byte{ 0 }; }));
+}
+
+TEST_CASE("Signed Distance Field Generation", "[ui][font][sdf]")
+{
+    const uint32_t spread = g_distance_field_settings.spread;
+
+    SECTION("Signed distance is encoded linearly in spread range")
+    {
+        CHECK(EncodeSignedDistance(-4.F, spread)  == Data::Byte{ 0 });
+        CHECK(EncodeSignedDistance(0.F, spread)   == Data::Byte{ 128 });
+        CHECK(EncodeSignedDistance(4.F, spread)   == Data::Byte{ 255 });
+        CHECK(EncodeSignedDistance(-10.F, spread) == Data::Byte{ 0 });
+        CHECK(EncodeSignedDistance(10.F, spread)  == Data::Byte{ 255 });
+        for(const float distance : { -3.5F, -1.25F, 0.F, 0.75F, 2.5F })
+        {
+            CHECK(DecodeSignedDistance(EncodeSignedDistance(distance, spread), spread) == Catch::Approx(distance).margin(4.F / 255.F));
+        }
+    }
+
+    SECTION("Distance field size includes spread margins and coverage alignment offset")
+    {
+        CHECK(GetSignedDistanceFieldSize(FrameSize(8U, 8U),  FramePoint(0, 0), g_distance_field_settings) == FrameSize(10U, 10U));
+        CHECK(GetSignedDistanceFieldSize(FrameSize(10U, 7U), FramePoint(3, 1), g_distance_field_settings) == FrameSize(12U, 10U));
+        CHECK_FALSE(GetSignedDistanceFieldSize(FrameSize(), FramePoint(), g_distance_field_settings));
+        CHECK(GenerateSignedDistanceField({}, FrameSize(), FramePoint(), g_distance_field_settings).empty());
+        CHECK_THROWS_AS(GetSignedDistanceFieldSize(FrameSize(8U, 8U), FramePoint(4, 0), g_distance_field_settings), std::out_of_range);
+        CHECK_THROWS_AS(GenerateSignedDistanceField(Data::Bytes(10U), FrameSize(4U, 4U), FramePoint(), g_distance_field_settings), ArgumentException);
+    }
+
+    SECTION("Distance field of disk matches analytic distance to circle")
+    {
+        const uint32_t    coverage_dimension = 80U;
+        const float       radius             = 10.F;
+        const FrameSize   coverage_size(coverage_dimension, coverage_dimension);
+        const Data::Bytes coverage_bitmap    = CreateDiskCoverage(coverage_dimension, radius, g_distance_field_settings.supersampling);
+        const FrameSize   field_size         = GetSignedDistanceFieldSize(coverage_size, FramePoint(), g_distance_field_settings);
+        const Data::Bytes distance_field     = GenerateSignedDistanceField(coverage_bitmap, coverage_size, FramePoint(), g_distance_field_settings);
+        REQUIRE(field_size == FrameSize(28U, 28U));
+        REQUIRE(distance_field.size() == field_size.GetPixelsCount());
+
+        // Distance field pixels outside of clamped spread range are not checked
+        const float center = static_cast<float>(field_size.GetWidth()) / 2.F;
+        float  max_distance_error = 0.F;
+        size_t checked_pixels_count = 0U;
+        for(uint32_t y = 0; y < field_size.GetHeight(); ++y)
+        {
+            for(uint32_t x = 0; x < field_size.GetWidth(); ++x)
+            {
+                const float dx = static_cast<float>(x) + 0.5F - center;
+                const float dy = static_cast<float>(y) + 0.5F - center;
+                const float expected_distance = radius - std::sqrt(dx * dx + dy * dy);
+                if (std::abs(expected_distance) > static_cast<float>(spread) - 0.5F)
+                    continue;
+
+                const float distance = DecodeSignedDistance(distance_field[y * field_size.GetWidth() + x], spread);
+                max_distance_error = std::max(max_distance_error, std::abs(distance - expected_distance));
+                checked_pixels_count++;
+            }
+        }
+        CHECK(checked_pixels_count > 300U);
+        CHECK(max_distance_error < 0.2F);
+        CHECK(distance_field[field_size.GetPixelsCount() / 2U + field_size.GetWidth() / 2U] == Data::Byte{ 255 });
+        CHECK(distance_field.front() == Data::Byte{ 0 });
+    }
+
+    SECTION("Distance field edge is aligned with coverage offset")
+    {
+        // Vertical stripe of 6 coverage pixels placed with 2 pixels offset after spread margin covers [4.5, 6.0] distance field pixels
+        const FrameSize coverage_size(16U, 16U);
+        Data::Bytes coverage_bitmap(coverage_size.GetPixelsCount(), Data::Byte{ 0 });
+        for(uint32_t y = 0; y < coverage_size.GetHeight(); ++y)
+        {
+            std::fill_n(coverage_bitmap.begin() + y * coverage_size.GetWidth(), 6U, Data::Byte{ 255 });
+        }
+
+        const FramePoint  coverage_offset(2, 1);
+        const FrameSize   field_size     = GetSignedDistanceFieldSize(coverage_size, coverage_offset, g_distance_field_settings);
+        const Data::Bytes distance_field = GenerateSignedDistanceField(coverage_bitmap, coverage_size, coverage_offset, g_distance_field_settings);
+        REQUIRE(field_size == FrameSize(13U, 13U));
+
+        const uint32_t middle_row_offset = field_size.GetWidth() * (field_size.GetHeight() / 2U);
+        const auto get_distance = [&](uint32_t x) { return DecodeSignedDistance(distance_field[middle_row_offset + x], spread); };
+        CHECK(get_distance(3U) == Catch::Approx(-1.F).margin(0.1F));
+        CHECK(get_distance(4U) == Catch::Approx(0.F).margin(0.1F));
+        CHECK(get_distance(5U) == Catch::Approx(0.5F).margin(0.1F));
+        CHECK(get_distance(6U) == Catch::Approx(-0.5F).margin(0.1F));
+        CHECK(get_distance(8U) == Catch::Approx(-2.5F).margin(0.1F));
+    }
+}
+
+TEST_CASE("Distance Field Font Atlas", "[ui][font][sdf]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor,
+                                            Rhi::RenderContextSettings{ FrameSize(640U, 480U) });
+    const FontLibrary font_lib;
+    const Font coverage_font       = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings("Roboto", FontGlyphMode::Coverage));
+    const Font distance_field_font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings("Roboto SDF", FontGlyphMode::DistanceField));
+
+    SECTION("Distance field glyphs are extended with spread margins")
+    {
+        const uint32_t  margins_size = 2U * g_distance_field_settings.spread;
+        const FrameSize& coverage_glyph_size       = coverage_font.GetMaxGlyphSize();
+        const FrameSize& distance_field_glyph_size = distance_field_font.GetMaxGlyphSize();
+        CHECK(distance_field_glyph_size.GetWidth()  >  coverage_glyph_size.GetWidth()  + margins_size / 2U);
+        CHECK(distance_field_glyph_size.GetWidth()  <= coverage_glyph_size.GetWidth()  + margins_size + 2U);
+        CHECK(distance_field_glyph_size.GetHeight() >  coverage_glyph_size.GetHeight() + margins_size / 2U);
+        CHECK(distance_field_glyph_size.GetHeight() <= coverage_glyph_size.GetHeight() + margins_size + 2U);
+        CHECK(distance_field_font.GetLineHeight() == Catch::Approx(coverage_font.GetLineHeight()).margin(1.F));
+    }
+
+    SECTION("Distance field atlas texture contains encoded glyph distances")
+    {
+        const Rhi::Texture& coverage_atlas_texture       = coverage_font.GetAtlasTexture(render_context);
+        const Rhi::Texture& distance_field_atlas_texture = distance_field_font.GetAtlasTexture(render_context);
+        render_context.CompleteInitialization();
+
+        CHECK(distance_field_atlas_texture.GetSettings().pixel_format == PixelFormat::R8Unorm);
+        CHECK(distance_field_atlas_texture.GetSettings().dimensions == Dimensions(distance_field_font.GetAtlasSize()));
+
+        const Data::Bytes& coverage_atlas = dynamic_cast<Null::Texture&>(coverage_atlas_texture.GetInterface()).GetStoredData(Rhi::SubResourceIndex());
+        const Data::Bytes& distance_field_atlas = dynamic_cast<Null::Texture&>(distance_field_atlas_texture.GetInterface()).GetStoredData(Rhi::SubResourceIndex());
+        REQUIRE(distance_field_atlas.size() == distance_field_font.GetAtlasSize().GetPixelsCount());
+
+        // Distance field is non-zero in spread margins around glyph edges, so it covers much more pixels than glyph coverage
+        CHECK(std::ranges::any_of(distance_field_atlas, [](Data::Byte value) { return value > Data::Byte{ 128 }; }));
+        CHECK(GetNonZeroPixelsCount(distance_field_atlas) > 2U * GetNonZeroPixelsCount(coverage_atlas));
+    }
+}
+
+TEST_CASE("Distance Field Text Mesh", "[ui][text][sdf]")
+{
+    const Rhi::RenderContext  render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor,
+                                             Rhi::RenderContextSettings{ FrameSize(640U, 480U) });
+    const Rhi::CommandQueue   render_cmd_queue(render_context, Rhi::CommandListType::Render);
+    const Rhi::RenderPattern  render_pattern(render_context, Rhi::RenderPatternSettings{});
+    UserInterface::Context    ui_context(g_fake_app, render_cmd_queue, render_pattern);
+
+    const FontLibrary font_lib;
+    const Font coverage_font       = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings("Roboto", FontGlyphMode::Coverage));
+    const Font distance_field_font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings("Roboto SDF", FontGlyphMode::DistanceField));
+
+    const auto create_text = [&ui_context](const Font& font, uint32_t font_size_pt)
+    {
+        return Text(ui_context, font, Text::SettingsUtf8{
+            .name         = "Test Text",
+            .text         = "Methane Kit",
+            .rect         = UnitRect{ Units::Pixels, Point2I(), FrameSize() },
+            .layout       = Text::Layout{ Text::Wrap::None },
+            .font_size_pt = font_size_pt
+        });
+    };
+
+    SECTION("Texts of different sizes are laid out with single distance field atlas")
+    {
+        const Text small_text = create_text(distance_field_font, 16U);
+        const FrameSize atlas_size = distance_field_font.GetAtlasSize();
+        const Text large_text = create_text(distance_field_font, 48U);
+
+        CHECK(distance_field_font.GetAtlasSize() == atlas_size);
+        const FrameSize& small_text_size = small_text.GetFrameRect().size;
+        const FrameSize& large_text_size = large_text.GetFrameRect().size;
+        REQUIRE(small_text_size);
+        CHECK(large_text_size.GetWidth()  == Catch::Approx(3U * small_text_size.GetWidth()).margin(1.F));
+        CHECK(large_text_size.GetHeight() == Catch::Approx(3U * small_text_size.GetHeight()).margin(1.F));
+    }
+
+    SECTION("Text font size is changed without font atlas update")
+    {
+        const Text text = create_text(distance_field_font, 0U);
+        const FrameSize atlas_size = distance_field_font.GetAtlasSize();
+        const FrameSize text_size  = text.GetFrameRect().size;
+
+        text.SetFontSize(32U);
+        CHECK(text.GetSettings().font_size_pt == 32U);
+        CHECK(text.GetFrameRect().size.GetWidth() == Catch::Approx(2U * text_size.GetWidth()).margin(1.F));
+        CHECK(distance_field_font.GetAtlasSize() == atlas_size);
+    }
+
+    SECTION("Coverage font text size can not differ from font size")
+    {
+        CHECK_NOTHROW(create_text(coverage_font, 16U));
+        CHECK_THROWS_AS(create_text(coverage_font, 32U), ArgumentException);
+    }
+}
@@ -0,0 +1,290 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontGlyphCacheTest.cpp
+Unit-tests of the font glyph cache shared by library fonts with least recently used glyphs eviction
+within memory budget, glyphs pinning by text meshes, reuse of atlas space released by evicted glyphs
+and glyph cache statistics of text updates with Null RHI backend
+
+******************************************************************************/
+
+#include "TextBatchTestHelpers.hpp"
+
+#include <TextMesh.h>
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static const std::u32string g_latin_chars = U"ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static FontSettings GetRobotoFontSettings(const std::u32string& characters)
+{
+    return FontSettings{ FontDescription{ "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, characters, FontGlyphMode::Coverage, {} };
+}
+
+static FontSettings GetSawarabiFontSettings(const std::u32string& characters)
+{
+    return FontSettings{ FontDescription{ "Sawarabi Mincho", "Fonts/SawarabiMincho/SawarabiMincho-Regular.ttf", 16U }, 96U, characters, FontGlyphMode::Coverage, {} };
+}
+
+// Text stream characters are taken mostly from the small set of frequently used characters
+// and rarely from the large set of other characters, which do not fit in glyph cache budget all together
+struct TextCharset
+{
+    std::u32string hot_chars;
+    std::u32string rare_chars;
+};
+
+static std::u32string GenerateRandomText(std::mt19937& random_engine, const TextCharset& charset, size_t text_length)
+{
+    std::bernoulli_distribution           is_rare_char_distribution(0.1);
+    std::uniform_int_distribution<size_t> hot_char_distribution(0U, charset.hot_chars.length() - 1U);
+    std::uniform_int_distribution<size_t> rare_char_distribution(0U, charset.rare_chars.length() - 1U);
+
+    std::u32string text(text_length, U' ');
+    std::ranges::generate(text, [&]()
+    {
+        return is_rare_char_distribution(random_engine)
+             ? charset.rare_chars[rare_char_distribution(random_engine)]
+             : charset.hot_chars[hot_char_distribution(random_engine)];
+    });
+    return text;
+}
+
+TEST_CASE("Font Glyph Cache Eviction", "[ui][font][glyph-cache]")
+{
+    const FontLibrary font_lib;
+    const Font font = font_lib.AddFont(Data::FontProvider::Get(), GetRobotoFontSettings(g_latin_chars));
+    const FontGlyphCacheStatistics& statistics = font_lib.GetGlyphCacheStatistics();
+
+    SECTION("Glyphs are not evicted with unlimited budget")
+    {
+        CHECK(font_lib.GetGlyphCacheBudgetSize() == 0U);
+        CHECK(statistics.cached_glyphs_count == g_latin_chars.length());
+        CHECK(statistics.misses_count == g_latin_chars.length());
+        CHECK(statistics.pinned_glyphs_count == 0U);
+
+        font.AddChars(Font::GetAlphabetDefault());
+        CHECK(statistics.cached_glyphs_count == Font::GetAlphabetDefault().length());
+        CHECK(statistics.hits_count == g_latin_chars.length());
+        CHECK(statistics.evicted_glyphs_count == 0U);
+    }
+
+    SECTION("Least recently used glyph is evicted and its atlas space is reused by the new glyph")
+    {
+        const FrameSize atlas_size = font.GetAtlasSize();
+        font_lib.SetGlyphCacheBudgetSize(statistics.cached_data_size);
+        font_lib.ResetGlyphCacheStatistics();
+
+        font.AddChar(U'.'); // small dot glyph fits into atlas space of the evicted glyph 'A', which was added first
+        CHECK(statistics.evicted_glyphs_count == 1U);
+        CHECK(statistics.reused_atlas_rects_count == 1U);
+        CHECK(statistics.cached_glyphs_count == g_latin_chars.length());
+        CHECK(statistics.cached_data_size <= font_lib.GetGlyphCacheBudgetSize());
+        CHECK(font.GetAtlasSize() == atlas_size);
+
+        font.AddChar(U'Z');
+        CHECK(statistics.hits_count == 1U);
+
+        font.AddChar(U'A');
+        CHECK(statistics.misses_count == 2U);
+    }
+
+    SECTION("Recently used glyph is not evicted")
+    {
+        font.AddChar(U'A');
+        font_lib.SetGlyphCacheBudgetSize(statistics.cached_data_size);
+        font_lib.ResetGlyphCacheStatistics();
+
+        font.AddChar(U'.');
+        font.AddChar(U'A');
+        CHECK(statistics.hits_count == 1U);
+
+        font.AddChar(U'B');
+        CHECK(statistics.misses_count == 2U);
+    }
+
+    SECTION("Already added glyphs requested along with the new glyph are not evicted for it")
+    {
+        font_lib.SetGlyphCacheBudgetSize(statistics.cached_data_size);
+        font_lib.ResetGlyphCacheStatistics();
+
+        font.AddChars(g_latin_chars + U".");
+        CHECK(statistics.evicted_glyphs_count == 0U);
+        CHECK(statistics.pinned_glyphs_count == 0U);
+        CHECK(statistics.cached_glyphs_count == g_latin_chars.length() + 1U);
+        CHECK(statistics.hits_count == g_latin_chars.length());
+        CHECK(statistics.misses_count == 1U);
+
+        font.AddChar(U'A');
+        CHECK(statistics.misses_count == 1U);
+    }
+
+    SECTION("Glyphs are evicted down to the reduced budget")
+    {
+        const Data::Size budget_size = statistics.cached_data_size / 2U;
+        font_lib.SetGlyphCacheBudgetSize(budget_size);
+        CHECK(statistics.cached_data_size <= budget_size);
+        CHECK(statistics.cached_glyphs_count < g_latin_chars.length());
+        CHECK(statistics.evicted_glyphs_count == g_latin_chars.length() - statistics.cached_glyphs_count);
+    }
+}
+
+TEST_CASE("Font Glyph Cache Shared by Fonts", "[ui][font][glyph-cache]")
+{
+    const FontLibrary font_lib;
+    const Font roboto_font = font_lib.AddFont(Data::FontProvider::Get(), GetRobotoFontSettings(g_latin_chars));
+    const FontGlyphCacheStatistics& statistics = font_lib.GetGlyphCacheStatistics();
+    const Data::Size budget_size = statistics.cached_data_size;
+    font_lib.SetGlyphCacheBudgetSize(budget_size);
+
+    const std::u32string hiragana_chars = Font::GetAlphabetInRange(U'あ', U'う');
+    const Font sawarabi_font = font_lib.AddFont(Data::FontProvider::Get(), GetSawarabiFontSettings(hiragana_chars));
+
+    SECTION("Glyphs of one font are evicted to fit glyphs of another font in shared budget")
+    {
+        CHECK(statistics.cached_data_size <= budget_size);
+        CHECK(statistics.evicted_glyphs_count > 0U);
+        CHECK(statistics.cached_glyphs_count == g_latin_chars.length() + hiragana_chars.length() - statistics.evicted_glyphs_count);
+
+        const Data::Size misses_count = statistics.misses_count;
+        roboto_font.AddChar(U'Z');
+        CHECK(statistics.misses_count == misses_count);
+        roboto_font.AddChar(U'A');
+        CHECK(statistics.misses_count == misses_count + 1U);
+    }
+
+    SECTION("Glyphs of the font are removed from cache on font characters reset")
+    {
+        const Data::Size cached_glyphs_count = statistics.cached_glyphs_count;
+        sawarabi_font.ResetChars(std::u32string());
+        CHECK(statistics.cached_glyphs_count == cached_glyphs_count - hiragana_chars.length());
+    }
+}
+
+TEST_CASE("Font Glyph Cache with Random Text Stream", "[ui][font][glyph-cache][text]")
+{
+    constexpr Data::Size budget_size     = 32U * 1024U;
+    constexpr size_t     text_length     = 16U;
+    constexpr size_t     updates_count   = 200U;
+    constexpr size_t     meshes_per_font = 2U;
+
+    const FontLibrary font_lib(nullptr, budget_size);
+    const FontGlyphCacheStatistics& statistics = font_lib.GetGlyphCacheStatistics();
+
+    // Frequently used Latin and Hiragana characters and rarely used Cyrillic, Greek and Katakana characters
+    const std::vector<TextCharset> charsets{
+        TextCharset{ U" abcdefghijklmnopqrstuvwxyz", Font::GetAlphabetInRange(U'А', U'я') + Font::GetAlphabetInRange(U'α', U'ω') },
+        TextCharset{ Font::GetAlphabetInRange(U'ぁ', U'だ'), Font::GetAlphabetInRange(U'ァ', U'ヶ') }
+    };
+    std::vector<Font> fonts{
+        font_lib.AddFont(Data::FontProvider::Get(), GetRobotoFontSettings(charsets[0].hot_chars)),
+        font_lib.AddFont(Data::FontProvider::Get(), GetSawarabiFontSettings(charsets[1].hot_chars))
+    };
+
+    std::mt19937 random_engine(1984U);
+    std::vector<std::unique_ptr<TextMesh>> text_meshes;
+    for(size_t mesh_index = 0U; mesh_index < fonts.size() * meshes_per_font; ++mesh_index)
+    {
+        const size_t font_index = mesh_index % fonts.size();
+        const std::u32string text = GenerateRandomText(random_engine, charsets[font_index], text_length);
+        FrameSize frame_size;
+        fonts[font_index].AddChars(text); // text characters are added to font before text mesh update, same as in Text
+        text_meshes.emplace_back(std::make_unique<TextMesh>(text, Text::Layout{ Text::Wrap::None }, fonts[font_index], frame_size));
+    }
+
+    Data::Size max_cached_data_size = 0U;
+    for(size_t update_index = 0U; update_index < updates_count; ++update_index)
+    {
+        const size_t mesh_index = update_index % text_meshes.size();
+        const size_t font_index = mesh_index % fonts.size();
+        const std::u32string text = GenerateRandomText(random_engine, charsets[font_index], text_length);
+        FrameSize frame_size;
+        fonts[font_index].AddChars(text);
+        text_meshes[mesh_index]->Update(text, Text::Layout{ Text::Wrap::None }, frame_size);
+        max_cached_data_size = std::max(max_cached_data_size, statistics.cached_data_size);
+    }
+
+    SECTION("Cached glyphs data size is bounded by budget with high hit rate")
+    {
+        CHECK(max_cached_data_size <= budget_size);
+        CHECK(statistics.evicted_glyphs_count > 0U);
+        CHECK(statistics.GetHitRate() >= 0.75F);
+    }
+
+    SECTION("Glyphs pinned by live text meshes are not evicted")
+    {
+        CHECK(statistics.pinned_glyphs_count > 0U);
+        for(const std::unique_ptr<TextMesh>& text_mesh_ptr : text_meshes)
+        {
+            const Data::Size misses_count = statistics.misses_count;
+            FrameSize frame_size;
+            const TextMesh rebuilt_text_mesh(text_mesh_ptr->GetText(), Text::Layout{ Text::Wrap::None }, text_mesh_ptr->GetFont(), frame_size);
+            CHECK(statistics.misses_count == misses_count);
+        }
+    }
+
+    SECTION("Glyphs are unpinned on text meshes release")
+    {
+        text_meshes.clear();
+        CHECK(statistics.pinned_glyphs_count == 0U);
+        CHECK(statistics.cached_data_size <= budget_size);
+    }
+}
+
+TEST_CASE("Font Glyph Cache Statistics of Text Updates", "[ui][font][glyph-cache][text]")
+{
+    Test::TextBatchTestContext test_context;
+    const Font font = test_context.AddFont("Roboto");
+    const FontLibrary& font_lib = test_context.GetFontLibrary();
+    const FontGlyphCacheStatistics& statistics = font_lib.GetGlyphCacheStatistics();
+    const Text text(test_context.ui_context, font, Text::SettingsUtf8{
+        .name   = "Glyph Cache Text",
+        .text   = "Hello",
+        .rect   = UnitRect{ Units::Pixels, Point2I(10, 10), FrameSize() },
+        .layout = Text::Layout{ Text::Wrap::None }
+    });
+    font_lib.ResetGlyphCacheStatistics();
+
+    SECTION("Each distinct character of the updated text is counted as one cache hit")
+    {
+        text.SetText("World!!");
+        CHECK(statistics.hits_count == 6U);
+        CHECK(statistics.misses_count == 0U);
+    }
+
+    SECTION("New character of the updated text is counted as one cache miss only")
+    {
+        text.SetText(U"Ж Ж");
+        CHECK(statistics.hits_count == 1U);
+        CHECK(statistics.misses_count == 1U);
+        CHECK(statistics.GetHitRate() == 0.5F);
+    }
+}
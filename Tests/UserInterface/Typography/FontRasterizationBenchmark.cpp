@@ -0,0 +1,100 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontRasterizationBenchmark.cpp
+Serial and parallel glyphs rasterization throughput benchmarks with embedded fonts
+
+******************************************************************************/
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+struct BenchmarkFont
+{
+    std::string_view name;
+    std::string_view path;
+    std::u32string   alphabet;
+};
+
+// Alphabets contain only characters with glyphs existing in the font
+static const std::array<BenchmarkFont, 2> g_benchmark_fonts{{
+    {
+        "Roboto", "Fonts/Roboto/Roboto-Regular.ttf",
+        Font::GetAlphabetInRange(U'\u0020', U'\u007E') + Font::GetAlphabetInRange(U'\u00A0', U'\u017F') +
+        Font::GetAlphabetInRange(U'\u0391', U'\u03A1') + Font::GetAlphabetInRange(U'\u03A3', U'\u03C9') + Font::GetAlphabetInRange(U'\u0400', U'\u045F')
+    },
+    {
+        "Sawarabi Mincho", "Fonts/SawarabiMincho/SawarabiMincho-Regular.ttf",
+        Font::GetAlphabetInRange(U'\u0020', U'\u007E') + Font::GetAlphabetInRange(U'\u00A0', U'\u017F') +
+        Font::GetAlphabetInRange(U'\u3041', U'\u3096') + Font::GetAlphabetInRange(U'\u30A1', U'\u30FA')
+    }
+}};
+
+static constexpr std::array<uint32_t, 5> g_font_sizes_pt{ 12U, 16U, 24U, 32U, 48U };
+
+static uint32_t RasterizeFontGlyphs(const FontLibrary& font_lib, const BenchmarkFont& benchmark_font, FontGlyphMode glyph_mode)
+{
+    uint32_t atlas_pixels_count = 0U;
+    for(const uint32_t font_size_pt : g_font_sizes_pt)
+    {
+        const Font font(font_lib, Data::FontProvider::Get(), FontSettings{
+            FontDescription{ std::string(benchmark_font.name), std::string(benchmark_font.path), font_size_pt },
+            96U, benchmark_font.alphabet, glyph_mode, {}
+        });
+        atlas_pixels_count += font.GetAtlasSize().GetPixelsCount();
+    }
+    return atlas_pixels_count;
+}
+
+TEST_CASE("Font Glyphs Rasterization Benchmark", "[ui][font][parallel][benchmark]")
+{
+    tf::Executor parallel_executor;
+    const FontLibrary serial_font_lib;
+    const FontLibrary parallel_font_lib(&parallel_executor);
+
+    for(const BenchmarkFont& benchmark_font : g_benchmark_fonts)
+    {
+        const size_t glyphs_count = benchmark_font.alphabet.size() * g_font_sizes_pt.size();
+        for(const FontGlyphMode glyph_mode : { FontGlyphMode::Coverage, FontGlyphMode::DistanceField })
+        {
+            const std::string_view mode_name = glyph_mode == FontGlyphMode::Coverage ? "coverage" : "distance field";
+
+            BENCHMARK(fmt::format("Serial rasterization of {} {} {} glyphs", glyphs_count, benchmark_font.name, mode_name))
+            {
+                return RasterizeFontGlyphs(serial_font_lib, benchmark_font, glyph_mode);
+            };
+
+            BENCHMARK(fmt::format("Parallel rasterization of {} {} {} glyphs", glyphs_count, benchmark_font.name, mode_name))
+            {
+                return RasterizeFontGlyphs(parallel_font_lib, benchmark_font, glyph_mode);
+            };
+        }
+    }
+}
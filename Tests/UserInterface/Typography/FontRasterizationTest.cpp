@@ -0,0 +1,113 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/FontRasterizationTest.cpp
+Unit-tests of the parallel glyphs rasterization producing the same font atlas as serial rasterization
+
+******************************************************************************/
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/Null/Texture.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static tf::Executor g_parallel_executor;
+
+static Rhi::Device GetTestDevice()
+{
+    const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+    CHECK(devices.size() > 0);
+    return devices[0];
+}
+
+static FontSettings GetFontSettings(const std::u32string& characters, FontGlyphMode glyph_mode = FontGlyphMode::Coverage)
+{
+    return FontSettings{ FontDescription{ "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, characters, glyph_mode, {} };
+}
+
+static const Data::Bytes& GetAtlasData(const Font& font, const Rhi::RenderContext& render_context)
+{
+    const Rhi::Texture& atlas_texture = font.GetAtlasTexture(render_context);
+    render_context.CompleteInitialization();
+    return dynamic_cast<Null::Texture&>(atlas_texture.GetInterface()).GetStoredData(Rhi::SubResourceIndex());
+}
+
+TEST_CASE("Font Parallel Glyphs Rasterization", "[ui][font][parallel]")
+{
+    const Rhi::RenderContext render_context(Platform::AppEnvironment{}, GetTestDevice(), g_parallel_executor,
+                                            Rhi::RenderContextSettings{ FrameSize(640U, 480U) });
+    const FontLibrary serial_font_lib;
+    const FontLibrary parallel_font_lib(&g_parallel_executor);
+    const std::u32string alphabet = Font::GetAlphabetDefault() + Font::GetAlphabetInRange(U'А', U'я');
+
+    SECTION("Parallel executor is provided by font library")
+    {
+        CHECK(serial_font_lib.GetParallelExecutor() == nullptr);
+        CHECK(parallel_font_lib.GetParallelExecutor() == &g_parallel_executor);
+    }
+
+    for(const FontGlyphMode glyph_mode : { FontGlyphMode::Coverage, FontGlyphMode::DistanceField })
+    {
+        const Font serial_font(serial_font_lib, Data::FontProvider::Get(), GetFontSettings(alphabet, glyph_mode));
+        const Font parallel_font(parallel_font_lib, Data::FontProvider::Get(), GetFontSettings(alphabet, glyph_mode));
+
+        SECTION(fmt::format("Parallel font atlas is equal to serial font atlas in {} mode",
+                            glyph_mode == FontGlyphMode::Coverage ? "coverage" : "distance field"))
+        {
+            CHECK(parallel_font.GetAtlasSize() == serial_font.GetAtlasSize());
+            CHECK(parallel_font.GetMaxGlyphSize() == serial_font.GetMaxGlyphSize());
+            CHECK(parallel_font.GetLineHeight() == serial_font.GetLineHeight());
+            CHECK(GetAtlasData(parallel_font, render_context) == GetAtlasData(serial_font, render_context));
+        }
+    }
+
+    SECTION("Characters added in parallel are placed to the same atlas as serially added characters")
+    {
+        const Font serial_font(serial_font_lib, Data::FontProvider::Get(), GetFontSettings(Font::GetAlphabetDefault()));
+        const Font parallel_font(parallel_font_lib, Data::FontProvider::Get(), GetFontSettings(Font::GetAlphabetDefault()));
+
+        const std::u32string added_chars = Font::GetAlphabetInRange(U'Α', U'Ρ') + Font::GetAlphabetInRange(U'Σ', U'ω');
+        serial_font.AddChars(added_chars);
+        parallel_font.AddChars(added_chars);
+
+        CHECK(parallel_font.GetAtlasSize() == serial_font.GetAtlasSize());
+        CHECK(GetAtlasData(parallel_font, render_context) == GetAtlasData(serial_font, render_context));
+    }
+
+    SECTION("Missing character glyph error is thrown from parallel rasterization without adding any characters")
+    {
+        const Font parallel_font(parallel_font_lib, Data::FontProvider::Get(), GetFontSettings(Font::GetAlphabetDefault()));
+        const FrameSize atlas_size = parallel_font.GetAtlasSize();
+
+        CHECK_THROWS(parallel_font.AddChars(Font::GetAlphabetInRange(U'А', U'я') + U"あ")); // Hiragana is missing in Roboto font
+        CHECK(parallel_font.GetAtlasSize() == atlas_size);
+        CHECK_NOTHROW(parallel_font.AddChars(Font::GetAlphabetInRange(U'А', U'я')));
+    }
+}
@@ -0,0 +1,77 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/TextBatchBenchmark.cpp
+Text batch update and draw benchmarks with a thousand of labels
+
+******************************************************************************/
+
+#include "TextBatchTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static constexpr Data::Size g_labels_count = 1000U;
+
+TEST_CASE("Text Batch Benchmark", "[ui][text][batch][benchmark]")
+{
+    Test::TextBatchTestContext test_context;
+    const Font font = test_context.AddFont("Roboto");
+    const std::vector<Text> labels = test_context.CreateLabels(font, g_labels_count);
+    const TextBatch text_batch = test_context.CreateTextBatch(font);
+    for(const Text& label : labels)
+    {
+        text_batch.AddText(label);
+    }
+    text_batch.Update(Test::g_frame_size);
+
+    size_t update_index = 0U;
+
+    BENCHMARK(fmt::format("Update text batch of {} unchanged labels", g_labels_count))
+    {
+        text_batch.Update(Test::g_frame_size);
+        return text_batch.GetStatistics().uploaded_data_size;
+    };
+
+    BENCHMARK(fmt::format("Update text batch of {} labels with one edited label", g_labels_count))
+    {
+        labels[g_labels_count / 2].SetText(update_index++ % 2 ? "Label 500" : "Label 005");
+        text_batch.Update(Test::g_frame_size);
+        return text_batch.GetStatistics().uploaded_data_size;
+    };
+
+    BENCHMARK(fmt::format("Update text batch of {} labels with all labels recolored", g_labels_count))
+    {
+        const Color4F color = update_index++ % 2 ? Color4F(1.F, 1.F, 1.F, 1.F) : Color4F(1.F, 1.F, 0.F, 1.F);
+        for(const Text& label : labels)
+        {
+            label.SetColor(color);
+        }
+        text_batch.Update(Test::g_frame_size);
+        return text_batch.GetStatistics().uploaded_data_size;
+    };
+
+    BENCHMARK(fmt::format("Draw text batch of {} labels", g_labels_count))
+    {
+        return test_context.DrawTextBatch(text_batch).size();
+    };
+}
@@ -0,0 +1,173 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/TextBatchTest.cpp
+Unit-tests of the text batch drawing many texts with one draw call
+and uploading only changed texts data with Null RHI backend
+
+******************************************************************************/
+
+#include "TextBatchTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static constexpr Data::Size g_texts_count   = 10U;
+static constexpr Data::Size g_instance_size = Test::g_text_instance_size;
+
+TEST_CASE("Text Batch Rendering", "[ui][text][batch]")
+{
+    Test::TextBatchTestContext test_context;
+    const Font font = test_context.AddFont("Roboto");
+    const TextBatch text_batch = test_context.CreateTextBatch(font);
+    const std::vector<Text> texts = test_context.CreateLabels(font, g_texts_count);
+    for(const Text& text : texts)
+    {
+        text_batch.AddText(text);
+    }
+
+    SECTION("All batched texts are drawn with one indexed draw call")
+    {
+        REQUIRE_NOTHROW(text_batch.Update(Test::g_frame_size));
+        CHECK(text_batch.GetTextsCount() == g_texts_count);
+        CHECK(text_batch.GetStatistics().batched_texts_count == g_texts_count);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == g_texts_count);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == g_texts_count);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawTextBatch(text_batch);
+        REQUIRE(draw_calls.size() == 1U);
+        CHECK(draw_calls[0].is_indexed);
+        CHECK(draw_calls[0].count == Test::GetReservedIndicesCount(texts, text_batch.GetSettings()));
+        CHECK(draw_calls[0].instance_count == 1U);
+    }
+
+    SECTION("Unchanged texts are not uploaded on next update")
+    {
+        text_batch.Update(Test::g_frame_size);
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().batched_texts_count == g_texts_count);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == 0U);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == 0U);
+        CHECK(text_batch.GetStatistics().uploaded_data_size == 0U);
+    }
+
+    SECTION("Only mesh of the text with changed characters is uploaded")
+    {
+        text_batch.Update(Test::g_frame_size);
+        texts[3].SetText("Label 3!");
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == 1U);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count <= 1U);
+        CHECK(test_context.DrawTextBatch(text_batch).size() == 1U);
+    }
+
+    SECTION("Only instance data of the text with changed color or position is uploaded")
+    {
+        text_batch.Update(Test::g_frame_size);
+        texts[5].SetColor(Color4F(1.F, 0.F, 0.F, 1.F));
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == 0U);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == 1U);
+        CHECK(text_batch.GetStatistics().uploaded_data_size == g_instance_size);
+
+        // Text frame rect with zero size is fit to text content size, so text is moved without mesh update
+        texts[7].SetFrameRect(UnitRect{ Units::Pixels, Point2I(300, 200), FrameSize() });
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == 0U);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == 1U);
+    }
+
+    SECTION("Instances of all texts are uploaded on render attachment resize")
+    {
+        text_batch.Update(Test::g_frame_size);
+        text_batch.Update(FrameSize(800U, 600U));
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == 0U);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == g_texts_count);
+        CHECK(text_batch.GetStatistics().uploaded_data_size == g_instance_size * g_texts_count);
+    }
+
+    SECTION("Text mesh growing over reserved capacity is uploaded with all texts in new layout")
+    {
+        text_batch.Update(Test::g_frame_size);
+        texts[0].SetText("Label with text much longer than reserved for the initial label text");
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().uploaded_meshes_count == g_texts_count);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawTextBatch(text_batch);
+        REQUIRE(draw_calls.size() == 1U);
+        CHECK(draw_calls[0].count == Test::GetReservedIndicesCount(texts, text_batch.GetSettings()));
+    }
+
+    SECTION("Removed and empty texts are not drawn")
+    {
+        text_batch.Update(Test::g_frame_size);
+        text_batch.RemoveText(texts.back());
+        texts.front().SetText("");
+        text_batch.Update(Test::g_frame_size);
+        CHECK_FALSE(text_batch.HasText(texts.back()));
+        CHECK(text_batch.GetTextsCount() == g_texts_count - 1U);
+        CHECK(text_batch.GetStatistics().batched_texts_count == g_texts_count - 2U);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawTextBatch(text_batch);
+        REQUIRE(draw_calls.size() == 1U);
+        CHECK(draw_calls[0].count == Test::GetReservedIndicesCount({ texts.begin() + 1, texts.end() - 1 }, text_batch.GetSettings()));
+    }
+
+    SECTION("Instances of texts following the removed text are moved to their new slots")
+    {
+        for(size_t text_index = 0U; text_index < texts.size(); ++text_index)
+        {
+            texts[text_index].SetColor(Color4F(static_cast<float>(text_index) / static_cast<float>(g_texts_count), 0.F, 0.F, 1.F));
+        }
+        text_batch.Update(Test::g_frame_size);
+        text_batch.RemoveText(texts[3]);
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().uploaded_instances_count == g_texts_count - 1U);
+
+        const std::vector<Color4F> instance_colors = test_context.DrawTextBatchAndGetInstanceColors(text_batch);
+        REQUIRE(instance_colors.size() >= g_texts_count - 1U);
+        for(size_t slot_index = 0U; slot_index < g_texts_count - 1U; ++slot_index)
+        {
+            const size_t text_index = slot_index < 3U ? slot_index : slot_index + 1U;
+            CHECK(instance_colors[slot_index] == texts[text_index].GetSettings().color);
+        }
+    }
+
+    SECTION("Text batch is not drawn without texts")
+    {
+        for(const Text& text : texts)
+        {
+            text_batch.RemoveText(text);
+        }
+        text_batch.Update(Test::g_frame_size);
+        CHECK(text_batch.GetStatistics().batched_texts_count == 0U);
+        CHECK(test_context.DrawTextBatch(text_batch).empty());
+    }
+
+    SECTION("Texts of another font or already batched texts can not be added")
+    {
+        const Font other_font = test_context.AddFont("Other Roboto");
+        const std::vector<Text> other_texts = test_context.CreateLabels(other_font, 1U);
+        CHECK_THROWS_AS(text_batch.AddText(other_texts.front()), ArgumentException);
+        CHECK_THROWS_AS(text_batch.AddText(texts.front()), ArgumentException);
+        CHECK(text_batch.GetTextsCount() == g_texts_count);
+    }
+}
@@ -0,0 +1,201 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/TextBatchTestHelpers.hpp
+Text batch test helpers with Null RHI backend
+
+******************************************************************************/
+
+#pragma once
+
+#include "../Types/FakePlatformApp.hpp"
+
+#include <Methane/UserInterface/TextBatch.h>
+#include <Methane/UserInterface/Text.h>
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/UserInterface/Context.h>
+#include <Methane/Graphics/RHI/System.h>
+#include <Methane/Graphics/RHI/RenderContext.h>
+#include <Methane/Graphics/RHI/RenderPattern.h>
+#include <Methane/Graphics/RHI/RenderPass.h>
+#include <Methane/Graphics/RHI/RenderState.h>
+#include <Methane/Graphics/RHI/RenderCommandList.h>
+#include <Methane/Graphics/RHI/CommandQueue.h>
+#include <Methane/Graphics/RHI/Program.h>
+#include <Methane/Graphics/RHI/ObjectRegistry.h>
+#include <Methane/Graphics/Null/Program.h>
+#include <Methane/Graphics/Null/Buffer.h>
+#include <Methane/Graphics/Null/RenderCommandList.h>
+#include <Methane/Graphics/Base/ProgramBindings.h>
+#include <Methane/Platform/AppEnvironment.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <taskflow/taskflow.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
+
+namespace Methane::UserInterface::Test
+{
+
+namespace Rhi  = Methane::Graphics::Rhi;
+namespace Null = Methane::Graphics::Null;
+namespace Base = Methane::Graphics::Base;
+
+inline const FrameSize g_frame_size(640U, 480U);
+
+// Text instance data has float4x4 transformation matrix followed by float4 color
+inline constexpr Data::Size g_text_instance_size = sizeof(float) * 20U;
+
+// Text mesh has 6 indices per every visible character, while the text batch reserves indices for mesh growth
+[[nodiscard]]
+inline uint32_t GetReservedIndicesCount(const std::vector<Text>& texts, const TextBatch::Settings& batch_settings)
+{
+    uint32_t indices_count = 0U;
+    for(const Text& text : texts)
+    {
+        const auto visible_chars_count = static_cast<uint32_t>(std::ranges::count_if(text.GetTextUtf32(),
+                                                                                     [](char32_t c) { return c != U' ' && c != U'\n'; }));
+        indices_count += visible_chars_count * 6U * batch_settings.mesh_buffers_reservation_multiplier;
+    }
+    return indices_count;
+}
+
+// Colors of text instances are read from the instances buffer bound to the text batch program by the last draw commands
+[[nodiscard]]
+inline std::vector<Color4F> GetDrawnTextInstanceColors(const Rhi::RenderCommandList& cmd_list)
+{
+    const Base::ProgramBindings* program_bindings_ptr = dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface()).GetProgramBindingsPtr();
+    if (!program_bindings_ptr)
+        throw std::logic_error("Text batch program bindings were not set by draw commands");
+
+    const Rhi::ResourceViews& instances_views = program_bindings_ptr->Get({ Rhi::ShaderType::Vertex, "g_instances" }).GetResourceViews();
+    const Data::Bytes& instances_data = dynamic_cast<const Null::Buffer&>(instances_views.front().GetResource()).GetStoredData();
+
+    std::vector<Color4F> instance_colors;
+    for(size_t instance_offset = 0U; instance_offset + g_text_instance_size <= instances_data.size(); instance_offset += g_text_instance_size)
+    {
+        const auto* color_ptr = reinterpret_cast<const float*>(instances_data.data() + instance_offset + sizeof(float) * 16U); // NOSONAR
+        instance_colors.emplace_back(color_ptr[0], color_ptr[1], color_ptr[2], color_ptr[3]);
+    }
+    return instance_colors;
+}
+
+class TextBatchTestContext
+{
+public:
+    TextBatchTestContext()
+        : render_context(m_app_env, GetTestDevice(), m_parallel_executor, Rhi::RenderContextSettings{ g_frame_size })
+        , render_cmd_queue(render_context, Rhi::CommandListType::Render)
+        , render_pattern(render_context, Rhi::RenderPatternSettings{})
+        , render_pass(render_pattern.CreateRenderPass(Rhi::RenderPassSettings{ {}, g_frame_size }))
+        , ui_context(m_fake_app, render_cmd_queue, render_pattern)
+    { }
+
+    [[nodiscard]]
+    const FontLibrary& GetFontLibrary() const noexcept { return m_font_lib; }
+
+    [[nodiscard]]
+    Font AddFont(const std::string& font_name) const
+    {
+        return m_font_lib.AddFont(Data::FontProvider::Get(), FontSettings{
+            FontDescription{ font_name, "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, Font::GetAlphabetDefault(), FontGlyphMode::Coverage, {}
+        });
+    }
+
+    // Null program has no shaders reflection, so text batch program arguments are initialized manually
+    [[nodiscard]]
+    TextBatch CreateTextBatch(const Font& font)
+    {
+        TextBatch text_batch(ui_context, font, TextBatch::Settings{ .name = "Test Text Batch" });
+
+        using enum Rhi::ShaderType;
+        const Rhi::RenderState render_state = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::RenderState>(text_batch.GetSettings().state_name);
+        dynamic_cast<Null::Program&>(render_state.GetProgram().GetInterface()).SetArgumentBindings({
+            { { Vertex, "g_instances", Rhi::ProgramArgumentAccessType::Mutable  }, { Rhi::ResourceType::Buffer,  1U } },
+            { { Pixel,  "g_texture",   Rhi::ProgramArgumentAccessType::Mutable  }, { Rhi::ResourceType::Texture, 1U } },
+            { { Pixel,  "g_sampler",   Rhi::ProgramArgumentAccessType::Constant }, { Rhi::ResourceType::Sampler, 1U } },
+        });
+        return text_batch;
+    }
+
+    // Labels are placed in the column one under another with frame size fit to the text content
+    [[nodiscard]]
+    std::vector<Text> CreateLabels(const Font& font, Data::Size labels_count)
+    {
+        std::vector<Text> labels;
+        labels.reserve(labels_count);
+        for(Data::Size label_index = 0U; label_index < labels_count; ++label_index)
+        {
+            labels.emplace_back(ui_context, font, Text::SettingsUtf8{
+                .name   = fmt::format("Label {}", label_index),
+                .text   = fmt::format("Label {}", label_index),
+                .rect   = UnitRect{ Units::Pixels, Point2I(10, 20 * static_cast<int32_t>(label_index % 20U)), FrameSize() },
+                .layout = Text::Layout{ Text::Wrap::None }
+            });
+        }
+        return labels;
+    }
+
+    [[nodiscard]]
+    Null::RenderCommandList::DrawCalls DrawTextBatch(const TextBatch& text_batch) const
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        text_batch.Draw(cmd_list);
+        return dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface()).GetDrawCalls();
+    }
+
+    [[nodiscard]]
+    std::vector<Color4F> DrawTextBatchAndGetInstanceColors(const TextBatch& text_batch) const
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        text_batch.Draw(cmd_list);
+        return GetDrawnTextInstanceColors(cmd_list);
+    }
+
+private:
+    [[nodiscard]]
+    static Rhi::Device GetTestDevice()
+    {
+        static const Rhi::Devices& devices = Rhi::System::Get().UpdateGpuDevices();
+        if (devices.empty())
+            throw std::logic_error("No RHI devices available");
+
+        return devices[0];
+    }
+
+    tf::Executor                   m_parallel_executor;
+    const Platform::AppEnvironment m_app_env{ nullptr };
+    const Platform::FakeApp        m_fake_app{ 1.F, 96U };
+
+public:
+    const Rhi::RenderContext render_context;
+    const Rhi::CommandQueue  render_cmd_queue;
+    const Rhi::RenderPattern render_pattern;
+    const Rhi::RenderPass    render_pass;
+    Context                  ui_context;
+
+private:
+    // Font library is released before render context along with fonts atlas textures
+    const FontLibrary        m_font_lib;
+};
+
+} // namespace Methane::UserInterface::Test
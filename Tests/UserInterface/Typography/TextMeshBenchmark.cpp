@@ -0,0 +1,102 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/TextMeshBenchmark.cpp
+Text mesh layout benchmarks of building from scratch and cached updates of large multi-line texts
+
+******************************************************************************/
+
+#include <TextMesh.h>
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+#include <fmt/format.h>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static constexpr size_t g_text_lines_count = 100U; // text mesh with 16-bit indices is limited to 16K visible characters
+
+static std::u32string GetMultiLineText(size_t edited_line_index = std::u32string::npos)
+{
+    std::u32string text;
+    for(size_t line_index = 0; line_index < g_text_lines_count; ++line_index)
+    {
+        if (line_index)
+            text += U'\n';
+
+        text += Font::ConvertUtf8To32(fmt::format("{:03} Lorem ipsum dolor sit amet, consectetur adipiscing elit, sed do eiusmod tempor incididunt {}.",
+                                                  line_index, line_index == edited_line_index ? "edited" : "ut labore"));
+    }
+    return text;
+}
+
+TEST_CASE("Text Mesh Layout Benchmark", "[ui][text][mesh][benchmark]")
+{
+    const FontLibrary font_lib;
+    Font font = font_lib.AddFont(Data::FontProvider::Get(), FontSettings{
+        FontDescription{ "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, Font::GetAlphabetDefault(), FontGlyphMode::Coverage, {}
+    });
+
+    const std::u32string text        = GetMultiLineText();
+    const std::u32string edited_text = GetMultiLineText(g_text_lines_count / 2);
+
+    for(const Text::Wrap wrap : { Text::Wrap::None, Text::Wrap::Word })
+    {
+        const std::string_view wrap_name = wrap == Text::Wrap::None ? "not wrapped" : "word wrapped";
+        const Text::Layout layout{ wrap, Text::HorizontalAlignment::Justify };
+
+        BENCHMARK(fmt::format("Build mesh of {} {} text lines", g_text_lines_count, wrap_name))
+        {
+            FrameSize frame_size(640U, 0U);
+            const TextMesh text_mesh(text, layout, font, frame_size);
+            return text_mesh.GetVertices().size();
+        };
+
+        FrameSize frame_size(640U, 0U);
+        TextMesh text_mesh(text, layout, font, frame_size);
+        size_t update_index = 0U;
+
+        BENCHMARK(fmt::format("Update mesh of {} {} text lines with one edited line", g_text_lines_count, wrap_name))
+        {
+            FrameSize update_frame_size(640U, 0U);
+            text_mesh.Update(update_index++ % 2 ? text : edited_text, layout, update_frame_size);
+            return text_mesh.GetVertices().size();
+        };
+
+        BENCHMARK(fmt::format("Update mesh of {} {} text lines with changed alignment", g_text_lines_count, wrap_name))
+        {
+            FrameSize update_frame_size(640U, 0U);
+            const Text::HorizontalAlignment alignment = update_index++ % 2 ? Text::HorizontalAlignment::Center : Text::HorizontalAlignment::Right;
+            text_mesh.Update(text, { wrap, alignment }, update_frame_size);
+            return text_mesh.GetVertices().size();
+        };
+
+        BENCHMARK(fmt::format("Update mesh of {} {} text lines with changed frame width", g_text_lines_count, wrap_name))
+        {
+            FrameSize update_frame_size(update_index++ % 2 ? 640U : 480U, 0U);
+            text_mesh.Update(text, layout, update_frame_size);
+            return text_mesh.GetVertices().size();
+        };
+    }
+}
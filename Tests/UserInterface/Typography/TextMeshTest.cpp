@@ -0,0 +1,236 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Typography/TextMeshTest.cpp
+Unit-tests of the text mesh updates with cached glyph runs and paragraph layouts
+producing the same mesh as the text mesh built from scratch
+
+******************************************************************************/
+
+#include <TextMesh.h>
+
+#include <Methane/UserInterface/Font.h>
+#include <Methane/UserInterface/FontLibrary.h>
+#include <Methane/Data/AppFontsProvider.h>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+static const std::u32string g_test_text =
+    U"Lorem ipsum dolor sit amet, consectetur adipiscing elit.\n"
+    U"Sed do eiusmod tempor incididunt ut labore et dolore magna aliqua.\n"
+    U"\n"
+    U"Ut enim ad minim veniam, quis nostrud exercitation ullamco laboris nisi ut aliquip ex ea commodo consequat.\n"
+    U"Duis aute irure dolor in reprehenderit in voluptate velit esse cillum dolore eu fugiat nulla pariatur.\n"
+    U"Excepteur sint occaecat cupidatat non proident, sunt in culpa qui officia deserunt mollit anim id est laborum.";
+
+static FontSettings GetFontSettings()
+{
+    return FontSettings{ FontDescription{ "Roboto", "Fonts/Roboto/Roboto-Regular.ttf", 16U }, 96U, Font::GetAlphabetDefault(), FontGlyphMode::Coverage, {} };
+}
+
+static bool IsCharPositionEqual(const TextMesh::CharPosition& left, const TextMesh::CharPosition& right)
+{
+    return left.GetX() == right.GetX() && left.GetY() == right.GetY() &&
+           left.is_line_start == right.is_line_start &&
+           left.is_whitespace == right.is_whitespace &&
+           left.is_line_break == right.is_line_break &&
+           left.start_vertex_index == right.start_vertex_index &&
+           left.visual_width == right.visual_width;
+}
+
+static bool IsVertexEqual(const TextMesh::Vertex& left, const TextMesh::Vertex& right)
+{
+    return left.position == right.position && left.texcoord == right.texcoord;
+}
+
+static void CheckTextMeshesEqual(const TextMesh& updated_mesh, const TextMesh& built_mesh)
+{
+    CHECK(updated_mesh.GetText() == built_mesh.GetText());
+    CHECK(updated_mesh.GetContentSize() == built_mesh.GetContentSize());
+    CHECK(updated_mesh.GetContentTopOffset() == built_mesh.GetContentTopOffset());
+    CHECK(std::ranges::equal(updated_mesh.GetCharPositions(), built_mesh.GetCharPositions(), IsCharPositionEqual));
+    CHECK(std::ranges::equal(updated_mesh.GetVertices(), built_mesh.GetVertices(), IsVertexEqual));
+    CHECK(updated_mesh.GetIndices() == built_mesh.GetIndices());
+}
+
+static void CheckUpdatedTextMesh(TextMesh& text_mesh, const std::u32string& text, const Text::Layout& layout, const FrameSize& frame_size, Font& font)
+{
+    FrameSize updated_frame_size = frame_size;
+    text_mesh.Update(text, layout, updated_frame_size);
+
+    FrameSize built_frame_size = frame_size;
+    const TextMesh built_mesh(text, layout, font, built_frame_size);
+
+    CHECK(updated_frame_size == built_frame_size);
+    CheckTextMeshesEqual(text_mesh, built_mesh);
+}
+
+TEST_CASE("Text Mesh Layout", "[ui][text][mesh]")
+{
+    const FontLibrary font_lib;
+    Font font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings());
+    const auto line_height = static_cast<int32_t>(font.GetLineHeight());
+
+    SECTION("Every text line starts at the left border below the previous line without wrap")
+    {
+        FrameSize frame_size;
+        const TextMesh text_mesh(g_test_text, Text::Layout{ Text::Wrap::None }, font, frame_size);
+        const TextMesh::CharPositions& char_positions = text_mesh.GetCharPositions();
+        REQUIRE(char_positions.size() == g_test_text.length() + 1);
+
+        int32_t line_top = line_height;
+        for(size_t char_index = 0; char_index < g_test_text.length(); ++char_index)
+        {
+            CHECK(char_positions[char_index].GetY() == line_top);
+            CHECK(char_positions[char_index].is_line_break == (g_test_text[char_index] == U'\n'));
+            if (g_test_text[char_index] == U'\n')
+            {
+                line_top += line_height;
+                CHECK(char_positions[char_index + 1].GetX() == 0);
+                CHECK(char_positions[char_index + 1].is_line_start);
+            }
+        }
+        CHECK(frame_size.GetWidth() == text_mesh.GetContentSize().GetWidth());
+        CHECK(text_mesh.GetVertices().size() == 4 * std::ranges::count_if(g_test_text, [](char32_t c) { return c != U' ' && c != U'\n'; }));
+        CHECK(text_mesh.GetIndices().size() * 4 == text_mesh.GetVertices().size() * 6);
+    }
+
+    for(const Text::Wrap wrap : { Text::Wrap::Anywhere, Text::Wrap::Word })
+    {
+        SECTION(fmt::format("Wrapped text characters are within frame width with {} wrap", wrap == Text::Wrap::Word ? "word" : "anywhere"))
+        {
+            FrameSize frame_size(200U, 0U);
+            const TextMesh text_mesh(g_test_text, Text::Layout{ wrap }, font, frame_size);
+            const TextMesh::CharPositions& char_positions = text_mesh.GetCharPositions();
+            CHECK(char_positions.back().GetY() > 6 * line_height);
+            for(size_t char_index = 0; char_index < g_test_text.length(); ++char_index)
+            {
+                if (!char_positions[char_index].IsWhiteSpaceOrLineBreak())
+                    CHECK(char_positions[char_index].GetX() + static_cast<int32_t>(char_positions[char_index].visual_width) <= 200);
+            }
+        }
+    }
+
+    SECTION("Empty text mesh has no characters")
+    {
+        FrameSize frame_size(100U, 0U);
+        const TextMesh text_mesh(U"", Text::Layout{}, font, frame_size);
+        CHECK(text_mesh.GetCharPositions().empty());
+        CHECK(text_mesh.GetVertices().empty());
+        CHECK(text_mesh.GetIndices().empty());
+        CHECK(text_mesh.GetContentSize() == FrameSize(100U, 0U));
+    }
+}
+
+TEST_CASE("Text Mesh Cached Updates", "[ui][text][mesh]")
+{
+    const FontLibrary font_lib;
+    Font font = font_lib.AddFont(Data::FontProvider::Get(), GetFontSettings());
+    const size_t paragraphs_count = std::ranges::count(g_test_text, U'\n') + 1;
+
+    const std::array<Text::Layout, 6> layouts{{
+        { Text::Wrap::None,     Text::HorizontalAlignment::Left    },
+        { Text::Wrap::None,     Text::HorizontalAlignment::Justify },
+        { Text::Wrap::Anywhere, Text::HorizontalAlignment::Right   },
+        { Text::Wrap::Anywhere, Text::HorizontalAlignment::Center  },
+        { Text::Wrap::Word,     Text::HorizontalAlignment::Left    },
+        { Text::Wrap::Word,     Text::HorizontalAlignment::Justify },
+    }};
+    const std::array<FrameSize, 3> frame_sizes{{ { 0U, 0U }, { 240U, 0U }, { 320U, 480U } }};
+
+    for(const Text::Layout& layout : layouts)
+    {
+        for(const FrameSize& frame_size : frame_sizes)
+        {
+            FrameSize init_frame_size = frame_size;
+            TextMesh text_mesh(g_test_text, layout, font, init_frame_size);
+
+            const std::string layout_name = fmt::format("wrap {}, alignment {} and frame size {}",
+                                                        static_cast<uint32_t>(layout.wrap), static_cast<uint32_t>(layout.horizontal_alignment),
+                                                        static_cast<std::string>(frame_size));
+
+            SECTION(fmt::format("Editing characters in the middle of text line with {}", layout_name))
+            {
+                std::u32string text = g_test_text;
+                text.replace(text.find(U"tempor"), 6, U"temporary");
+                CheckUpdatedTextMesh(text_mesh, text, layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().shaped_paragraphs_count == 1U);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 1U);
+            }
+
+            SECTION(fmt::format("Appending and erasing trailing characters with {}", layout_name))
+            {
+                CheckUpdatedTextMesh(text_mesh, g_test_text + U" Appended words", layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 1U);
+                CheckUpdatedTextMesh(text_mesh, g_test_text.substr(0, g_test_text.length() - 20), layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 1U);
+            }
+
+            SECTION(fmt::format("Inserting and removing text lines with {}", layout_name))
+            {
+                const size_t second_line_pos = g_test_text.find(U'\n') + 1;
+                std::u32string text = g_test_text;
+                text.insert(second_line_pos, U"Inserted text line\n");
+                CheckUpdatedTextMesh(text_mesh, text, layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 1U);
+
+                text.erase(0, second_line_pos);
+                CheckUpdatedTextMesh(text_mesh, text, layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 0U);
+
+                CheckUpdatedTextMesh(text_mesh, U"", layout, frame_size, font);
+                CheckUpdatedTextMesh(text_mesh, g_test_text, layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == paragraphs_count);
+            }
+
+            SECTION(fmt::format("Changing horizontal alignment reuses paragraph layouts with {}", layout_name))
+            {
+                Text::Layout aligned_layout = layout;
+                aligned_layout.horizontal_alignment = Text::HorizontalAlignment::Center;
+                CheckUpdatedTextMesh(text_mesh, g_test_text, aligned_layout, frame_size, font);
+                CHECK(text_mesh.GetUpdateStatistics().shaped_paragraphs_count == 0U);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == 0U);
+            }
+
+            SECTION(fmt::format("Changing wrap and frame size reuses paragraph glyph runs with {}", layout_name))
+            {
+                CheckUpdatedTextMesh(text_mesh, g_test_text, { Text::Wrap::Word, layout.horizontal_alignment }, FrameSize(180U, 0U), font);
+                CheckUpdatedTextMesh(text_mesh, g_test_text, { Text::Wrap::Anywhere, layout.horizontal_alignment }, FrameSize(400U, 300U), font);
+                CHECK(text_mesh.GetUpdateStatistics().shaped_paragraphs_count == 0U);
+                CHECK(text_mesh.GetUpdateStatistics().laid_out_paragraphs_count == paragraphs_count);
+            }
+        }
+    }
+
+    SECTION("Text mesh is updated after font characters reset")
+    {
+        FrameSize frame_size(240U, 0U);
+        TextMesh text_mesh(g_test_text, Text::Layout{ Text::Wrap::Word }, font, frame_size);
+        font.ResetChars(Font::GetAlphabetDefault());
+        CheckUpdatedTextMesh(text_mesh, g_test_text, Text::Layout{ Text::Wrap::Word }, FrameSize(240U, 0U), font);
+        CHECK(text_mesh.GetUpdateStatistics().shaped_paragraphs_count == paragraphs_count);
+    }
+}
@@ -0,0 +1,245 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Widgets/WidgetsBatchTest.cpp
+Unit-tests of the widgets batch drawing panels, badges and texts with Null RHI backend
+
+******************************************************************************/
+
+#include "WidgetsBatchTestHelpers.hpp"
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <memory>
+
+using namespace Methane;
+using namespace Methane::Graphics;
+using namespace Methane::UserInterface;
+
+[[nodiscard]]
+static Ptr<Panel> CreatePanel(Context& ui_context, std::string_view name, const Point2I& origin, const FrameSize& size)
+{
+    return std::make_shared<Panel>(ui_context, UnitRect{ Units::Pixels, origin, size }, Panel::Settings{ .name = std::string(name) });
+}
+
+[[nodiscard]]
+static Ptr<TextItem> CreateTextItem(Context& ui_context, const Font& font, std::string_view text, const Point2I& origin)
+{
+    return std::make_shared<TextItem>(ui_context, font, Text::SettingsUtf8{
+        .name   = std::string(text),
+        .text   = std::string(text),
+        .rect   = UnitRect{ Units::Pixels, origin, FrameSize() },
+        .layout = Text::Layout{ Text::Wrap::None }
+    });
+}
+
+TEST_CASE("Widgets Batch Rendering", "[ui][widgets][batch]")
+{
+    Test::WidgetsBatchTestContext test_context;
+    const Font          font          = test_context.AddFont("Roboto");
+    const WidgetsBatch  widgets_batch = test_context.CreateWidgetsBatch(font);
+
+    const Ptr<Panel>    root_panel_ptr  = CreatePanel(test_context.ui_context, "Root Panel", Point2I(10, 10), FrameSize(300U, 200U));
+    const Ptr<Panel>    left_panel_ptr  = CreatePanel(test_context.ui_context, "Left Panel", Point2I(10, 10), FrameSize(100U, 100U));
+    const Ptr<Panel>    right_panel_ptr = CreatePanel(test_context.ui_context, "Right Panel", Point2I(150, 10), FrameSize(100U, 100U));
+    const Ptr<TextItem> title_text_ptr  = CreateTextItem(test_context.ui_context, font, "Title", Point2I(10, 150));
+    const Ptr<TextItem> label_text_ptr  = CreateTextItem(test_context.ui_context, font, "Label", Point2I(10, 10));
+    root_panel_ptr->AddChild(*left_panel_ptr);
+    root_panel_ptr->AddChild(*right_panel_ptr);
+    root_panel_ptr->AddChild(*title_text_ptr);
+    left_panel_ptr->AddChild(*label_text_ptr);
+
+    const Ptr<Panel>    side_panel_ptr  = CreatePanel(test_context.ui_context, "Side Panel", Point2I(400, 10), FrameSize(200U, 200U));
+
+    widgets_batch.AddItem(*root_panel_ptr);
+    widgets_batch.AddItem(*side_panel_ptr);
+    widgets_batch.Update(Test::g_frame_size);
+
+    SECTION("All quads of items tree are drawn with one draw call and texts with one draw call per font")
+    {
+        CHECK(widgets_batch.GetItemsCount() == 2U);
+        CHECK(widgets_batch.HasItem(*root_panel_ptr));
+        CHECK_FALSE(widgets_batch.HasItem(*left_panel_ptr));
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.rebuilt_subtrees_count == 2U);
+        CHECK(statistics.rebuilt_quads_count == 4U);
+        CHECK(statistics.batched_quads_count == 4U);
+        CHECK(statistics.batched_texts_count == 2U);
+        CHECK(statistics.quad_draw_batches_count == 1U);
+        CHECK(statistics.uploaded_data_size == 4U * Test::g_quad_data_size);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawWidgetsBatch(widgets_batch);
+        REQUIRE(draw_calls.size() == 2U);
+        CHECK(draw_calls[0].is_indexed);
+        CHECK(draw_calls[0].count == 4U * 6U);
+        CHECK(draw_calls[0].start_index == 0U);
+    }
+
+    SECTION("Unchanged items are not rebuilt and not uploaded on next update")
+    {
+        widgets_batch.Update(Test::g_frame_size);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.rebuilt_subtrees_count == 0U);
+        CHECK(statistics.rebuilt_quads_count == 0U);
+        CHECK(statistics.batched_quads_count == 4U);
+        CHECK(statistics.uploaded_data_size == 0U);
+    }
+
+    SECTION("Only quad of the panel with changed color is rebuilt and uploaded")
+    {
+        right_panel_ptr->SetBlendColor(Color4F(1.F, 0.F, 0.F, 0.5F));
+        widgets_batch.Update(Test::g_frame_size);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.rebuilt_subtrees_count == 0U);
+        CHECK(statistics.rebuilt_quads_count == 1U);
+        CHECK(statistics.uploaded_data_size == Test::g_quad_data_size);
+    }
+
+    SECTION("Only quad of the moved panel is rebuilt and uploaded")
+    {
+        side_panel_ptr->SetRect(UnitRect{ Units::Pixels, Point2I(420, 20), FrameSize(200U, 200U) });
+        widgets_batch.Update(Test::g_frame_size);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.rebuilt_subtrees_count == 0U);
+        CHECK(statistics.rebuilt_quads_count == 1U);
+        CHECK(statistics.uploaded_data_size == Test::g_quad_data_size);
+    }
+
+    SECTION("Only subtree of the root item with changed children is collected again")
+    {
+        const Ptr<Panel> new_panel_ptr = CreatePanel(test_context.ui_context, "New Panel", Point2I(10, 10), FrameSize(50U, 50U));
+        side_panel_ptr->AddChild(*new_panel_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.rebuilt_subtrees_count == 1U);
+        CHECK(statistics.rebuilt_quads_count == 1U);
+        CHECK(statistics.batched_quads_count == 5U);
+        CHECK(statistics.uploaded_data_size == Test::g_quad_data_size);
+
+        side_panel_ptr->RemoveChild(*new_panel_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+        CHECK(widgets_batch.GetStatistics().rebuilt_subtrees_count == 1U);
+        CHECK(widgets_batch.GetStatistics().batched_quads_count == 4U);
+    }
+
+    SECTION("Textured quads are drawn with one draw call per texture change")
+    {
+        const Rhi::Texture first_texture  = test_context.CreateTexture("First Texture");
+        const Rhi::Texture second_texture = test_context.CreateTexture("Second Texture");
+        const Badge::Settings badge_settings{ .size = UnitSize{ Units::Pixels, 32U, 32U } };
+        const auto first_badge_ptr  = std::make_shared<Badge>(test_context.ui_context, first_texture,  Badge::Settings(badge_settings).SetCorner(Badge::FrameCorner::TopLeft));
+        const auto second_badge_ptr = std::make_shared<Badge>(test_context.ui_context, first_texture,  Badge::Settings(badge_settings).SetCorner(Badge::FrameCorner::TopRight));
+        const auto third_badge_ptr  = std::make_shared<Badge>(test_context.ui_context, second_texture, Badge::Settings(badge_settings).SetCorner(Badge::FrameCorner::BottomLeft));
+        side_panel_ptr->AddChild(*first_badge_ptr);
+        side_panel_ptr->AddChild(*third_badge_ptr);
+        side_panel_ptr->AddChild(*second_badge_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.batched_quads_count == 7U);
+        CHECK(statistics.quad_draw_batches_count == 2U);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawWidgetsBatch(widgets_batch);
+        REQUIRE(draw_calls.size() == 3U);
+        CHECK(draw_calls[0].count == 6U * 6U);
+        CHECK(draw_calls[1].count == 1U * 6U);
+        CHECK(draw_calls[1].start_index == 6U * 6U);
+    }
+
+    SECTION("Removed items are not drawn")
+    {
+        widgets_batch.RemoveItem(*root_panel_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+        CHECK(widgets_batch.GetItemsCount() == 1U);
+        CHECK(widgets_batch.GetStatistics().batched_quads_count == 1U);
+        CHECK(widgets_batch.GetStatistics().batched_texts_count == 0U);
+
+        const Null::RenderCommandList::DrawCalls draw_calls = test_context.DrawWidgetsBatch(widgets_batch);
+        REQUIRE(draw_calls.size() == 1U);
+        CHECK(draw_calls[0].count == 6U);
+
+        widgets_batch.RemoveItem(*side_panel_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+        CHECK(test_context.DrawWidgetsBatch(widgets_batch).empty());
+    }
+
+    SECTION("Texts of the items following the removed item are drawn with their own instance data")
+    {
+        const Ptr<TextItem> side_text_ptr = CreateTextItem(test_context.ui_context, font, "Side", Point2I(10, 10));
+        side_text_ptr->SetColor(Color4F(0.F, 1.F, 0.F, 1.F));
+        side_panel_ptr->AddChild(*side_text_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+
+        widgets_batch.RemoveItem(*root_panel_ptr);
+        widgets_batch.Update(Test::g_frame_size);
+        CHECK(widgets_batch.GetStatistics().batched_quads_count == 1U);
+        CHECK(widgets_batch.GetStatistics().batched_texts_count == 1U);
+
+        const std::vector<Color4F> text_instance_colors = test_context.DrawWidgetsBatchAndGetTextInstanceColors(widgets_batch);
+        REQUIRE_FALSE(text_instance_colors.empty());
+        CHECK(text_instance_colors.front() == side_text_ptr->GetSettings().color);
+    }
+
+    SECTION("Items can not be added twice or removed when not added")
+    {
+        CHECK_THROWS_AS(widgets_batch.AddItem(*root_panel_ptr), ArgumentException);
+        CHECK_THROWS_AS(widgets_batch.RemoveItem(*left_panel_ptr), ArgumentException);
+    }
+}
+
+TEST_CASE("Widgets Batch Heads-Up-Display", "[ui][widgets][batch][hud]")
+{
+    Test::WidgetsBatchTestContext test_context;
+    const Font         font          = test_context.AddFont("Roboto");
+    const WidgetsBatch widgets_batch = test_context.CreateWidgetsBatch(font);
+
+    const auto hud_ptr = std::make_shared<HeadsUpDisplay>(test_context.ui_context, test_context.GetFontContext(),
+                                                          HeadsUpDisplay::Settings().SetUpdateIntervalSec(0.0));
+    widgets_batch.AddItem(*hud_ptr);
+    hud_ptr->UpdateValues();
+    widgets_batch.Update(Test::g_frame_size);
+
+    SECTION("HUD panel and text blocks are drawn with one quads draw call and one draw call per font")
+    {
+        CHECK(hud_ptr->GetLayoutsCount() == 1U);
+
+        const WidgetsBatch::Statistics& statistics = widgets_batch.GetStatistics();
+        CHECK(statistics.batched_quads_count == 1U);
+        CHECK(statistics.batched_texts_count == 7U);
+        CHECK(statistics.quad_draw_batches_count == 1U);
+        CHECK(test_context.DrawWidgetsBatch(widgets_batch).size() == 3U);
+    }
+
+    SECTION("HUD text blocks are not laid out again while their sizes are unchanged")
+    {
+        hud_ptr->UpdateValues();
+        widgets_batch.Update(Test::g_frame_size);
+        hud_ptr->UpdateValues();
+        widgets_batch.Update(Test::g_frame_size);
+
+        CHECK(hud_ptr->GetLayoutsCount() == 1U);
+        CHECK(widgets_batch.GetStatistics().rebuilt_subtrees_count == 0U);
+        CHECK(widgets_batch.GetStatistics().rebuilt_quads_count == 0U);
+        CHECK(widgets_batch.GetStatistics().uploaded_data_size == 0U);
+    }
+}
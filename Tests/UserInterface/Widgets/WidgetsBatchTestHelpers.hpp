@@ -0,0 +1,156 @@
+/******************************************************************************
+
+Copyright 2025 Evgeny Gorodetskiy
+
+Licensed under the Apache License, Version 2.0 (the "License"),
+you may not use this file except in compliance with the License.
+You may obtain a copy of the License at
+
+    http://www.apache.org/licenses/LICENSE-2.0
+
+Unless required by applicable law or agreed to in writing, software
+distributed under the License is distributed on an "AS IS" BASIS,
+WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+See the License for the specific language governing permissions and
+limitations under the License.
+
+*******************************************************************************
+
+FILE: Tests/UserInterface/Widgets/WidgetsBatchTestHelpers.hpp
+Widgets batch test helpers with Null RHI backend
+
+******************************************************************************/
+
+#pragma once
+
+#include "../Typography/TextBatchTestHelpers.hpp"
+
+#include <Methane/UserInterface/WidgetsBatch.h>
+#include <Methane/UserInterface/Panel.h>
+#include <Methane/UserInterface/Badge.h>
+#include <Methane/UserInterface/TextItem.h>
+#include <Methane/UserInterface/HeadsUpDisplay.h>
+#include <Methane/Graphics/ScreenQuad.h>
+#include <Methane/Graphics/RHI/Texture.h>
+#include <Methane/Graphics/RHI/IShader.h>
+#include <Methane/Data/AppShadersProvider.h>
+
+#include <string>
+
+namespace Methane::UserInterface::Test
+{
+
+// Quad vertex has float2 position, float2 texture coordinates, float4 color and uint texture mode
+inline constexpr Data::Size g_quad_data_size = 4U * (sizeof(float) * 8U + sizeof(uint32_t));
+
+class WidgetsBatchTestContext
+    : public TextBatchTestContext
+{
+public:
+    WidgetsBatchTestContext()
+    {
+        InitializeScreenQuadRenderState(gfx::ScreenQuad::TextureMode::Disabled);
+        InitializeScreenQuadRenderState(gfx::ScreenQuad::TextureMode::RgbaFloat);
+    }
+
+    [[nodiscard]]
+    const FontContext& GetFontContext() const noexcept { return m_font_context; }
+
+    // Null program has no shaders reflection, so widgets batch and text batch program arguments are initialized manually
+    [[nodiscard]]
+    WidgetsBatch CreateWidgetsBatch(const Font& font)
+    {
+        static_cast<void>(CreateTextBatch(font));
+        WidgetsBatch widgets_batch(ui_context, WidgetsBatch::Settings{ .name = "Test Widgets Batch" });
+
+        using enum Rhi::ShaderType;
+        const Rhi::RenderState render_state = render_context.GetObjectRegistry().GetGraphicsObject<Rhi::RenderState>(widgets_batch.GetSettings().state_name);
+        dynamic_cast<Null::Program&>(render_state.GetProgram().GetInterface()).SetArgumentBindings({
+            { { Pixel, "g_texture", Rhi::ProgramArgumentAccessType::Mutable  }, { Rhi::ResourceType::Texture, 1U, 0U } },
+            { { Pixel, "g_sampler", Rhi::ProgramArgumentAccessType::Constant }, { Rhi::ResourceType::Sampler, 1U, 0U } },
+        });
+        return widgets_batch;
+    }
+
+    [[nodiscard]]
+    Rhi::Texture CreateTexture(const std::string& name) const
+    {
+        Rhi::Texture texture = render_context.CreateTexture(
+            Rhi::TextureSettings::ForImage(gfx::Dimensions(16U, 16U), std::nullopt, gfx::PixelFormat::RGBA8Unorm, false));
+        texture.SetName(name);
+        return texture;
+    }
+
+    [[nodiscard]]
+    Null::RenderCommandList::DrawCalls DrawWidgetsBatch(const WidgetsBatch& widgets_batch) const
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        widgets_batch.Draw(cmd_list);
+        return dynamic_cast<const Null::RenderCommandList&>(cmd_list.GetInterface()).GetDrawCalls();
+    }
+
+    // Texts are drawn after quads, so instances buffer of the last drawn text batch remains bound after widgets batch draw
+    [[nodiscard]]
+    std::vector<Color4F> DrawWidgetsBatchAndGetTextInstanceColors(const WidgetsBatch& widgets_batch) const
+    {
+        const Rhi::RenderCommandList cmd_list = render_cmd_queue.CreateRenderCommandList(render_pass);
+        widgets_batch.Draw(cmd_list);
+        return GetDrawnTextInstanceColors(cmd_list);
+    }
+
+private:
+    // Screen-quad render state is registered in advance under the name used by screen-quads of panels and badges,
+    // so that widgets reuse it from the objects registry with program arguments initialized manually
+    void InitializeScreenQuadRenderState(gfx::ScreenQuad::TextureMode texture_mode) const
+    {
+        using enum Rhi::ShaderType;
+        const bool is_texture_disabled = texture_mode == gfx::ScreenQuad::TextureMode::Disabled;
+        const Rhi::ShaderMacroDefinitions ps_macro_definitions = is_texture_disabled
+                                                               ? Rhi::ShaderMacroDefinitions{ { "TEXTURE_DISABLED", "" } }
+                                                               : Rhi::ShaderMacroDefinitions{};
+        const std::string quad_name = is_texture_disabled
+                                    ? fmt::format("Screen-Quad with Alpha-Blending {}", Rhi::ShaderMacroDefinition::ToString(ps_macro_definitions))
+                                    : std::string("Screen-Quad with Alpha-Blending");
+
+        const Rhi::ProgramArgumentAccessor constants_accessor = META_PROGRAM_ARG_ROOT_BUFFER_MUTABLE(Pixel, "g_constants");
+        const Rhi::Program program = render_context.CreateProgram(
+            Rhi::ProgramSettingsImpl
+            {
+                Rhi::ProgramSettingsImpl::ShaderSet
+                {
+                    { Vertex, { Data::ShaderProvider::Get(), { "ScreenQuad", "QuadVS" } } },
+                    { Pixel,  { Data::ShaderProvider::Get(), { "ScreenQuad", "QuadPS" }, ps_macro_definitions } },
+                },
+                Rhi::ProgramInputBufferLayouts
+                {
+                    Rhi::ProgramInputBufferLayout{ Rhi::ProgramInputBufferLayout::ArgumentSemantics{ "POSITION", "TEXCOORD" } }
+                },
+                Rhi::ProgramArgumentAccessors{ constants_accessor },
+                render_pattern.GetAttachmentFormats()
+            });
+
+        Null::ResourceArgumentDescs argument_descs{
+            { constants_accessor, { Rhi::ResourceType::Buffer, 1U, 16U } } // float4 blend color
+        };
+        if (!is_texture_disabled)
+        {
+            argument_descs.emplace(Rhi::ProgramArgumentAccessor{ Pixel, "g_texture", Rhi::ProgramArgumentAccessType::Mutable  }, Null::ResourceArgumentDesc{ Rhi::ResourceType::Texture, 1U, 0U });
+            argument_descs.emplace(Rhi::ProgramArgumentAccessor{ Pixel, "g_sampler", Rhi::ProgramArgumentAccessType::Constant }, Null::ResourceArgumentDesc{ Rhi::ResourceType::Sampler, 1U, 0U });
+        }
+        dynamic_cast<Null::Program&>(program.GetInterface()).SetArgumentBindings(argument_descs);
+
+        Rhi::RenderState render_state = render_context.CreateRenderState(
+            Rhi::RenderState::Settings
+            {
+                .program        = program,
+                .render_pattern = render_pattern
+            });
+        render_state.SetName(fmt::format("{} Render State", quad_name));
+        render_context.GetObjectRegistry().AddGraphicsObject(render_state);
+    }
+
+    // Font context of heads-up-display is released before render context along with fonts atlas textures
+    const FontContext m_font_context{ Data::FontProvider::Get() };
+};
+
+} // namespace Methane::UserInterface::Test